@@ -138,6 +138,10 @@ get-frame-cflags-for     = $(strip $(call load-var-for,COPTFLAGS,$(1)) \
                                    $(BUILD_FLAGS) \
                             )
 
+get-blas64-cflags-for    = $(strip $(call get-frame-cflags-for,$(1)) \
+                                   -DBLIS_IS_BUILDING_BLAS64 \
+                            )
+
 get-kernel-cflags-for    = $(strip $(call load-var-for,CKOPTFLAGS,$(1)) \
                                    $(call load-var-for,CKVECFLAGS,$(1)) \
                                    $(call get-noopt-cflags-for,$(1)) \
@@ -176,6 +180,7 @@ get-refinit-text-for    = "('$(1)' CFLAGS for ref. kernel init)"
 get-refkern-text-for    = "('$(1)' CFLAGS for ref. kernels)"
 get-config-text-for     = "('$(1)' CFLAGS for config code)"
 get-frame-text-for      = "('$(1)' CFLAGS for framework code)"
+get-blas64-text-for     = "('$(1)' CFLAGS for 64-bit BLAS)"
 get-kernel-text-for     = "('$(1)' CFLAGS for kernels)"
 get-sandbox-c99text-for = "('$(1)' CFLAGS for sandboxes)"
 get-sandbox-cxxtext-for = "('$(1)' CXXFLAGS for sandboxes)"
@@ -321,7 +326,11 @@ TESTSUITE_CONF_GEN := input.general
 TESTSUITE_CONF_OPS := input.operations
 TESTSUITE_FAST_GEN := input.general.fast
 TESTSUITE_FAST_OPS := input.operations.fast
+TESTSUITE_L1MT_GEN := input.general.l1mt
+TESTSUITE_L1MT_OPS := input.operations.l1mt
 TESTSUITE_OUT_FILE := output.testsuite
+TESTSUITE_L1MT_OUT_FILE := output.testsuite.l1mt
+TESTSUITE_CHECKS_OUT_FILE := output.testsuite.checks
 
 # CHANGELOG file.
 CHANGELOG          := CHANGELOG
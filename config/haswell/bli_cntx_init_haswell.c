@@ -47,7 +47,7 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	// their storage preferences.
 	bli_cntx_set_l3_nat_ukrs
 	(
-	  8,
+	  16,
 	  // gemm
 #if 1
 	  BLIS_GEMM_UKR,       BLIS_FLOAT,    bli_sgemm_zen_asm_6x16,       TRUE,
@@ -63,53 +63,92 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,    bli_sgemmtrsm_l_zen_asm_6x16, TRUE,
 	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_l_zen_asm_6x8,  TRUE,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_SCOMPLEX, bli_cgemmtrsm_l_zen_int_3x8,  TRUE,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_DCOMPLEX, bli_zgemmtrsm_l_zen_int_3x4,  TRUE,
 	  // gemmtrsm_u
 	  BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,    bli_sgemmtrsm_u_zen_asm_6x16, TRUE,
 	  BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_u_zen_asm_6x8,  TRUE,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_SCOMPLEX, bli_cgemmtrsm_u_zen_int_3x8,  TRUE,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_DCOMPLEX, bli_zgemmtrsm_u_zen_int_3x4,  TRUE,
+	  // trsm_l
+	  BLIS_TRSM_L_UKR,     BLIS_SCOMPLEX, bli_ctrsm_l_zen_int_3x8,      TRUE,
+	  BLIS_TRSM_L_UKR,     BLIS_DCOMPLEX, bli_ztrsm_l_zen_int_3x4,      TRUE,
+	  // trsm_u
+	  BLIS_TRSM_U_UKR,     BLIS_SCOMPLEX, bli_ctrsm_u_zen_int_3x8,      TRUE,
+	  BLIS_TRSM_U_UKR,     BLIS_DCOMPLEX, bli_ztrsm_u_zen_int_3x4,      TRUE,
 	  cntx
 	);
 
 	bli_cntx_set_l1f_kers
 	(
-	  4,
+	  8,
 	  // axpyf
-	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_zen_int_8,
-	  BLIS_AXPYF_KER,     BLIS_DOUBLE, bli_daxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_FLOAT,    bli_saxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_DOUBLE,   bli_daxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_SCOMPLEX, bli_caxpyf_zen_int_4,
+	  BLIS_AXPYF_KER,     BLIS_DCOMPLEX, bli_zaxpyf_zen_int_4,
 	  // dotxf
-	  BLIS_DOTXF_KER,     BLIS_FLOAT,  bli_sdotxf_zen_int_8,
-	  BLIS_DOTXF_KER,     BLIS_DOUBLE, bli_ddotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_FLOAT,    bli_sdotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_DOUBLE,   bli_ddotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_SCOMPLEX, bli_cdotxf_zen_int_4,
+	  BLIS_DOTXF_KER,     BLIS_DCOMPLEX, bli_zdotxf_zen_int_4,
 	  cntx
 	);
 
 	// Update the context with optimized level-1v kernels.
 	bli_cntx_set_l1v_kers
 	(
-	  10,
+	  24,
 	  // amaxv
-	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
-	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_FLOAT,    bli_samaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_DOUBLE,   bli_damaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_SCOMPLEX, bli_camaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_DCOMPLEX, bli_zamaxv_zen_int,
 	  // axpyv
 #if 0
-	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int,
-	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int,
+	  BLIS_AXPYV_KER,  BLIS_FLOAT,    bli_saxpyv_zen_int,
+	  BLIS_AXPYV_KER,  BLIS_DOUBLE,   bli_daxpyv_zen_int,
 #else
-	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int10,
-	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int10,
+	  BLIS_AXPYV_KER,  BLIS_FLOAT,    bli_saxpyv_zen_int10,
+	  BLIS_AXPYV_KER,  BLIS_DOUBLE,   bli_daxpyv_zen_int10,
 #endif
+	  BLIS_AXPYV_KER,  BLIS_SCOMPLEX, bli_caxpyv_zen_int,
+	  BLIS_AXPYV_KER,  BLIS_DCOMPLEX, bli_zaxpyv_zen_int,
 	  // dotv
-	  BLIS_DOTV_KER,   BLIS_FLOAT,  bli_sdotv_zen_int,
-	  BLIS_DOTV_KER,   BLIS_DOUBLE, bli_ddotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_FLOAT,    bli_sdotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_DOUBLE,   bli_ddotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_SCOMPLEX, bli_cdotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_DCOMPLEX, bli_zdotv_zen_int,
 	  // dotxv
-	  BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_zen_int,
-	  BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
+	  BLIS_DOTXV_KER,  BLIS_FLOAT,    bli_sdotxv_zen_int,
+	  BLIS_DOTXV_KER,  BLIS_DOUBLE,   bli_ddotxv_zen_int,
+	  BLIS_DOTXV_KER,  BLIS_SCOMPLEX, bli_cdotxv_zen_int,
+	  BLIS_DOTXV_KER,  BLIS_DCOMPLEX, bli_zdotxv_zen_int,
+	  // rotv
+	  BLIS_ROTV_KER,   BLIS_FLOAT,    bli_srotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_DOUBLE,   bli_drotv_zen_int,
+	  // rotmv
+	  BLIS_ROTMV_KER,  BLIS_FLOAT,    bli_srotmv_zen_int,
+	  BLIS_ROTMV_KER,  BLIS_DOUBLE,   bli_drotmv_zen_int,
 	  // scalv
 #if 0
-	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int,
-	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int,
+	  BLIS_SCALV_KER,  BLIS_FLOAT,    bli_sscalv_zen_int,
+	  BLIS_SCALV_KER,  BLIS_DOUBLE,   bli_dscalv_zen_int,
 #else
-	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
-	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
+	  BLIS_SCALV_KER,  BLIS_FLOAT,    bli_sscalv_zen_int10,
+	  BLIS_SCALV_KER,  BLIS_DOUBLE,   bli_dscalv_zen_int10,
 #endif
+	  BLIS_SCALV_KER,  BLIS_SCOMPLEX, bli_cscalv_zen_int,
+	  BLIS_SCALV_KER,  BLIS_DCOMPLEX, bli_zscalv_zen_int,
+	  cntx
+	);
+
+	// Update the context with optimized transpose kernels.
+	bli_cntx_set_transm_kers
+	(
+	  2,
+	  BLIS_TRANSM_KER, BLIS_FLOAT,  bli_stransm_zen_int,
+	  BLIS_TRANSM_KER, BLIS_DOUBLE, bli_dtransm_zen_int,
 	  cntx
 	);
 
@@ -125,8 +164,8 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   144,    72,   144,    72 );
 	bli_blksz_init_easy( &blkszs[ BLIS_KC ],   256,   256,   256,   256 );
 	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  4080,  4080,  4080,  4080 );
-	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,     8,     8 );
-	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,     8,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,     4,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,     4,     4 );
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
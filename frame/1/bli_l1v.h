@@ -34,6 +34,9 @@
 
 #include "bli_l1v_check.h"
 
+// Prototype threading-related helpers.
+#include "bli_l1v_thread.h"
+
 // Define kernel function types.
 //#include "bli_l1v_ft_ex.h"
 #include "bli_l1v_ft_ker.h"
@@ -153,6 +153,39 @@ void PASTEMAC(opname,_check) \
 GENFRONT( invertv )
 
 
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  c, \
+       obj_t*  s  \
+     ) \
+{ \
+	bli_l1v_xycs_check( x, y, c, s ); \
+}
+
+GENFRONT( rotv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  param  \
+     ) \
+{ \
+	bli_l1v_xyp_check( x, y, param ); \
+}
+
+GENFRONT( rotmv )
+
+
 #undef  GENFRONT
 #define GENFRONT( opname ) \
 \
@@ -557,3 +590,86 @@ void bli_l1v_xi_check
 	bli_check_error_code( e_val );
 }
 
+void bli_l1v_xycs_check
+     (
+       obj_t*  x,
+       obj_t*  y,
+       obj_t*  c,
+       obj_t*  s
+     )
+{
+	err_t e_val;
+
+	// Check the vector operands.
+
+	bli_l1v_xy_check( x, y );
+
+	// Check object datatypes.
+
+	e_val = bli_check_noninteger_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_noninteger_object( s );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( s );
+	bli_check_error_code( e_val );
+
+	// The rotation coefficients must be real-valued.
+
+	e_val = bli_check_real_valued_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_real_valued_object( s );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( s );
+	bli_check_error_code( e_val );
+}
+
+void bli_l1v_xyp_check
+     (
+       obj_t*  x,
+       obj_t*  y,
+       obj_t*  param
+     )
+{
+	err_t e_val;
+
+	// Check the vector operands.
+
+	bli_l1v_xy_check( x, y );
+
+	// Check object datatypes.
+
+	e_val = bli_check_floating_object( param );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_real_proj_of( x, param );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions. The parameter vector holds the flag
+	// followed by the four elements of the modified Givens matrix.
+
+	e_val = bli_check_vector_object( param );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( param, 5 );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( param );
+	bli_check_error_code( e_val );
+}
+
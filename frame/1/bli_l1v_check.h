@@ -131,6 +131,33 @@ void PASTEMAC(opname,_check) \
 GENTPROT( invertv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  c, \
+       obj_t*  s  \
+     );
+
+GENTPROT( rotv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  param  \
+     );
+
+GENTPROT( rotmv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
@@ -214,3 +241,18 @@ void bli_l1v_xi_check
        obj_t*  index
      );
 
+void bli_l1v_xycs_check
+     (
+       obj_t*  x,
+       obj_t*  y,
+       obj_t*  c,
+       obj_t*  s
+     );
+
+void bli_l1v_xyp_check
+     (
+       obj_t*  x,
+       obj_t*  y,
+       obj_t*  param
+     );
+
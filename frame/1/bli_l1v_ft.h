@@ -158,6 +158,39 @@ typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
 
 INSERT_GENTDEF( invertv )
 
+// rotv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  c, \
+       ctype_r*  s  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTDEFR( rotv )
+
+// rotmv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  param  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTDEFR( rotmv )
+
 // scalv, setv
 
 #undef  GENTDEF
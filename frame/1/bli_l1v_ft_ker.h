@@ -161,6 +161,39 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
 
 INSERT_GENTDEF( invertv )
 
+// rotv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict c, \
+       ctype_r* restrict s, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( rotv )
+
+// rotmv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict param, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( rotmv )
+
 // scalv, setv
 
 #undef  GENTDEF
@@ -139,6 +139,31 @@ void PASTEMAC(ch,opname) \
      ); \
 
 
+#define ROTV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict c, \
+       ctype_r* restrict s, \
+       cntx_t*  restrict cntx  \
+     ); \
+
+
+#define ROTMV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict param, \
+       cntx_t*  restrict cntx  \
+     ); \
+
+
 #define SCALV_KER_PROT( ctype, ch, opname ) \
 \
 void PASTEMAC(ch,opname) \
@@ -410,6 +410,126 @@ void PASTEMAC(opname,EX_SUF) \
 GENFRONT( invertv )
 
 
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  c, \
+       obj_t*  s  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	num_t     dt        = bli_obj_dt( x ); \
+	num_t     dt_r      = bli_dt_proj_to_real( dt ); \
+\
+	dim_t     n         = bli_obj_vector_dim( x ); \
+	void*     buf_x     = bli_obj_buffer_at_off( x ); \
+	inc_t     inc_x     = bli_obj_vector_inc( x ); \
+	void*     buf_y     = bli_obj_buffer_at_off( y ); \
+	inc_t     inc_y     = bli_obj_vector_inc( y ); \
+\
+	void*     buf_c; \
+	void*     buf_s; \
+\
+	obj_t     c_local; \
+	obj_t     s_local; \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( x, y, c, s ); \
+\
+	/* Create local copy-casts of the rotation coefficients in the real
+	   projection of the datatype of x and y. */ \
+	bli_obj_scalar_init_detached_copy_of( dt_r, BLIS_NO_CONJUGATE, \
+	                                      c, &c_local ); \
+	bli_obj_scalar_init_detached_copy_of( dt_r, BLIS_NO_CONJUGATE, \
+	                                      s, &s_local ); \
+	buf_c = bli_obj_buffer_for_1x1( dt_r, &c_local ); \
+	buf_s = bli_obj_buffer_for_1x1( dt_r, &s_local ); \
+\
+	/* Query a type-specific function pointer, except one that uses
+	   void* instead of typed pointers. */ \
+	PASTECH2(opname,BLIS_TAPI_EX_SUF,_vft) f = \
+	PASTEMAC2(opname,BLIS_TAPI_EX_SUF,_qfp)( dt ); \
+\
+	f \
+	( \
+	   n, \
+	   buf_x, inc_x, \
+	   buf_y, inc_y, \
+	   buf_c, \
+	   buf_s, \
+	   cntx, \
+	   rntm  \
+	); \
+}
+
+GENFRONT( rotv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  param  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	num_t     dt        = bli_obj_dt( x ); \
+	num_t     dt_r      = bli_dt_proj_to_real( dt ); \
+\
+	dim_t     n         = bli_obj_vector_dim( x ); \
+	void*     buf_x     = bli_obj_buffer_at_off( x ); \
+	inc_t     inc_x     = bli_obj_vector_inc( x ); \
+	void*     buf_y     = bli_obj_buffer_at_off( y ); \
+	inc_t     inc_y     = bli_obj_vector_inc( y ); \
+\
+	double    buf_param[ 5 ]; \
+\
+	obj_t     param_local; \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( x, y, param ); \
+\
+	/* The kernels expect the five parameters to be contiguous, so copy
+	   them into a local (unit-stride) vector. The local buffer is sized
+	   for the largest real datatype. */ \
+	bli_obj_create_with_attached_buffer( dt_r, 5, 1, buf_param, 1, 5, \
+	                                     &param_local ); \
+	bli_copyv( param, &param_local ); \
+\
+	/* Query a type-specific function pointer, except one that uses
+	   void* instead of typed pointers. */ \
+	PASTECH2(opname,BLIS_TAPI_EX_SUF,_vft) f = \
+	PASTEMAC2(opname,BLIS_TAPI_EX_SUF,_qfp)( dt ); \
+\
+	f \
+	( \
+	   n, \
+	   buf_x, inc_x, \
+	   buf_y, inc_y, \
+	   buf_param, \
+	   cntx, \
+	   rntm  \
+	); \
+}
+
+GENFRONT( rotmv )
+
+
 #undef  GENFRONT
 #define GENFRONT( opname ) \
 \
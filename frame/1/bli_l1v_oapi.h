@@ -137,6 +137,35 @@ void PASTEMAC(opname,EX_SUF) \
 GENTPROT( invertv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  c, \
+       obj_t*  s  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENTPROT( rotv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  param  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENTPROT( rotmv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
@@ -39,10 +39,47 @@
 //
 // Define BLAS-like interfaces with typed operands.
 //
+// NOTE: Each operation below is parallelized once its vector operands are
+// long enough (as determined by the BLIS_VT blocksize in the context; see
+// bli_l1v_thread_num_threads()). In that case, the elements are
+// partitioned into contiguous ranges, one per thread, and the kernel is
+// applied to each range by a PASTEMAC2(ch,opname,_thr) function. Otherwise,
+// the kernel is called directly.
+//
 
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   params->conjx, \
+	   end - start, \
+	   x + start*incx, incx, \
+	   y + start*incy, incy, \
+	   params->cntx  \
+	); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        conj_t  conjx, \
@@ -57,11 +94,29 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.conjx = conjx; \
+		params.n     = n; \
+		params.x     = x; params.incx = incx; \
+		params.y     = y; params.incy = incy; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -115,6 +170,38 @@ INSERT_GENTFUNC_BASIC( amaxv, BLIS_AMAXV_KER )
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   params->conjx, \
+	   end - start, \
+	   params->alpha, \
+	   x + start*incx, incx, \
+	   params->beta, \
+	   y + start*incy, incy, \
+	   params->cntx  \
+	); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        conj_t  conjx, \
@@ -131,11 +218,31 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.conjx = conjx; \
+		params.n     = n; \
+		params.alpha = alpha; \
+		params.x     = x; params.incx = incx; \
+		params.beta  = beta; \
+		params.y     = y; params.incy = incy; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -155,6 +262,37 @@ INSERT_GENTFUNC_BASIC( axpbyv, BLIS_AXPBYV_KER )
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   params->conjx, \
+	   end - start, \
+	   params->alpha, \
+	   x + start*incx, incx, \
+	   y + start*incy, incy, \
+	   params->cntx  \
+	); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        conj_t  conjx, \
@@ -170,12 +308,31 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) \
 		cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.conjx = conjx; \
+		params.n     = n; \
+		params.alpha = alpha; \
+		params.x     = x; params.incx = incx; \
+		params.y     = y; params.incy = incy; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -195,6 +352,82 @@ INSERT_GENTFUNC_BASIC( scal2v, BLIS_SCAL2V_KER )
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	ctype*        rho    = params->rho; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	/* Each thread writes its partial result to its own element of rho. */ \
+	f \
+	( \
+	   params->conjx, \
+	   params->conjy, \
+	   end - start, \
+	   x + start*incx, incx, \
+	   y + start*incy, incy, \
+	   rho + bli_thread_work_id( thread ), \
+	   params->cntx  \
+	); \
+} \
+\
+/* Compute a dot product with n_threads threads. The partial results are \
+   reduced in order of thread id (rather than in the order in which the \
+   threads happen to finish) so that, for a given number of threads, the \
+   result is the same from one run to the next. */ \
+static void PASTEMAC(ch,dotv_thread) \
+     ( \
+       dim_t   n_threads, \
+       void*   f, \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       dim_t   n, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  rho, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	l1v_params_t params; \
+	ctype*       rho_parts; \
+	dim_t        i; \
+\
+	rho_parts = bli_malloc_intl( n_threads * sizeof( ctype ) ); \
+\
+	params.f     = f; \
+	params.conjx = conjx; \
+	params.conjy = conjy; \
+	params.n     = n; \
+	params.x     = x; params.incx = incx; \
+	params.y     = y; params.incy = incy; \
+	params.rho   = rho_parts; \
+	params.cntx  = cntx; \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+\
+	PASTEMAC(ch,set0s)( *rho ); \
+\
+	for ( i = 0; i < n_threads; ++i ) \
+		PASTEMAC(ch,adds)( rho_parts[ i ], *rho ); \
+\
+	bli_free_intl( rho_parts ); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        conj_t  conjx, \
@@ -211,11 +444,21 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		PASTEMAC(ch,dotv_thread)( n_threads, f, conjx, conjy, n, \
+		                          x, incx, y, incy, rho, cntx ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -253,11 +496,40 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads = 1; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	/* When alpha is zero, the kernel only needs to scale rho by beta. */ \
+	if ( !PASTEMAC(ch,eq0)( *alpha ) ) \
+		n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		ctype dot; \
+\
+		/* Compute the dot product with the (threaded) dotv kernel and then \
+		   fold it into rho: rho = beta * rho + alpha * dot. */ \
+		PASTEMAC(ch,dotv_thread)( n_threads, \
+		                          bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTV_KER, cntx ), \
+		                          conjx, conjy, n, \
+		                          x, incx, y, incy, &dot, cntx ); \
+\
+		if ( PASTEMAC(ch,eq0)( *beta ) ) \
+		{ \
+			PASTEMAC(ch,set0s)( *rho ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,scals)( *beta, *rho ); \
+		} \
+\
+		PASTEMAC(ch,axpys)( *alpha, dot, *rho ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -279,6 +551,32 @@ INSERT_GENTFUNC_BASIC( dotxv, BLIS_DOTXV_KER )
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   end - start, \
+	   x + start*incx, incx, \
+	   params->cntx  \
+	); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        dim_t   n, \
@@ -291,11 +589,27 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.n     = n; \
+		params.x     = x; params.incx = incx; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -308,9 +622,209 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTFUNC_BASIC( invertv, BLIS_INVERTV_KER )
 
 
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   end - start, \
+	   x + start*incx, incx, \
+	   y + start*incy, incy, \
+	   params->alpha, \
+	   params->beta, \
+	   params->cntx  \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  c, \
+       ctype_r*  s  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.n     = n; \
+		params.x     = x; params.incx = incx; \
+		params.y     = y; params.incy = incy; \
+		params.alpha = c; \
+		params.beta  = s; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
+\
+	f \
+	( \
+	   n, \
+	   x, incx, \
+	   y, incy, \
+	   c, \
+	   s, \
+	   cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotv, BLIS_ROTV_KER )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   end - start, \
+	   x + start*incx, incx, \
+	   y + start*incy, incy, \
+	   params->alpha, \
+	   params->cntx  \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  param  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.n     = n; \
+		params.x     = x; params.incx = incx; \
+		params.y     = y; params.incy = incy; \
+		params.alpha = param; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
+\
+	f \
+	( \
+	   n, \
+	   x, incx, \
+	   y, incy, \
+	   param, \
+	   cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotmv, BLIS_ROTMV_KER )
+
+
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   params->conjalpha, \
+	   end - start, \
+	   params->alpha, \
+	   x + start*incx, incx, \
+	   params->cntx  \
+	); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        conj_t  conjalpha, \
@@ -325,11 +839,29 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f         = f; \
+		params.conjalpha = conjalpha; \
+		params.n         = n; \
+		params.alpha     = alpha; \
+		params.x         = x; params.incx = incx; \
+		params.cntx      = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -348,6 +880,35 @@ INSERT_GENTFUNC_BASIC( setv,  BLIS_SETV_KER )
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   end - start, \
+	   x + start*incx, incx, \
+	   y + start*incy, incy, \
+	   params->cntx  \
+	); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        dim_t   n, \
@@ -361,11 +922,28 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.n     = n; \
+		params.x     = x; params.incx = incx; \
+		params.y     = y; params.incy = incy; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
 \
 	f \
 	( \
@@ -381,6 +959,37 @@ INSERT_GENTFUNC_BASIC( swapv, BLIS_SWAPV_KER )
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype*        y      = params->y; \
+	inc_t         incy   = params->incy; \
+	dim_t         start, end; \
+\
+	PASTECH2(ch,opname,_ker_ft) f = params->f; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	f \
+	( \
+	   params->conjx, \
+	   end - start, \
+	   x + start*incx, incx, \
+	   params->beta, \
+	   y + start*incy, incy, \
+	   params->cntx  \
+	); \
+} \
+\
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
        conj_t  conjx, \
@@ -396,11 +1005,30 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	BLIS_TAPI_EX_DECLS \
 \
 	const num_t dt = PASTEMAC(ch,type); \
+	dim_t       n_threads; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads > 1 ) \
+	{ \
+		l1v_params_t params; \
+\
+		params.f     = f; \
+		params.conjx = conjx; \
+		params.n     = n; \
+		params.x     = x; params.incx = incx; \
+		params.beta  = beta; \
+		params.y     = y; params.incy = incy; \
+		params.cntx  = cntx; \
+\
+		bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+		return; \
+	} \
 \
 	f \
 	( \
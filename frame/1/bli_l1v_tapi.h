@@ -151,6 +151,37 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTPROT_BASIC0( invertv )
 
 
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  c, \
+       ctype_r*  s  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROTR_BASIC0( rotv )
+
+
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  param  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROTR_BASIC0( rotmv )
+
+
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, opname ) \
 \
@@ -0,0 +1,70 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+dim_t bli_l1v_thread_num_threads
+     (
+       num_t   dt,
+       siz_t   n_elem,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	rntm_t rntm_l;
+	dim_t  n_min;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Query the minimum number of elements that each thread must be given
+	// before a level-1v or level-1m operation is parallelized. A threshold
+	// that is not positive disables multithreading for the datatype.
+	n_min = bli_cntx_get_blksz_def_dt( dt, BLIS_VT, cntx );
+
+	// Return early, without consulting the runtime object, when the
+	// operands are too small to be split between even two threads. This
+	// keeps the overhead of small level-1v operations to a minimum.
+	if ( n_min <= 0 || n_elem < 2 * ( siz_t )n_min ) return 1;
+
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); }
+
+	return bli_thread_calc_num_threads_for_work( n_elem, n_min, rntm );
+#else
+	( void )dt; ( void )n_elem; ( void )cntx; ( void )rntm;
+
+	return 1;
+#endif
+}
+
@@ -0,0 +1,71 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// The operands and parameters of a level-1v operation, bundled so that
+// they may be passed through bli_thread_launch() to each thread. Not every
+// field is used by every operation. The level-1v rotation operations pass
+// c and s through alpha and beta, respectively, and param through alpha.
+typedef struct l1v_params_s
+{
+	void*   f;
+	conj_t  conjalpha;
+	conj_t  conjx;
+	conj_t  conjy;
+	dim_t   n;
+	void*   alpha;
+	void*   x; inc_t incx;
+	void*   beta;
+	void*   y; inc_t incy;
+	void*   rho;
+	void*   scale;
+	void*   sumsq;
+	cntx_t* cntx;
+} l1v_params_t;
+
+
+// Partition elements among threads in units of a SIMD vector so that each
+// thread (except perhaps the last) begins on an aligned boundary whenever
+// the vector itself is aligned.
+#define bli_l1v_thread_bf( dt ) \
+\
+	( BLIS_SIMD_ALIGN_SIZE / bli_dt_size( dt ) )
+
+dim_t bli_l1v_thread_num_threads
+     (
+       num_t   dt,
+       siz_t   n_elem,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
@@ -68,4 +68,5 @@
 
 // Other
 #include "bli_scalm.h"
+#include "bli_transm.h"
 
@@ -153,6 +153,25 @@ INSERT_GENTDEF( packm_cxk_rih )
 INSERT_GENTDEF( packm_cxk_1er )
 
 
+// transm_ker
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* restrict cntx  \
+     );
+
+INSERT_GENTDEF( transm )
+
+
 
 
 
@@ -138,3 +138,11 @@ INSERT_GENTPROT_BASIC0( packm_14xk_1er_ker_name )
 INSERT_GENTPROT_BASIC0( packm_16xk_1er_ker_name )
 INSERT_GENTPROT_BASIC0( packm_30xk_1er_ker_name )
 
+
+// transpose kernels
+
+#undef  GENTPROT
+#define GENTPROT TRANSM_KER_PROT
+
+INSERT_GENTPROT_BASIC0( transm_ker_name )
+
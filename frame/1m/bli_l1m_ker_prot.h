@@ -128,3 +128,19 @@ void PASTEMAC(ch,varname) \
        cntx_t* restrict cntx  \
      );
 
+
+// transpose kernels
+
+#define TRANSM_KER_PROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* restrict cntx  \
+     );
+
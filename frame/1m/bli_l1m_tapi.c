@@ -129,6 +129,27 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
 	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Dense transpositions that change which dimension of the matrix is
+	   contiguous in memory are handled by the blocked transpose kernel,
+	   which avoids accessing x (or y) with a large stride one vector at
+	   a time. */ \
+	if ( bli_does_trans( transx ) && bli_is_dense( uplox ) && \
+	     !( rs_x == 1 && cs_y == 1 ) && !( cs_x == 1 && rs_y == 1 ) ) \
+	{ \
+		PASTEMAC(ch,transm_var1) \
+		( \
+		  bli_extract_conj( transx ), \
+		  n, \
+		  m, \
+		  PASTEMAC(ch,1), \
+		  x, rs_x, cs_x, \
+		  y, rs_y, cs_y, \
+		  cntx, \
+		  rntm  \
+		); \
+		return; \
+	} \
 \
 	/* Invoke the helper variant, which loops over the appropriate kernel
 	   to implement the current operation. */ \
@@ -291,6 +312,27 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 		); \
 		return; \
 	} \
+\
+	/* Dense transpositions that change which dimension of the matrix is
+	   contiguous in memory are handled by the blocked transpose kernel,
+	   which avoids accessing x (or y) with a large stride one vector at
+	   a time. */ \
+	if ( bli_does_trans( transx ) && bli_is_dense( uplox ) && \
+	     !( rs_x == 1 && cs_y == 1 ) && !( cs_x == 1 && rs_y == 1 ) ) \
+	{ \
+		PASTEMAC(ch,transm_var1) \
+		( \
+		  bli_extract_conj( transx ), \
+		  n, \
+		  m, \
+		  alpha, \
+		  x, rs_x, cs_x, \
+		  y, rs_y, cs_y, \
+		  cntx, \
+		  rntm  \
+		); \
+		return; \
+	} \
 \
 	/* Invoke the helper variant, which loops over the appropriate kernel
 	   to implement the current operation. */ \
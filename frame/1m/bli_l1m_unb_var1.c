@@ -34,6 +34,66 @@
 
 #include "blis.h"
 
+//
+// Each of the operations below is parallelized when the matrix contains
+// enough elements (as determined by the BLIS_VT blocksize in the context;
+// see bli_l1v_thread_num_threads()). Dense matrices are partitioned by
+// columns (or by rows when there are fewer columns than threads), while
+// triangular matrices are partitioned by columns such that each thread
+// is assigned roughly the same number of elements.
+//
+
+// Determine the columns [j_start,j_end), and the range [i_start,i_end) of
+// elements within each column (dense matrices only), for which the current
+// thread is responsible.
+static void bli_l1m_thread_range
+     (
+       num_t         dt,
+       l1m_params_t* params,
+       thrinfo_t*    thread,
+       dim_t*        j_start,
+       dim_t*        j_end,
+       dim_t*        i_start,
+       dim_t*        i_end
+     )
+{
+	uplo_t uplox_eff  = params->uplox_eff;
+	dim_t  n_elem_max = params->n_elem_max;
+	dim_t  n_iter     = params->n_iter;
+	dim_t  n_way      = bli_thread_n_way( thread );
+	doff_t diagoff;
+
+	*j_start = 0; *j_end = n_iter;
+	*i_start = 0; *i_end = n_elem_max;
+
+	if ( n_way == 1 ) return;
+
+	if ( bli_is_dense( uplox_eff ) )
+	{
+		if ( n_iter >= n_way )
+			bli_thread_get_range_sub( thread, n_iter, 1, FALSE,
+			                          j_start, j_end );
+		else
+			bli_thread_get_range_sub( thread, n_elem_max,
+			                          bli_l1v_thread_bf( dt ), FALSE,
+			                          i_start, i_end );
+	}
+	else
+	{
+		// Column j of an upper-stored matrix contains the first
+		// n_shift + j + 1 elements, and column j of a lower-stored matrix
+		// begins at element j - n_shift. Express this in terms of a
+		// diagonal offset so that the number of stored elements, rather
+		// than the number of columns, is balanced across threads.
+		if ( bli_is_upper( uplox_eff ) ) diagoff = -( doff_t )params->n_shift;
+		else                             diagoff =  ( doff_t )params->n_shift;
+
+		bli_thread_get_range_weighted_sub( thread, diagoff, uplox_eff,
+		                                   n_elem_max, n_iter, 1, FALSE,
+		                                   j_start, j_end );
+	}
+}
+
 //
 // Define BLAS-like interfaces with typed operands.
 //
@@ -41,59 +101,49 @@
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kername, kerid ) \
 \
-void PASTEMAC(ch,opname) \
+static void PASTEMAC2(ch,opname,_thr) \
      ( \
-       doff_t  diagoffx, \
-       diag_t  diagx, \
-       uplo_t  uplox, \
-       trans_t transx, \
-       dim_t   m, \
-       dim_t   n, \
-       ctype*  x, inc_t rs_x, inc_t cs_x, \
-       ctype*  y, inc_t rs_y, inc_t cs_y, \
-       cntx_t* cntx, \
-       rntm_t* rntm  \
+       void*      params_v, \
+       thrinfo_t* thread  \
      ) \
 { \
-	const num_t dt = PASTEMAC(ch,type); \
-\
-	ctype*   x1; \
-	ctype*   y1; \
-	uplo_t   uplox_eff; \
-	conj_t   conjx; \
-	dim_t    n_iter; \
-	dim_t    n_elem, n_elem_max; \
-	inc_t    ldx, incx; \
-	inc_t    ldy, incy; \
-	dim_t    j, i; \
-	dim_t    ij0, n_shift; \
-\
-	/* Set various loop parameters. */ \
-	bli_set_dims_incs_uplo_2m \
-	( \
-	  diagoffx, diagx, transx, \
-	  uplox, m, n, rs_x, cs_x, rs_y, cs_y, \
-	  &uplox_eff, &n_elem_max, &n_iter, &incx, &ldx, &incy, &ldy, \
-	  &ij0, &n_shift \
-	); \
-\
-	if ( bli_is_zeros( uplox_eff ) ) return; \
-\
-	/* Extract the conjugation component from the transx parameter. */ \
-	conjx = bli_extract_conj( transx ); \
-\
-	/* Query the kernel needed for this operation. */ \
-	PASTECH2(ch,kername,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+	const num_t   dt         = PASTEMAC(ch,type); \
+\
+	l1m_params_t* params     = params_v; \
+	uplo_t        uplox_eff  = params->uplox_eff; \
+	conj_t        conjx      = params->conjx; \
+	dim_t         n_elem_max = params->n_elem_max; \
+	dim_t         ij0        = params->ij0; \
+	dim_t         n_shift    = params->n_shift; \
+	ctype*        x          = params->x; \
+	inc_t         incx       = params->incx; \
+	inc_t         ldx        = params->ldx; \
+	ctype*        y          = params->y; \
+	inc_t         incy       = params->incy; \
+	inc_t         ldy        = params->ldy; \
+	cntx_t*       cntx       = params->cntx; \
+\
+	ctype*        x1; \
+	ctype*        y1; \
+	dim_t         n_elem; \
+	dim_t         j, i; \
+	dim_t         j_start, j_end; \
+	dim_t         i_start, i_end; \
+\
+	PASTECH2(ch,kername,_ker_ft) f = params->f; \
+\
+	bli_l1m_thread_range( dt, params, thread, \
+	                      &j_start, &j_end, &i_start, &i_end ); \
 \
 	/* Handle dense and upper/lower storage cases separately. */ \
 	if ( bli_is_dense( uplox_eff ) ) \
 	{ \
-		for ( j = 0; j < n_iter; ++j ) \
+		for ( j = j_start; j < j_end; ++j ) \
 		{ \
-			n_elem = n_elem_max; \
+			n_elem = i_end - i_start; \
 \
-			x1     = x + (j  )*ldx + (0  )*incx; \
-			y1     = y + (j  )*ldy + (0  )*incy; \
+			x1     = x + (j  )*ldx + (i_start  )*incx; \
+			y1     = y + (j  )*ldy + (i_start  )*incy; \
 \
 			/* Invoke the kernel with the appropriate parameters. */ \
 			f( \
@@ -109,7 +159,7 @@ void PASTEMAC(ch,opname) \
 	{ \
 		if ( bli_is_upper( uplox_eff ) ) \
 		{ \
-			for ( j = 0; j < n_iter; ++j ) \
+			for ( j = j_start; j < j_end; ++j ) \
 			{ \
 				n_elem = bli_min( n_shift + j + 1, n_elem_max ); \
 \
@@ -128,7 +178,7 @@ void PASTEMAC(ch,opname) \
 		} \
 		else if ( bli_is_lower( uplox_eff ) ) \
 		{ \
-			for ( j = 0; j < n_iter; ++j ) \
+			for ( j = j_start; j < j_end; ++j ) \
 			{ \
 				i      = bli_max( 0, ( doff_t )j - ( doff_t )n_shift ); \
 				n_elem = n_elem_max - i; \
@@ -147,15 +197,7 @@ void PASTEMAC(ch,opname) \
 			} \
 		} \
 	} \
-}
-
-INSERT_GENTFUNC_BASIC2( addm_unb_var1,  addv,  BLIS_ADDV_KER )
-INSERT_GENTFUNC_BASIC2( copym_unb_var1, copyv, BLIS_COPYV_KER )
-INSERT_GENTFUNC_BASIC2( subm_unb_var1,  subv,  BLIS_SUBV_KER )
-
-
-#undef  GENTFUNC
-#define GENTFUNC( ctype, ch, opname, kername, kerid ) \
+} \
 \
 void PASTEMAC(ch,opname) \
      ( \
@@ -165,52 +207,102 @@ void PASTEMAC(ch,opname) \
        trans_t transx, \
        dim_t   m, \
        dim_t   n, \
-       ctype*  alpha, \
        ctype*  x, inc_t rs_x, inc_t cs_x, \
        ctype*  y, inc_t rs_y, inc_t cs_y, \
        cntx_t* cntx, \
        rntm_t* rntm  \
      ) \
 { \
-	const num_t dt = PASTEMAC(ch,type); \
-\
-	ctype*   x1; \
-	ctype*   y1; \
-	uplo_t   uplox_eff; \
-	conj_t   conjx; \
-	dim_t    n_iter; \
-	dim_t    n_elem, n_elem_max; \
-	inc_t    ldx, incx; \
-	inc_t    ldy, incy; \
-	dim_t    j, i; \
-	dim_t    ij0, n_shift; \
+	const num_t  dt = PASTEMAC(ch,type); \
+\
+	l1m_params_t params; \
+	dim_t        n_threads; \
 \
 	/* Set various loop parameters. */ \
 	bli_set_dims_incs_uplo_2m \
 	( \
 	  diagoffx, diagx, transx, \
 	  uplox, m, n, rs_x, cs_x, rs_y, cs_y, \
-	  &uplox_eff, &n_elem_max, &n_iter, &incx, &ldx, &incy, &ldy, \
-	  &ij0, &n_shift \
+	  &params.uplox_eff, &params.n_elem_max, &params.n_iter, \
+	  &params.incx, &params.ldx, &params.incy, &params.ldy, \
+	  &params.ij0, &params.n_shift \
 	); \
 \
-	if ( bli_is_zeros( uplox_eff ) ) return; \
+	if ( bli_is_zeros( params.uplox_eff ) ) return; \
 \
 	/* Extract the conjugation component from the transx parameter. */ \
-	conjx = bli_extract_conj( transx ); \
+	params.conjx = bli_extract_conj( transx ); \
 \
 	/* Query the kernel needed for this operation. */ \
-	PASTECH2(ch,kername,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+	params.f     = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	params.x     = x; \
+	params.y     = y; \
+	params.cntx  = cntx; \
+\
+	n_threads = bli_l1v_thread_num_threads \
+	( \
+	  dt, \
+	  ( siz_t )params.n_elem_max * ( siz_t )params.n_iter, \
+	  cntx, \
+	  rntm  \
+	); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC2( addm_unb_var1,  addv,  BLIS_ADDV_KER )
+INSERT_GENTFUNC_BASIC2( copym_unb_var1, copyv, BLIS_COPYV_KER )
+INSERT_GENTFUNC_BASIC2( subm_unb_var1,  subv,  BLIS_SUBV_KER )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, kername, kerid ) \
+\
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt         = PASTEMAC(ch,type); \
+\
+	l1m_params_t* params     = params_v; \
+	uplo_t        uplox_eff  = params->uplox_eff; \
+	conj_t        conjx      = params->conjx; \
+	dim_t         n_elem_max = params->n_elem_max; \
+	dim_t         ij0        = params->ij0; \
+	dim_t         n_shift    = params->n_shift; \
+	ctype*        alpha      = params->alpha; \
+	ctype*        x          = params->x; \
+	inc_t         incx       = params->incx; \
+	inc_t         ldx        = params->ldx; \
+	ctype*        y          = params->y; \
+	inc_t         incy       = params->incy; \
+	inc_t         ldy        = params->ldy; \
+	cntx_t*       cntx       = params->cntx; \
+\
+	ctype*        x1; \
+	ctype*        y1; \
+	dim_t         n_elem; \
+	dim_t         j, i; \
+	dim_t         j_start, j_end; \
+	dim_t         i_start, i_end; \
+\
+	PASTECH2(ch,kername,_ker_ft) f = params->f; \
+\
+	bli_l1m_thread_range( dt, params, thread, \
+	                      &j_start, &j_end, &i_start, &i_end ); \
 \
 	/* Handle dense and upper/lower storage cases separately. */ \
 	if ( bli_is_dense( uplox_eff ) ) \
 	{ \
-		for ( j = 0; j < n_iter; ++j ) \
+		for ( j = j_start; j < j_end; ++j ) \
 		{ \
-			n_elem = n_elem_max; \
+			n_elem = i_end - i_start; \
 \
-			x1     = x + (j  )*ldx + (0  )*incx; \
-			y1     = y + (j  )*ldy + (0  )*incy; \
+			x1     = x + (j  )*ldx + (i_start  )*incx; \
+			y1     = y + (j  )*ldy + (i_start  )*incy; \
 \
 			/* Invoke the kernel with the appropriate parameters. */ \
 			f( \
@@ -227,7 +319,7 @@ void PASTEMAC(ch,opname) \
 	{ \
 		if ( bli_is_upper( uplox_eff ) ) \
 		{ \
-			for ( j = 0; j < n_iter; ++j ) \
+			for ( j = j_start; j < j_end; ++j ) \
 			{ \
 				n_elem = bli_min( n_shift + j + 1, n_elem_max ); \
 \
@@ -247,7 +339,7 @@ void PASTEMAC(ch,opname) \
 		} \
 		else if ( bli_is_lower( uplox_eff ) ) \
 		{ \
-			for ( j = 0; j < n_iter; ++j ) \
+			for ( j = j_start; j < j_end; ++j ) \
 			{ \
 				i      = bli_max( 0, ( doff_t )j - ( doff_t )n_shift ); \
 				n_elem = n_elem_max - i; \
@@ -267,61 +359,108 @@ void PASTEMAC(ch,opname) \
 			} \
 		} \
 	} \
-}
-
-INSERT_GENTFUNC_BASIC2( axpym_unb_var1,  axpyv,  BLIS_AXPYV_KER )
-INSERT_GENTFUNC_BASIC2( scal2m_unb_var1, scal2v, BLIS_SCAL2V_KER )
-
-
-#undef  GENTFUNC
-#define GENTFUNC( ctype, ch, opname, kername, kerid ) \
+} \
 \
 void PASTEMAC(ch,opname) \
      ( \
-       conj_t  conjalpha, \
        doff_t  diagoffx, \
        diag_t  diagx, \
        uplo_t  uplox, \
+       trans_t transx, \
        dim_t   m, \
        dim_t   n, \
        ctype*  alpha, \
        ctype*  x, inc_t rs_x, inc_t cs_x, \
+       ctype*  y, inc_t rs_y, inc_t cs_y, \
        cntx_t* cntx, \
        rntm_t* rntm  \
      ) \
 { \
-	const num_t dt = PASTEMAC(ch,type); \
+	const num_t  dt = PASTEMAC(ch,type); \
 \
-	ctype*   x1; \
-	uplo_t   uplox_eff; \
-	dim_t    n_iter; \
-	dim_t    n_elem, n_elem_max; \
-	inc_t    ldx, incx; \
-	dim_t    j, i; \
-	dim_t    ij0, n_shift; \
+	l1m_params_t params; \
+	dim_t        n_threads; \
 \
 	/* Set various loop parameters. */ \
-	bli_set_dims_incs_uplo_1m \
+	bli_set_dims_incs_uplo_2m \
 	( \
-	  diagoffx, diagx, \
-	  uplox, m, n, rs_x, cs_x, \
-	  &uplox_eff, &n_elem_max, &n_iter, &incx, &ldx, \
-	  &ij0, &n_shift \
+	  diagoffx, diagx, transx, \
+	  uplox, m, n, rs_x, cs_x, rs_y, cs_y, \
+	  &params.uplox_eff, &params.n_elem_max, &params.n_iter, \
+	  &params.incx, &params.ldx, &params.incy, &params.ldy, \
+	  &params.ij0, &params.n_shift \
 	); \
 \
-	if ( bli_is_zeros( uplox_eff ) ) return; \
+	if ( bli_is_zeros( params.uplox_eff ) ) return; \
+\
+	/* Extract the conjugation component from the transx parameter. */ \
+	params.conjx = bli_extract_conj( transx ); \
 \
 	/* Query the kernel needed for this operation. */ \
-	PASTECH2(ch,kername,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+	params.f     = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	params.alpha = alpha; \
+	params.x     = x; \
+	params.y     = y; \
+	params.cntx  = cntx; \
+\
+	n_threads = bli_l1v_thread_num_threads \
+	( \
+	  dt, \
+	  ( siz_t )params.n_elem_max * ( siz_t )params.n_iter, \
+	  cntx, \
+	  rntm  \
+	); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC2( axpym_unb_var1,  axpyv,  BLIS_AXPYV_KER )
+INSERT_GENTFUNC_BASIC2( scal2m_unb_var1, scal2v, BLIS_SCAL2V_KER )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, kername, kerid ) \
+\
+static void PASTEMAC2(ch,opname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt         = PASTEMAC(ch,type); \
+\
+	l1m_params_t* params     = params_v; \
+	uplo_t        uplox_eff  = params->uplox_eff; \
+	conj_t        conjalpha  = params->conjx; \
+	dim_t         n_elem_max = params->n_elem_max; \
+	dim_t         ij0        = params->ij0; \
+	dim_t         n_shift    = params->n_shift; \
+	ctype*        alpha      = params->alpha; \
+	ctype*        x          = params->x; \
+	inc_t         incx       = params->incx; \
+	inc_t         ldx        = params->ldx; \
+	cntx_t*       cntx       = params->cntx; \
+\
+	ctype*        x1; \
+	dim_t         n_elem; \
+	dim_t         j, i; \
+	dim_t         j_start, j_end; \
+	dim_t         i_start, i_end; \
+\
+	PASTECH2(ch,kername,_ker_ft) f = params->f; \
+\
+	bli_l1m_thread_range( dt, params, thread, \
+	                      &j_start, &j_end, &i_start, &i_end ); \
 \
 	/* Handle dense and upper/lower storage cases separately. */ \
 	if ( bli_is_dense( uplox_eff ) ) \
 	{ \
-		for ( j = 0; j < n_iter; ++j ) \
+		for ( j = j_start; j < j_end; ++j ) \
 		{ \
-			n_elem = n_elem_max; \
+			n_elem = i_end - i_start; \
 \
-			x1     = x + (j  )*ldx + (0  )*incx; \
+			x1     = x + (j  )*ldx + (i_start  )*incx; \
 \
 			/* Invoke the kernel with the appropriate parameters. */ \
 			f( \
@@ -337,7 +476,7 @@ void PASTEMAC(ch,opname) \
 	{ \
 		if ( bli_is_upper( uplox_eff ) ) \
 		{ \
-			for ( j = 0; j < n_iter; ++j ) \
+			for ( j = j_start; j < j_end; ++j ) \
 			{ \
 				n_elem = bli_min( n_shift + j + 1, n_elem_max ); \
 \
@@ -355,7 +494,7 @@ void PASTEMAC(ch,opname) \
 		} \
 		else if ( bli_is_lower( uplox_eff ) ) \
 		{ \
-			for ( j = 0; j < n_iter; ++j ) \
+			for ( j = j_start; j < j_end; ++j ) \
 			{ \
 				i      = bli_max( 0, ( doff_t )j - ( doff_t )n_shift ); \
 				n_elem = n_elem_max - i; \
@@ -373,6 +512,57 @@ void PASTEMAC(ch,opname) \
 			} \
 		} \
 	} \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conjalpha, \
+       doff_t  diagoffx, \
+       diag_t  diagx, \
+       uplo_t  uplox, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  x, inc_t rs_x, inc_t cs_x, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const num_t  dt = PASTEMAC(ch,type); \
+\
+	l1m_params_t params; \
+	dim_t        n_threads; \
+\
+	/* Set various loop parameters. */ \
+	bli_set_dims_incs_uplo_1m \
+	( \
+	  diagoffx, diagx, \
+	  uplox, m, n, rs_x, cs_x, \
+	  &params.uplox_eff, &params.n_elem_max, &params.n_iter, \
+	  &params.incx, &params.ldx, \
+	  &params.ij0, &params.n_shift \
+	); \
+\
+	if ( bli_is_zeros( params.uplox_eff ) ) return; \
+\
+	/* Query the kernel needed for this operation. */ \
+	params.f     = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	/* The conjx field carries conjalpha for these operations. */ \
+	params.conjx = conjalpha; \
+	params.alpha = alpha; \
+	params.x     = x; \
+	params.cntx  = cntx; \
+\
+	n_threads = bli_l1v_thread_num_threads \
+	( \
+	  dt, \
+	  ( siz_t )params.n_elem_max * ( siz_t )params.n_iter, \
+	  cntx, \
+	  rntm  \
+	); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,opname,_thr), &params ); \
 }
 
 INSERT_GENTFUNC_BASIC2( scalm_unb_var1, scalv, BLIS_SCALV_KER )
@@ -32,6 +32,25 @@
 
 */
 
+// The loop parameters of a level-1m operation (as computed by
+// bli_set_dims_incs_uplo_1m() or bli_set_dims_incs_uplo_2m()), bundled so
+// that they may be passed through bli_thread_launch() to each thread.
+// Not every field is used by every operation.
+typedef struct l1m_params_s
+{
+	void*   f;
+	uplo_t  uplox_eff;
+	conj_t  conjx;
+	dim_t   n_elem_max;
+	dim_t   n_iter;
+	dim_t   ij0;
+	dim_t   n_shift;
+	void*   alpha;
+	void*   x; inc_t incx; inc_t ldx;
+	void*   y; inc_t incy; inc_t ldy;
+	cntx_t* cntx;
+} l1m_params_t;
+
 
 //
 // Prototype BLAS-like interfaces with typed operands.
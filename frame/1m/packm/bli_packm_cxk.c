@@ -75,6 +75,7 @@ void PASTEMAC(ch,opname) \
 	else \
 	{ \
 		trans_t transa = ( trans_t )conja; \
+		rntm_t  rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
 \
 		/* Treat the micro-panel as panel_dim x panel_len and column-stored
 		   (unit row stride). */ \
@@ -90,9 +91,7 @@ void PASTEMAC(ch,opname) \
 		  a, inca, lda, \
 		  p, 1,    ldp, \
 		  cntx, \
-		  /* The rntm_t* can safely be NULL as long as it's not used by
-		     scal2m_ex(). */ \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 }
@@ -57,6 +57,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	dim_t  panel_dim; \
 	dim_t  panel_len; \
 	inc_t  incc, ldc; \
@@ -182,7 +184,7 @@ void PASTEMAC(ch,varname) \
 		  zero, \
 		  p_edge, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -205,7 +207,7 @@ void PASTEMAC(ch,varname) \
 		  zero, \
 		  p_edge, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -239,7 +241,7 @@ void PASTEMAC(ch,varname) \
 			  one, \
 			  p_br, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 	} \
@@ -284,6 +286,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	doff_t  diagoffc_abs; \
 	dim_t   i, j; \
 	bool_t  row_stored; \
@@ -454,7 +458,7 @@ void PASTEMAC(ch,varname) \
 			  c11, rs_c, cs_c, \
 			  p11, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 \
 			/* If source matrix c is Hermitian, we have to zero out the
@@ -486,7 +490,7 @@ void PASTEMAC(ch,varname) \
 			  kappa, \
 			  p11, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 	} \
@@ -524,6 +528,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	/* Pack the panel. */ \
 	PASTEMAC(ch,kername) \
 	( \
@@ -550,7 +556,7 @@ void PASTEMAC(ch,varname) \
 		  kappa, \
 		  p, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -564,7 +570,7 @@ void PASTEMAC(ch,varname) \
 		  n_panel, \
 		  p, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -594,7 +600,7 @@ void PASTEMAC(ch,varname) \
 		  zero, \
 		  p, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -57,6 +57,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	dim_t  panel_dim; \
 	dim_t  panel_len; \
 	inc_t  incc, ldc; \
@@ -184,7 +186,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_r, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 		PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 		( \
@@ -197,7 +199,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_i, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 		PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 		( \
@@ -210,7 +212,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_rpi, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -235,7 +237,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_r, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 		PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 		( \
@@ -248,7 +250,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_i, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 		PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 		( \
@@ -261,7 +263,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_rpi, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -297,7 +299,7 @@ void PASTEMAC(ch,varname) \
 			  one_r, \
 			  p_br_r, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 			PASTEMAC2(chr,setd,BLIS_TAPI_EX_SUF) \
 			( \
@@ -308,7 +310,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_br_i, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 	} \
@@ -343,6 +345,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	doff_t  diagoffc_abs; \
 	dim_t   i, j; \
 	bool_t  row_stored; \
@@ -530,7 +534,7 @@ void PASTEMAC(ch,varname) \
 			  c11_r, rs_c11, cs_c11, \
 			  p11_r, rs_p,   cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 \
 			/* Copy the imaginary part of the stored triangle of c11 to p11_i,
@@ -547,7 +551,7 @@ void PASTEMAC(ch,varname) \
 			  c11_i, rs_c11, cs_c11, \
 			  p11_i, rs_p,   cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 \
 			/* If source matrix c is Hermitian, we have to zero out the
@@ -648,6 +652,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	/* Pack the panel. */ \
 	PASTEMAC(ch,kername) \
 	( \
@@ -700,7 +706,7 @@ void PASTEMAC(ch,varname) \
 			  &kappa_r, \
 			  p_r, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 			PASTEMAC2(chr,setd,BLIS_TAPI_EX_SUF) \
 			( \
@@ -711,7 +717,7 @@ void PASTEMAC(ch,varname) \
 			  &kappa_i, \
 			  p_i, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 \
 			/* Update the diagonal of the p11 section of the rpi panel.
@@ -770,7 +776,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_r, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 			PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 			( \
@@ -783,7 +789,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_i, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 			PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 			( \
@@ -796,7 +802,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_rpi, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 	} \
@@ -57,6 +57,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	dim_t  panel_dim; \
 	dim_t  panel_len; \
 	inc_t  incc, ldc; \
@@ -183,7 +185,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_r, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 		PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 		( \
@@ -196,7 +198,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_i, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -220,7 +222,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_r, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 		PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 		( \
@@ -233,7 +235,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_i, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -269,7 +271,7 @@ void PASTEMAC(ch,varname) \
 			  one_r, \
 			  p_br_r, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 			PASTEMAC2(chr,setd,BLIS_TAPI_EX_SUF) \
 			( \
@@ -280,7 +282,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_br_i, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 	} \
@@ -315,6 +317,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	doff_t  diagoffc_abs; \
 	dim_t   i, j; \
 	bool_t  row_stored; \
@@ -502,7 +506,7 @@ void PASTEMAC(ch,varname) \
 			  c11_r, rs_c11, cs_c11, \
 			  p11_r, rs_p,   cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 \
 			/* Copy the imaginary part of the stored triangle of c11 to p11_i,
@@ -519,7 +523,7 @@ void PASTEMAC(ch,varname) \
 			  c11_i, rs_c11, cs_c11, \
 			  p11_i, rs_p,   cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 \
 			/* If source matrix c is Hermitian, we have to zero out the
@@ -605,6 +609,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	/* Pack the panel. */ \
 	PASTEMAC(ch,kername) \
 	( \
@@ -643,7 +649,7 @@ void PASTEMAC(ch,varname) \
 			  &kappa_r, \
 			  p_r, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 			PASTEMAC2(chr,setd,BLIS_TAPI_EX_SUF) \
 			( \
@@ -654,7 +660,7 @@ void PASTEMAC(ch,varname) \
 			  &kappa_i, \
 			  p_i, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 \
@@ -700,7 +706,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_r, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 			PASTEMAC2(chr,setm,BLIS_TAPI_EX_SUF) \
 			( \
@@ -713,7 +719,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_i, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 	} \
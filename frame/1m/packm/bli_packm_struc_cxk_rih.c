@@ -57,6 +57,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	dim_t  panel_dim; \
 	dim_t  panel_len; \
 	/*dim_t  panel_len_max;*/ \
@@ -186,7 +188,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_r, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -209,7 +211,7 @@ void PASTEMAC(ch,varname) \
 		  zero_r, \
 		  p_edge_r, rs_p, cs_p, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 \
@@ -518,6 +520,8 @@ void PASTEMAC(ch,varname) \
        cntx_t*         cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	/* Pack the panel. */ \
 	PASTEMAC(ch,kername) \
 	( \
@@ -584,7 +588,7 @@ void PASTEMAC(ch,varname) \
 			  zero_r, \
 			  p_r, rs_p, cs_p, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 	} \
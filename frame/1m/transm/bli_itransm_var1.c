@@ -0,0 +1,168 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant computes A := alpha * conja( A )^T in place, where A is an
+// m x m matrix. A is partitioned into square blocks of BLIS_ITRANSM_BLOCK
+// elements on a side, and each pair of blocks ( A(i,j), A(j,i) ) that are
+// mirror images across the diagonal is exchanged (and transposed) by
+// copying A(i,j) to a temporary buffer on the stack, transposing A(j,i)
+// into A(i,j) with the transpose kernel, and then transposing the buffer
+// into A(j,i). Diagonal blocks are handled the same way, with i = j. Since
+// each pair of blocks may be processed independently, the pairs are dealt
+// out to threads in round-robin fashion.
+//
+
+#define BLIS_ITRANSM_BLOCK 32
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC2(ch,varname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t      dt     = PASTEMAC(ch,type); \
+	const dim_t      mb     = BLIS_ITRANSM_BLOCK; \
+\
+	transm_params_t* params = params_v; \
+\
+	conj_t           conja  = params->conja; \
+	dim_t            m      = params->m; \
+	ctype*           alpha  = params->alpha; \
+	ctype*           a      = params->a; \
+	inc_t            rs_a   = params->rs_a; \
+	inc_t            cs_a   = params->cs_a; \
+	cntx_t*          cntx   = params->cntx; \
+\
+	dim_t            n_way  = bli_thread_n_way( thread ); \
+	dim_t            tid    = bli_thread_work_id( thread ); \
+\
+	dim_t            n_blk  = ( m + mb - 1 ) / mb; \
+	dim_t            bi, bj, k; \
+	dim_t            m_i, m_j; \
+	dim_t            i, j; \
+\
+	ctype*           a_ij; \
+	ctype*           a_ji; \
+	ctype            t[ BLIS_ITRANSM_BLOCK * BLIS_ITRANSM_BLOCK ]; \
+\
+	PASTECH(ch,transm_ker_ft) f; \
+\
+	/* Query the context for the kernel function pointer. */ \
+	f = bli_cntx_get_transm_ker_dt( dt, BLIS_TRANSM_KER, cntx ); \
+\
+	/* Visit the pairs of blocks on or above the diagonal in column-major
+	   order, numbering them with k. */ \
+	k = 0; \
+	for ( bj = 0; bj < n_blk; ++bj ) \
+	for ( bi = 0; bi <= bj; ++bi, ++k ) \
+	{ \
+		if ( k % n_way != tid ) continue; \
+\
+		m_i  = bli_min( mb, m - bi*mb ); \
+		m_j  = bli_min( mb, m - bj*mb ); \
+\
+		a_ij = a + bi*mb*rs_a + bj*mb*cs_a; \
+		a_ji = a + bj*mb*rs_a + bi*mb*cs_a; \
+\
+		/* t := A(i,j); (t is m_i x m_j and column-stored.) */ \
+		for ( j = 0; j < m_j; ++j ) \
+		for ( i = 0; i < m_i; ++i ) \
+			PASTEMAC(ch,copys)( *(a_ij + i*rs_a + j*cs_a), t[ i + j*m_i ] ); \
+\
+		/* A(i,j) := alpha * conja( A(j,i) )^T; (Unless A(i,j) is a diagonal
+		   block, in which case t already holds a copy of A(j,i).) */ \
+		if ( bi != bj ) \
+			f \
+			( \
+			  conja, \
+			  m_j, \
+			  m_i, \
+			  alpha, \
+			  a_ji, rs_a, cs_a, \
+			  a_ij, rs_a, cs_a, \
+			  cntx  \
+			); \
+\
+		/* A(j,i) := alpha * conja( t )^T; */ \
+		f \
+		( \
+		  conja, \
+		  m_i, \
+		  m_j, \
+		  alpha, \
+		  t,    1,    m_i, \
+		  a_ji, rs_a, cs_a, \
+		  cntx  \
+		); \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t  conja, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const num_t     dt = PASTEMAC(ch,type); \
+\
+	transm_params_t params; \
+	dim_t           n_threads; \
+\
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	params.conja = conja; \
+	params.m     = m; \
+	params.n     = m; \
+	params.alpha = alpha; \
+	params.a     = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.cntx  = cntx; \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, ( siz_t )m * ( siz_t )m, \
+	                                        cntx, rntm ); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,varname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC0( itransm_var1 )
+
@@ -0,0 +1,190 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Guard the function definitions so that they are only compiled when
+// #included from files that define the typed API macros.
+#ifdef BLIS_ENABLE_TAPI
+
+//
+// Define BLAS-like interfaces with typed operands.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* omatcopy is equivalent to scal2m on a dense matrix, which uses the
+	   transpose kernel whenever the transposition changes the dimension
+	   along which the matrix is contiguous in memory. */ \
+	PASTEMAC2(ch,scal2m,BLIS_TAPI_EX_SUF) \
+	( \
+	  0, \
+	  BLIS_NONUNIT_DIAG, \
+	  BLIS_DENSE, \
+	  transa, \
+	  m, \
+	  n, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( omatcopy )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+                  inc_t rs_b, inc_t cs_b  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const bool_t same_strides = ( rs_a == rs_b && cs_a == cs_b ); \
+\
+	ctype*       w; \
+	inc_t        rs_w, cs_w; \
+\
+	if ( bli_zero_dim2( m, n ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If the storage of the matrix is unchanged and no transposition or
+	   conjugation is requested, the operation reduces to scalm. */ \
+	if ( transa == BLIS_NO_TRANSPOSE && same_strides ) \
+	{ \
+		PASTEMAC2(ch,scalm,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  0, \
+		  BLIS_NONUNIT_DIAG, \
+		  BLIS_DENSE, \
+		  m, \
+		  n, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  cntx, \
+		  rntm  \
+		); \
+		return; \
+	} \
+\
+	/* A square matrix whose storage is unchanged may be transposed in
+	   place by exchanging pairs of blocks. */ \
+	if ( bli_does_trans( transa ) && m == n && same_strides ) \
+	{ \
+		PASTEMAC(ch,itransm_var1) \
+		( \
+		  bli_extract_conj( transa ), \
+		  m, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  cntx, \
+		  rntm  \
+		); \
+		return; \
+	} \
+\
+	/* Otherwise, the elements of the matrix must be permuted within the
+	   buffer. Rather than following the cycles of the permutation, which
+	   touches memory in a cache-hostile order, we compute the result into
+	   a column-stored workspace (using the blocked transpose kernel, if
+	   applicable) and then copy the workspace back into the buffer with
+	   the requested strides. */ \
+	rs_w = 1; \
+	cs_w = m; \
+	w    = bli_malloc_intl( m * n * sizeof( ctype ) ); \
+\
+	PASTEMAC2(ch,omatcopy,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, \
+	  m, \
+	  n, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  w, rs_w, cs_w, \
+	  cntx, \
+	  rntm  \
+	); \
+\
+	PASTEMAC2(ch,copym,BLIS_TAPI_EX_SUF) \
+	( \
+	  0, \
+	  BLIS_NONUNIT_DIAG, \
+	  BLIS_DENSE, \
+	  BLIS_NO_TRANSPOSE, \
+	  m, \
+	  n, \
+	  w, rs_w, cs_w, \
+	  a, rs_b, cs_b, \
+	  cntx, \
+	  rntm  \
+	); \
+\
+	bli_free_intl( w ); \
+}
+
+INSERT_GENTFUNC_BASIC0( imatcopy )
+
+
+#endif
+
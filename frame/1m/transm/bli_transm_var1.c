@@ -0,0 +1,145 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant computes B := alpha * conja( A )^T, where A is m x n and B is
+// n x m, by partitioning the longer dimension of A among threads and
+// invoking the transpose kernel on each thread's block of A.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC2(ch,varname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t      dt     = PASTEMAC(ch,type); \
+\
+	transm_params_t* params = params_v; \
+\
+	conj_t           conja  = params->conja; \
+	dim_t            m      = params->m; \
+	dim_t            n      = params->n; \
+	ctype*           alpha  = params->alpha; \
+	ctype*           a      = params->a; \
+	inc_t            rs_a   = params->rs_a; \
+	inc_t            cs_a   = params->cs_a; \
+	ctype*           b      = params->b; \
+	inc_t            rs_b   = params->rs_b; \
+	inc_t            cs_b   = params->cs_b; \
+	cntx_t*          cntx   = params->cntx; \
+\
+	dim_t            start, end; \
+\
+	PASTECH(ch,transm_ker_ft) f; \
+\
+	/* Query the context for the kernel function pointer. */ \
+	f = bli_cntx_get_transm_ker_dt( dt, BLIS_TRANSM_KER, cntx ); \
+\
+	/* Column j of A becomes row j of B, and row i of A becomes column i
+	   of B. Partition whichever of these dimensions is longer. */ \
+	if ( n >= m ) \
+	{ \
+		bli_thread_get_range_sub( thread, n, bli_l1v_thread_bf( dt ), FALSE, \
+		                          &start, &end ); \
+\
+		f \
+		( \
+		  conja, \
+		  m, \
+		  end - start, \
+		  alpha, \
+		  a + start*cs_a, rs_a, cs_a, \
+		  b + start*rs_b, rs_b, cs_b, \
+		  cntx  \
+		); \
+	} \
+	else \
+	{ \
+		bli_thread_get_range_sub( thread, m, bli_l1v_thread_bf( dt ), FALSE, \
+		                          &start, &end ); \
+\
+		f \
+		( \
+		  conja, \
+		  end - start, \
+		  n, \
+		  alpha, \
+		  a + start*rs_a, rs_a, cs_a, \
+		  b + start*cs_b, rs_b, cs_b, \
+		  cntx  \
+		); \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t  conja, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const num_t     dt = PASTEMAC(ch,type); \
+\
+	transm_params_t params; \
+	dim_t           n_threads; \
+\
+	if ( bli_zero_dim2( m, n ) ) return; \
+\
+	params.conja = conja; \
+	params.m     = m; \
+	params.n     = n; \
+	params.alpha = alpha; \
+	params.a     = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.b     = b; params.rs_b = rs_b; params.cs_b = cs_b; \
+	params.cntx  = cntx; \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, ( siz_t )m * ( siz_t )n, \
+	                                        cntx, rntm ); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,varname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC0( transm_var1 )
+
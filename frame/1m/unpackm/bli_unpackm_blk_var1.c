@@ -143,6 +143,8 @@ void PASTEMAC(ch,varname) \
        cntx_t* cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	ctype* restrict one       = PASTEMAC(ch,1); \
 	ctype* restrict c_cast    = c; \
 	ctype* restrict p_cast    = p; \
@@ -247,7 +249,7 @@ void PASTEMAC(ch,varname) \
 			  p_begin, rs_p, cs_p, \
 			  c_begin, rs_c, cs_c, \
 			  cntx, \
-			  NULL  \
+			  &rntm_l  \
 			); \
 		} \
 		else \
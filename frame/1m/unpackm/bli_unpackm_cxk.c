@@ -48,6 +48,8 @@ void PASTEMAC(ch,opname) \
        cntx_t* cntx  \
      ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	num_t     dt     = PASTEMAC(ch,type); \
 	l1mkr_t   ker_id = panel_dim; \
 \
@@ -90,7 +92,7 @@ void PASTEMAC(ch,opname) \
 		  p, 1,    ldp, \
 		  a, inca, lda, \
 		  cntx, \
-		  NULL  \
+		  &rntm_l  \
 		); \
 	} \
 }
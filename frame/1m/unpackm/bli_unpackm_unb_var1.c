@@ -109,6 +109,8 @@ void PASTEMAC(ch,varname)( \
                            cntx_t* cntx  \
                          ) \
 { \
+	rntm_t rntm_l = BLIS_RNTM_SINGLE_THREADED_INITIALIZER; \
+\
 	ctype* p_cast = p; \
 	ctype* c_cast = c; \
 \
@@ -123,7 +125,7 @@ void PASTEMAC(ch,varname)( \
 	  p_cast, rs_p, cs_p, \
 	  c_cast, rs_c, cs_c, \
 	  cntx, \
-	  NULL  \
+	  &rntm_l  \
 	); \
 }
 
@@ -68,3 +68,6 @@
 #include "bli_trmv.h"
 #include "bli_trsv.h"
 
+// Banded and packed operations
+#include "bli_l2bp.h"
+
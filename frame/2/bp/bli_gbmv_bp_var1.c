@@ -0,0 +1,247 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant computes y := beta * y + alpha * op(A) * x, where A is
+// banded, by sweeping down the rows of op(A) and computing the elements
+// of y with dotxf (within the dense interior of the band) and dotxv
+// (along the ragged edges of the band). Each thread is assigned a
+// contiguous range of the elements of y, and thus of the rows of op(A).
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC2(ch,varname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt     = PASTEMAC(ch,type); \
+\
+	l2bp_params_t* params = params_v; \
+\
+	trans_t        transa = params->transa; \
+	conj_t         conjx  = params->conjx; \
+	dim_t          m      = params->m; \
+	dim_t          n      = params->n; \
+	dim_t          kl     = params->kl; \
+	dim_t          ku     = params->ku; \
+	ctype*         alpha  = params->alpha; \
+	ctype*         a      = params->a; \
+	inc_t          rs_a   = params->rs_a; \
+	inc_t          cs_a   = params->cs_a; \
+	ctype*         x      = params->x; \
+	inc_t          incx   = params->incx; \
+	ctype*         beta   = params->beta; \
+	ctype*         y      = params->y; \
+	inc_t          incy   = params->incy; \
+	cntx_t*        cntx   = params->cntx; \
+\
+	ctype*         one    = PASTEMAC(ch,1); \
+	ctype*         a_d; \
+	dim_t          m_y, n_x; \
+	dim_t          kl_t, ku_t; \
+	inc_t          rs_at, cs_at; \
+	dim_t          i_start, i_end; \
+	dim_t          j_dense, j_dense_end; \
+	dim_t          j_beg, j_lim; \
+	dim_t          i, ii, f; \
+	dim_t          b_fuse; \
+	conj_t         conja; \
+\
+	PASTECH(ch,scalv_ker_ft) kfp_sv; \
+	PASTECH(ch,dotxv_ker_ft) kfp_dv; \
+	PASTECH(ch,dotxf_ker_ft) kfp_df; \
+\
+	/* Query the context for the kernel function pointers and fusing
+	   factor. */ \
+	kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+	kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	kfp_df = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTXF_KER, cntx ); \
+	b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_DF, cntx ); \
+\
+	/* Address the band as a (sparse) dense matrix so that element (i,j)
+	   of op(A) resides at a_d[ i*rs_at + j*cs_at ]. */ \
+	a_d = a + ku*rs_a; \
+\
+	bli_set_dims_incs_with_trans( transa, \
+	                              m, n, rs_a, cs_a - rs_a, \
+	                              &m_y, &n_x, &rs_at, &cs_at ); \
+\
+	if ( bli_does_trans( transa ) ) { kl_t = ku; ku_t = kl; } \
+	else                            { kl_t = kl; ku_t = ku; } \
+\
+	conja = bli_extract_conj( transa ); \
+\
+	/* Determine the rows of op(A) (and elements of y) for which the
+	   current thread is responsible. */ \
+	bli_thread_get_range_sub( thread, m_y, b_fuse, FALSE, &i_start, &i_end ); \
+\
+	if ( i_end <= i_start ) return; \
+\
+	/* y = beta * y; */ \
+	kfp_sv \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  i_end - i_start, \
+	  beta, \
+	  y + i_start*incy, incy, \
+	  cntx  \
+	); \
+\
+	for ( i = i_start; i < i_end; i += f ) \
+	{ \
+		f = bli_determine_blocksize_dim_f( i, i_end, b_fuse ); \
+\
+		/* Identify the columns in which all f rows lie within the band. */ \
+		j_dense     = bli_max( 0,   i + f - 1 - kl_t ); \
+		j_dense_end = bli_min( n_x, i + ku_t + 1 ); \
+\
+		if ( j_dense < j_dense_end ) \
+		{ \
+			/* y1 = y1 + alpha * A11 * x1; */ \
+			kfp_df \
+			( \
+			  conja, \
+			  conjx, \
+			  j_dense_end - j_dense, \
+			  f, \
+			  alpha, \
+			  a_d + i*rs_at + j_dense*cs_at, cs_at, rs_at, \
+			  x + j_dense*incx, incx, \
+			  one, \
+			  y + i*incy, incy, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			/* No dense block exists; process each row in full. */ \
+			j_dense = j_dense_end = n_x; \
+		} \
+\
+		/* Handle the ragged portions of each row to the left and right of
+		   the dense block. */ \
+		for ( ii = i; ii < i + f; ++ii ) \
+		{ \
+			j_beg = bli_max( 0,   ii - kl_t ); \
+			j_lim = bli_min( n_x, ii + ku_t + 1 ); \
+\
+			if ( j_beg < j_dense && j_beg < j_lim ) \
+			{ \
+				kfp_dv \
+				( \
+				  conja, \
+				  conjx, \
+				  bli_min( j_dense, j_lim ) - j_beg, \
+				  alpha, \
+				  a_d + ii*rs_at + j_beg*cs_at, cs_at, \
+				  x + j_beg*incx, incx, \
+				  one, \
+				  y + ii*incy, \
+				  cntx  \
+				); \
+			} \
+\
+			if ( j_dense_end < j_lim && j_dense < j_dense_end ) \
+			{ \
+				kfp_dv \
+				( \
+				  conja, \
+				  conjx, \
+				  j_lim - j_dense_end, \
+				  alpha, \
+				  a_d + ii*rs_at + j_dense_end*cs_at, cs_at, \
+				  x + j_dense_end*incx, incx, \
+				  one, \
+				  y + ii*incy, \
+				  cntx  \
+				); \
+			} \
+		} \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2bp_params_t params; \
+	dim_t         m_y = ( bli_does_trans( transa ) ? n : m ); \
+	dim_t         n_threads; \
+\
+	params.transa = transa; \
+	params.conjx  = conjx; \
+	params.m      = m; \
+	params.n      = n; \
+	params.kl     = kl; \
+	params.ku     = ku; \
+	params.alpha  = alpha; \
+	params.a      = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.x      = x; params.incx = incx; \
+	params.beta   = beta; \
+	params.y      = y; params.incy = incy; \
+	params.cntx   = cntx; \
+\
+	/* Only parallelize when each thread has enough of the band to
+	   amortize the cost of spawning threads. */ \
+	n_threads = bli_thread_calc_num_threads_for_work \
+	( \
+	  ( siz_t )m_y * ( siz_t )( kl + ku + 1 ), \
+	  BLIS_DEFAULT_L2_MIN_WORK_PER_THREAD, \
+	  rntm  \
+	); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,varname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv_bp_var1 )
+
@@ -0,0 +1,346 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant computes y := beta * y + alpha * A * x, where A is a
+// Hermitian or symmetric matrix stored in banded or packed form. Only the
+// stored triangle of A is referenced. Each thread is assigned a contiguous
+// range of the elements of y. Columns of the stored triangle whose
+// diagonal element falls within that range are processed with dotaxpyv,
+// which computes the contribution of the column to y (as an axpy) and the
+// contribution of its reflection to the diagonal element (as a dot
+// product) in one pass over the column. Portions of these columns that
+// fall outside of the thread's range are only needed for the dot product,
+// and columns whose diagonal element falls outside of the range are only
+// needed for the axpy.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC2(ch,varname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt     = PASTEMAC(ch,type); \
+\
+	l2bp_params_t* params = params_v; \
+\
+	uplo_t         uploa  = params->uploa; \
+	conj_t         conja  = params->conja; \
+	conj_t         conjx  = params->conjx; \
+	conj_t         conjh  = params->conjh; \
+	bool_t         packed = params->packed; \
+	dim_t          m      = params->m; \
+	dim_t          k      = params->ku; \
+	ctype*         alpha  = params->alpha; \
+	ctype*         a      = params->a; \
+	inc_t          rs_a   = params->rs_a; \
+	inc_t          cs_a   = params->cs_a; \
+	ctype*         x      = params->x; \
+	inc_t          incx   = params->incx; \
+	ctype*         beta   = params->beta; \
+	ctype*         y      = params->y; \
+	inc_t          incy   = params->incy; \
+	cntx_t*        cntx   = params->cntx; \
+\
+	ctype*         one    = PASTEMAC(ch,1); \
+	ctype*         a_j; \
+	ctype*         chi1; \
+	ctype*         psi1; \
+	ctype          alpha11; \
+	ctype          chi1_conj; \
+	ctype          alpha_chi1; \
+	ctype          rho; \
+	dim_t          i_start, i_end; \
+	dim_t          i_beg, i_mid, i_lim; \
+	dim_t          j; \
+	conj_t         conjat; \
+\
+	PASTECH(ch,scalv_ker_ft)    kfp_sv; \
+	PASTECH(ch,axpyv_ker_ft)    kfp_av; \
+	PASTECH(ch,dotxv_ker_ft)    kfp_dv; \
+	PASTECH(ch,dotaxpyv_ker_ft) kfp_vf; \
+\
+	/* Query the context for the kernel function pointers. */ \
+	kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER,    cntx ); \
+	kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER,    cntx ); \
+	kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER,    cntx ); \
+	kfp_vf = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTAXPYV_KER, cntx ); \
+\
+	/* The reflected triangle is conjugated only for Hermitian matrices. */ \
+	conjat = bli_apply_conj( conjh, conja ); \
+\
+	/* Determine the elements of y for which the current thread is
+	   responsible. */ \
+	bli_thread_get_range_sub( thread, m, 1, FALSE, &i_start, &i_end ); \
+\
+	if ( i_end <= i_start ) return; \
+\
+	/* y = beta * y; */ \
+	kfp_sv \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  i_end - i_start, \
+	  beta, \
+	  y + i_start*incy, incy, \
+	  cntx  \
+	); \
+\
+	if ( bli_is_upper( uploa ) ) \
+	{ \
+		/* Process the columns whose diagonal elements we own. */ \
+		for ( j = i_start; j < i_end; ++j ) \
+		{ \
+			a_j  = a + bli_l2bp_col_offset( packed, uploa, m, k, j, rs_a, cs_a ); \
+			chi1 = x + j*incx; \
+			psi1 = y + j*incy; \
+\
+			PASTEMAC(ch,copycjs)( conjx, *chi1, chi1_conj ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1_conj, alpha_chi1 ); \
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			i_beg = bli_max( 0, j - k ); \
+			i_mid = bli_max( i_start, i_beg ); \
+\
+			/* y(i_mid:j-1) += alpha * chi1 * a(i_mid:j-1,j);
+			   rho = a(i_mid:j-1,j)' * x(i_mid:j-1); */ \
+			if ( i_mid < j ) \
+			{ \
+				kfp_vf \
+				( \
+				  conjat, \
+				  conja, \
+				  conjx, \
+				  j - i_mid, \
+				  &alpha_chi1, \
+				  a_j + i_mid*rs_a, rs_a, \
+				  x + i_mid*incx, incx, \
+				  &rho, \
+				  y + i_mid*incy, incy, \
+				  cntx  \
+				); \
+			} \
+\
+			/* psi1 += alpha * a(i_beg:i_mid-1,j)' * x(i_beg:i_mid-1); */ \
+			if ( i_beg < i_mid ) \
+			{ \
+				kfp_dv \
+				( \
+				  conjat, \
+				  conjx, \
+				  i_mid - i_beg, \
+				  alpha, \
+				  a_j + i_beg*rs_a, rs_a, \
+				  x + i_beg*incx, incx, \
+				  one, \
+				  psi1, \
+				  cntx  \
+				); \
+			} \
+\
+			/* For Hermitian matrices, ignore the imaginary part of the
+			   diagonal element. */ \
+			PASTEMAC(ch,copycjs)( conja, *(a_j + j*rs_a), alpha11 ); \
+			if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11 ); \
+\
+			/* psi1 += alpha * ( rho + alpha11 * chi1 ); */ \
+			PASTEMAC(ch,axpys)( alpha11, chi1_conj, rho ); \
+			PASTEMAC(ch,axpys)( *alpha, rho, *psi1 ); \
+		} \
+\
+		/* Process the columns to the right of our range that reach up
+		   into it. */ \
+		for ( j = i_end; j < bli_min( m, i_end + k ); ++j ) \
+		{ \
+			a_j  = a + bli_l2bp_col_offset( packed, uploa, m, k, j, rs_a, cs_a ); \
+			chi1 = x + j*incx; \
+\
+			PASTEMAC(ch,copycjs)( conjx, *chi1, chi1_conj ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1_conj, alpha_chi1 ); \
+\
+			i_beg = bli_max( i_start, j - k ); \
+\
+			kfp_av \
+			( \
+			  conja, \
+			  i_end - i_beg, \
+			  &alpha_chi1, \
+			  a_j + i_beg*rs_a, rs_a, \
+			  y + i_beg*incy, incy, \
+			  cntx  \
+			); \
+		} \
+	} \
+	else /* if ( bli_is_lower( uploa ) ) */ \
+	{ \
+		/* Process the columns to the left of our range that reach down
+		   into it. */ \
+		for ( j = bli_max( 0, i_start - k ); j < i_start; ++j ) \
+		{ \
+			a_j  = a + bli_l2bp_col_offset( packed, uploa, m, k, j, rs_a, cs_a ); \
+			chi1 = x + j*incx; \
+\
+			PASTEMAC(ch,copycjs)( conjx, *chi1, chi1_conj ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1_conj, alpha_chi1 ); \
+\
+			i_lim = bli_min( i_end, j + k + 1 ); \
+\
+			kfp_av \
+			( \
+			  conja, \
+			  i_lim - i_start, \
+			  &alpha_chi1, \
+			  a_j + i_start*rs_a, rs_a, \
+			  y + i_start*incy, incy, \
+			  cntx  \
+			); \
+		} \
+\
+		/* Process the columns whose diagonal elements we own. */ \
+		for ( j = i_start; j < i_end; ++j ) \
+		{ \
+			a_j  = a + bli_l2bp_col_offset( packed, uploa, m, k, j, rs_a, cs_a ); \
+			chi1 = x + j*incx; \
+			psi1 = y + j*incy; \
+\
+			PASTEMAC(ch,copycjs)( conjx, *chi1, chi1_conj ); \
+			PASTEMAC(ch,scal2s)( *alpha, chi1_conj, alpha_chi1 ); \
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			i_lim = bli_min( m, j + k + 1 ); \
+			i_mid = bli_min( i_end, i_lim ); \
+\
+			/* y(j+1:i_mid-1) += alpha * chi1 * a(j+1:i_mid-1,j);
+			   rho = a(j+1:i_mid-1,j)' * x(j+1:i_mid-1); */ \
+			if ( j + 1 < i_mid ) \
+			{ \
+				kfp_vf \
+				( \
+				  conjat, \
+				  conja, \
+				  conjx, \
+				  i_mid - ( j + 1 ), \
+				  &alpha_chi1, \
+				  a_j + ( j + 1 )*rs_a, rs_a, \
+				  x + ( j + 1 )*incx, incx, \
+				  &rho, \
+				  y + ( j + 1 )*incy, incy, \
+				  cntx  \
+				); \
+			} \
+\
+			/* psi1 += alpha * a(i_mid:i_lim-1,j)' * x(i_mid:i_lim-1); */ \
+			if ( i_mid < i_lim ) \
+			{ \
+				kfp_dv \
+				( \
+				  conjat, \
+				  conjx, \
+				  i_lim - i_mid, \
+				  alpha, \
+				  a_j + i_mid*rs_a, rs_a, \
+				  x + i_mid*incx, incx, \
+				  one, \
+				  psi1, \
+				  cntx  \
+				); \
+			} \
+\
+			/* For Hermitian matrices, ignore the imaginary part of the
+			   diagonal element. */ \
+			PASTEMAC(ch,copycjs)( conja, *(a_j + j*rs_a), alpha11 ); \
+			if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11 ); \
+\
+			/* psi1 += alpha * ( rho + alpha11 * chi1 ); */ \
+			PASTEMAC(ch,axpys)( alpha11, chi1_conj, rho ); \
+			PASTEMAC(ch,axpys)( *alpha, rho, *psi1 ); \
+		} \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       bool_t  packed, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2bp_params_t params; \
+	dim_t         n_threads; \
+\
+	params.uploa  = uploa; \
+	params.conja  = conja; \
+	params.conjx  = conjx; \
+	params.conjh  = conjh; \
+	params.packed = packed; \
+	params.m      = m; \
+	params.ku     = k; \
+	params.alpha  = alpha; \
+	params.a      = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.x      = x; params.incx = incx; \
+	params.beta   = beta; \
+	params.y      = y; params.incy = incy; \
+	params.cntx   = cntx; \
+\
+	/* Only parallelize when each thread has enough of the stored triangle
+	   to amortize the cost of spawning threads. Each stored element is
+	   read once but contributes to two elements of y. */ \
+	n_threads = bli_thread_calc_num_threads_for_work \
+	( \
+	  2 * ( siz_t )m * ( siz_t )( k + 1 ), \
+	  BLIS_DEFAULT_L2_MIN_WORK_PER_THREAD, \
+	  rntm  \
+	); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,varname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hemv_bp_var1 )
+
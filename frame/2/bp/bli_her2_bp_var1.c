@@ -0,0 +1,199 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant computes A := A + alpha * x * y^H + conj(alpha) * y * x^H
+// (or A := A + alpha * x * y^T + alpha * y * x^T), where A is a Hermitian
+// or symmetric matrix stored in banded or packed form. Only the stored
+// triangle of A is updated, one column at a time via axpy2v. Each thread
+// is assigned a contiguous range of columns; for packed matrices, the
+// ranges are weighted so that each thread updates roughly the same number
+// of elements.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC2(ch,varname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt     = PASTEMAC(ch,type); \
+\
+	l2bp_params_t* params = params_v; \
+\
+	uplo_t         uploa  = params->uploa; \
+	conj_t         conjx  = params->conjx; \
+	conj_t         conjy  = params->conjy; \
+	conj_t         conjh  = params->conjh; \
+	bool_t         packed = params->packed; \
+	dim_t          m      = params->m; \
+	dim_t          k      = params->ku; \
+	ctype*         alpha  = params->alpha; \
+	ctype*         a      = params->a; \
+	inc_t          rs_a   = params->rs_a; \
+	inc_t          cs_a   = params->cs_a; \
+	ctype*         x      = params->x; \
+	inc_t          incx   = params->incx; \
+	ctype*         y      = params->y; \
+	inc_t          incy   = params->incy; \
+	cntx_t*        cntx   = params->cntx; \
+\
+	ctype*         a_j; \
+	ctype*         chi1; \
+	ctype*         psi1; \
+	ctype          alpha0; \
+	ctype          alpha1; \
+	ctype          alpha0_psi1; \
+	ctype          alpha1_chi1; \
+	dim_t          j_start, j_end; \
+	dim_t          i_beg, i_lim; \
+	dim_t          j; \
+	conj_t         conj0, conj1; \
+\
+	PASTECH(ch,axpy2v_ker_ft) kfp_2v; \
+\
+	/* Query the context for the kernel function pointer. */ \
+	kfp_2v = bli_cntx_get_l1f_ker_dt( dt, BLIS_AXPY2V_KER, cntx ); \
+\
+	/* The second term is scaled by conj(alpha) and the elements of x and
+	   y that scale each column are conjugated only for Hermitian
+	   matrices. */ \
+	PASTEMAC(ch,copys)( *alpha, alpha0 ); \
+	PASTEMAC(ch,copycjs)( conjh, *alpha, alpha1 ); \
+\
+	conj0 = bli_apply_conj( conjh, conjy ); \
+	conj1 = bli_apply_conj( conjh, conjx ); \
+\
+	/* Eliminate unused variable warnings. */ \
+	( void )conj0; \
+	( void )conj1; \
+\
+	/* Determine the columns for which the current thread is responsible. */ \
+	if ( packed ) \
+		bli_thread_get_range_weighted_sub( thread, 0, uploa, m, m, 1, FALSE, \
+		                                   &j_start, &j_end ); \
+	else \
+		bli_thread_get_range_sub( thread, m, 1, FALSE, &j_start, &j_end ); \
+\
+	for ( j = j_start; j < j_end; ++j ) \
+	{ \
+		a_j  = a + bli_l2bp_col_offset( packed, uploa, m, k, j, rs_a, cs_a ); \
+		chi1 = x + j*incx; \
+		psi1 = y + j*incy; \
+\
+		/* Identify the stored portion of the column (including the
+		   diagonal). */ \
+		if ( bli_is_upper( uploa ) ) { i_beg = bli_max( 0, j - k ); i_lim = j + 1; } \
+		else                         { i_beg = j; i_lim = bli_min( m, j + k + 1 ); } \
+\
+		/* alpha0_psi1 = alpha0 * conj0( psi1 );
+		   alpha1_chi1 = alpha1 * conj1( chi1 ); */ \
+		PASTEMAC(ch,copycjs)( conj0, *psi1, alpha0_psi1 ); \
+		PASTEMAC(ch,scals)( alpha0, alpha0_psi1 ); \
+		PASTEMAC(ch,copycjs)( conj1, *chi1, alpha1_chi1 ); \
+		PASTEMAC(ch,scals)( alpha1, alpha1_chi1 ); \
+\
+		/* a(i_beg:i_lim-1,j) += alpha0_psi1 * conjx( x(i_beg:i_lim-1) ) +
+		                         alpha1_chi1 * conjy( y(i_beg:i_lim-1) ); */ \
+		kfp_2v \
+		( \
+		  conjx, \
+		  conjy, \
+		  i_lim - i_beg, \
+		  &alpha0_psi1, \
+		  &alpha1_chi1, \
+		  x + i_beg*incx, incx, \
+		  y + i_beg*incy, incy, \
+		  a_j + i_beg*rs_a, rs_a, \
+		  cntx  \
+		); \
+\
+		/* For Hermitian matrices, explicitly set the imaginary component
+		   of the diagonal element to zero. */ \
+		if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( *(a_j + j*rs_a) ); \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       conj_t  conjh, \
+       bool_t  packed, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2bp_params_t params; \
+	dim_t         n_threads; \
+\
+	params.uploa  = uploa; \
+	params.conjx  = conjx; \
+	params.conjy  = conjy; \
+	params.conjh  = conjh; \
+	params.packed = packed; \
+	params.m      = m; \
+	params.ku     = k; \
+	params.alpha  = alpha; \
+	params.a      = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.x      = x; params.incx = incx; \
+	params.y      = y; params.incy = incy; \
+	params.cntx   = cntx; \
+\
+	/* Only parallelize when each thread has enough of the stored triangle
+	   to amortize the cost of spawning threads. */ \
+	n_threads = bli_thread_calc_num_threads_for_work \
+	( \
+	  2 * ( siz_t )m * ( siz_t )( k + 1 ), \
+	  BLIS_DEFAULT_L2_MIN_WORK_PER_THREAD, \
+	  rntm  \
+	); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,varname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC0( her2_bp_var1 )
+
@@ -0,0 +1,173 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant computes A := A + alpha * x * x^H (or x * x^T), where A is
+// a Hermitian or symmetric matrix stored in banded or packed form. Only
+// the stored triangle of A is updated, one column at a time via axpyv.
+// Each thread is assigned a contiguous range of columns; for packed
+// matrices, the ranges are weighted so that each thread updates roughly
+// the same number of elements.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC2(ch,varname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt     = PASTEMAC(ch,type); \
+\
+	l2bp_params_t* params = params_v; \
+\
+	uplo_t         uploa  = params->uploa; \
+	conj_t         conjx  = params->conjx; \
+	conj_t         conjh  = params->conjh; \
+	bool_t         packed = params->packed; \
+	dim_t          m      = params->m; \
+	dim_t          k      = params->ku; \
+	ctype*         alpha  = params->alpha; \
+	ctype*         a      = params->a; \
+	inc_t          rs_a   = params->rs_a; \
+	inc_t          cs_a   = params->cs_a; \
+	ctype*         x      = params->x; \
+	inc_t          incx   = params->incx; \
+	cntx_t*        cntx   = params->cntx; \
+\
+	ctype*         a_j; \
+	ctype*         chi1; \
+	ctype          alpha_chi1; \
+	dim_t          j_start, j_end; \
+	dim_t          i_beg, i_lim; \
+	dim_t          j; \
+	conj_t         conj1; \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av; \
+\
+	/* Query the context for the kernel function pointer. */ \
+	kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+	/* The element of x that scales each column is conjugated only for
+	   Hermitian matrices. */ \
+	conj1 = bli_apply_conj( conjh, conjx ); \
+\
+	/* Eliminate unused variable warnings. */ \
+	( void )conj1; \
+\
+	/* Determine the columns for which the current thread is responsible. */ \
+	if ( packed ) \
+		bli_thread_get_range_weighted_sub( thread, 0, uploa, m, m, 1, FALSE, \
+		                                   &j_start, &j_end ); \
+	else \
+		bli_thread_get_range_sub( thread, m, 1, FALSE, &j_start, &j_end ); \
+\
+	for ( j = j_start; j < j_end; ++j ) \
+	{ \
+		a_j  = a + bli_l2bp_col_offset( packed, uploa, m, k, j, rs_a, cs_a ); \
+		chi1 = x + j*incx; \
+\
+		/* Identify the stored portion of the column (including the
+		   diagonal). */ \
+		if ( bli_is_upper( uploa ) ) { i_beg = bli_max( 0, j - k ); i_lim = j + 1; } \
+		else                         { i_beg = j; i_lim = bli_min( m, j + k + 1 ); } \
+\
+		/* alpha_chi1 = alpha * conj1( chi1 ); */ \
+		PASTEMAC(ch,copycjs)( conj1, *chi1, alpha_chi1 ); \
+		PASTEMAC(ch,scals)( *alpha, alpha_chi1 ); \
+\
+		/* a(i_beg:i_lim-1,j) += alpha_chi1 * conjx( x(i_beg:i_lim-1) ); */ \
+		kfp_av \
+		( \
+		  conjx, \
+		  i_lim - i_beg, \
+		  &alpha_chi1, \
+		  x + i_beg*incx, incx, \
+		  a_j + i_beg*rs_a, rs_a, \
+		  cntx  \
+		); \
+\
+		/* For Hermitian matrices, explicitly set the imaginary component
+		   of the diagonal element to zero. */ \
+		if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( *(a_j + j*rs_a) ); \
+	} \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjh, \
+       bool_t  packed, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	l2bp_params_t params; \
+	dim_t         n_threads; \
+\
+	params.uploa  = uploa; \
+	params.conjx  = conjx; \
+	params.conjh  = conjh; \
+	params.packed = packed; \
+	params.m      = m; \
+	params.ku     = k; \
+	params.alpha  = alpha; \
+	params.a      = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.x      = x; params.incx = incx; \
+	params.cntx   = cntx; \
+\
+	/* Only parallelize when each thread has enough of the stored triangle
+	   to amortize the cost of spawning threads. */ \
+	n_threads = bli_thread_calc_num_threads_for_work \
+	( \
+	  ( siz_t )m * ( siz_t )( k + 1 ), \
+	  BLIS_DEFAULT_L2_MIN_WORK_PER_THREAD, \
+	  rntm  \
+	); \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,varname,_thr), &params ); \
+}
+
+INSERT_GENTFUNC_BASIC0( her_bp_var1 )
+
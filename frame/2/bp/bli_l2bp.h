@@ -0,0 +1,92 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Level-2 operations on banded and packed matrices.
+//
+// Banded matrices are stored as in the BLAS, except that arbitrary row and
+// column strides are permitted: element (i,j) of an m x n matrix with kl
+// sub-diagonals and ku super-diagonals resides at
+//
+//   a[ (ku+i-j)*rs_a + j*cs_a ]
+//
+// for max(0,j-ku) <= i <= min(m-1,j+kl). (For the upper triangular and
+// Hermitian/symmetric operations, kl = 0 and ku = k when uplo is upper, and
+// kl = k and ku = 0 when uplo is lower.) An important consequence of this
+// layout is that the band is itself a strided matrix: element (i,j) also
+// resides at (a + ku*rs_a)[ i*rs_a + j*(cs_a-rs_a) ], which allows the
+// interior of the band to be processed directly by level-1f kernels.
+//
+// Packed matrices are stored by columns, as in the BLAS, with no gaps
+// between the stored portions of adjacent columns.
+//
+
+// Prototype typed APIs (expert and non-expert).
+#include "bli_tapi_ex.h"
+#include "bli_l2bp_tapi.h"
+
+#include "bli_tapi_ba.h"
+#include "bli_l2bp_tapi.h"
+
+// Prototype the internal variants.
+#include "bli_l2bp_var.h"
+
+
+// Return the offset, in units of elements, of the (possibly unstored)
+// element (0,j) of an m x m banded (packed == FALSE) or packed
+// (packed == TRUE) matrix, such that element (i,j) resides at this offset
+// plus i*rs_a. For packed matrices, rs_a is always 1 and cs_a is ignored.
+
+static inc_t bli_l2bp_col_offset
+     (
+       bool_t packed,
+       uplo_t uplo,
+       dim_t  m,
+       dim_t  k,
+       dim_t  j,
+       inc_t  rs_a,
+       inc_t  cs_a
+     )
+{
+	if ( packed )
+	{
+		if ( bli_is_upper( uplo ) ) return ( j * ( j + 1 ) ) / 2;
+		else                        return ( j * ( 2*m - j - 1 ) ) / 2;
+	}
+	else
+	{
+		if ( bli_is_upper( uplo ) ) return k*rs_a + j*( cs_a - rs_a );
+		else                        return          j*( cs_a - rs_a );
+	}
+}
@@ -0,0 +1,555 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Guard the function definitions so that they are only compiled when
+// #included from files that define the typed API macros.
+#ifdef BLIS_ENABLE_TAPI
+
+//
+// Define BLAS-like interfaces with typed operands.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, rvarname, cvarname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	dim_t m_y, n_x; \
+\
+	/* Determine the dimensions of y and x. */ \
+	bli_set_dims_with_trans( transa, m, n, &m_y, &n_x ); \
+\
+	/* If y has zero elements, return early. */ \
+	if ( bli_zero_dim1( m_y ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( n_x ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m_y, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	/* Declare a void function pointer for the current operation. */ \
+	PASTECH2(ch,opname,_bp_ft) f; \
+\
+	/* Choose the underlying implementation. Since the band is addressed
+	   as a dense matrix with the same row stride as A, the choice mirrors
+	   that of gemv. */ \
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,rvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,cvarname); \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,cvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,rvarname); \
+	} \
+\
+	/* Invoke the variant chosen above, which loops over a level-1v or
+	   level-1f kernel to implement the current operation. */ \
+	f \
+	( \
+	  transa, \
+	  conjx, \
+	  m, \
+	  n, \
+	  kl, \
+	  ku, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC2( gbmv, gbmv_bp_var1, gbmv_bp_var2 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTEMAC(ch,varname) \
+	( \
+	  uploa, \
+	  conja, \
+	  conjx, \
+	  conjh, /* used by the variant to distinguish hbmv from sbmv */ \
+	  FALSE, \
+	  m, \
+	  k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC2( hbmv, BLIS_CONJUGATE,    hemv_bp_var1 )
+INSERT_GENTFUNC_BASIC2( sbmv, BLIS_NO_CONJUGATE, hemv_bp_var1 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTEMAC(ch,varname) \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  FALSE, \
+	  m, \
+	  k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tbmv, trmv_bp_var1 )
+INSERT_GENTFUNC_BASIC( tbsv, trsv_bp_var1 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  ap, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	/* A packed matrix is treated as a banded matrix with m-1 off-diagonals
+	   and unit row stride (see bli_l2bp_col_offset()). */ \
+	PASTEMAC(ch,varname) \
+	( \
+	  uploa, \
+	  conja, \
+	  conjx, \
+	  conjh, /* used by the variant to distinguish hpmv from spmv */ \
+	  TRUE, \
+	  m, \
+	  m - 1, \
+	  alpha, \
+	  ap, 1, m, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC2( hpmv, BLIS_CONJUGATE,    hemv_bp_var1 )
+INSERT_GENTFUNC_BASIC2( spmv, BLIS_NO_CONJUGATE, hemv_bp_var1 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  ap, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTEMAC(ch,varname) \
+	( \
+	  uploa, \
+	  transa, \
+	  diaga, \
+	  TRUE, \
+	  m, \
+	  m - 1, \
+	  alpha, \
+	  ap, 1, m, \
+	  x, incx, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tpmv, trmv_bp_var1 )
+INSERT_GENTFUNC_BASIC( tpsv, trsv_bp_var1 )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, conjh, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t   uploa, \
+       conj_t   conjx, \
+       dim_t    m, \
+       ctype_r* alpha, \
+       ctype*   x, inc_t incx, \
+       ctype*   ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	ctype alpha_local; \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(chr,eq0)( *alpha ) ) return; \
+\
+	/* Make a local copy of alpha, cast into the complex domain. */ \
+	PASTEMAC2(chr,ch,copys)( *alpha, alpha_local ); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTEMAC(ch,varname) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjh, /* used by the variant to distinguish hpr from spr */ \
+	  TRUE, \
+	  m, \
+	  m - 1, \
+	  &alpha_local, \
+	  x, incx, \
+	  ap, 1, m, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC2( hpr, BLIS_CONJUGATE, her_bp_var1 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t   uploa, \
+       conj_t   conjx, \
+       dim_t    m, \
+       ctype*   alpha, \
+       ctype*   x, inc_t incx, \
+       ctype*   ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTEMAC(ch,varname) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjh, /* used by the variant to distinguish hpr from spr */ \
+	  TRUE, \
+	  m, \
+	  m - 1, \
+	  alpha, \
+	  x, incx, \
+	  ap, 1, m, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC2( spr, BLIS_NO_CONJUGATE, her_bp_var1 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjh, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Initialize a local runtime with global settings if necessary. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTEMAC(ch,varname) \
+	( \
+	  uploa, \
+	  conjx, \
+	  conjy, \
+	  conjh, /* used by the variant to distinguish hpr2 from spr2 */ \
+	  TRUE, \
+	  m, \
+	  m - 1, \
+	  alpha, \
+	  x, incx, \
+	  y, incy, \
+	  ap, 1, m, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC2( hpr2, BLIS_CONJUGATE,    her2_bp_var1 )
+INSERT_GENTFUNC_BASIC2( spr2, BLIS_NO_CONJUGATE, her2_bp_var1 )
+
+
+#endif
+
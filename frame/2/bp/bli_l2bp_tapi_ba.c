@@ -32,20 +32,15 @@
 
 */
 
+#include "blis.h"
+
+// Include cpp macros that instantiate the API definition templates as
+// omitting expert parameters.
+#include "bli_tapi_ba.h"
+
+// Define the macro protecting the typed API definitions.
+#define BLIS_ENABLE_TAPI
+
+// Include the typed API definitions here.
+#include "bli_l2bp_tapi.c"
 
-//
-// Prototype CBLAS subroutine wrapper interfaces.
-//
-#undef  GENTPROT
-#define GENTPROT( ftype_x, chx, blasname ) \
-\
-void PASTEF773(i,chx,blasname,sub) \
-     ( \
-       const f77_int* n, \
-       const ftype_x* x, const f77_int* incx, \
-             f77_int* rval  \
-     );
-
-#ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTPROT_BLAS( amax )
-#endif
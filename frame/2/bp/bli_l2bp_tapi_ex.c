@@ -32,20 +32,15 @@
 
 */
 
+#include "blis.h"
+
+// Include cpp macros that instantiate the API definition templates as
+// having expert parameters.
+#include "bli_tapi_ex.h"
+
+// Define the macro protecting the typed API definitions.
+#define BLIS_ENABLE_TAPI
+
+// Include the typed API definitions here.
+#include "bli_l2bp_tapi.c"
 
-//
-// Prototype CBLAS subroutine wrapper interfaces.
-//
-#undef  GENTPROTR2
-#define GENTPROTR2( ftype_x, ftype_r, chx, chr, blasname ) \
-\
-void PASTEF773(chr,chx,blasname,sub) \
-     ( \
-       const f77_int* n, \
-       const ftype_x* x, const f77_int* incx, \
-             ftype_r* rval  \
-     );
-
-#ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTPROTR2_BLAS( asum )
-#endif
@@ -0,0 +1,162 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This variant solves transa(A) * x = alpha * b for x, where A is a
+// triangular matrix stored in banded or packed form and b is initially
+// stored in x. Each column of the stored triangle is applied either as an
+// axpyv (when A is not transposed) or as a dotxv (when A is transposed),
+// with the columns visited in the order dictated by forward or backward
+// substitution. Since every column depends on the preceding ones, this
+// variant is not parallelized.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       bool_t  packed, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	ctype*  one       = PASTEMAC(ch,1); \
+	ctype*  minus_one = PASTEMAC(ch,m1); \
+	ctype*  a_j; \
+	ctype*  chi1; \
+	ctype   alpha11; \
+	ctype   minus_chi1; \
+	dim_t   i_beg, i_lim; \
+	dim_t   j, jt; \
+	bool_t  fwd; \
+	conj_t  conja; \
+\
+	PASTECH(ch,scalv_ker_ft) kfp_sv; \
+	PASTECH(ch,axpyv_ker_ft) kfp_av; \
+	PASTECH(ch,dotxv_ker_ft) kfp_dv; \
+\
+	/* Query the context for the kernel function pointers. */ \
+	kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+	kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	conja = bli_extract_conj( transa ); \
+\
+	/* x = alpha * x; */ \
+	kfp_sv \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  alpha, \
+	  x, incx, \
+	  cntx  \
+	); \
+\
+	/* We use forward substitution when transa(A) is lower triangular and
+	   backward substitution when it is upper triangular. */ \
+	fwd = ( bli_is_upper( uploa ) != bli_does_notrans( transa ) ); \
+\
+	for ( jt = 0; jt < m; ++jt ) \
+	{ \
+		j    = ( fwd ? jt : m - jt - 1 ); \
+		a_j  = a + bli_l2bp_col_offset( packed, uploa, m, k, j, rs_a, cs_a ); \
+		chi1 = x + j*incx; \
+\
+		/* Identify the off-diagonal portion of the stored column. */ \
+		if ( bli_is_upper( uploa ) ) { i_beg = bli_max( 0, j - k ); i_lim = j; } \
+		else                         { i_beg = j + 1; i_lim = bli_min( m, j + k + 1 ); } \
+\
+		if ( bli_does_trans( transa ) ) \
+		{ \
+			/* chi1 -= conja( a(i_beg:i_lim-1,j) )^T * x(i_beg:i_lim-1); */ \
+			if ( i_beg < i_lim ) \
+			{ \
+				kfp_dv \
+				( \
+				  conja, \
+				  BLIS_NO_CONJUGATE, \
+				  i_lim - i_beg, \
+				  minus_one, \
+				  a_j + i_beg*rs_a, rs_a, \
+				  x + i_beg*incx, incx, \
+				  one, \
+				  chi1, \
+				  cntx  \
+				); \
+			} \
+		} \
+\
+		/* chi1 = chi1 / conja( a(j,j) ); */ \
+		if ( bli_is_nonunit_diag( diaga ) ) \
+		{ \
+			PASTEMAC(ch,copycjs)( conja, *(a_j + j*rs_a), alpha11 ); \
+			PASTEMAC(ch,invscals)( alpha11, *chi1 ); \
+		} \
+\
+		if ( bli_does_notrans( transa ) ) \
+		{ \
+			/* x(i_beg:i_lim-1) -= chi1 * conja( a(i_beg:i_lim-1,j) ); */ \
+			if ( i_beg < i_lim ) \
+			{ \
+				PASTEMAC(ch,neg2s)( *chi1, minus_chi1 ); \
+\
+				kfp_av \
+				( \
+				  conja, \
+				  i_lim - i_beg, \
+				  &minus_chi1, \
+				  a_j + i_beg*rs_a, rs_a, \
+				  x + i_beg*incx, incx, \
+				  cntx  \
+				); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( trsv_bp_var1 )
+
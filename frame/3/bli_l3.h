@@ -60,6 +60,9 @@
 #include "bli_tapi_ba.h"
 #include "bli_l3_tapi.h"
 
+// Prototype asynchronous (non-blocking) APIs.
+#include "bli_l3_async.h"
+
 // Prototype microkernel wrapper APIs
 #include "bli_l3_ukr_oapi.h"
 #include "bli_l3_ukr_tapi.h"
@@ -0,0 +1,216 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Define asynchronous object-based interfaces. Each operation has an exec
+// function, which the worker thread calls with the request, and a front
+// end, which saves the operands in a new request and submits it.
+//
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+static void PASTEMAC(opname,_async_exec)( async_t* req ) \
+{ \
+	PASTEMAC(opname,_ex)( &req->obj[0], &req->obj[1], &req->obj[2], \
+	                      &req->obj[3], &req->obj[4], \
+	                      req->cntx, &req->rntm ); \
+} \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      b, \
+       obj_t*      beta, \
+       obj_t*      c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	async_t* req = bli_async_create( PASTEMAC(opname,_async_exec), \
+	                                 cntx, rntm, cb, cb_data ); \
+\
+	bli_async_save_scalar( alpha, &req->obj[0] ); \
+	bli_async_save_obj( a,        &req->obj[1] ); \
+	bli_async_save_obj( b,        &req->obj[2] ); \
+	bli_async_save_scalar( beta,  &req->obj[3] ); \
+	bli_async_save_obj( c,        &req->obj[4] ); \
+\
+	bli_async_submit( req ); \
+\
+	return req; \
+}
+
+GENFRONT( gemm )
+GENFRONT( her2k )
+GENFRONT( syr2k )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+static void PASTEMAC(opname,_async_exec)( async_t* req ) \
+{ \
+	PASTEMAC(opname,_ex)( req->side, \
+	                      &req->obj[0], &req->obj[1], &req->obj[2], \
+	                      &req->obj[3], &req->obj[4], \
+	                      req->cntx, &req->rntm ); \
+} \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       side_t      side, \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      b, \
+       obj_t*      beta, \
+       obj_t*      c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	async_t* req = bli_async_create( PASTEMAC(opname,_async_exec), \
+	                                 cntx, rntm, cb, cb_data ); \
+\
+	req->side = side; \
+\
+	bli_async_save_scalar( alpha, &req->obj[0] ); \
+	bli_async_save_obj( a,        &req->obj[1] ); \
+	bli_async_save_obj( b,        &req->obj[2] ); \
+	bli_async_save_scalar( beta,  &req->obj[3] ); \
+	bli_async_save_obj( c,        &req->obj[4] ); \
+\
+	bli_async_submit( req ); \
+\
+	return req; \
+}
+
+GENFRONT( hemm )
+GENFRONT( symm )
+GENFRONT( trmm3 )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+static void PASTEMAC(opname,_async_exec)( async_t* req ) \
+{ \
+	PASTEMAC(opname,_ex)( &req->obj[0], &req->obj[1], \
+	                      &req->obj[2], &req->obj[3], \
+	                      req->cntx, &req->rntm ); \
+} \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      beta, \
+       obj_t*      c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	async_t* req = bli_async_create( PASTEMAC(opname,_async_exec), \
+	                                 cntx, rntm, cb, cb_data ); \
+\
+	bli_async_save_scalar( alpha, &req->obj[0] ); \
+	bli_async_save_obj( a,        &req->obj[1] ); \
+	bli_async_save_scalar( beta,  &req->obj[2] ); \
+	bli_async_save_obj( c,        &req->obj[3] ); \
+\
+	bli_async_submit( req ); \
+\
+	return req; \
+}
+
+GENFRONT( herk )
+GENFRONT( syrk )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+static void PASTEMAC(opname,_async_exec)( async_t* req ) \
+{ \
+	PASTEMAC(opname,_ex)( req->side, \
+	                      &req->obj[0], &req->obj[1], &req->obj[2], \
+	                      req->cntx, &req->rntm ); \
+} \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       side_t      side, \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      b, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	async_t* req = bli_async_create( PASTEMAC(opname,_async_exec), \
+	                                 cntx, rntm, cb, cb_data ); \
+\
+	req->side = side; \
+\
+	bli_async_save_scalar( alpha, &req->obj[0] ); \
+	bli_async_save_obj( a,        &req->obj[1] ); \
+	bli_async_save_obj( b,        &req->obj[2] ); \
+\
+	bli_async_submit( req ); \
+\
+	return req; \
+}
+
+GENFRONT( trmm )
+GENFRONT( trsm )
+
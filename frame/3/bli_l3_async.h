@@ -0,0 +1,122 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Prototype asynchronous object-based interfaces. Each function submits
+// the operation to the async worker threads and returns a handle that may
+// be passed to bli_async_test(), bli_async_wait(), and bli_async_free().
+// If cb is not NULL, it is called (by the worker thread) with the handle
+// and cb_data once the operation has completed.
+//
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      b, \
+       obj_t*      beta, \
+       obj_t*      c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     );
+
+GENPROT( gemm )
+GENPROT( her2k )
+GENPROT( syr2k )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       side_t      side, \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      b, \
+       obj_t*      beta, \
+       obj_t*      c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     );
+
+GENPROT( hemm )
+GENPROT( symm )
+GENPROT( trmm3 )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      beta, \
+       obj_t*      c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     );
+
+GENPROT( herk )
+GENPROT( syrk )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+async_t* PASTEMAC(opname,_async) \
+     ( \
+       side_t      side, \
+       obj_t*      alpha, \
+       obj_t*      a, \
+       obj_t*      b, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       async_cb_ft cb, \
+       void*       cb_data \
+     );
+
+GENPROT( trmm )
+GENPROT( trsm )
+
@@ -49,6 +49,10 @@ void bli_l3_packm
 	mem_t*    cntl_mem_p;
 	siz_t     size_needed;
 
+	BLIS_PROF_DECL( t0 );
+
+	BLIS_PROF_START( t0 );
+
 	// FGVZ: Not sure why we need this barrier, but we do.
 	bli_thread_obarrier( thread );
 
@@ -67,7 +71,11 @@ void bli_l3_packm
 
 	// If zero was returned, no memory needs to be allocated and so we can
 	// return early.
-	if ( size_needed == 0 ) return;
+	if ( size_needed == 0 )
+	{
+		BLIS_PROF_STOP( bli_prof_packm_kind( cntl ), t0 );
+		return;
+	}
 
 	// Query the memory broker from the context.
 	membrk = bli_cntx_get_membrk( cntx );
@@ -178,5 +186,7 @@ void bli_l3_packm
 
 	// Barrier so that packing is done before computation.
 	bli_thread_obarrier( thread );
+
+	BLIS_PROF_STOP( bli_prof_packm_kind( cntl ), t0 );
 }
 
@@ -81,6 +81,36 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 \
 	bli_obj_set_conjtrans( transa, &ao ); \
 	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	/* Check the parameters of problems that the tiny gemm path below may
+	   compute, since it does not perform any checking of its own. Larger
+	   problems are checked by the object API. (cntx itself is left
+	   untouched so that the object API may still choose an induced
+	   method.) */ \
+	if ( bli_error_checking_is_enabled() && \
+	     m <= BLIS_TINY_GEMM_MAX_DIM && \
+	     n <= BLIS_TINY_GEMM_MAX_DIM && \
+	     k <= BLIS_TINY_GEMM_MAX_DIM ) \
+	{ \
+		cntx_t* cntx_chk = ( cntx != NULL ? cntx : bli_gks_query_cntx() ); \
+\
+		PASTEMAC(opname,_check)( &alphao, &ao, &bo, &betao, &co, cntx_chk ); \
+	} \
+\
+	/* For sufficiently small problems, skip the object-based framework
+	   (and threading) entirely. */ \
+	if ( PASTEMAC(ch,gemm_tiny) \
+	     ( \
+	       transa, \
+	       transb, \
+	       m, n, k, \
+	       alpha, \
+	       a, rs_a, cs_a, \
+	       b, rs_b, cs_b, \
+	       beta, \
+	       c, rs_c, cs_c, \
+	       cntx  \
+	     ) == BLIS_SUCCESS ) return; \
 \
 	PASTEMAC(opname,BLIS_OAPI_EX_SUF) \
 	( \
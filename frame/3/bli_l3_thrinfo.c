@@ -133,6 +133,9 @@ void bli_l3_thrinfo_create_root
 	// Use the thread id passed in as the global communicator id.
 	dim_t   gl_comm_id = id;
 
+	// Record the thread id for the level-3 profiler, if enabled.
+	BLIS_PROF_SET_THREAD_ID( id );
+
 	// Use the blocksize id of the current (root) control tree node to
 	// query the top-most ways of parallelism to obtain.
 	bszid_t bszid      = bli_cntl_bszid( cntl );
@@ -35,6 +35,8 @@
 #include "bli_gemm_cntl.h"
 #include "bli_gemm_front.h"
 #include "bli_gemm_int.h"
+#include "bli_gemm_tiny.h"
+#include "bli_gemm_ooc.h"
 
 #include "bli_gemm_var.h"
 
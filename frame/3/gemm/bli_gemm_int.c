@@ -52,6 +52,8 @@ void bli_gemm_int
 	obj_t        c_local;
 	gemm_var_oft f;
 
+	BLIS_PROF_NODE_DECL( prof_node );
+
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
 		bli_gemm_basic_check( alpha, a, b, beta, c, cntx );
@@ -118,6 +120,11 @@ void bli_gemm_int
 		}
 	}
 
+	// Enter the current control tree node for the purposes of profiling.
+	// This tracks the partitioning loop being executed and times the
+	// macro-kernel.
+	BLIS_PROF_NODE_ENTER( prof_node, cntl );
+
 	// Invoke the variant.
 	f
 	(
@@ -129,5 +136,7 @@ void bli_gemm_int
 	  cntl,
       thread
 	);
+
+	BLIS_PROF_NODE_EXIT( prof_node, cntl );
 }
 
@@ -0,0 +1,418 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#if !BLIS_OS_WINDOWS
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+// The out-of-core gemm driver partitions C into mt x nt tiles, and the k
+// dimension into kt-wide slices, where mt, nt, and kt are multiples of MC,
+// NC, and KC, respectively. Each step of the computation multiplies one
+// mt x kt tile of A by one kt x nt tile of B into one tile of C, all of
+// which are copied into in-core tile buffers. While the caller's thread
+// computes one step, a second (I/O) thread copies the tiles of A and B for
+// the next step into a second set of buffers, and writes back completed
+// tiles of C. When the operands are mapped from files (for example, via
+// bli_obj_create_with_file()), those copies are where the file is read and
+// written, so the I/O overlaps with the computation.
+
+typedef struct
+{
+	obj_t           a;
+	obj_t           b;
+	obj_t           c;
+
+	dim_t           mt, nt, kt;
+	dim_t           n_mt, n_kt;
+	dim_t           n_steps;
+	bool_t          load_c;
+
+	obj_t           at[2];
+	obj_t           bt[2];
+	obj_t           ct[2];
+
+	cntx_t*         cntx;
+	rntm_t          rntm_io;
+
+	// The number of steps whose tiles have been loaded, and the number of
+	// steps that have been computed.
+	dim_t           loaded;
+	dim_t           computed;
+
+	pthread_mutex_t mutex;
+	pthread_cond_t  cond;
+} gemm_ooc_t;
+
+// -----------------------------------------------------------------------------
+
+// Find the offsets and dimensions of the tiles used in step s.
+
+static void bli_gemm_ooc_step
+     (
+       gemm_ooc_t* ooc,
+       dim_t       s,
+       dim_t*      i,
+       dim_t*      j,
+       dim_t*      p,
+       dim_t*      mi,
+       dim_t*      nj,
+       dim_t*      kp
+     )
+{
+	dim_t ct = s / ooc->n_kt;
+
+	// The tiles of C are visited in column-major order, so that each tile
+	// of B is reused (from the page cache) by consecutive tiles of C.
+	*i  = ( ct % ooc->n_mt ) * ooc->mt;
+	*j  = ( ct / ooc->n_mt ) * ooc->nt;
+	*p  = ( s  % ooc->n_kt ) * ooc->kt;
+	*mi = bli_min( ooc->mt, bli_obj_length( &ooc->c ) - *i );
+	*nj = bli_min( ooc->nt, bli_obj_width( &ooc->c ) - *j );
+	*kp = bli_min( ooc->kt, bli_obj_width( &ooc->a ) - *p );
+}
+
+// Alias the leading m x n part of a tile buffer.
+
+static void bli_gemm_ooc_tile( dim_t m, dim_t n, obj_t* buf, obj_t* tile )
+{
+	bli_acquire_mpart( 0, 0, m, n, buf, tile );
+}
+
+// Ask the operating system to start reading the pages of a submatrix, so
+// that the copy that follows does not fault them in one at a time. This
+// has no effect on memory that is already resident.
+
+static void bli_gemm_ooc_prefetch( obj_t* x )
+{
+#if !BLIS_OS_WINDOWS
+	siz_t page_size = ( siz_t )sysconf( _SC_PAGESIZE );
+	siz_t es        = bli_obj_elem_size( x );
+	char* p         = bli_obj_buffer_at_off( x );
+	dim_t m         = bli_obj_length( x );
+	dim_t n         = bli_obj_width( x );
+	inc_t rs        = bli_obj_row_stride( x );
+	inc_t cs        = bli_obj_col_stride( x );
+	dim_t n_vec, len;
+	inc_t inc, ld;
+	dim_t v;
+
+	if ( m == 0 || n == 0 || rs < 0 || cs < 0 ) return;
+
+	// Walk the submatrix one column (or row) at a time, whichever is
+	// contiguous in memory.
+	if ( rs <= cs ) { n_vec = n; len = m; inc = rs; ld = cs; }
+	else            { n_vec = m; len = n; inc = cs; ld = rs; }
+
+	// If the vectors are adjacent, one range covers all of them.
+	if ( inc == 1 && ld == len ) { len *= n_vec; n_vec = 1; }
+
+	for ( v = 0; v < n_vec; ++v )
+	{
+		char* p_vec = p + v * ld * es;
+		siz_t delta = ( siz_t )( uintptr_t )p_vec % page_size;
+		siz_t size  = ( ( len - 1 ) * inc + 1 ) * es;
+
+		posix_madvise( p_vec - delta, size + delta, POSIX_MADV_WILLNEED );
+	}
+#endif
+}
+
+static void bli_gemm_ooc_copy( gemm_ooc_t* ooc, obj_t* x, obj_t* y )
+{
+	bli_gemm_ooc_prefetch( x );
+
+	bli_copym_ex( x, y, ooc->cntx, &ooc->rntm_io );
+}
+
+// Wait until at least n steps have been computed.
+
+static void bli_gemm_ooc_wait_computed( gemm_ooc_t* ooc, dim_t n )
+{
+	pthread_mutex_lock( &ooc->mutex );
+
+	while ( ooc->computed < n )
+		pthread_cond_wait( &ooc->cond, &ooc->mutex );
+
+	pthread_mutex_unlock( &ooc->mutex );
+}
+
+// Write back tile ct of C, once all of its steps have been computed.
+
+static void bli_gemm_ooc_store_c( gemm_ooc_t* ooc, dim_t ct )
+{
+	dim_t i, j, p, mi, nj, kp;
+	obj_t c1, ct1;
+
+	bli_gemm_ooc_wait_computed( ooc, ( ct + 1 ) * ooc->n_kt );
+
+	bli_gemm_ooc_step( ooc, ct * ooc->n_kt, &i, &j, &p, &mi, &nj, &kp );
+
+	bli_acquire_mpart( i, j, mi, nj, &ooc->c, &c1 );
+	bli_gemm_ooc_tile( mi, nj, &ooc->ct[ ct % 2 ], &ct1 );
+
+	bli_gemm_ooc_copy( ooc, &ct1, &c1 );
+}
+
+static void* bli_gemm_ooc_io( void* arg )
+{
+	gemm_ooc_t* ooc  = arg;
+	dim_t       n_ct = ooc->n_steps / ooc->n_kt;
+	dim_t       s, ct;
+
+	for ( s = 0; s < ooc->n_steps; ++s )
+	{
+		dim_t i, j, p, mi, nj, kp;
+		obj_t a1, b1, c1, at1, bt1, ct1;
+
+		bli_gemm_ooc_step( ooc, s, &i, &j, &p, &mi, &nj, &kp );
+
+		ct = s / ooc->n_kt;
+
+		if ( p == 0 )
+		{
+			// Before reusing the buffer of the tile of C from two tiles
+			// ago, write that tile back.
+			if ( ct >= 2 ) bli_gemm_ooc_store_c( ooc, ct - 2 );
+
+			if ( ooc->load_c )
+			{
+				bli_acquire_mpart( i, j, mi, nj, &ooc->c, &c1 );
+				bli_gemm_ooc_tile( mi, nj, &ooc->ct[ ct % 2 ], &ct1 );
+
+				bli_gemm_ooc_copy( ooc, &c1, &ct1 );
+			}
+		}
+
+		// Wait until the step that last used these buffers has been
+		// computed.
+		bli_gemm_ooc_wait_computed( ooc, s - 1 );
+
+		bli_acquire_mpart( i, p, mi, kp, &ooc->a, &a1 );
+		bli_acquire_mpart( p, j, kp, nj, &ooc->b, &b1 );
+		bli_gemm_ooc_tile( mi, kp, &ooc->at[ s % 2 ], &at1 );
+		bli_gemm_ooc_tile( kp, nj, &ooc->bt[ s % 2 ], &bt1 );
+
+		bli_gemm_ooc_copy( ooc, &a1, &at1 );
+		bli_gemm_ooc_copy( ooc, &b1, &bt1 );
+
+		pthread_mutex_lock( &ooc->mutex );
+		ooc->loaded = s + 1;
+		pthread_cond_broadcast( &ooc->cond );
+		pthread_mutex_unlock( &ooc->mutex );
+	}
+
+	// Write back the tiles of C that remain.
+	for ( ct = bli_max( n_ct - 2, 0 ); ct < n_ct; ++ct )
+		bli_gemm_ooc_store_c( ooc, ct );
+
+	return NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_ooc
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     )
+{
+	bli_gemm_ooc_ex( alpha, a, b, beta, c, 0, NULL, NULL );
+}
+
+void bli_gemm_ooc_ex
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       siz_t   max_mem,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	gemm_ooc_t ooc;
+	pthread_t  io_thread;
+	num_t      dt;
+	siz_t      es;
+	dim_t      m, n, k;
+	dim_t      mc, nc;
+	dim_t      mt, nt, kt;
+	dim_t      s, i;
+
+	bli_init_once();
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+	if ( max_mem == 0 ) max_mem = BLIS_GEMM_OOC_MAX_MEM;
+
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+	// If C has a transposition, compute C^T = B^T A^T instead, so that the
+	// tiles of C can be written back without one.
+	ooc.a = *a;
+	ooc.b = *b;
+	ooc.c = *c;
+
+	if ( bli_obj_has_trans( &ooc.c ) )
+	{
+		bli_obj_swap( &ooc.a, &ooc.b );
+		bli_obj_toggle_trans( &ooc.a );
+		bli_obj_toggle_trans( &ooc.b );
+		bli_obj_toggle_trans( &ooc.c );
+	}
+
+	// Induce any transposition of A and B into their dimensions and strides
+	// so that their tiles can be located with bli_acquire_mpart(). The
+	// copies into the tile buffers still apply any conjugation.
+	if ( bli_obj_has_trans( &ooc.a ) )
+	{
+		bli_obj_induce_trans( &ooc.a );
+		bli_obj_toggle_trans( &ooc.a );
+	}
+	if ( bli_obj_has_trans( &ooc.b ) )
+	{
+		bli_obj_induce_trans( &ooc.b );
+		bli_obj_toggle_trans( &ooc.b );
+	}
+
+	m = bli_obj_length( &ooc.c );
+	n = bli_obj_width( &ooc.c );
+	k = bli_obj_width( &ooc.a );
+
+	if ( m == 0 || n == 0 ) return;
+
+	if ( k == 0 || bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_scalm_ex( beta, &ooc.c, cntx, rntm );
+		return;
+	}
+
+	dt = bli_obj_dt( &ooc.c );
+	es = bli_obj_elem_size( &ooc.c );
+	mc = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	nc = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	kt = bli_min( k, bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ) );
+
+	// Start with tiles that cover all of C, and halve the larger of their
+	// dimensions until the (double-buffered) tiles of A, B, and C fit in
+	// max_mem, or cannot shrink below MC x NC. Larger tiles of C mean that
+	// A and B are read fewer times.
+	mt = m;
+	nt = n;
+
+	while ( es * ( 2 * mt * nt + 2 * kt * ( mt + nt ) ) > max_mem )
+	{
+		if      ( mt >= nt && mt > mc ) mt = bli_align_dim_to_mult( ( mt + 1 ) / 2, mc );
+		else if ( nt > nc )             nt = bli_align_dim_to_mult( ( nt + 1 ) / 2, nc );
+		else if ( mt > mc )             mt = bli_align_dim_to_mult( ( mt + 1 ) / 2, mc );
+		else break;
+	}
+
+	ooc.mt      = mt;
+	ooc.nt      = nt;
+	ooc.kt      = kt;
+	ooc.n_mt    = ( m + mt - 1 ) / mt;
+	ooc.n_kt    = ( k + kt - 1 ) / kt;
+	ooc.n_steps = ooc.n_mt * ( ( n + nt - 1 ) / nt ) * ooc.n_kt;
+	ooc.cntx    = cntx;
+
+	// If beta is zero, C is only written, so its tiles need not be read.
+	ooc.load_c  = !bli_obj_equals( beta, &BLIS_ZERO );
+
+	ooc.loaded   = 0;
+	ooc.computed = 0;
+
+	// The I/O thread copies with a single thread so that it does not
+	// compete with the computation.
+	bli_rntm_init( &ooc.rntm_io );
+	bli_rntm_set_num_threads( 1, &ooc.rntm_io );
+
+	for ( i = 0; i < 2; ++i )
+	{
+		bli_obj_create( dt, mt, kt, 0, 0, &ooc.at[ i ] );
+		bli_obj_create( dt, kt, nt, 0, 0, &ooc.bt[ i ] );
+		bli_obj_create( dt, mt, nt, 0, 0, &ooc.ct[ i ] );
+	}
+
+	pthread_mutex_init( &ooc.mutex, NULL );
+	pthread_cond_init( &ooc.cond, NULL );
+
+	pthread_create( &io_thread, NULL, bli_gemm_ooc_io, &ooc );
+
+	for ( s = 0; s < ooc.n_steps; ++s )
+	{
+		dim_t ip, jp, p, mi, nj, kp;
+		obj_t at1, bt1, ct1;
+
+		bli_gemm_ooc_step( &ooc, s, &ip, &jp, &p, &mi, &nj, &kp );
+
+		pthread_mutex_lock( &ooc.mutex );
+		while ( ooc.loaded <= s )
+			pthread_cond_wait( &ooc.cond, &ooc.mutex );
+		pthread_mutex_unlock( &ooc.mutex );
+
+		bli_gemm_ooc_tile( mi, kp, &ooc.at[ s % 2 ], &at1 );
+		bli_gemm_ooc_tile( kp, nj, &ooc.bt[ s % 2 ], &bt1 );
+		bli_gemm_ooc_tile( mi, nj, &ooc.ct[ ( s / ooc.n_kt ) % 2 ], &ct1 );
+
+		// Beta is applied by the first step of each tile of C only.
+		bli_gemm_ex( alpha, &at1, &bt1, p == 0 ? beta : &BLIS_ONE, &ct1,
+		             cntx, rntm );
+
+		pthread_mutex_lock( &ooc.mutex );
+		ooc.computed = s + 1;
+		pthread_cond_broadcast( &ooc.cond );
+		pthread_mutex_unlock( &ooc.mutex );
+	}
+
+	pthread_join( io_thread, NULL );
+
+	pthread_cond_destroy( &ooc.cond );
+	pthread_mutex_destroy( &ooc.mutex );
+
+	for ( i = 0; i < 2; ++i )
+	{
+		bli_obj_free( &ooc.at[ i ] );
+		bli_obj_free( &ooc.bt[ i ] );
+		bli_obj_free( &ooc.ct[ i ] );
+	}
+}
+
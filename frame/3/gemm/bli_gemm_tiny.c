@@ -0,0 +1,428 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// The tiny gemm fast path. For problems in which m, n, and k are all small,
+// the cost of creating objects, building a control tree, partitioning for
+// threads, and checking out packing blocks from the memory broker is on
+// the order of (or larger than) the flops themselves. This function
+// computes such problems directly: it packs op(A) and op(B) into
+// micro-panels within a buffer on the stack and then calls the native gemm
+// micro-kernel over the resulting MR x NR tiles, single-threaded.
+//
+// If the problem is not eligible, BLIS_FAILURE is returned without
+// touching C, and the caller should proceed with the conventional
+// implementation. Note that, unlike the object API, no parameter checking
+// is performed here; callers are expected to have checked the operands
+// (as bli_?gemm_ex() does when error checking is enabled).
+//
+// Eligibility is determined by a separate predicate so that the stack
+// buffers, which are sized for the largest eligible problem, are only
+// allocated (by the noinline function that computes the product) once
+// a problem is known to qualify.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static bool_t PASTEMAC(ch,opname) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype*   alpha, \
+       inc_t    rs_c, inc_t cs_c, \
+       cntx_t** cntx  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	dim_t           m_use, n_use; \
+	dim_t           m_iter, n_iter; \
+	inc_t           ps_a, ps_b; \
+	dim_t           off_a; \
+\
+	/* Only handle problems in which every dimension is nonzero and no
+	   larger than BLIS_TINY_GEMM_MAX_DIM. If alpha is zero, the operation
+	   reduces to scaling C by beta, which the conventional path handles. */ \
+	if ( m <= 0 || n <= 0 || k <= 0 ) return FALSE; \
+	if ( m > BLIS_TINY_GEMM_MAX_DIM || \
+	     n > BLIS_TINY_GEMM_MAX_DIM || \
+	     k > BLIS_TINY_GEMM_MAX_DIM ) return FALSE; \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return FALSE; \
+\
+	/* If an induced method would be used for this datatype (because the
+	   native complex micro-kernel is unoptimized, or because the method
+	   was enabled explicitly), defer to the conventional path. */ \
+	if ( bli_ind_oper_find_avail( BLIS_GEMM, dt ) != BLIS_NAT ) \
+		return FALSE; \
+\
+	if ( *cntx == NULL ) *cntx = bli_gks_query_cntx(); \
+\
+	if ( bli_cntx_method( *cntx ) != BLIS_NAT ) return FALSE; \
+\
+	const dim_t     MR         = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, *cntx ); \
+	const dim_t     NR         = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, *cntx ); \
+	const dim_t     PACKMR     = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, *cntx ); \
+	const dim_t     PACKNR     = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, *cntx ); \
+\
+	const bool_t    row_pref   = bli_cntx_l3_nat_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, *cntx ); \
+	const bool_t    col_pref   = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, *cntx ); \
+\
+	/* Determine the orientation that bli_?gemm_tiny_ker() will use
+	   (see below), and make sure that all of the micro-panels fit within
+	   its buffer. */ \
+	if ( ( bli_is_row_stored( rs_c, cs_c ) && row_pref ) || \
+	     ( bli_is_col_stored( rs_c, cs_c ) && col_pref ) ) \
+	{ m_use = m; n_use = n; } \
+	else \
+	{ m_use = n; n_use = m; } \
+\
+	m_iter = ( m_use + MR - 1 ) / MR; \
+	n_iter = ( n_use + NR - 1 ) / NR; \
+\
+	ps_a = PACKMR * k; if ( bli_is_odd( ps_a ) ) ps_a += 1; \
+	ps_b = PACKNR * k; if ( bli_is_odd( ps_b ) ) ps_b += 1; \
+\
+	off_a = bli_align_dim_to_size( n_iter * ps_b, sizeof( ctype ), \
+	                               BLIS_SIMD_ALIGN_SIZE ); \
+\
+	return ( off_a + m_iter * ps_a <= \
+	         ( dim_t )( BLIS_TINY_GEMM_BUF_SIZE / sizeof( ctype ) ) ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_tiny_is_eligible )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static __attribute__((noinline)) void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype           pbuf[ BLIS_TINY_GEMM_BUF_SIZE \
+	                      / sizeof( ctype ) ] \
+	                      __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	ctype           ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	ctype* restrict zero       = PASTEMAC(ch,0); \
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict a_p; \
+	ctype* restrict b_p; \
+	ctype* restrict a_use; \
+	ctype* restrict b_use; \
+	conj_t          conja_use, conjb_use; \
+	inc_t           rs_opa, cs_opa; \
+	inc_t           rs_opb, cs_opb; \
+	inc_t           rs_ua, cs_ua; \
+	inc_t           rs_ub, cs_ub; \
+	inc_t           rs_uc, cs_uc; \
+	dim_t           m_use, n_use; \
+	dim_t           m_iter, n_iter; \
+	dim_t           i, j; \
+	dim_t           m_cur, n_cur; \
+	inc_t           ps_a, ps_b; \
+	dim_t           off_a; \
+	auxinfo_t       aux; \
+\
+	const dim_t     MR         = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     NR         = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     PACKMR     = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     PACKNR     = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	const bool_t    row_pref   = bli_cntx_l3_nat_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const bool_t    col_pref   = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t     rs_ct      = ( col_pref ? 1 : NR ); \
+	const inc_t     cs_ct      = ( col_pref ? MR : 1 ); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemm_ukr   = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Compute the strides of op(A) (m x k) and op(B) (k x n). */ \
+	rs_opa = rs_a; cs_opa = cs_a; \
+	rs_opb = rs_b; cs_opb = cs_b; \
+\
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_opa, &cs_opa ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_opb, &cs_opb ); \
+\
+	/* As in bli_gemm_front(), if the micro-kernel dislikes the storage of
+	   C, compute C^T = op(B)^T op(A)^T instead so that the micro-kernel
+	   accesses C in its preferred manner. */ \
+	if ( ( bli_is_row_stored( rs_c, cs_c ) && row_pref ) || \
+	     ( bli_is_col_stored( rs_c, cs_c ) && col_pref ) ) \
+	{ \
+		m_use     = m;      n_use     = n; \
+		a_use     = a;      b_use     = b; \
+		rs_ua     = rs_opa; cs_ua     = cs_opa; \
+		rs_ub     = rs_opb; cs_ub     = cs_opb; \
+		rs_uc     = rs_c;   cs_uc     = cs_c; \
+		conja_use = bli_extract_conj( transa ); \
+		conjb_use = bli_extract_conj( transb ); \
+	} \
+	else \
+	{ \
+		m_use     = n;      n_use     = m; \
+		a_use     = b;      b_use     = a; \
+		rs_ua     = cs_opb; cs_ua     = rs_opb; \
+		rs_ub     = cs_opa; cs_ub     = rs_opa; \
+		rs_uc     = cs_c;   cs_uc     = rs_c; \
+		conja_use = bli_extract_conj( transb ); \
+		conjb_use = bli_extract_conj( transa ); \
+	} \
+\
+	m_iter = ( m_use + MR - 1 ) / MR; \
+	n_iter = ( n_use + NR - 1 ) / NR; \
+\
+	/* Compute the micro-panel strides the same way bli_packm_init() does.
+	   The micro-panels of B are placed first, and those of A begin at the
+	   next aligned address. (bli_?gemm_tiny_is_eligible() has
+	   already verified that all of them fit within the buffer.) */ \
+	ps_a = PACKMR * k; if ( bli_is_odd( ps_a ) ) ps_a += 1; \
+	ps_b = PACKNR * k; if ( bli_is_odd( ps_b ) ) ps_b += 1; \
+\
+	off_a = bli_align_dim_to_size( n_iter * ps_b, sizeof( ctype ), \
+	                               BLIS_SIMD_ALIGN_SIZE ); \
+\
+	b_p = pbuf; \
+	a_p = pbuf + off_a; \
+\
+	/* Pack op(B) into column micro-panels. */ \
+	for ( j = 0; j < n_iter; ++j ) \
+	{ \
+		ctype* restrict p1 = b_p + j * ps_b; \
+\
+		n_cur = bli_min( NR, n_use - j * NR ); \
+\
+		PASTEMAC(ch,packm_cxk) \
+		( \
+		  conjb_use, \
+		  n_cur, \
+		  k, \
+		  one, \
+		  b_use + j * NR * cs_ub, cs_ub, rs_ub, \
+		  p1,                             PACKNR, \
+		  cntx  \
+		); \
+\
+		/* Zero the unused rows of the micro-panel so that the micro-kernel
+		   may compute a full MR x NR tile. */ \
+		if ( n_cur != PACKNR ) \
+			PASTEMAC2(ch,setm,BLIS_TAPI_EX_SUF) \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  0, \
+			  BLIS_NONUNIT_DIAG, \
+			  BLIS_DENSE, \
+			  PACKNR - n_cur, \
+			  k, \
+			  zero, \
+			  p1 + n_cur, 1, PACKNR, \
+			  cntx, \
+			  NULL  \
+			); \
+	} \
+\
+	/* Pack op(A) into row micro-panels. */ \
+	for ( i = 0; i < m_iter; ++i ) \
+	{ \
+		ctype* restrict p1 = a_p + i * ps_a; \
+\
+		m_cur = bli_min( MR, m_use - i * MR ); \
+\
+		PASTEMAC(ch,packm_cxk) \
+		( \
+		  conja_use, \
+		  m_cur, \
+		  k, \
+		  one, \
+		  a_use + i * MR * rs_ua, rs_ua, cs_ua, \
+		  p1,                             PACKMR, \
+		  cntx  \
+		); \
+\
+		if ( m_cur != PACKMR ) \
+			PASTEMAC2(ch,setm,BLIS_TAPI_EX_SUF) \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  0, \
+			  BLIS_NONUNIT_DIAG, \
+			  BLIS_DENSE, \
+			  PACKMR - m_cur, \
+			  k, \
+			  zero, \
+			  p1 + m_cur, 1, PACKMR, \
+			  cntx, \
+			  NULL  \
+			); \
+	} \
+\
+	/* Clear the temporary C buffer in case it has any infs or NaNs. */ \
+	if ( m_use % MR != 0 || n_use % NR != 0 ) \
+		PASTEMAC(ch,set0s_mxn)( MR, NR, \
+		                        ct, rs_ct, cs_ct ); \
+\
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+	bli_auxinfo_set_is_a( 1, &aux ); \
+	bli_auxinfo_set_is_b( 1, &aux ); \
+\
+	/* Loop over the n dimension (NR columns at a time), and then over the
+	   m dimension (MR rows at a time), as in bli_gemm_ker_var2(). */ \
+	for ( j = 0; j < n_iter; ++j ) \
+	{ \
+		ctype* restrict b1 = b_p + j * ps_b; \
+		ctype* restrict c1 = c   + j * NR * cs_uc; \
+\
+		n_cur = bli_min( NR, n_use - j * NR ); \
+\
+		for ( i = 0; i < m_iter; ++i ) \
+		{ \
+			ctype* restrict a1  = a_p + i * ps_a; \
+			ctype* restrict c11 = c1  + i * MR * rs_uc; \
+			ctype* restrict a2  = a1  + ps_a; \
+			ctype* restrict b2  = b1; \
+\
+			m_cur = bli_min( MR, m_use - i * MR ); \
+\
+			/* Compute the addresses of the next micro-panels of A and B. */ \
+			if ( i == m_iter - 1 ) \
+			{ \
+				a2 = a_p; \
+				b2 = ( j == n_iter - 1 ? b_p : b1 + ps_b ); \
+			} \
+\
+			bli_auxinfo_set_next_a( a2, &aux ); \
+			bli_auxinfo_set_next_b( b2, &aux ); \
+\
+			/* Handle interior and edge cases separately. */ \
+			if ( m_cur == MR && n_cur == NR ) \
+			{ \
+				gemm_ukr \
+				( \
+				  k, \
+				  alpha, \
+				  a1, \
+				  b1, \
+				  beta, \
+				  c11, rs_uc, cs_uc, \
+				  &aux, \
+				  cntx  \
+				); \
+			} \
+			else \
+			{ \
+				gemm_ukr \
+				( \
+				  k, \
+				  alpha, \
+				  a1, \
+				  b1, \
+				  zero, \
+				  ct, rs_ct, cs_ct, \
+				  &aux, \
+				  cntx  \
+				); \
+\
+				/* Scale the edge of C and add the result from above. */ \
+				PASTEMAC(ch,xpbys_mxn)( m_cur, n_cur, \
+				                        ct,  rs_ct, cs_ct, \
+				                        beta, \
+				                        c11, rs_uc, cs_uc ); \
+			} \
+		} \
+	} \
+\
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_tiny_ker )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	if ( !PASTEMAC(ch,gemm_tiny_is_eligible)( m, n, k, alpha, \
+	                                          rs_c, cs_c, &cntx ) ) \
+		return BLIS_FAILURE; \
+\
+	PASTEMAC(ch,gemm_tiny_ker) \
+	( \
+	  transa, \
+	  transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  cntx  \
+	); \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_tiny )
+
@@ -52,6 +52,8 @@ void bli_trsm_int
 	obj_t        c_local;
 	trsm_var_oft f;
 
+	BLIS_PROF_NODE_DECL( prof_node );
+
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
 		bli_gemm_basic_check( alpha, a, b, beta, c, cntx );
@@ -124,6 +126,11 @@ void bli_trsm_int
 	// Extract the function pointer from the current control tree node.
 	f = bli_cntl_var_func( cntl );
 
+	// Enter the current control tree node for the purposes of profiling.
+	// This tracks the partitioning loop being executed and times the
+	// macro-kernel.
+	BLIS_PROF_NODE_ENTER( prof_node, cntl );
+
 	// Invoke the variant.
 	f
 	(
@@ -135,5 +142,7 @@ void bli_trsm_int
 	  cntl,
 	  thread
 	);
+
+	BLIS_PROF_NODE_EXIT( prof_node, cntl );
 }
 
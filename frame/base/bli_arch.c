@@ -51,6 +51,16 @@
 // which will be overwritten upon calling bli_arch_set_id().
 static arch_t id = -1;
 
+#ifndef BLIS_CONFIGURETIME_CPUID
+// Whether the id above has been set, the arch_t id requested via
+// bli_arch_set_id_override() (if any), and whether an override (from that
+// function or the BLIS_ARCH_TYPE environment variable) was applied.
+static bool_t id_is_set       = FALSE;
+static bool_t id_override_set = FALSE;
+static arch_t id_override;
+static bool_t id_overridden   = FALSE;
+#endif
+
 arch_t bli_arch_query_id( void )
 {
 	bli_arch_set_id_once();
@@ -74,6 +84,22 @@ void bli_arch_set_id_once( void )
 
 void bli_arch_set_id( void )
 {
+#ifndef BLIS_CONFIGURETIME_CPUID
+	// If the caller requested a specific architecture, either through the
+	// API or the environment, use it instead of querying the hardware.
+	if ( !id_override_set )
+		id_override_set = bli_arch_query_env( &id_override );
+
+	id_is_set = TRUE;
+
+	if ( id_override_set )
+	{
+		id            = id_override;
+		id_overridden = TRUE;
+		return;
+	}
+#endif
+
 	// Architecture families.
 #if defined BLIS_FAMILY_INTEL64 || \
     defined BLIS_FAMILY_AMD64   || \
@@ -188,3 +214,190 @@ char* bli_arch_string( arch_t id )
 	return config_name[ id ];
 }
 
+#ifndef BLIS_CONFIGURETIME_CPUID
+
+// -----------------------------------------------------------------------------
+
+bool_t bli_arch_is_configured( arch_t id )
+{
+	// Return whether a context for the given architecture id is registered
+	// by bli_gks_init(), i.e., whether the corresponding sub-configuration
+	// was included when BLIS was configured.
+
+	switch ( id )
+	{
+#ifdef BLIS_CONFIG_SKX
+		case BLIS_ARCH_SKX:         return TRUE;
+#endif
+#ifdef BLIS_CONFIG_KNL
+		case BLIS_ARCH_KNL:         return TRUE;
+#endif
+#ifdef BLIS_CONFIG_KNC
+		case BLIS_ARCH_KNC:         return TRUE;
+#endif
+#ifdef BLIS_CONFIG_HASWELL
+		case BLIS_ARCH_HASWELL:     return TRUE;
+#endif
+#ifdef BLIS_CONFIG_SANDYBRIDGE
+		case BLIS_ARCH_SANDYBRIDGE: return TRUE;
+#endif
+#ifdef BLIS_CONFIG_PENRYN
+		case BLIS_ARCH_PENRYN:      return TRUE;
+#endif
+#ifdef BLIS_CONFIG_ZEN
+		case BLIS_ARCH_ZEN:         return TRUE;
+#endif
+#ifdef BLIS_CONFIG_EXCAVATOR
+		case BLIS_ARCH_EXCAVATOR:   return TRUE;
+#endif
+#ifdef BLIS_CONFIG_STEAMROLLER
+		case BLIS_ARCH_STEAMROLLER: return TRUE;
+#endif
+#ifdef BLIS_CONFIG_PILEDRIVER
+		case BLIS_ARCH_PILEDRIVER:  return TRUE;
+#endif
+#ifdef BLIS_CONFIG_BULLDOZER
+		case BLIS_ARCH_BULLDOZER:   return TRUE;
+#endif
+#ifdef BLIS_CONFIG_CORTEXA57
+		case BLIS_ARCH_CORTEXA57:   return TRUE;
+#endif
+#ifdef BLIS_CONFIG_CORTEXA53
+		case BLIS_ARCH_CORTEXA53:   return TRUE;
+#endif
+#ifdef BLIS_CONFIG_CORTEXA15
+		case BLIS_ARCH_CORTEXA15:   return TRUE;
+#endif
+#ifdef BLIS_CONFIG_CORTEXA9
+		case BLIS_ARCH_CORTEXA9:    return TRUE;
+#endif
+#ifdef BLIS_CONFIG_POWER7
+		case BLIS_ARCH_POWER7:      return TRUE;
+#endif
+#ifdef BLIS_CONFIG_BGQ
+		case BLIS_ARCH_BGQ:         return TRUE;
+#endif
+#ifdef BLIS_CONFIG_GENERIC
+		case BLIS_ARCH_GENERIC:     return TRUE;
+#endif
+		default:                    return FALSE;
+	}
+}
+
+bool_t bli_arch_id_from_string( char* str, arch_t* id_p )
+{
+	// Map a sub-configuration name (e.g. "haswell") or a numeric arch_t
+	// value to an arch_t id. Return FALSE if the string matches neither.
+
+	char*  end;
+	long   val;
+	arch_t i;
+
+	for ( i = 0; i < BLIS_NUM_ARCHS; ++i )
+	{
+		if ( strcmp( str, config_name[ i ] ) == 0 )
+		{
+			*id_p = i;
+			return TRUE;
+		}
+	}
+
+	val = strtol( str, &end, 10 );
+
+	if ( end != str && *end == '\0' && 0 <= val && val < BLIS_NUM_ARCHS )
+	{
+		*id_p = ( arch_t )val;
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+// -----------------------------------------------------------------------------
+
+bool_t bli_arch_query_env( arch_t* id_p )
+{
+	// Read the architecture requested via the BLIS_ARCH_TYPE environment
+	// variable, if any, into *id_p and return TRUE. An unknown or
+	// unconfigured architecture is reported and then ignored, in which case
+	// FALSE is returned and the hardware is queried as usual.
+
+	char*  str = getenv( "BLIS_ARCH_TYPE" );
+	arch_t req;
+	char   msg[ 256 ];
+
+	if ( str == NULL || *str == '\0' ) return FALSE;
+
+	if ( !bli_arch_id_from_string( str, &req ) )
+	{
+		snprintf( msg, sizeof( msg ),
+		          "Ignoring unknown architecture '%s' in BLIS_ARCH_TYPE.", str );
+		bli_print_msg( msg, __FILE__, __LINE__ );
+		return FALSE;
+	}
+
+	if ( !bli_arch_is_configured( req ) )
+	{
+		snprintf( msg, sizeof( msg ),
+		          "Ignoring architecture '%s' in BLIS_ARCH_TYPE; it was not "
+		          "included in the configuration.", config_name[ req ] );
+		bli_print_msg( msg, __FILE__, __LINE__ );
+		return FALSE;
+	}
+
+	*id_p = req;
+
+	return TRUE;
+}
+
+void bli_arch_set_id_override( arch_t req )
+{
+	// Pin BLIS to the given architecture id, taking precedence over both
+	// the BLIS_ARCH_TYPE environment variable and the hardware query. The
+	// architecture is chosen once, so this function must be called before
+	// BLIS is initialized (explicitly or by the first call to any other
+	// BLIS function).
+
+	char msg[ 256 ];
+
+	if ( BLIS_NUM_ARCHS <= ( guint_t )req )
+	{
+		bli_print_msg( "Invalid architecture id value.", __FILE__, __LINE__ );
+		bli_abort();
+	}
+
+	if ( !bli_arch_is_configured( req ) )
+	{
+		snprintf( msg, sizeof( msg ),
+		          "Architecture '%s' was not included in the configuration.",
+		          config_name[ req ] );
+		bli_print_msg( msg, __FILE__, __LINE__ );
+		bli_abort();
+	}
+
+	// If the architecture was already chosen, it may only be "changed" to
+	// the same value.
+	if ( id_is_set )
+	{
+		if ( req == id ) return;
+
+		snprintf( msg, sizeof( msg ),
+		          "Unable to change the architecture to '%s' after BLIS was "
+		          "initialized with '%s'.", config_name[ req ], config_name[ id ] );
+		bli_print_msg( msg, __FILE__, __LINE__ );
+		bli_abort();
+	}
+
+	id_override     = req;
+	id_override_set = TRUE;
+}
+
+bool_t bli_arch_is_overridden( void )
+{
+	bli_arch_set_id_once();
+
+	return id_overridden;
+}
+
+#endif
+
@@ -42,6 +42,13 @@ void    bli_arch_set_id( void );
 
 char*   bli_arch_string( arch_t id );
 
+bool_t  bli_arch_is_configured( arch_t id );
+bool_t  bli_arch_id_from_string( char* str, arch_t* id );
+
+bool_t  bli_arch_query_env( arch_t* id );
+void    bli_arch_set_id_override( arch_t id );
+bool_t  bli_arch_is_overridden( void );
+
 
 #endif
 
@@ -873,6 +873,16 @@ err_t bli_check_valid_arch_id( arch_t id )
 	return e_val;
 }
 
+err_t bli_check_registered_arch_id( void* nat_fp )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( nat_fp == NULL )
+		e_val = BLIS_UNREGISTERED_ARCH_ID;
+
+	return e_val;
+}
+
 // -- Architecture-related errors ----------------------------------------------
 
 err_t bli_check_valid_mc_mod_mult( blksz_t* mc, blksz_t* mr )
@@ -107,6 +107,7 @@ err_t bli_check_alignment_is_mult_of_ptr_size( size_t align_size );
 err_t bli_check_object_alias_of( obj_t* a, obj_t* b );
 
 err_t bli_check_valid_arch_id( arch_t id );
+err_t bli_check_registered_arch_id( void* nat_fp );
 
 err_t bli_check_valid_mc_mod_mult( blksz_t* mc, blksz_t* mr );
 err_t bli_check_valid_nc_mod_mult( blksz_t* nc, blksz_t* nr );
@@ -856,6 +856,96 @@ void bli_cntx_set_packm_kers( dim_t n_kers, ... )
 
 // -----------------------------------------------------------------------------
 
+void bli_cntx_set_transm_kers( dim_t n_kers, ... )
+{
+	// This function can be called from the bli_cntx_init_*() function for
+	// a particular architecture if the kernel developer wishes to use
+	// non-default transpose kernels. It should be called after
+	// bli_cntx_init_defaults() so that default functions are still called
+	// for any datatypes that were not targed for optimization.
+
+	/* Example prototypes:
+
+	   void bli_cntx_set_transm_kers
+	   (
+	     dim_t      n_ukrs,
+	     transmkr_t ker0_id, num_t ker0_dt, void* ker0_fp,
+	     transmkr_t ker1_id, num_t ker1_dt, void* ker1_fp,
+	     transmkr_t ker2_id, num_t ker2_dt, void* ker2_fp,
+	     ...
+	     cntx_t*    cntx
+	   );
+	*/
+	va_list     args;
+	dim_t       i;
+
+	// Allocate some temporary local arrays.
+	transmkr_t* ker_ids   = bli_malloc_intl( n_kers * sizeof( transmkr_t ) );
+	num_t*      ker_dts   = bli_malloc_intl( n_kers * sizeof( num_t      ) );
+	void**      ker_fps   = bli_malloc_intl( n_kers * sizeof( void*      ) );
+
+	// -- Begin variable argument section --
+
+	// Initialize variable argument environment.
+	va_start( args, n_kers );
+
+	// Process n_kers tuples.
+	for ( i = 0; i < n_kers; ++i )
+	{
+		// Here, we query the variable argument list for:
+		// - the transmkr_t of the kernel we're about to process,
+		// - the datatype of the kernel, and
+		// - the kernel function pointer
+		// that we need to store to the context.
+		const transmkr_t ker_id   = ( transmkr_t )va_arg( args, transmkr_t );
+		const num_t      ker_dt   = ( num_t      )va_arg( args, num_t      );
+		      void*      ker_fp   = ( void*      )va_arg( args, void*      );
+
+		// Store the values in our temporary arrays.
+		ker_ids[ i ]   = ker_id;
+		ker_dts[ i ]   = ker_dt;
+		ker_fps[ i ]   = ker_fp;
+	}
+
+	// The last argument should be the context pointer.
+	cntx_t* cntx = ( cntx_t* )va_arg( args, cntx_t* );
+
+	// Shutdown variable argument environment and clean up stack.
+	va_end( args );
+
+	// -- End variable argument section --
+
+	// Query the context for the address of:
+	// - the transpose kernels func_t array
+	func_t* cntx_transm_kers = bli_cntx_transm_kers_buf( cntx );
+
+	// Now that we have the context address, we want to copy the values
+	// from the temporary buffers into the corresponding buffers in the
+	// context.
+
+	// Process each kernel id tuple provided.
+	for ( i = 0; i < n_kers; ++i )
+	{
+		// Read the current kernel id, datatype, and function pointer.
+		const transmkr_t ker_id   = ker_ids[ i ];
+		const num_t      ker_dt   = ker_dts[ i ];
+		      void*      ker_fp   = ker_fps[ i ];
+
+		// Index into the func_t for the current kernel id being processed.
+		func_t*          kers     = &cntx_transm_kers[ ker_id ];
+
+		// Store the kernel function pointer into the context.
+		bli_func_set_dt( ker_fp, ker_dt, kers );
+	}
+
+	// Free the temporary local arrays.
+	bli_free_intl( ker_ids );
+	bli_free_intl( ker_dts );
+	bli_free_intl( ker_fps );
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_cntx_print( cntx_t* cntx )
 {
 	dim_t i;
@@ -930,6 +1020,19 @@ void bli_cntx_print( cntx_t* cntx )
 		      );
 	}
 
+	for ( i = 0; i < BLIS_NUM_TRANSM_KERS; ++i )
+	{
+		func_t* ker = bli_cntx_get_transm_kers( i, cntx );
+
+		printf( "transm ker %2lu:  %16p %16p %16p %16p\n",
+		        ( unsigned long )i,
+		        bli_func_get_dt( BLIS_FLOAT,    ker ),
+		        bli_func_get_dt( BLIS_DOUBLE,   ker ),
+		        bli_func_get_dt( BLIS_SCOMPLEX, ker ),
+		        bli_func_get_dt( BLIS_DCOMPLEX, ker )
+		      );
+	}
+
 	{
 		ind_t method = bli_cntx_method( cntx );
 
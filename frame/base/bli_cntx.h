@@ -54,6 +54,7 @@ typedef struct cntx_s
 
 	func_t*   packm_kers;
 	func_t*   unpackm_kers;
+	func_t*   transm_kers;
 
 	ind_t     method;
 	pack_t    schema_a;
@@ -106,6 +107,10 @@ static func_t* bli_cntx_unpackm_kers_buf( cntx_t* cntx )
 {
 	return cntx->unpackm_kers;
 }
+static func_t* bli_cntx_transm_kers_buf( cntx_t* cntx )
+{
+	return cntx->transm_kers;
+}
 static ind_t bli_cntx_method( cntx_t* cntx )
 {
 	return cntx->method;
@@ -373,6 +378,23 @@ static void* bli_cntx_get_unpackm_ker_dt( num_t dt, l1mkr_t ker_id, cntx_t* cntx
 
 // -----------------------------------------------------------------------------
 
+static func_t* bli_cntx_get_transm_kers( transmkr_t ker_id, cntx_t* cntx )
+{
+	func_t* funcs = bli_cntx_transm_kers_buf( cntx );
+	func_t* func  = &funcs[ ker_id ];
+
+	return func;
+}
+
+static void* bli_cntx_get_transm_ker_dt( num_t dt, transmkr_t ker_id, cntx_t* cntx )
+{
+	func_t* func = bli_cntx_get_transm_kers( ker_id, cntx );
+
+	return bli_func_get_dt( dt, func );
+}
+
+// -----------------------------------------------------------------------------
+
 static bool_t bli_cntx_l3_nat_ukr_prefers_rows_dt( num_t dt, l3ukr_t ukr_id, cntx_t* cntx )
 {
 	bool_t prefs = bli_cntx_get_l3_nat_ukr_prefs_dt( dt, ukr_id, cntx );
@@ -541,6 +563,13 @@ static void bli_cntx_set_unpackm_ker_dt( void* fp, num_t dt, l1mkr_t ker_id, cnt
 	bli_func_set_dt( fp, dt, func );
 }
 
+static void bli_cntx_set_transm_ker( transmkr_t ker_id, func_t* func, cntx_t* cntx )
+{
+	func_t* funcs = bli_cntx_transm_kers_buf( cntx );
+
+	funcs[ ker_id ] = *func;
+}
+
 // -----------------------------------------------------------------------------
 
 // Function prototypes
@@ -555,6 +584,7 @@ void  bli_cntx_set_l3_nat_ukrs( dim_t n_ukrs, ... );
 void  bli_cntx_set_l1f_kers( dim_t n_kers, ... );
 void  bli_cntx_set_l1v_kers( dim_t n_kers, ... );
 void  bli_cntx_set_packm_kers( dim_t n_kers, ... );
+void  bli_cntx_set_transm_kers( dim_t n_kers, ... );
 
 void  bli_cntx_print( cntx_t* cntx );
 
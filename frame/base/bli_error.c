@@ -166,6 +166,8 @@ void bli_error_init_msgs( void )
 
 	sprintf( bli_error_string_for_code(BLIS_INVALID_ARCH_ID),
 	         "Invalid architecture id value." );
+	sprintf( bli_error_string_for_code(BLIS_UNREGISTERED_ARCH_ID),
+	         "Architecture id was not registered with the gks." );
 
 	sprintf( bli_error_string_for_code(BLIS_MC_DEF_NONMULTIPLE_OF_MR),
 	         "Default MC is non-multiple of MR for one or more datatypes." );
@@ -179,6 +181,11 @@ void bli_error_init_msgs( void )
 	         "Default KC is non-multiple of KR for one or more datatypes." );
 	sprintf( bli_error_string_for_code(BLIS_KC_MAX_NONMULTIPLE_OF_KR),
 	         "Maximum KC is non-multiple of KR for one or more datatypes." );
+
+	sprintf( bli_error_string_for_code(BLIS_FILE_OPEN_FAILURE),
+	         "Could not open, or resize, the file backing an object." );
+	sprintf( bli_error_string_for_code(BLIS_FILE_MAP_FAILURE),
+	         "Could not map the file backing an object into memory." );
 }
 
 void bli_print_msg( char* str, char* file, guint_t line )
@@ -39,6 +39,12 @@
 // induced methods.
 static cntx_t** gks[ BLIS_NUM_ARCHS ];
 
+// The array of function pointers holding the registered context initialization
+// functions for native execution. Only the native context of the architecture
+// returned by bli_arch_query_id() is built by bli_gks_init(); the contexts of
+// any other registered architecture are built on first lookup.
+static void*    cntx_nat_init[ BLIS_NUM_ARCHS ];
+
 // The array of function pointers holding the registered context initialization
 // functions for induced methods.
 static void*    cntx_ind_init[ BLIS_NUM_ARCHS ];
@@ -52,6 +58,11 @@ typedef void (*nat_cntx_init_ft)( cntx_t* cntx );
 typedef void (*ref_cntx_init_ft)( cntx_t* cntx );
 typedef void (*ind_cntx_init_ft)( ind_t method, num_t dt, cntx_t* cntx );
 
+// A mutex to allow synchronous access to the gks when it needs to be updated
+// with a new entry, either a native context that is built lazily or a
+// context corresponding to an ind_t value.
+static pthread_mutex_t gks_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 // -----------------------------------------------------------------------------
 
 void bli_gks_init( void )
@@ -61,8 +72,13 @@ void bli_gks_init( void )
 		// contexts.
 		bli_gks_init_index();
 
+		// Read any runtime overrides of the blocksizes, which are applied to
+		// each native context as it is registered.
+		bli_gks_blksz_init();
+
 		// Register a context for each architecture that was #define'd in
-		// bli_config.h.
+		// bli_config.h. Registration is cheap: only the native context of
+		// the architecture that is actually running is initialized here.
 
 		// Intel architectures
 #ifdef BLIS_CONFIG_SKX
@@ -130,7 +146,7 @@ void bli_gks_init( void )
 		                                              bli_cntx_init_cortexa57_ind );
 #endif
 #ifdef BLIS_CONFIG_CORTEXA53
-		bli_gks_register_cntx( BLIS_ARCH_CORTEXA57,   bli_cntx_init_cortexa53,
+		bli_gks_register_cntx( BLIS_ARCH_CORTEXA53,   bli_cntx_init_cortexa53,
 		                                              bli_cntx_init_cortexa53_ref,
 		                                              bli_cntx_init_cortexa53_ind );
 #endif
@@ -205,6 +221,8 @@ void bli_gks_finalize( void )
 			}
 		}
 
+		// Discard any runtime overrides of the blocksizes.
+		bli_gks_blksz_finalize();
 	}
 	// END CRITICAL SECTION
 }
@@ -223,6 +241,7 @@ void bli_gks_init_index( void )
 	// zero/NULL. This is done so that later on we know which ones were
 	// allocated.
 	memset( gks,           0, gks_size );
+	memset( cntx_nat_init, 0, fpa_size );
 	memset( cntx_ref_init, 0, fpa_size );
 	memset( cntx_ind_init, 0, fpa_size );
 }
@@ -250,9 +269,11 @@ cntx_t* bli_gks_lookup_ind_cntx
 {
 	// Return the address of the context for a given architecture id and
 	// induced method. This function assumes the architecture has already
-	// been registered. Note that this function returns NULL if the induced
-	// method hasn't yet been called (and thus its context pointer is still
-	// NULL).
+	// been registered. If the native context for the architecture has not
+	// yet been built (because it is not the architecture returned by
+	// bli_arch_query_id()), it is built here. Note that this function
+	// returns NULL if the induced method hasn't yet been called (and thus
+	// its context pointer is still NULL).
 
 	// Sanity check: verify that the arch_t id is valid.
 	if ( bli_error_checking_is_enabled() )
@@ -261,10 +282,42 @@ cntx_t* bli_gks_lookup_ind_cntx
 		bli_check_error_code( e_val );
 	}
 
-	// Index into the array of context pointers for the given architecture id,
-	// and then index into the subarray for the given induced method.
-	cntx_t** restrict gks_id     = gks[ id ];
-	cntx_t*  restrict gks_id_ind = gks_id[ ind ];
+	// If the context array for the architecture has not yet been allocated,
+	// build the native context now. The pointer is checked again inside the
+	// critical section in case another thread got there first. Since
+	// bli_gks_init_nat_cntx() publishes the array only after the native
+	// context is fully initialized, an acquire load that returns non-NULL
+	// guarantees that the context it refers to is also visible.
+	cntx_t** gks_id = __atomic_load_n( &gks[ id ], __ATOMIC_ACQUIRE );
+
+	if ( gks_id == NULL )
+	{
+		// Acquire the mutex protecting the gks.
+		pthread_mutex_lock( &gks_mutex );
+
+		// BEGIN CRITICAL SECTION
+		{
+			if ( gks[ id ] == NULL )
+			{
+				err_t e_val = bli_check_registered_arch_id( cntx_nat_init[ id ] );
+				bli_check_error_code( e_val );
+
+				bli_gks_init_nat_cntx( id );
+			}
+
+			gks_id = gks[ id ];
+		}
+		// END CRITICAL SECTION
+
+		// Release the mutex protecting the gks.
+		pthread_mutex_unlock( &gks_mutex );
+	}
+
+	// Index into the subarray for the given induced method. Induced method
+	// contexts are likewise published by bli_gks_query_ind_cntx() only once
+	// they are initialized.
+	cntx_t* restrict gks_id_ind = __atomic_load_n( &gks_id[ ind ],
+	                                               __ATOMIC_ACQUIRE );
 
 	// Return the context pointer at gks_id_ind.
 	return gks_id_ind;
@@ -288,12 +341,13 @@ void bli_gks_register_cntx
 	// associated with id), and one to a function that initializes a
 	// context for use with induced methods (again, with function pointers
 	// to the architecture). The latter two functions are automatically
-	// generated by the framework. Unlike with native contexts, we don't
-	// actually store the induced contexts until that induced method is
-	// called, and we don't ever store reference contexts. For this reason, we
-	// can get away with only storing the pointers to the initialization
-	// functions for those latter two types of contexts, which we can then
-	// call at a later time when those contexts are needed.
+	// generated by the framework. We don't actually store the induced
+	// contexts until that induced method is called, we only store the native
+	// context of an architecture other than the one that is running if it is
+	// looked up, and we don't ever store reference contexts. For this reason,
+	// we can get away with only storing the pointers to the initialization
+	// functions, which we can then call at a later time when those contexts
+	// are needed.
 
 	// Sanity check: verify that the arch_t id is valid.
 	if ( bli_error_checking_is_enabled() )
@@ -302,45 +356,66 @@ void bli_gks_register_cntx
 		bli_check_error_code( e_val );
 	}
 
-	nat_cntx_init_ft f = nat_fp;
-
 	// First, store the function pointers to the context initialization
-	// functions for reference kernels and induced method execution. The
-	// former will be used whenever we need to obtain reference kernels and
-	// latter will be used later on if the user calls a level-3 function
-	// with induced execution enabled. 
+	// functions for native execution, reference kernels and induced method
+	// execution. The first will be used when the native context is built,
+	// the second whenever we need to obtain reference kernels, and the third
+	// later on if the user calls a level-3 function with induced execution
+	// enabled.
+	cntx_nat_init[ id ] = nat_fp;
 	cntx_ref_init[ id ] = ref_fp;
 	cntx_ind_init[ id ] = ind_fp;
 
+	// Only build the native context of the architecture that is actually
+	// running. In a build with multiple configurations (e.g. x86_64), the
+	// contexts of the other architectures are never needed unless they are
+	// explicitly looked up, in which case bli_gks_lookup_ind_cntx() builds
+	// them on demand.
+	if ( id != bli_arch_query_id() ) return;
+
+	bli_gks_init_nat_cntx( id );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gks_init_nat_cntx
+     (
+       arch_t id
+     )
+{
+	// This function allocates and initializes the native context for the
+	// given architecture id using the native context initialization function
+	// stored by bli_gks_register_cntx(). It is called either from within
+	// bli_gks_init() or from within the critical section in
+	// bli_gks_lookup_ind_cntx().
+
+	nat_cntx_init_ft f = cntx_nat_init[ id ];
+
 	// If the the context array pointer isn't NULL, then it means the given
-	// architecture id has already registered (and the underlying memory
-	// allocations and context initializations have already been performed).
-	// This is really just a safety feature to prevent memory leaks; this
-	// early return should never occur, because the caller should never try
-	// to register with an architecture id that has already been registered.
+	// architecture id has already been built. This is really just a safety
+	// feature to prevent memory leaks; this early return should never occur.
 	if ( gks[ id ] != NULL ) return;
 
 	// At this point, we know the pointer to the array of cntx_t* is NULL and
 	// needs to be allocated. Allocate the memory and initialize it to
-	// zeros/NULL, storing the address of the alloacted memory at the element
-	// for the current architecture id.
-	gks[ id ] = bli_calloc_intl( sizeof( cntx_t* ) * BLIS_NUM_IND_METHODS );
-
-	// Alias the allocated array for readability.
-	cntx_t** restrict gks_id = gks[ id ];
+	// zeros/NULL. The address is not stored to gks[ id ] until the native
+	// context is completely built (see below), since bli_gks_lookup_ind_cntx()
+	// reads gks[ id ] outside of its critical section.
+	cntx_t** gks_id = bli_calloc_intl( sizeof( cntx_t* ) * BLIS_NUM_IND_METHODS );
 
 	// Allocate memory for a single context and store the address at
-	// the element in the gks[ id ] array that is reserved for native
-	// execution.
-	gks_id[ BLIS_NAT ] = bli_calloc_intl( sizeof( cntx_t ) );
+	// the element in the array that is reserved for native execution.
+	cntx_t* gks_id_nat = bli_calloc_intl( sizeof( cntx_t ) );
 
-	// Alias the allocated context address for readability.
-	cntx_t* restrict gks_id_nat = gks_id[ BLIS_NAT ];
+	gks_id[ BLIS_NAT ] = gks_id_nat;
 
 	// Call the context initialization function on the element of the newly
 	// allocated array corresponding to native execution.
 	f( gks_id_nat );
 
+	// Apply any runtime overrides of the blocksizes.
+	bli_gks_blksz_apply( id, gks_id_nat );
+
 	// Verify that cache blocksizes are whole multiples of register blocksizes.
 	// Specifically, verify that:
 	//   - MC is a whole multiple of MR.
@@ -372,6 +447,12 @@ void bli_gks_register_cntx
 	e_val = bli_check_valid_mc_mod_mult( mc, nr ); bli_check_error_code( e_val );
 	e_val = bli_check_valid_nc_mod_mult( nc, mr ); bli_check_error_code( e_val );
 #endif
+
+	// Now that the native context is complete, publish the array. The
+	// release store pairs with the acquire load in bli_gks_lookup_ind_cntx()
+	// so that any thread that observes a non-NULL gks[ id ] also observes
+	// the initialized context.
+	__atomic_store_n( &gks[ id ], gks_id, __ATOMIC_RELEASE );
 }
 
 // -----------------------------------------------------------------------------
@@ -416,10 +497,6 @@ cntx_t* bli_gks_query_cntx_noinit( void )
 
 // -----------------------------------------------------------------------------
 
-// A mutex to allow synchronous access to the gks when it needs to be updated
-// with a new entry corresponding to a context for an ind_t value.
-static pthread_mutex_t gks_mutex = PTHREAD_MUTEX_INITIALIZER;
-
 cntx_t* bli_gks_query_ind_cntx
      (
        ind_t ind,
@@ -454,13 +531,13 @@ cntx_t* bli_gks_query_ind_cntx
 	}
 
 	// NOTE: These initial statements can reside outside of the critical section
-	// because gks[ id ] should have already been allocated, and the native
-	// context in that array should have already been allocated/initialized.
+	// because looking up the native context guarantees that gks[ id ] has
+	// been allocated and that its native context has been initialized.
 
-	// Query the gks for the array of context pointers corresponding to the
-	// given architecture id.
-	cntx_t** restrict gks_id     = gks[ id ];
-	cntx_t*  restrict gks_id_nat = gks_id[ BLIS_NAT ];
+	// Query the gks for the native context and the array of context pointers
+	// corresponding to the given architecture id.
+	cntx_t*  restrict gks_id_nat = bli_gks_lookup_nat_cntx( id );
+	cntx_t** restrict gks_id     = __atomic_load_n( &gks[ id ], __ATOMIC_ACQUIRE );
 
 	// If for some reason the native context was requested, we can return
 	// its address early.
@@ -486,9 +563,8 @@ cntx_t* bli_gks_query_ind_cntx
 		{
 			// If gks_id_ind is NULL, then we know we must allocate and then
 			// initialize the context, storing its address back to
-			// gks_id[ ind ].
-			gks_id_ind    = bli_calloc_intl( sizeof( cntx_t ) );
-			gks_id[ ind ] = gks_id_ind;
+			// gks_id[ ind ] once it is initialized.
+			gks_id_ind = bli_calloc_intl( sizeof( cntx_t ) );
 
 			// Before we can call the induced method context initialization
 			// function on the newly allocated structure, we must first copy
@@ -505,6 +581,11 @@ cntx_t* bli_gks_query_ind_cntx
 			// that the context is pre- initialized with values for native
 			// execution.)
 			f( ind, dt, gks_id_ind );
+
+			// Publish the context only now that it is complete, since
+			// bli_gks_lookup_ind_cntx() reads gks_id[ ind ] without
+			// acquiring the mutex.
+			__atomic_store_n( &gks_id[ ind ], gks_id_ind, __ATOMIC_RELEASE );
 		}
 	}
 	// END CRITICAL SECTION
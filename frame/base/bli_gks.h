@@ -47,6 +47,7 @@ void    bli_gks_init_index( void );
 cntx_t* bli_gks_lookup_nat_cntx( arch_t id );
 cntx_t* bli_gks_lookup_ind_cntx( arch_t id, ind_t ind );
 void    bli_gks_register_cntx( arch_t id, void* nat_fp, void* ref_fp, void* ind_fp );
+void    bli_gks_init_nat_cntx( arch_t id );
 
 cntx_t* bli_gks_query_cntx( void );
 cntx_t* bli_gks_query_nat_cntx( void );
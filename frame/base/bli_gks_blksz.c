@@ -0,0 +1,333 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Overrides are kept in separate sets: one for each sub-configuration
+// (read from its section of the file), one for the overrides in the file
+// that precede the first section, and one for the environment variable.
+// They are applied in the order file, section, environment, so that the
+// more specific or more recent sets take precedence.
+#define BLIS_BLKSZ_OVR_FILE ( BLIS_NUM_ARCHS + 0 )
+#define BLIS_BLKSZ_OVR_ENV  ( BLIS_NUM_ARCHS + 1 )
+#define BLIS_BLKSZ_OVR_NUM  ( BLIS_NUM_ARCHS + 2 )
+
+// The overriding default and maximum blocksizes for each set, blocksize id,
+// and datatype, and whether each one was given.
+static bool_t blksz_ovr_set[ BLIS_BLKSZ_OVR_NUM ][ BLIS_NUM_BLKSZS ][ BLIS_NUM_FP_TYPES ];
+static dim_t  blksz_ovr_def[ BLIS_BLKSZ_OVR_NUM ][ BLIS_NUM_BLKSZS ][ BLIS_NUM_FP_TYPES ];
+static dim_t  blksz_ovr_max[ BLIS_BLKSZ_OVR_NUM ][ BLIS_NUM_BLKSZS ][ BLIS_NUM_FP_TYPES ];
+
+// The maximum length of a line in a blocksize file.
+#define BLIS_BLKSZ_LINE_MAX 1024
+
+// -----------------------------------------------------------------------------
+
+static bool_t bli_gks_blksz_name_to_id( char* name, bszid_t* bszid )
+{
+	// Only blocksizes that are not tied to the kernels may be overridden.
+	if      ( strcmp( name, "MC" ) == 0 ) *bszid = BLIS_MC;
+	else if ( strcmp( name, "KC" ) == 0 ) *bszid = BLIS_KC;
+	else if ( strcmp( name, "NC" ) == 0 ) *bszid = BLIS_NC;
+	else if ( strcmp( name, "M2" ) == 0 ) *bszid = BLIS_M2;
+	else if ( strcmp( name, "N2" ) == 0 ) *bszid = BLIS_N2;
+	else if ( strcmp( name, "VT" ) == 0 ) *bszid = BLIS_VT;
+	else return FALSE;
+
+	return TRUE;
+}
+
+static bool_t bli_gks_blksz_char_to_dt( char c, num_t* dt )
+{
+	if      ( c == 's' ) *dt = BLIS_FLOAT;
+	else if ( c == 'd' ) *dt = BLIS_DOUBLE;
+	else if ( c == 'c' ) *dt = BLIS_SCOMPLEX;
+	else if ( c == 'z' ) *dt = BLIS_DCOMPLEX;
+	else return FALSE;
+
+	return TRUE;
+}
+
+static err_t bli_gks_blksz_parse_token( dim_t ovr, char* token )
+{
+	char*   eq = strchr( token, '=' );
+	char*   us;
+	char*   end;
+	bszid_t bszid;
+	num_t   dt;
+	num_t   dt_lo = BLIS_DT_LO;
+	num_t   dt_hi = BLIS_DT_HI;
+	long    def, max;
+
+	if ( eq == NULL ) return BLIS_FAILURE;
+
+	// Split the token into its name and value, and the name into the
+	// blocksize name and the optional datatype character.
+	*eq = '\0';
+	us  = strchr( token, '_' );
+
+	if ( us != NULL )
+	{
+		if ( us[1] == '\0' || us[2] != '\0' ) return BLIS_FAILURE;
+		if ( !bli_gks_blksz_char_to_dt( us[1], &dt ) ) return BLIS_FAILURE;
+
+		*us   = '\0';
+		dt_lo = dt;
+		dt_hi = dt;
+	}
+
+	if ( !bli_gks_blksz_name_to_id( token, &bszid ) ) return BLIS_FAILURE;
+
+	// Parse the default value and the optional maximum value.
+	def = strtol( eq + 1, &end, 10 );
+	max = def;
+
+	if ( end == eq + 1 ) return BLIS_FAILURE;
+
+	if ( *end == ':' )
+	{
+		char* max_str = end + 1;
+
+		max = strtol( max_str, &end, 10 );
+
+		if ( end == max_str ) return BLIS_FAILURE;
+	}
+
+	if ( *end != '\0' || max < def ) return BLIS_FAILURE;
+
+	// A threading threshold of zero disables level-1v/-1m threading, but
+	// every other blocksize must be positive.
+	if ( def < 0 || ( def == 0 && bszid != BLIS_VT ) ) return BLIS_FAILURE;
+
+	for ( dt = dt_lo; dt <= dt_hi; ++dt )
+	{
+		blksz_ovr_set[ ovr ][ bszid ][ dt ] = TRUE;
+		blksz_ovr_def[ ovr ][ bszid ][ dt ] = ( dim_t )def;
+		blksz_ovr_max[ ovr ][ bszid ][ dt ] = ( dim_t )max;
+	}
+
+	return BLIS_SUCCESS;
+}
+
+static err_t bli_gks_blksz_parse_set( dim_t ovr, char* str )
+{
+	const char* delim = " \t\r\n,;";
+	err_t       r_val = BLIS_SUCCESS;
+	char*       save;
+	char*       token;
+
+	// NOTE: The string is modified in place.
+	for ( token = strtok_r( str, delim, &save ); token != NULL;
+	      token = strtok_r( NULL, delim, &save ) )
+	{
+		char msg[ 256 ];
+
+		snprintf( msg, sizeof( msg ), "Ignoring invalid blocksize override '%s'.",
+		          token );
+
+		if ( bli_gks_blksz_parse_token( ovr, token ) != BLIS_SUCCESS )
+		{
+			bli_print_msg( msg, __FILE__, __LINE__ );
+			r_val = BLIS_FAILURE;
+		}
+	}
+
+	return r_val;
+}
+
+err_t bli_gks_blksz_parse( char* str )
+{
+	return bli_gks_blksz_parse_set( BLIS_BLKSZ_OVR_ENV, str );
+}
+
+static void bli_gks_blksz_read_file( char* filename )
+{
+	FILE* file = fopen( filename, "r" );
+	char  line[ BLIS_BLKSZ_LINE_MAX ];
+
+	// Overrides that precede the first section header apply to every
+	// sub-configuration. Those in a section apply only to the sub-
+	// configuration named in its header, and those in a section for an
+	// unknown sub-configuration are ignored (ovr = -1).
+	dim_t ovr = BLIS_BLKSZ_OVR_FILE;
+
+	if ( file == NULL )
+	{
+		bli_print_msg( "Unable to open the file given by BLIS_BLKSZ_FILE.",
+		               __FILE__, __LINE__ );
+		return;
+	}
+
+	while ( fgets( line, sizeof( line ), file ) != NULL )
+	{
+		char* comment = strchr( line, '#' );
+		char* s       = line;
+
+		if ( comment != NULL ) *comment = '\0';
+
+		while ( *s == ' ' || *s == '\t' ) ++s;
+
+		if ( *s == '[' )
+		{
+			char* close = strchr( s, ']' );
+			dim_t id;
+
+			if ( close != NULL ) *close = '\0';
+
+			ovr = -1;
+
+			for ( id = 0; id < BLIS_NUM_ARCHS; ++id )
+				if ( strcmp( s + 1, bli_arch_string( id ) ) == 0 ) ovr = id;
+
+			if ( ovr == -1 )
+				bli_print_msg( "Ignoring the overrides for an unknown "
+				               "sub-configuration in BLIS_BLKSZ_FILE.",
+				               __FILE__, __LINE__ );
+		}
+		else if ( ovr != -1 )
+		{
+			bli_gks_blksz_parse_set( ovr, s );
+		}
+	}
+
+	fclose( file );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gks_blksz_init( void )
+{
+	char* filename = getenv( "BLIS_BLKSZ_FILE" );
+	char* env      = getenv( "BLIS_BLKSZ" );
+
+	bli_gks_blksz_finalize();
+
+	// Read the file first so that the environment variable takes
+	// precedence.
+	if ( filename != NULL ) bli_gks_blksz_read_file( filename );
+
+	if ( env != NULL )
+	{
+		// Parse a copy, since the string is modified during parsing.
+		char* env_copy = bli_malloc_intl( strlen( env ) + 1 );
+
+		strcpy( env_copy, env );
+		bli_gks_blksz_parse( env_copy );
+		bli_free_intl( env_copy );
+	}
+}
+
+void bli_gks_blksz_finalize( void )
+{
+	memset( blksz_ovr_set, 0, sizeof( blksz_ovr_set ) );
+	memset( blksz_ovr_def, 0, sizeof( blksz_ovr_def ) );
+	memset( blksz_ovr_max, 0, sizeof( blksz_ovr_max ) );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_gks_blksz_apply_set( dim_t ovr, cntx_t* cntx )
+{
+	bszid_t bszid;
+	num_t   dt;
+
+	for ( bszid = 0; bszid < BLIS_NUM_BLKSZS; ++bszid )
+	for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		dim_t    def   = blksz_ovr_def[ ovr ][ bszid ][ dt ];
+		dim_t    max   = blksz_ovr_max[ ovr ][ bszid ][ dt ];
+		blksz_t* blksz = bli_cntx_get_blksz( bszid, cntx );
+		dim_t    mult1 = 1;
+		dim_t    mult2 = 1;
+		dim_t    mult;
+
+		if ( !blksz_ovr_set[ ovr ][ bszid ][ dt ] ) continue;
+
+		// Cache blocksizes must be whole multiples of the corresponding
+		// register blocksizes (see bli_gks_register_cntx()).
+		if      ( bszid == BLIS_MC )
+		{
+			mult1 = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+#ifndef BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
+			mult2 = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+#endif
+		}
+		else if ( bszid == BLIS_NC )
+		{
+			mult1 = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+#ifndef BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
+			mult2 = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+#endif
+		}
+		else if ( bszid == BLIS_KC )
+		{
+			mult1 = bli_cntx_get_blksz_def_dt( dt, BLIS_KR, cntx );
+		}
+
+		// Combine the two constraints into their least common multiple.
+		mult = mult1;
+		while ( mult % mult2 != 0 ) mult += mult1;
+
+		if ( def % mult != 0 || max % mult != 0 )
+		{
+			char msg[ 256 ];
+
+			// Map the blocksize id and datatype to the names used in the
+			// overrides. (Note that the datatype is indexed by num_t.)
+			char* bszid_str[ BLIS_NUM_BLKSZS ] =
+			{
+				"KR", "MR", "NR", "MC", "KC", "NC",
+				"M2", "N2", "AF", "DF", "XF", "VT"
+			};
+			char* dt_str = "scdz";
+
+			snprintf( msg, sizeof( msg ), "Ignoring blocksize override "
+			          "%s_%c=%ld:%ld; it must be a multiple of %ld.",
+			          bszid_str[ bszid ], dt_str[ dt ], ( long )def,
+			          ( long )max, ( long )mult );
+			bli_print_msg( msg, __FILE__, __LINE__ );
+			continue;
+		}
+
+		bli_blksz_set_def( def, dt, blksz );
+		bli_blksz_set_max( max, dt, blksz );
+	}
+}
+
+void bli_gks_blksz_apply( arch_t id, cntx_t* cntx )
+{
+	bli_gks_blksz_apply_set( BLIS_BLKSZ_OVR_FILE, cntx );
+	bli_gks_blksz_apply_set( id,                  cntx );
+	bli_gks_blksz_apply_set( BLIS_BLKSZ_OVR_ENV,  cntx );
+}
@@ -0,0 +1,60 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_GKS_BLKSZ_H
+#define BLIS_GKS_BLKSZ_H
+
+// Runtime overrides of the cache (and other non-register) blocksizes set
+// by a configuration's bli_cntx_init_*() function. Overrides are read once,
+// by bli_gks_init(), from the file named by BLIS_BLKSZ_FILE and then from
+// the BLIS_BLKSZ environment variable, and are applied to each native
+// context as it is registered. Each override has the form
+//
+//   NAME[_dt]=def[:max]
+//
+// where NAME is one of MC, KC, NC, M2, N2, or VT; dt (optional) is one of
+// s, d, c, or z; and max (optional) is the maximum blocksize, which
+// defaults to def. Overrides are separated by whitespace, commas, or
+// semicolons. In a file, '#' begins a comment, and a line of the form
+// [name] restricts the overrides that follow to the context of the sub-
+// configuration with that name (e.g. [zen]). VT may be zero, which
+// disables level-1v/-1m threading; every other blocksize must be positive.
+
+void bli_gks_blksz_init( void );
+void bli_gks_blksz_finalize( void );
+
+err_t bli_gks_blksz_parse( char* str );
+void  bli_gks_blksz_apply( arch_t id, cntx_t* cntx );
+
+#endif
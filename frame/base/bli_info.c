@@ -47,6 +47,13 @@ char* bli_info_get_int_type_size_str( void )        { return bli_int_type_size_s
 
 
 
+// -- Architecture-related -----------------------------------------------------
+
+gint_t bli_info_get_arch_id( void )                 { return bli_arch_query_id(); }
+char*  bli_info_get_arch_string( void )             { return bli_arch_string( bli_arch_query_id() ); }
+gint_t bli_info_get_arch_is_overridden( void )      { return bli_arch_is_overridden(); }
+
+
 // -- General configuration-related --------------------------------------------
 
 gint_t bli_info_get_int_type_size( void )           { return BLIS_INT_TYPE_SIZE; }
@@ -94,6 +101,22 @@ gint_t bli_info_get_enable_packbuf_pools( void )
 	return 0;
 #endif
 }
+gint_t bli_info_get_enable_l3_prof( void )
+{
+#ifdef BLIS_ENABLE_L3_PROF
+	return 1;
+#else
+	return 0;
+#endif
+}
+gint_t bli_info_get_enable_perf_counters( void )
+{
+#ifdef BLIS_ENABLE_PERF_COUNTERS
+	return 1;
+#else
+	return 0;
+#endif
+}
 
 
 
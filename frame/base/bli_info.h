@@ -39,6 +39,13 @@ char* bli_info_get_version_str( void );
 char* bli_info_get_int_type_size_str( void );
 
 
+// -- Architecture-related -----------------------------------------------------
+
+gint_t bli_info_get_arch_id( void );
+char*  bli_info_get_arch_string( void );
+gint_t bli_info_get_arch_is_overridden( void );
+
+
 // -- General configuration-related --------------------------------------------
 
 gint_t bli_info_get_int_type_size( void );
@@ -58,6 +65,8 @@ gint_t bli_info_get_enable_blas( void );
 gint_t bli_info_get_enable_cblas( void );
 gint_t bli_info_get_blas_int_type_size( void );
 gint_t bli_info_get_enable_packbuf_pools( void );
+gint_t bli_info_get_enable_l3_prof( void );
+gint_t bli_info_get_enable_perf_counters( void );
 
 
 // -- Kernel implementation-related --------------------------------------------
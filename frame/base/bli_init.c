@@ -72,6 +72,13 @@ void bli_finalize_auto( void )
 
 // -----------------------------------------------------------------------------
 
+// A pthread_once_t variable is a pthread structure used in pthread_once().
+// pthread_once() is guaranteed to execute exactly once among all threads that
+// pass in this control object. Thus, we need one for initialization and a
+// separate one for finalization.
+static pthread_once_t once_init     = PTHREAD_ONCE_INIT;
+static pthread_once_t once_finalize = PTHREAD_ONCE_INIT;
+
 void bli_init_apis( void )
 {
 	// Initialize various sub-APIs.
@@ -80,27 +87,39 @@ void bli_init_apis( void )
 	bli_ind_init();
 	bli_thread_init();
 	bli_memsys_init();
+	bli_prof_init();
+	bli_perfctr_init();
+
+	// Reset the control variable that will allow finalization.
+	// NOTE: We must initialize a fresh pthread_once_t object and THEN copy
+	// the contents to the static control variable because some compilers
+	// do not allow PTHREAD_ONCE_INIT to be used as an rvalue.
+	pthread_once_t once_new = PTHREAD_ONCE_INIT;
+	once_finalize = once_new;
 }
 
 void bli_finalize_apis( void )
 {
+	// Wait for any asynchronous operations still in progress, since they
+	// may need the sub-APIs below.
+	bli_async_finalize();
+
 	// Finalize various sub-APIs.
+	bli_perfctr_finalize();
+	bli_prof_finalize();
 	bli_memsys_finalize();
 	bli_thread_finalize();
 	bli_gks_finalize();
 	bli_ind_finalize();
 	bli_error_finalize();
+
+	// Reset the control variable that will allow (re-)initialization.
+	pthread_once_t once_new = PTHREAD_ONCE_INIT;
+	once_init = once_new;
 }
 
 // -----------------------------------------------------------------------------
 
-// A pthread_once_t variable is a pthread structure used in pthread_once().
-// pthread_once() is guaranteed to execute exactly once among all threads that
-// pass in this control object. Thus, we need one for initialization and a
-// separate one for finalization.
-static pthread_once_t once_init     = PTHREAD_ONCE_INIT;
-static pthread_once_t once_finalize = PTHREAD_ONCE_INIT;
-
 void bli_init_once( void )
 {
 	pthread_once( &once_init, bli_init_apis );
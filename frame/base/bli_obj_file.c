@@ -0,0 +1,176 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#if !BLIS_OS_WINDOWS
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+siz_t bli_obj_buffer_extent
+     (
+       obj_t* obj
+     )
+{
+	dim_t m  = bli_obj_length( obj );
+	dim_t n  = bli_obj_width( obj );
+	inc_t rs = bli_abs( bli_obj_row_stride( obj ) );
+	inc_t cs = bli_abs( bli_obj_col_stride( obj ) );
+
+	if ( m == 0 || n == 0 ) return 0;
+
+	return ( siz_t )( ( m - 1 ) * rs + ( n - 1 ) * cs + 1 ) *
+	       bli_obj_elem_size( obj );
+}
+
+#if !BLIS_OS_WINDOWS
+
+void bli_obj_create_with_file
+     (
+       num_t       dt,
+       dim_t       m,
+       dim_t       n,
+       inc_t       rs,
+       inc_t       cs,
+       const char* path,
+       siz_t       offset,
+       bool_t      writable,
+       obj_t*      obj
+     )
+{
+	siz_t  page_size = ( siz_t )sysconf( _SC_PAGESIZE );
+	siz_t  map_off   = offset - offset % page_size;
+	siz_t  extent;
+	siz_t  map_size;
+	int    fd;
+	void*  p;
+
+	struct stat st;
+
+	bli_init_once();
+
+	// Unlike bli_obj_create(), we do not pad the leading dimension, since
+	// the file layout is fixed by whoever wrote it.
+	if ( rs == 0 && cs == 0 ) { rs = 1; cs = bli_max( m, 1 ); }
+
+	bli_obj_create_without_buffer( dt, m, n, obj );
+	bli_obj_attach_buffer( NULL, rs, cs, 1, obj );
+
+	extent = bli_obj_buffer_extent( obj );
+
+	if ( extent == 0 ) return;
+
+	fd = open( path, writable ? O_RDWR | O_CREAT : O_RDONLY, 0666 );
+
+	if ( fd < 0 ) bli_check_error_code( BLIS_FILE_OPEN_FAILURE );
+
+	if ( fstat( fd, &st ) != 0 )
+		bli_check_error_code( BLIS_FILE_OPEN_FAILURE );
+
+	// Extend the file if the matrix would run past its end. A read-only
+	// object cannot extend the file, and touching a mapped page beyond the
+	// end of the file would raise SIGBUS, so that is an error.
+	if ( ( siz_t )st.st_size < offset + extent )
+	{
+		if ( !writable || ftruncate( fd, ( off_t )( offset + extent ) ) != 0 )
+			bli_check_error_code( BLIS_FILE_OPEN_FAILURE );
+	}
+
+	// The mapping must start on a page boundary, so it may begin somewhat
+	// before the matrix.
+	map_size = offset - map_off + extent;
+
+	p = mmap( NULL, map_size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+	          MAP_SHARED, fd, ( off_t )map_off );
+
+	if ( p == MAP_FAILED ) bli_check_error_code( BLIS_FILE_MAP_FAILURE );
+
+	// The mapping remains valid after the file is closed.
+	close( fd );
+
+	bli_obj_set_buffer( ( char* )p + ( offset - map_off ), obj );
+}
+
+void bli_obj_free_file
+     (
+       obj_t* obj
+     )
+{
+	siz_t page_size = ( siz_t )sysconf( _SC_PAGESIZE );
+	char* p         = bli_obj_buffer( obj );
+	siz_t extent    = bli_obj_buffer_extent( obj );
+	siz_t delta;
+
+	if ( p == NULL || extent == 0 ) return;
+
+	// Recover the start of the mapping, which is the page boundary at or
+	// before the buffer (see bli_obj_create_with_file()).
+	delta = ( siz_t )( uintptr_t )p % page_size;
+
+	munmap( p - delta, delta + extent );
+
+	bli_obj_set_buffer( NULL, obj );
+}
+
+#else
+
+void bli_obj_create_with_file
+     (
+       num_t       dt,
+       dim_t       m,
+       dim_t       n,
+       inc_t       rs,
+       inc_t       cs,
+       const char* path,
+       siz_t       offset,
+       bool_t      writable,
+       obj_t*      obj
+     )
+{
+	bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+}
+
+void bli_obj_free_file
+     (
+       obj_t* obj
+     )
+{
+	bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+}
+
+#endif
+
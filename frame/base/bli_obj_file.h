@@ -0,0 +1,71 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Create an object whose buffer is a shared memory mapping of (part of) a
+// file, starting at byte offset "offset". As with bli_obj_create(), rs and
+// cs give the strides in units of elements, except that rs = cs = 0 selects
+// column storage without any padding (cs = m). If writable is TRUE, the
+// file is created if it does not exist, and extended if it is too short.
+// Otherwise, the file must already hold the entire matrix, and the object
+// must not be written to.
+
+void bli_obj_create_with_file
+     (
+       num_t       dt,
+       dim_t       m,
+       dim_t       n,
+       inc_t       rs,
+       inc_t       cs,
+       const char* path,
+       siz_t       offset,
+       bool_t      writable,
+       obj_t*      obj
+     );
+
+// Unmap the buffer of an object created by bli_obj_create_with_file().
+// Any updates to the object are written back to the file by the operating
+// system.
+
+void bli_obj_free_file
+     (
+       obj_t* obj
+     );
+
+// Return the number of bytes spanned by the elements of an object.
+
+siz_t bli_obj_buffer_extent
+     (
+       obj_t* obj
+     );
+
@@ -0,0 +1,368 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// syscall() is not declared under strict POSIX feature test macros.
+#define _GNU_SOURCE
+
+#include "blis.h"
+
+static char* perfctr_event_str[ BLIS_NUM_PERFCTR_EVENTS ] =
+{
+	"cycles", "instructions", "l1d_misses", "llc_misses", "dtlb_misses",
+	"fp_ops"
+};
+
+char* bli_perfctr_event_string( perfctr_event_t event )
+{
+	return perfctr_event_str[ event ];
+}
+
+#if defined(BLIS_ENABLE_PERF_COUNTERS) && defined(__linux__)
+
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#define PERFCTR_CACHE_READ_MISS( cache ) \
+\
+	( ( cache ) | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | \
+	              ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) )
+
+// The generic events counted for every event except BLIS_PERFCTR_FP_OPS.
+static struct
+{
+	uint32_t type;
+	uint64_t config;
+} perfctr_attrs[ BLIS_NUM_PERFCTR_EVENTS - 1 ] =
+{
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+	{ PERF_TYPE_HW_CACHE, PERFCTR_CACHE_READ_MISS( PERF_COUNT_HW_CACHE_L1D ) },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+	{ PERF_TYPE_HW_CACHE, PERFCTR_CACHE_READ_MISS( PERF_COUNT_HW_CACHE_DTLB ) },
+};
+
+// There is no generic event for floating-point operations, so they are
+// counted as the weighted sum of one or more raw (model-specific) events.
+static uint64_t        perfctr_fp_config[ BLIS_PERFCTR_MAX_FP_EVENTS ];
+static uint64_t        perfctr_fp_weight[ BLIS_PERFCTR_MAX_FP_EVENTS ];
+static dim_t           perfctr_n_fp = 0;
+
+static bool_t          perfctr_enabled = FALSE;
+static perfctr_t       perfctr_ops[ BLIS_NUM_LEVEL3_OPS ];
+static pthread_mutex_t perfctr_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// -----------------------------------------------------------------------------
+
+// Choose the raw events used to count floating-point operations, either
+// from BLIS_PERF_FP_EVENTS (a comma-separated list of config[:weight]
+// pairs, in hexadecimal and decimal, respectively) or by vendor.
+static void bli_perfctr_init_fp_events( void )
+{
+	char* str = getenv( "BLIS_PERF_FP_EVENTS" );
+
+	perfctr_n_fp = 0;
+
+	if ( str != NULL )
+	{
+		while ( *str != '\0' && perfctr_n_fp < BLIS_PERFCTR_MAX_FP_EVENTS )
+		{
+			perfctr_fp_config[ perfctr_n_fp ] = strtoull( str, &str, 16 );
+			perfctr_fp_weight[ perfctr_n_fp ] = 1;
+
+			if ( *str == ':' )
+				perfctr_fp_weight[ perfctr_n_fp ] = strtoull( str + 1, &str, 10 );
+
+			++perfctr_n_fp;
+
+			if ( *str != ',' ) break;
+			++str;
+		}
+		return;
+	}
+
+#if defined(__x86_64__) || defined(__i386)
+	{
+		uint32_t eax, ebx, ecx, edx;
+		uint32_t family;
+
+		__cpuid( 0, eax, ebx, ecx, edx );
+
+		// The vendor string is stored in ebx, edx, and ecx.
+		bool_t is_intel = ( ebx == 0x756e6547 && edx == 0x49656e69 && ecx == 0x6c65746e );
+		bool_t is_amd   = ( ebx == 0x68747541 && edx == 0x69746e65 && ecx == 0x444d4163 );
+
+		__cpuid( 1, eax, ebx, ecx, edx );
+
+		family = ( ( eax >> 8 ) & 0xf ) + ( ( eax >> 20 ) & 0xff );
+
+		if ( is_intel && family == 6 )
+		{
+			// FP_ARITH_INST_RETIRED (Broadwell and later), with one umask
+			// for each of scalar, 128-, 256-, and 512-bit double and single
+			// precision, weighted by the number of elements per instruction.
+			// (FMA instructions are counted twice by the hardware.)
+			uint64_t umask[]  = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+			uint64_t weight[] = {    1,    1,    2,    4,    4,    8,    8,   16 };
+
+			for ( dim_t i = 0; i < 8; ++i )
+			{
+				perfctr_fp_config[ i ] = 0xc7 | ( umask[ i ] << 8 );
+				perfctr_fp_weight[ i ] = weight[ i ];
+			}
+			perfctr_n_fp = 8;
+		}
+		else if ( is_amd && family >= 0x17 )
+		{
+			// Retired SSE/AVX FLOPs (Zen and later).
+			perfctr_fp_config[ 0 ] = 0x03 | ( 0xffull << 8 );
+			perfctr_fp_weight[ 0 ] = 1;
+			perfctr_n_fp = 1;
+		}
+	}
+#endif
+}
+
+void bli_perfctr_init( void )
+{
+	char* str = getenv( "BLIS_PERF_COUNTERS" );
+
+	if ( str != NULL ) perfctr_enabled = ( atoi( str ) != 0 );
+
+	bli_perfctr_init_fp_events();
+
+	bli_perfctr_reset();
+}
+
+void bli_perfctr_finalize( void )
+{
+	perfctr_enabled = FALSE;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_perfctr_set_enabled( bool_t enabled )
+{
+	perfctr_enabled = enabled;
+}
+
+bool_t bli_perfctr_is_enabled( void )
+{
+	return perfctr_enabled;
+}
+
+void bli_perfctr_reset( void )
+{
+	pthread_mutex_lock( &perfctr_mutex );
+
+	memset( perfctr_ops, 0, sizeof( perfctr_ops ) );
+
+	pthread_mutex_unlock( &perfctr_mutex );
+}
+
+void bli_perfctr_query( opid_t family, perfctr_t* ctr )
+{
+	memset( ctr, 0, sizeof( perfctr_t ) );
+
+	pthread_mutex_lock( &perfctr_mutex );
+
+	// Sum over all level-3 operations if BLIS_NOID was given.
+	for ( opid_t op = 0; op < BLIS_NUM_LEVEL3_OPS; ++op )
+	{
+		if ( family != BLIS_NOID && family != op ) continue;
+
+		ctr->n_calls += perfctr_ops[ op ].n_calls;
+
+		for ( dim_t e = 0; e < BLIS_NUM_PERFCTR_EVENTS; ++e )
+		{
+			ctr->count[ e ] += perfctr_ops[ op ].count[ e ];
+			ctr->avail[ e ] |= perfctr_ops[ op ].avail[ e ];
+		}
+	}
+
+	pthread_mutex_unlock( &perfctr_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+// Open a counter for the calling thread (on any cpu), initially disabled.
+static int bli_perfctr_open( uint32_t type, uint64_t config )
+{
+	struct perf_event_attr attr;
+
+	memset( &attr, 0, sizeof( attr ) );
+
+	attr.size           = sizeof( attr );
+	attr.type           = type;
+	attr.config         = config;
+	attr.disabled       = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv     = 1;
+	attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED |
+	                      PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+	return ( int )syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+}
+
+// Read and close a counter. Since there may be more events than hardware
+// counters, the kernel may multiplex them, in which case the count is
+// scaled by the fraction of the time that the event was counted.
+static bool_t bli_perfctr_close( int fd, uint64_t* count )
+{
+	uint64_t buf[ 3 ];
+	bool_t   r_val = FALSE;
+
+	if ( fd < 0 ) return FALSE;
+
+	if ( read( fd, buf, sizeof( buf ) ) == sizeof( buf ) )
+	{
+		*count = ( buf[ 2 ] == 0 ? 0 :
+		           ( uint64_t )( ( double )buf[ 0 ] * buf[ 1 ] / buf[ 2 ] ) );
+		r_val  = TRUE;
+	}
+
+	close( fd );
+
+	return r_val;
+}
+
+void bli_perfctr_begin( perfctr_thr_t* thr )
+{
+	dim_t e, i;
+
+	thr->active = perfctr_enabled;
+
+	if ( !thr->active ) return;
+
+	for ( e = 0; e < BLIS_NUM_PERFCTR_EVENTS - 1; ++e )
+		thr->fd[ e ] = bli_perfctr_open( perfctr_attrs[ e ].type,
+		                                 perfctr_attrs[ e ].config );
+
+	for ( i = 0; i < perfctr_n_fp; ++i )
+		thr->fd_fp[ i ] = bli_perfctr_open( PERF_TYPE_RAW,
+		                                    perfctr_fp_config[ i ] );
+
+	// Start all of the counters only after they have all been opened.
+	for ( e = 0; e < BLIS_NUM_PERFCTR_EVENTS - 1; ++e )
+		if ( thr->fd[ e ] >= 0 ) ioctl( thr->fd[ e ], PERF_EVENT_IOC_ENABLE, 0 );
+
+	for ( i = 0; i < perfctr_n_fp; ++i )
+		if ( thr->fd_fp[ i ] >= 0 ) ioctl( thr->fd_fp[ i ], PERF_EVENT_IOC_ENABLE, 0 );
+}
+
+void bli_perfctr_end( perfctr_thr_t* thr, opid_t family, dim_t id )
+{
+	uint64_t count[ BLIS_NUM_PERFCTR_EVENTS ] = { 0 };
+	bool_t   avail[ BLIS_NUM_PERFCTR_EVENTS ] = { FALSE };
+	uint64_t c;
+	dim_t    e, i;
+
+	if ( !thr->active ) return;
+
+	for ( e = 0; e < BLIS_NUM_PERFCTR_EVENTS - 1; ++e )
+		if ( thr->fd[ e ] >= 0 ) ioctl( thr->fd[ e ], PERF_EVENT_IOC_DISABLE, 0 );
+
+	for ( i = 0; i < perfctr_n_fp; ++i )
+		if ( thr->fd_fp[ i ] >= 0 ) ioctl( thr->fd_fp[ i ], PERF_EVENT_IOC_DISABLE, 0 );
+
+	for ( e = 0; e < BLIS_NUM_PERFCTR_EVENTS - 1; ++e )
+	{
+		avail[ e ] = bli_perfctr_close( thr->fd[ e ], &count[ e ] );
+	}
+
+	for ( i = 0; i < perfctr_n_fp; ++i )
+	{
+		if ( bli_perfctr_close( thr->fd_fp[ i ], &c ) )
+		{
+			count[ BLIS_PERFCTR_FP_OPS ] += c * perfctr_fp_weight[ i ];
+			avail[ BLIS_PERFCTR_FP_OPS ]  = TRUE;
+		}
+	}
+
+	if ( family >= BLIS_NUM_LEVEL3_OPS ) return;
+
+	pthread_mutex_lock( &perfctr_mutex );
+
+	// Count each operation once, via its chief thread.
+	if ( id == 0 ) perfctr_ops[ family ].n_calls += 1;
+
+	for ( e = 0; e < BLIS_NUM_PERFCTR_EVENTS; ++e )
+	{
+		perfctr_ops[ family ].count[ e ] += count[ e ];
+		perfctr_ops[ family ].avail[ e ] |= avail[ e ];
+	}
+
+	pthread_mutex_unlock( &perfctr_mutex );
+}
+
+#else
+
+// -- Stubs for when hardware performance counters are disabled ----------------
+
+void bli_perfctr_init( void )
+{
+}
+
+void bli_perfctr_finalize( void )
+{
+}
+
+void bli_perfctr_set_enabled( bool_t enabled )
+{
+}
+
+bool_t bli_perfctr_is_enabled( void )
+{
+	return FALSE;
+}
+
+void bli_perfctr_reset( void )
+{
+}
+
+void bli_perfctr_query( opid_t family, perfctr_t* ctr )
+{
+	memset( ctr, 0, sizeof( perfctr_t ) );
+}
+
+void bli_perfctr_begin( perfctr_thr_t* thr )
+{
+}
+
+void bli_perfctr_end( perfctr_thr_t* thr, opid_t family, dim_t id )
+{
+}
+
+#endif
@@ -0,0 +1,106 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_PERFCTR_H
+#define BLIS_PERFCTR_H
+
+// Hardware performance counters. When BLIS is configured with
+// --enable-perf-counters (on Linux), each thread executing a level-3
+// operation opens a set of counters via perf_event_open() in the thread
+// decorator, and upon completion adds its counts to the totals for the
+// operation. Counting must also be enabled at runtime, either via
+// bli_perfctr_set_enabled() or by setting BLIS_PERF_COUNTERS=1.
+
+typedef enum
+{
+	BLIS_PERFCTR_CYCLES = 0,
+	BLIS_PERFCTR_INSTRUCTIONS,
+	BLIS_PERFCTR_L1D_MISSES,
+	BLIS_PERFCTR_LLC_MISSES,
+	BLIS_PERFCTR_DTLB_MISSES,
+	BLIS_PERFCTR_FP_OPS
+} perfctr_event_t;
+
+#define BLIS_NUM_PERFCTR_EVENTS 6
+
+// The maximum number of hardware events that are summed to count the
+// floating-point operations (e.g. one per vector width on Intel).
+#define BLIS_PERFCTR_MAX_FP_EVENTS 8
+
+// Totals accumulated over all threads for one or more operations. An event
+// that could not be opened on this system is marked unavailable.
+typedef struct
+{
+	uint64_t n_calls;
+	uint64_t count[ BLIS_NUM_PERFCTR_EVENTS ];
+	bool_t   avail[ BLIS_NUM_PERFCTR_EVENTS ];
+} perfctr_t;
+
+// The counters opened by one thread for the duration of one operation.
+typedef struct
+{
+	bool_t   active;
+	int      fd[ BLIS_NUM_PERFCTR_EVENTS - 1 ];
+	int      fd_fp[ BLIS_PERFCTR_MAX_FP_EVENTS ];
+} perfctr_thr_t;
+
+void   bli_perfctr_init( void );
+void   bli_perfctr_finalize( void );
+
+void   bli_perfctr_set_enabled( bool_t enabled );
+bool_t bli_perfctr_is_enabled( void );
+void   bli_perfctr_reset( void );
+void   bli_perfctr_query( opid_t family, perfctr_t* ctr );
+char*  bli_perfctr_event_string( perfctr_event_t event );
+
+void   bli_perfctr_begin( perfctr_thr_t* thr );
+void   bli_perfctr_end( perfctr_thr_t* thr, opid_t family, dim_t id );
+
+// Hooks used within the level-3 thread decorators.
+
+#ifdef BLIS_ENABLE_PERF_COUNTERS
+
+#define BLIS_PERFCTR_DECL( t )              perfctr_thr_t t
+#define BLIS_PERFCTR_BEGIN( t )             bli_perfctr_begin( &t )
+#define BLIS_PERFCTR_END( t, family, id )   bli_perfctr_end( &t, family, id )
+
+#else
+
+#define BLIS_PERFCTR_DECL( t )
+#define BLIS_PERFCTR_BEGIN( t )
+#define BLIS_PERFCTR_END( t, family, id )
+
+#endif
+
+#endif
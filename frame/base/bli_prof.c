@@ -0,0 +1,384 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_L3_PROF
+
+typedef struct
+{
+	uint64_t t_beg;
+	uint64_t t_end;
+	int32_t  tid;
+	int16_t  kind;
+	int16_t  level;
+} prof_event_t;
+
+// The buffer of individual events, and the number of events recorded since
+// the last reset (which may exceed BLIS_PROF_MAX_EVENTS).
+static prof_event_t* prof_events   = NULL;
+static siz_t         prof_n_events = 0;
+
+// Per-thread totals, indexed by thread id, event kind, and level. Since
+// BLIS_NO_PART is the last bszid_t value, it is used as the index for
+// events that occur outside of any partitioning loop.
+static uint64_t      prof_ticks[ BLIS_PROF_MAX_THREADS ]
+                                [ BLIS_NUM_PROF_KINDS ]
+                                [ BLIS_NUM_BLKSZS + 1 ];
+static uint64_t      prof_count[ BLIS_PROF_MAX_THREADS ]
+                                [ BLIS_NUM_PROF_KINDS ]
+                                [ BLIS_NUM_BLKSZS + 1 ];
+
+// The tick counter and wall clock values at the last reset, which are used
+// to estimate the tick rate when dumping.
+static uint64_t      prof_tick_ref = 0;
+static double        prof_time_ref = 0.0;
+
+// The id of the current thread within the level-3 operation it is
+// executing, and the partitioning loop it is currently executing.
+static BLIS_THREAD_LOCAL dim_t   prof_tid   = 0;
+static BLIS_THREAD_LOCAL bszid_t prof_level = BLIS_NO_PART;
+
+static char* prof_kind_str[ BLIS_NUM_PROF_KINDS ] =
+{
+	"packm_a", "packm_b", "ker", "barrier"
+};
+
+static char* prof_level_str[ BLIS_NUM_BLKSZS + 1 ] =
+{
+	"kr", "mr", "nr", "mc", "kc", "nc", "m2", "n2", "af", "df", "xf", "vt",
+	"none"
+};
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_init( void )
+{
+	prof_events = bli_malloc_intl( sizeof( prof_event_t ) *
+	                               BLIS_PROF_MAX_EVENTS );
+
+	bli_prof_reset();
+}
+
+void bli_prof_finalize( void )
+{
+	// If requested, dump the profile to the file named by BLIS_PROF_FILE,
+	// in the format named by BLIS_PROF_FORMAT ("json" or "chrome").
+	char* filename = getenv( "BLIS_PROF_FILE" );
+	char* format   = getenv( "BLIS_PROF_FORMAT" );
+
+	if ( filename != NULL )
+	{
+		prof_fmt_t fmt = BLIS_PROF_JSON;
+
+		if ( format != NULL && strcmp( format, "chrome" ) == 0 )
+			fmt = BLIS_PROF_CHROME_TRACE;
+
+		bli_prof_dump( filename, fmt );
+	}
+
+	bli_free_intl( prof_events );
+	prof_events = NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+bool_t bli_prof_is_enabled( void )
+{
+	return TRUE;
+}
+
+void bli_prof_reset( void )
+{
+	// NOTE: This function must not be called while a level-3 operation is
+	// executing.
+	memset( prof_ticks, 0, sizeof( prof_ticks ) );
+	memset( prof_count, 0, sizeof( prof_count ) );
+
+	prof_n_events = 0;
+
+	prof_tick_ref = bli_prof_ticks();
+	prof_time_ref = bli_clock();
+}
+
+uint64_t bli_prof_ticks( void )
+{
+#if defined(__x86_64__) || defined(__i386__)
+	uint32_t lo, hi;
+
+	__asm__ __volatile__ ( "rdtsc" : "=a" (lo), "=d" (hi) );
+
+	return ( ( uint64_t )hi << 32 ) | lo;
+#else
+	return ( uint64_t )( bli_clock() * 1.0e9 );
+#endif
+}
+
+void bli_prof_set_thread_id( dim_t id )
+{
+	prof_tid   = id;
+	prof_level = BLIS_NO_PART;
+}
+
+prof_kind_t bli_prof_packm_kind( cntl_t* cntl )
+{
+	// Packing of A and B is distinguished by the pack schema: A is packed
+	// into row panels and B into column panels.
+	if ( bli_is_row_packed( bli_cntl_packm_params_pack_schema( cntl ) ) )
+		return BLIS_PROF_PACKM_A;
+	else
+		return BLIS_PROF_PACKM_B;
+}
+
+static bool_t bli_prof_is_ker_node( cntl_t* cntl )
+{
+	// The macro-kernel node is the parent of the (empty) leaf node.
+	return ( bool_t )
+	       ( bli_cntl_sub_node( cntl ) != NULL &&
+	         bli_cntl_is_leaf( bli_cntl_sub_node( cntl ) ) );
+}
+
+void bli_prof_node_enter( prof_node_t* node, cntl_t* cntl )
+{
+	bszid_t bszid = bli_cntl_bszid( cntl );
+
+	node->level = prof_level;
+
+	// Only partitioning loops change the level; packing and macro-kernel
+	// nodes inherit the level of their parent.
+	if ( bszid != BLIS_NO_PART && !bli_prof_is_ker_node( cntl ) )
+		prof_level = bszid;
+
+	node->t_beg = bli_prof_ticks();
+}
+
+void bli_prof_node_exit( prof_node_t* node, cntl_t* cntl )
+{
+	if ( bli_prof_is_ker_node( cntl ) )
+		bli_prof_record( BLIS_PROF_KER, node->t_beg, bli_prof_ticks() );
+
+	prof_level = node->level;
+}
+
+void bli_prof_record( prof_kind_t kind, uint64_t t_beg, uint64_t t_end )
+{
+	dim_t   tid   = bli_min( prof_tid, BLIS_PROF_MAX_THREADS - 1 );
+	bszid_t level = prof_level;
+	siz_t   index;
+
+	__atomic_fetch_add( &prof_ticks[ tid ][ kind ][ level ], t_end - t_beg,
+	                    __ATOMIC_RELAXED );
+	__atomic_fetch_add( &prof_count[ tid ][ kind ][ level ], 1,
+	                    __ATOMIC_RELAXED );
+
+	index = __atomic_fetch_add( &prof_n_events, 1, __ATOMIC_RELAXED );
+
+	if ( prof_events == NULL || index >= BLIS_PROF_MAX_EVENTS ) return;
+
+	prof_events[ index ].t_beg = t_beg;
+	prof_events[ index ].t_end = t_end;
+	prof_events[ index ].tid   = ( int32_t )prof_tid;
+	prof_events[ index ].kind  = ( int16_t )kind;
+	prof_events[ index ].level = ( int16_t )level;
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_prof_dump_json( FILE* file, double ticks_per_sec )
+{
+	siz_t  n_events = bli_min( prof_n_events, BLIS_PROF_MAX_EVENTS );
+	bool_t first    = TRUE;
+
+	fprintf( file, "{\n" );
+	fprintf( file, "  \"ticks_per_second\": %.6e,\n", ticks_per_sec );
+	fprintf( file, "  \"events_recorded\": %lu,\n", ( unsigned long )prof_n_events );
+	fprintf( file, "  \"events_dumped\": %lu,\n", ( unsigned long )n_events );
+
+	// Output the per-thread totals for each event kind and level.
+	fprintf( file, "  \"totals\": [" );
+
+	for ( dim_t t = 0; t < BLIS_PROF_MAX_THREADS; ++t )
+	for ( dim_t k = 0; k < BLIS_NUM_PROF_KINDS; ++k )
+	for ( dim_t l = 0; l < BLIS_NUM_BLKSZS + 1; ++l )
+	{
+		if ( prof_count[ t ][ k ][ l ] == 0 ) continue;
+
+		fprintf( file, "%s\n    { \"thread\": %ld, \"kind\": \"%s\", "
+		               "\"level\": \"%s\", \"count\": %lu, \"ticks\": %lu, "
+		               "\"seconds\": %.6e }",
+		         ( first ? "" : "," ), ( long )t,
+		         prof_kind_str[ k ], prof_level_str[ l ],
+		         ( unsigned long )prof_count[ t ][ k ][ l ],
+		         ( unsigned long )prof_ticks[ t ][ k ][ l ],
+		         prof_ticks[ t ][ k ][ l ] / ticks_per_sec );
+		first = FALSE;
+	}
+
+	fprintf( file, "\n  ],\n" );
+
+	// Output the individual events, with start times relative to the last
+	// reset.
+	fprintf( file, "  \"events\": [" );
+
+	for ( siz_t i = 0; i < n_events; ++i )
+	{
+		prof_event_t* e = &prof_events[ i ];
+
+		fprintf( file, "%s\n    { \"thread\": %d, \"kind\": \"%s\", "
+		               "\"level\": \"%s\", \"start\": %lu, \"ticks\": %lu }",
+		         ( i == 0 ? "" : "," ), ( int )e->tid,
+		         prof_kind_str[ e->kind ], prof_level_str[ e->level ],
+		         ( unsigned long )( e->t_beg - prof_tick_ref ),
+		         ( unsigned long )( e->t_end - e->t_beg ) );
+	}
+
+	fprintf( file, "\n  ]\n" );
+	fprintf( file, "}\n" );
+}
+
+static void bli_prof_dump_chrome( FILE* file, double ticks_per_sec )
+{
+	siz_t  n_events    = bli_min( prof_n_events, BLIS_PROF_MAX_EVENTS );
+	double us_per_tick = 1.0e6 / ticks_per_sec;
+
+	// Output the events in the Trace Event Format understood by
+	// chrome://tracing and Perfetto, with one complete ("X") event per
+	// recorded event and times in microseconds.
+	fprintf( file, "{\n" );
+	fprintf( file, "  \"displayTimeUnit\": \"ns\",\n" );
+	fprintf( file, "  \"traceEvents\": [" );
+
+	for ( siz_t i = 0; i < n_events; ++i )
+	{
+		prof_event_t* e = &prof_events[ i ];
+
+		fprintf( file, "%s\n    { \"name\": \"%s\", \"cat\": \"%s\", "
+		               "\"ph\": \"X\", \"pid\": 0, \"tid\": %d, "
+		               "\"ts\": %.3f, \"dur\": %.3f }",
+		         ( i == 0 ? "" : "," ),
+		         prof_kind_str[ e->kind ], prof_level_str[ e->level ],
+		         ( int )e->tid,
+		         ( e->t_beg - prof_tick_ref ) * us_per_tick,
+		         ( e->t_end - e->t_beg ) * us_per_tick );
+	}
+
+	fprintf( file, "\n  ]\n" );
+	fprintf( file, "}\n" );
+}
+
+err_t bli_prof_dump( const char* filename, prof_fmt_t fmt )
+{
+	FILE*  file;
+	double ticks_per_sec;
+	double time_diff = bli_clock() - prof_time_ref;
+
+	// Estimate the tick rate from the ticks and wall clock time that have
+	// elapsed since the last reset. If too little time has passed for a
+	// reliable estimate, assume a 1 GHz counter.
+	if ( time_diff > 1.0e-3 )
+		ticks_per_sec = ( bli_prof_ticks() - prof_tick_ref ) / time_diff;
+	else
+		ticks_per_sec = 1.0e9;
+
+	// A NULL filename denotes standard output.
+	if ( filename == NULL ) file = stdout;
+	else                    file = fopen( filename, "w" );
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	if ( fmt == BLIS_PROF_CHROME_TRACE )
+		bli_prof_dump_chrome( file, ticks_per_sec );
+	else
+		bli_prof_dump_json( file, ticks_per_sec );
+
+	if ( file != stdout ) fclose( file );
+
+	return BLIS_SUCCESS;
+}
+
+#else
+
+// -- Profiling disabled -------------------------------------------------------
+
+void bli_prof_init( void )
+{
+}
+
+void bli_prof_finalize( void )
+{
+}
+
+bool_t bli_prof_is_enabled( void )
+{
+	return FALSE;
+}
+
+void bli_prof_reset( void )
+{
+}
+
+err_t bli_prof_dump( const char* filename, prof_fmt_t fmt )
+{
+	// There is nothing to dump unless profiling was enabled at
+	// configure-time.
+	return BLIS_NOT_YET_IMPLEMENTED;
+}
+
+uint64_t bli_prof_ticks( void )
+{
+	return 0;
+}
+
+void bli_prof_set_thread_id( dim_t id )
+{
+}
+
+prof_kind_t bli_prof_packm_kind( cntl_t* cntl )
+{
+	return BLIS_PROF_PACKM_A;
+}
+
+void bli_prof_node_enter( prof_node_t* node, cntl_t* cntl )
+{
+}
+
+void bli_prof_node_exit( prof_node_t* node, cntl_t* cntl )
+{
+}
+
+void bli_prof_record( prof_kind_t kind, uint64_t t_beg, uint64_t t_end )
+{
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_PROF_H
+#define BLIS_PROF_H
+
+// Level-3 profiling. When BLIS is configured with --enable-l3-prof, the
+// level-3 back-ends record, for each thread, the ticks spent packing A and
+// B, executing macro-kernels, and waiting at barriers, along with the
+// partitioning loop (control tree level) within which each event occurred.
+// When profiling is disabled, the hooks below expand to nothing and the
+// API functions are no-ops.
+
+typedef enum
+{
+	BLIS_PROF_PACKM_A = 0,
+	BLIS_PROF_PACKM_B,
+	BLIS_PROF_KER,
+	BLIS_PROF_BARRIER
+} prof_kind_t;
+
+#define BLIS_NUM_PROF_KINDS 4
+
+// The state saved upon entering a control tree node, which is restored
+// upon exiting it.
+typedef struct
+{
+	bszid_t  level;
+	uint64_t t_beg;
+} prof_node_t;
+
+typedef enum
+{
+	BLIS_PROF_JSON = 0,
+	BLIS_PROF_CHROME_TRACE
+} prof_fmt_t;
+
+// The maximum number of individual events that are retained for dumping.
+// Events beyond this limit are still counted in the per-thread totals.
+#ifndef BLIS_PROF_MAX_EVENTS
+#define BLIS_PROF_MAX_EVENTS  262144
+#endif
+
+// The maximum number of threads for which per-thread totals are kept.
+// Events from threads with larger ids are accumulated into the last slot.
+#ifndef BLIS_PROF_MAX_THREADS
+#define BLIS_PROF_MAX_THREADS 256
+#endif
+
+void        bli_prof_init( void );
+void        bli_prof_finalize( void );
+
+bool_t      bli_prof_is_enabled( void );
+void        bli_prof_reset( void );
+err_t       bli_prof_dump( const char* filename, prof_fmt_t fmt );
+
+uint64_t    bli_prof_ticks( void );
+void        bli_prof_set_thread_id( dim_t id );
+prof_kind_t bli_prof_packm_kind( cntl_t* cntl );
+void        bli_prof_node_enter( prof_node_t* node, cntl_t* cntl );
+void        bli_prof_node_exit( prof_node_t* node, cntl_t* cntl );
+void        bli_prof_record( prof_kind_t kind, uint64_t t_beg, uint64_t t_end );
+
+// Instrumentation hooks used within the level-3 back-ends.
+
+#ifdef BLIS_ENABLE_L3_PROF
+
+#define BLIS_PROF_DECL( t )              uint64_t t
+#define BLIS_PROF_START( t )             t = bli_prof_ticks()
+#define BLIS_PROF_STOP( kind, t )        bli_prof_record( kind, t, bli_prof_ticks() )
+
+#define BLIS_PROF_NODE_DECL( n )         prof_node_t n
+#define BLIS_PROF_NODE_ENTER( n, cntl )  bli_prof_node_enter( &n, cntl )
+#define BLIS_PROF_NODE_EXIT( n, cntl )   bli_prof_node_exit( &n, cntl )
+
+#define BLIS_PROF_SET_THREAD_ID( id )    bli_prof_set_thread_id( id )
+
+#else
+
+#define BLIS_PROF_DECL( t )
+#define BLIS_PROF_START( t )
+#define BLIS_PROF_STOP( kind, t )
+
+#define BLIS_PROF_NODE_DECL( n )
+#define BLIS_PROF_NODE_ENTER( n, cntl )
+#define BLIS_PROF_NODE_EXIT( n, cntl )
+
+#define BLIS_PROF_SET_THREAD_ID( id )
+
+#endif
+
+#endif
@@ -198,17 +198,46 @@ void bli_rntm_set_ways_from_rntm
 
 		pc = 1;
 
-		bli_partition_2x2( nt, m*BLIS_DEFAULT_M_THREAD_RATIO,
-		                       n*BLIS_DEFAULT_N_THREAD_RATIO, &ic, &jc );
+		// If the available CPUs span several L3 caches, give each L3 cache
+		// its own jc group (as many as evenly divide the threads), so that
+		// each packed block of B is shared only by threads on one L3 cache.
+		// The threads within each group are then factored between the ic
+		// and jr loops, so that each group's threads share its L3 cache.
+		dim_t n_l3 = bli_affinity_num_domains();
 
-		for ( ir = BLIS_DEFAULT_MR_THREAD_MAX ; ir > 1 ; ir-- )
+		jc = bli_gcd( nt, n_l3 );
+
+		if ( jc > 1 && n >= jc )
 		{
-			if ( ic % ir == 0 ) { ic /= ir; break; }
+			dim_t jn;
+
+			bli_partition_2x2( nt / jc, m*BLIS_DEFAULT_M_THREAD_RATIO,
+			                            ( n / jc )*BLIS_DEFAULT_N_THREAD_RATIO,
+			                            &ic, &jn );
+
+			for ( jr = BLIS_DEFAULT_NR_THREAD_MAX ; jr > 1 ; jr-- )
+			{
+				if ( jn % jr == 0 ) break;
+			}
+
+			// Any parallelism along n that the jr loop can't absorb is
+			// given to the ic loop instead of crossing L3 caches.
+			ic *= jn / jr;
+		}
+		else
+		{
+			bli_partition_2x2( nt, m*BLIS_DEFAULT_M_THREAD_RATIO,
+			                       n*BLIS_DEFAULT_N_THREAD_RATIO, &ic, &jc );
+
+			for ( jr = BLIS_DEFAULT_NR_THREAD_MAX ; jr > 1 ; jr-- )
+			{
+				if ( jc % jr == 0 ) { jc /= jr; break; }
+			}
 		}
 
-		for ( jr = BLIS_DEFAULT_NR_THREAD_MAX ; jr > 1 ; jr-- )
+		for ( ir = BLIS_DEFAULT_MR_THREAD_MAX ; ir > 1 ; ir-- )
 		{
-			if ( jc % jr == 0 ) { jc /= jr; break; }
+			if ( ic % ir == 0 ) { ic /= ir; break; }
 		}
 	}
 	else // if ( ways_set == FALSE && nt_set == FALSE )
@@ -235,6 +264,38 @@ void bli_rntm_set_ways_from_rntm
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
 }
 
+void bli_rntm_limit_ways
+     (
+       dim_t   nt_max,
+       rntm_t* rntm
+     )
+{
+	dim_t ways[ 5 ];
+	dim_t nt_rem = bli_max( nt_max, 1 );
+	dim_t nt     = 1;
+
+	ways[ 0 ] = bli_rntm_jc_ways( rntm );
+	ways[ 1 ] = bli_rntm_pc_ways( rntm );
+	ways[ 2 ] = bli_rntm_ic_ways( rntm );
+	ways[ 3 ] = bli_rntm_jr_ways( rntm );
+	ways[ 4 ] = bli_rntm_ir_ways( rntm );
+
+	// Walk the loops from the outside in, giving each loop as many of its
+	// original ways as still fit within nt_max. Since a loop's ways are
+	// only ever reduced, any loop that an operation deliberately left
+	// unparallelized (e.g. the jc loop of trmm_r) stays that way.
+	for ( dim_t i = 0; i < 5; ++i )
+	{
+		ways[ i ] = bli_min( ways[ i ], nt_rem );
+		nt_rem   /= ways[ i ];
+		nt       *= ways[ i ];
+	}
+
+	bli_rntm_set_num_threads_only( nt, rntm );
+	bli_rntm_set_ways_only( ways[ 0 ], ways[ 1 ], ways[ 2 ],
+	                        ways[ 3 ], ways[ 4 ], rntm );
+}
+
 void bli_rntm_print
      (
        rntm_t* rntm
@@ -42,8 +42,12 @@
 /*
 typedef struct rntm_s
 {
-	dim_t     num_threads;
-	dim_t*    thrloop;
+	dim_t      num_threads;
+	dim_t*     thrloop;
+
+	affinity_t affinity;
+	dim_t      num_cpus;
+	dim_t*     cpus;
 } rntm_t;
 */
 
@@ -86,6 +90,19 @@ static dim_t bli_rntm_pr_ways( rntm_t* rntm )
 	return bli_rntm_ways_for( BLIS_KR, rntm );
 }
 
+static affinity_t bli_rntm_affinity( rntm_t* rntm )
+{
+	return rntm->affinity;
+}
+static dim_t bli_rntm_affinity_num_cpus( rntm_t* rntm )
+{
+	return rntm->num_cpus;
+}
+static dim_t* bli_rntm_affinity_cpus( rntm_t* rntm )
+{
+	return rntm->cpus;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -136,6 +153,16 @@ static void bli_rntm_set_ways_only( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_
 	bli_rntm_set_pr_ways_only(  1, rntm );
 }
 
+static void bli_rntm_set_affinity_only( affinity_t affinity, rntm_t* rntm )
+{
+	rntm->affinity = affinity;
+}
+static void bli_rntm_set_affinity_cpus_only( dim_t n_cpus, dim_t* cpus, rntm_t* rntm )
+{
+	rntm->num_cpus = n_cpus;
+	rntm->cpus     = cpus;
+}
+
 static void bli_rntm_clear_num_threads_only( rntm_t* rntm )
 {
 	bli_rntm_set_num_threads_only( -1, rntm );
@@ -144,6 +171,11 @@ static void bli_rntm_clear_ways_only( rntm_t* rntm )
 {
 	bli_rntm_set_ways_only( -1, -1, -1, -1, -1, rntm );
 }
+static void bli_rntm_clear_affinity_only( rntm_t* rntm )
+{
+	bli_rntm_set_affinity_only( BLIS_AFFINITY_DEFAULT, rntm );
+	bli_rntm_set_affinity_cpus_only( 0, NULL, rntm );
+}
 
 //
 // -- rntm_t modification (public API) -----------------------------------------
@@ -172,6 +204,23 @@ static void bli_rntm_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir,
 	bli_rntm_clear_num_threads_only( rntm );
 }
 
+static void bli_rntm_set_affinity( affinity_t affinity, rntm_t* rntm )
+{
+	// Record the thread affinity policy. An explicit list of CPUs must be
+	// given via bli_rntm_set_affinity_cpus() instead.
+	bli_rntm_set_affinity_only( affinity, rntm );
+	bli_rntm_set_affinity_cpus_only( 0, NULL, rntm );
+}
+
+static void bli_rntm_set_affinity_cpus( dim_t n_cpus, dim_t* cpus, rntm_t* rntm )
+{
+	// Record an explicit list of CPUs, to which thread i is bound to
+	// cpus[ i % n_cpus ]. The list is not copied, so it must remain valid
+	// for as long as the rntm_t is used.
+	bli_rntm_set_affinity_only( BLIS_AFFINITY_LIST, rntm );
+	bli_rntm_set_affinity_cpus_only( n_cpus, cpus, rntm );
+}
+
 //
 // -- rntm_t initialization ----------------------------------------------------
 //
@@ -181,12 +230,27 @@ static void bli_rntm_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir,
 // will be in a good state upon return.
 
 #define BLIS_RNTM_INITIALIZER { .num_threads = -1, \
-                                .thrloop = { -1, -1, -1, -1, -1, -1 } } \
+                                .thrloop = { -1, -1, -1, -1, -1, -1 }, \
+                                .affinity = BLIS_AFFINITY_DEFAULT, \
+                                .num_cpus = 0, \
+                                .cpus = NULL } \
+
+// The same, except that the rntm_t confines an operation to the calling
+// thread. Internal calls made from within level-3 threads (such as those
+// that pack and unpack micro-panels) use it so that level-1v/1m
+// parallelism is never nested inside level-3 parallelism.
+#define BLIS_RNTM_SINGLE_THREADED_INITIALIZER \
+                              { .num_threads = 1, \
+                                .thrloop = { -1, -1, -1, -1, -1, -1 }, \
+                                .affinity = BLIS_AFFINITY_DEFAULT, \
+                                .num_cpus = 0, \
+                                .cpus = NULL } \
 
 static void bli_rntm_init( rntm_t* rntm )
 {
 	bli_rntm_clear_num_threads_only( rntm );
 	bli_rntm_clear_ways_only( rntm );
+	bli_rntm_clear_affinity_only( rntm );
 }
 
 // -----------------------------------------------------------------------------
@@ -211,6 +275,12 @@ void bli_rntm_set_ways_from_rntm
        rntm_t* rntm
      );
 
+void bli_rntm_limit_ways
+     (
+       dim_t   nt_max,
+       rntm_t* rntm
+     );
+
 void bli_rntm_print
      (
        rntm_t* rntm
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -33,74 +33,69 @@
 */
 
 #include "blis.h"
-#include "f77_dot_sub.h"
 
 
 //
-// Define CBLAS subrotine wrapper interfaces.
+// Define BLAS-to-BLIS interfaces.
 //
-#undef  GENTFUNCDOT
-#define GENTFUNCDOT( ftype, ch, chc, blis_conjx, blasname, blisname ) \
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ftype, ftype_r, ch, chr, blasname, blisname ) \
 \
-void PASTEF773(ch,blasname,chc,sub) \
+void PASTEF77(ch,blasname) \
      ( \
-       const f77_int* n, \
-       const ftype*   x, const f77_int* incx, \
-       const ftype*   y, const f77_int* incy, \
-             ftype*   rval  \
+       const f77_char* uploa, \
+       const f77_int*  m, \
+       const ftype_r*  alpha, \
+       const ftype*    x, const f77_int* incx, \
+             ftype*    ap  \
      ) \
 { \
-	*rval = PASTEF772(ch,blasname,chc) \
+	uplo_t  blis_uploa; \
+	dim_t   m0; \
+	ftype*  x0; \
+	inc_t   incx0; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Perform BLAS parameter checking. */ \
+	PASTEBLACHK(blasname) \
 	( \
-	  n, \
-	  x, incx, \
-	  y, incy \
+	  MKSTR(ch), \
+	  MKSTR(blasname), \
+	  uploa, \
+	  m, \
+	  incx  \
 	); \
+\
+	/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
+	bli_param_map_netlib_to_blis_uplo( *uploa, &blis_uploa ); \
+\
+	/* Convert/typecast negative values of m to zero. */ \
+	bli_convert_blas_dim1( *m, m0 ); \
+\
+	/* If the input increments are negative, adjust the pointers so we can
+	   use positive increments instead. */ \
+	bli_convert_blas_incv( m0, (ftype*)x, *incx, x0, incx0 ); \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
+	( \
+	  blis_uploa, \
+	  BLIS_NO_CONJUGATE, \
+	  m0, \
+	  (ftype_r*)alpha, \
+	  x0, incx0, \
+	  ap, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
 }
 
-#ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTFUNCDOT_BLAS( dot, NULL )
-
-
-// -- "Black sheep" dot product function definitions --
-
-// Input vectors stored in single precision, computed in double precision,
-// with result returned in single precision.
-void PASTEF772(sds,dot,sub)
-     (
-       const f77_int* n,
-       const float*  sb,
-       const float*   x, const f77_int* incx,
-       const float*   y, const f77_int* incy,
-             float*   rval
-     )
-{
-	*rval = *sb + PASTEF77(sds,dot)
-	(
-	  n,
-	  sb,
-	  x, incx,
-	  y, incy
-	);
-}
-
-// Input vectors stored in single precision, computed in double precision,
-// with result returned in double precision.
-void PASTEF772(ds,dot,sub)
-     (
-       const f77_int* n,
-       const float*   x, const f77_int* incx,
-       const float*   y, const f77_int* incy,
-             double*  rval
-     )
-{
-	*rval = PASTEF77(ds,dot)
-	(
-	  n,
-	  x, incx,
-	  y, incy
-	);
-}
-
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTFUNCCO_BLAS( hpr, hpr )
 #endif
 
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -34,18 +34,21 @@
 
 
 //
-// Prototype CBLAS subroutine wrapper interfaces.
+// Prototype BLAS-to-BLIS interfaces.
 //
 #undef  GENTPROTR2
-#define GENTPROTR2( ftype_x, ftype_r, chx, chr, blasname ) \
+#define GENTPROTR2( ftype, ftype_r, chx, chr, blasname ) \
 \
-void PASTEF773(chr,chx,blasname,sub) \
+void PASTEF772(chx,chr,blasname) \
      ( \
        const f77_int* n, \
-       const ftype_x* x, const f77_int* incx, \
-             ftype_r* rval  \
+       ftype*   x, const f77_int* incx, \
+       ftype*   y, const f77_int* incy, \
+       const ftype_r* c, \
+       const ftype_r* s  \
      );
 
-#ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTPROTR2_BLAS( nrm2 )
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTPROTR2_BLAS( rot )
 #endif
+
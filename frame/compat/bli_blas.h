@@ -100,11 +100,6 @@
 #include "bla_scal.h"
 #include "bla_swap.h"
 
-#include "f77_amax_sub.h"
-#include "f77_asum_sub.h"
-#include "f77_dot_sub.h"
-#include "f77_nrm2_sub.h"
-
 
 // -- Level-2 BLAS prototypes --
 
@@ -143,6 +138,15 @@
 #include "bla_tpmv.h"
 #include "bla_tpsv.h"
 
+#include "bla_hpmv_check.h"
+#include "bla_hpr_check.h"
+#include "bla_hpr2_check.h"
+#include "bla_spmv_check.h"
+#include "bla_spr_check.h"
+#include "bla_spr2_check.h"
+#include "bla_tpmv_check.h"
+#include "bla_tpsv_check.h"
+
 // banded
 
 #include "bla_gbmv.h"
@@ -151,6 +155,12 @@
 #include "bla_tbmv.h"
 #include "bla_tbsv.h"
 
+#include "bla_gbmv_check.h"
+#include "bla_hbmv_check.h"
+#include "bla_sbmv_check.h"
+#include "bla_tbmv_check.h"
+#include "bla_tbsv_check.h"
+
 
 // -- Level-3 BLAS prototypes --
 
@@ -175,5 +185,12 @@
 #include "bla_trsm_check.h"
 
 
+// -- 64-bit BLAS prototypes --
+
+#if defined(BLIS_ENABLE_BLAS64) && !defined(BLIS_IS_BUILDING_BLAS64)
+#include "bli_blas64.h"
+#endif
+
+
 #endif // BLIS_ENABLE_BLAS
 #endif // BLIS_VIA_BLASTEST
@@ -0,0 +1,133 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// This header prototypes the 64-bit copy of the BLAS compatibility layer,
+// whose symbols carry a "_64_" suffix (e.g. dgemm_64_). It includes the
+// same prototype headers as bli_blas.h a second time, with the Fortran
+// name-mangling suffix changed and the BLAS integer types temporarily
+// mapped to a 64-bit integer. It is only #included from bli_blas.h, and
+// only when the 64-bit copy was built (and is not currently being built).
+
+#undef  BLIS_F77_SUFFIX
+#define BLIS_F77_SUFFIX _64_
+
+#define f77_int     int64_t
+#define bla_integer int64_t
+#define ftnlen      int64_t
+
+
+// -- Utility prototypes --
+
+#include "bla_lsame.h"
+#include "bla_xerbla.h"
+
+
+// -- Level-0 BLAS prototypes --
+
+#include "bla_cabs1.h"
+
+
+// -- Level-1 BLAS prototypes --
+
+#include "bla_amax.h"
+#include "bla_asum.h"
+#include "bla_axpy.h"
+#include "bla_copy.h"
+#include "bla_dot.h"
+#include "bla_nrm2.h"
+#include "bla_rot.h"
+#include "bla_rotg.h"
+#include "bla_rotm.h"
+#include "bla_rotmg.h"
+#include "bla_scal.h"
+#include "bla_swap.h"
+
+
+// -- Level-2 BLAS prototypes --
+
+// dense
+
+#include "bla_gemv.h"
+#include "bla_ger.h"
+#include "bla_hemv.h"
+#include "bla_her.h"
+#include "bla_her2.h"
+#include "bla_symv.h"
+#include "bla_syr.h"
+#include "bla_syr2.h"
+#include "bla_trmv.h"
+#include "bla_trsv.h"
+
+// packed
+
+#include "bla_hpmv.h"
+#include "bla_hpr.h"
+#include "bla_hpr2.h"
+#include "bla_spmv.h"
+#include "bla_spr.h"
+#include "bla_spr2.h"
+#include "bla_tpmv.h"
+#include "bla_tpsv.h"
+
+// banded
+
+#include "bla_gbmv.h"
+#include "bla_hbmv.h"
+#include "bla_sbmv.h"
+#include "bla_tbmv.h"
+#include "bla_tbsv.h"
+
+
+// -- Level-3 BLAS prototypes --
+
+#include "bla_gemm.h"
+#include "bla_hemm.h"
+#include "bla_herk.h"
+#include "bla_her2k.h"
+#include "bla_symm.h"
+#include "bla_syrk.h"
+#include "bla_syr2k.h"
+#include "bla_trmm.h"
+#include "bla_trsm.h"
+
+
+// Restore the default suffix and types.
+
+#undef  f77_int
+#undef  bla_integer
+#undef  ftnlen
+
+#undef  BLIS_F77_SUFFIX
+#define BLIS_F77_SUFFIX _
+
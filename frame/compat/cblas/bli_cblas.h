@@ -50,6 +50,55 @@
 #include "cblas.h"
 
 
+// -- Constants --
+
+// The longest CBLAS function name is "cblas_" plus a seven-character
+// datatype/operation string (e.g. "zher2k" or "izamax"), plus the null
+// terminator.
+#define BLIS_MAX_CBLAS_FUNC_STR_LENGTH (6+7+1)
+
+
+// -- Parameter mapping and checking --
+
+#include "bli_cblas_param_map.h"
+
+// Level-2
+#include "cblas_gemv_check.h"
+#include "cblas_gbmv_check.h"
+#include "cblas_ger_check.h"
+#include "cblas_hemv_check.h"
+#include "cblas_hbmv_check.h"
+#include "cblas_hpmv_check.h"
+#include "cblas_symv_check.h"
+#include "cblas_sbmv_check.h"
+#include "cblas_spmv_check.h"
+#include "cblas_her_check.h"
+#include "cblas_hpr_check.h"
+#include "cblas_syr_check.h"
+#include "cblas_spr_check.h"
+#include "cblas_her2_check.h"
+#include "cblas_hpr2_check.h"
+#include "cblas_syr2_check.h"
+#include "cblas_spr2_check.h"
+#include "cblas_trmv_check.h"
+#include "cblas_tbmv_check.h"
+#include "cblas_tpmv_check.h"
+#include "cblas_trsv_check.h"
+#include "cblas_tbsv_check.h"
+#include "cblas_tpsv_check.h"
+
+// Level-3
+#include "cblas_gemm_check.h"
+#include "cblas_hemm_check.h"
+#include "cblas_symm_check.h"
+#include "cblas_herk_check.h"
+#include "cblas_syrk_check.h"
+#include "cblas_her2k_check.h"
+#include "cblas_syr2k_check.h"
+#include "cblas_trmm_check.h"
+#include "cblas_trsm_check.h"
+
+
 #endif // BLIS_ENABLE_CBLAS
 
 #endif
@@ -0,0 +1,124 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_CBLAS_PARAM_MAP_H
+#define BLIS_CBLAS_PARAM_MAP_H
+
+#ifdef BLIS_ENABLE_CBLAS
+
+
+// --- Query the validity of CBLAS enumerated values --------------------------
+
+static inline bool_t bli_cblas_is_valid_order( enum CBLAS_ORDER order )
+{
+	return ( bool_t )( order == CblasRowMajor || order == CblasColMajor );
+}
+
+static inline bool_t bli_cblas_is_valid_side( enum CBLAS_SIDE side )
+{
+	return ( bool_t )( side == CblasLeft || side == CblasRight );
+}
+
+static inline bool_t bli_cblas_is_valid_uplo( enum CBLAS_UPLO uplo )
+{
+	return ( bool_t )( uplo == CblasUpper || uplo == CblasLower );
+}
+
+static inline bool_t bli_cblas_is_valid_trans( enum CBLAS_TRANSPOSE trans )
+{
+	return ( bool_t )( trans == CblasNoTrans ||
+	                   trans == CblasTrans   ||
+	                   trans == CblasConjTrans );
+}
+
+static inline bool_t bli_cblas_is_valid_diag( enum CBLAS_DIAG diag )
+{
+	return ( bool_t )( diag == CblasNonUnit || diag == CblasUnit );
+}
+
+// Return the smallest valid leading dimension of an m x n matrix.
+static inline f77_int bli_cblas_min_ld( enum CBLAS_ORDER order, f77_int m, f77_int n )
+{
+	return bli_max( 1, ( order == CblasRowMajor ? n : m ) );
+}
+
+
+// --- Map CBLAS enumerated values to their BLIS equivalents -------------------
+
+// NOTE: These functions assume that the values have already been checked
+// for validity (via the cblas_*_check() macros).
+
+static inline void bli_param_map_cblas_to_blis_side( enum CBLAS_SIDE side, side_t* blis_side )
+{
+	if ( side == CblasLeft ) *blis_side = BLIS_LEFT;
+	else                     *blis_side = BLIS_RIGHT;
+}
+
+static inline void bli_param_map_cblas_to_blis_uplo( enum CBLAS_UPLO uplo, uplo_t* blis_uplo )
+{
+	if ( uplo == CblasLower ) *blis_uplo = BLIS_LOWER;
+	else                      *blis_uplo = BLIS_UPPER;
+}
+
+static inline void bli_param_map_cblas_to_blis_trans( enum CBLAS_TRANSPOSE trans, trans_t* blis_trans )
+{
+	if      ( trans == CblasNoTrans ) *blis_trans = BLIS_NO_TRANSPOSE;
+	else if ( trans == CblasTrans   ) *blis_trans = BLIS_TRANSPOSE;
+	else                              *blis_trans = BLIS_CONJ_TRANSPOSE;
+}
+
+static inline void bli_param_map_cblas_to_blis_diag( enum CBLAS_DIAG diag, diag_t* blis_diag )
+{
+	if ( diag == CblasUnit ) *blis_diag = BLIS_UNIT_DIAG;
+	else                     *blis_diag = BLIS_NONUNIT_DIAG;
+}
+
+
+// --- Set the strides of a matrix stored in CBLAS order ----------------------
+
+// A row-major matrix is simply a matrix with unit column stride, which BLIS
+// supports natively, so no operand ever needs to be transposed or copied.
+
+static inline void bli_cblas_set_strides( enum CBLAS_ORDER order, f77_int ld, inc_t* rs, inc_t* cs )
+{
+	if ( order == CblasRowMajor ) { *rs = ld; *cs = 1;  }
+	else                          { *rs = 1;  *cs = ld; }
+}
+
+
+#endif // BLIS_ENABLE_CBLAS
+
+#endif
+
@@ -0,0 +1,67 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef BLIS_ENABLE_CBLAS
+
+#define cblas_ger_check( dt_str, op_str, order, m, n, incx, incy, lda ) \
+{ \
+	f77_int info = 0; \
+\
+	if      ( !bli_cblas_is_valid_order( order ) ) \
+		info = 1; \
+	else if ( m < 0 ) \
+		info = 2; \
+	else if ( n < 0 ) \
+		info = 3; \
+	else if ( incx == 0 ) \
+		info = 6; \
+	else if ( incy == 0 ) \
+		info = 8; \
+	else if ( lda < bli_cblas_min_ld( order, m, n ) ) \
+		info = 10; \
+\
+	if ( info != 0 ) \
+	{ \
+		char func_str[ BLIS_MAX_CBLAS_FUNC_STR_LENGTH ]; \
+\
+		sprintf( func_str, "cblas_%s%s", dt_str, op_str ); \
+\
+		cblas_xerbla( info, func_str, "" ); \
+\
+		return; \
+	} \
+}
+
+#endif
+
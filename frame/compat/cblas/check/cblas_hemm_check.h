@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,41 +32,44 @@
 
 */
 
-
-//
-// Prototype CBLAS subroutine wrapper interfaces.
-//
-#undef  GENTPROTDOT
-#define GENTPROTDOT( ftype, ch, chc, blasname ) \
-\
-void PASTEF773(ch,blasname,chc,sub) \
-     ( \
-       const f77_int* n, \
-       const ftype*   x, const f77_int* incx, \
-       const ftype*   y, const f77_int* incy, \
-             ftype*   rval  \
-     );
-
 #ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTPROTDOT_BLAS( dot )
 
+#define cblas_hemm_check( dt_str, op_str, order, side, uploa, m, n, lda, ldb, ldc ) \
+{ \
+	f77_int info = 0; \
+	f77_int ka; \
+\
+	if ( side == CblasLeft ) { ka = m; } \
+	else                     { ka = n; } \
+\
+	if      ( !bli_cblas_is_valid_order( order ) ) \
+		info = 1; \
+	else if ( !bli_cblas_is_valid_side( side ) ) \
+		info = 2; \
+	else if ( !bli_cblas_is_valid_uplo( uploa ) ) \
+		info = 3; \
+	else if ( m < 0 ) \
+		info = 4; \
+	else if ( n < 0 ) \
+		info = 5; \
+	else if ( lda < bli_max( 1, ka ) ) \
+		info = 8; \
+	else if ( ldb < bli_cblas_min_ld( order, m, n ) ) \
+		info = 10; \
+	else if ( ldc < bli_cblas_min_ld( order, m, n ) ) \
+		info = 13; \
+\
+	if ( info != 0 ) \
+	{ \
+		char func_str[ BLIS_MAX_CBLAS_FUNC_STR_LENGTH ]; \
+\
+		sprintf( func_str, "cblas_%s%s", dt_str, op_str ); \
+\
+		cblas_xerbla( info, func_str, "" ); \
+\
+		return; \
+	} \
+}
 
-// -- "Black sheep" dot product function prototypes --
-
-void PASTEF772(sds,dot,sub)
-     (
-       const f77_int* n,
-       const float*  sb,
-       const float*   x, const f77_int* incx,
-       const float*   y, const f77_int* incy,
-             float*   rval
-     );
-
-void PASTEF772(ds,dot,sub)
-     (
-       const f77_int* n,
-       const float*   x, const f77_int* incx,
-       const float*   y, const f77_int* incy,
-             double*  rval
-     );
 #endif
+
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,31 +32,32 @@
 
 */
 
-#include "blis.h"
-#include "f77_asum_sub.h"
-
+#ifdef BLIS_ENABLE_CBLAS
 
-//
-// Define CBLAS subrotine wrapper interfaces.
-//
-#undef  GENTFUNCR2
-#define GENTFUNCR2( ftype_x, ftype_r, chx, chr, blasname, blisname ) \
-\
-void PASTEF773(chr,chx,blasname,sub) \
-     ( \
-       const f77_int* n, \
-       const ftype_x* x, const f77_int* incx, \
-             ftype_r* rval  \
-     ) \
+#define cblas_hpr_check( dt_str, op_str, order, uploa, m, incx ) \
 { \
-	*rval = PASTEF772(chr,chx,blasname) \
-	( \
-	  n, \
-	  x, incx \
-	); \
+	f77_int info = 0; \
+\
+	if      ( !bli_cblas_is_valid_order( order ) ) \
+		info = 1; \
+	else if ( !bli_cblas_is_valid_uplo( uploa ) ) \
+		info = 2; \
+	else if ( m < 0 ) \
+		info = 3; \
+	else if ( incx == 0 ) \
+		info = 6; \
+\
+	if ( info != 0 ) \
+	{ \
+		char func_str[ BLIS_MAX_CBLAS_FUNC_STR_LENGTH ]; \
+\
+		sprintf( func_str, "cblas_%s%s", dt_str, op_str ); \
+\
+		cblas_xerbla( info, func_str, "" ); \
+\
+		return; \
+	} \
 }
 
-#ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTFUNCR2_BLAS( asum, NULL )
 #endif
 
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,31 +32,9 @@
 
 */
 
-#include "blis.h"
-#include "f77_amax_sub.h"
-
-
-//
-// Define CBLAS subrotine wrapper interfaces.
-//
-#undef  GENTFUNC
-#define GENTFUNC( ftype_x, chx, blasname, blisname ) \
-\
-void PASTEF773(i,chx,blasname,sub) \
-     ( \
-       const f77_int* n, \
-       const ftype_x* x, const f77_int* incx, \
-             f77_int* rval  \
-     ) \
-{ \
-	*rval = PASTEF772(i,chx,blasname) \
-	( \
-	  n, \
-	  x, incx \
-	); \
-}
-
 #ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTFUNC_BLAS( amax, NULL )
+
+#define cblas_sbmv_check cblas_hbmv_check
+
 #endif
 
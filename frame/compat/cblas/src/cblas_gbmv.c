@@ -0,0 +1,158 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+
+//
+// Define CBLAS-to-BLIS interfaces.
+//
+#undef  GENTFUNC
+#define GENTFUNC( ftype, ch, stype, vtype, saddr, cblasname, blisname ) \
+\
+void PASTECBLAS(ch,cblasname) \
+     ( \
+       enum CBLAS_ORDER     order, \
+       enum CBLAS_TRANSPOSE transa, \
+       f77_int              m, \
+       f77_int              n, \
+       f77_int              kl, \
+       f77_int              ku, \
+       stype                alpha, \
+       const vtype*         a, f77_int lda, \
+       const vtype*         x, f77_int incx, \
+       stype                beta, \
+             vtype*         y, f77_int incy  \
+     ) \
+{ \
+	trans_t blis_transa; \
+	dim_t   m0, n0; \
+	dim_t   kl0, ku0; \
+	dim_t   m_y, n_x; \
+	ftype*  x0; \
+	ftype*  y0; \
+	inc_t   incx0; \
+	inc_t   incy0; \
+	inc_t   rs_a, cs_a; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Perform CBLAS parameter checking. */ \
+	PASTECBLACHK(cblasname) \
+	( \
+	  MKSTR(ch), \
+	  MKSTR(cblasname), \
+	  order, \
+	  transa, \
+	  m, \
+	  n, \
+	  kl, \
+	  ku, \
+	  lda, \
+	  incx, \
+	  incy  \
+	); \
+\
+	/* Map CBLAS enums to their corresponding BLIS enumerated type value. */ \
+	bli_param_map_cblas_to_blis_trans( transa, &blis_transa ); \
+\
+	/* Convert/typecast negative values of m, n, kl, and ku to zero. */ \
+	bli_convert_blas_dim1( m, m0 ); \
+	bli_convert_blas_dim1( n, n0 ); \
+	bli_convert_blas_dim1( kl, kl0 ); \
+	bli_convert_blas_dim1( ku, ku0 ); \
+\
+	/* Determine the dimensions of x and y so we can adjust the increments,
+	   if necessary.*/ \
+	bli_set_dims_with_trans( blis_transa, m0, n0, &m_y, &n_x ); \
+\
+	/* As with gemv, BLAS returns without performing any action (rather
+	   than computing y := beta * y) when A has no rows or no columns. We
+	   emulate this behavior exactly for "bug-for-bug" compatibility. */ \
+	if ( m0 == 0 || n0 == 0 ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
+\
+	/* If the input increments are negative, adjust the pointers so we can
+	   use positive increments instead. */ \
+	bli_convert_blas_incv( n_x, (ftype*)x, incx, x0, incx0 ); \
+	bli_convert_blas_incv( m_y, (ftype*)y, incy, y0, incy0 ); \
+\
+	/* The band storage of a row-major m x n matrix A is identical to the
+	   (column-major) band storage of the n x m matrix A^T, whose lower and
+	   upper bandwidths are ku and kl. Thus, in the row-major case we
+	   operate on A^T and toggle the transposition (but not conjugation)
+	   of transa. */ \
+	if ( order == CblasRowMajor ) \
+	{ \
+		bli_toggle_trans( &blis_transa ); \
+		bli_swap_dims( &m0, &n0 ); \
+		bli_swap_dims( &kl0, &ku0 ); \
+	} \
+\
+	/* Set the row and column strides of A. */ \
+	rs_a = 1; \
+	cs_a = lda; \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
+	( \
+	  blis_transa, \
+	  BLIS_NO_CONJUGATE, \
+	  m0, \
+	  n0, \
+	  kl0, \
+	  ku0, \
+	  (ftype*)saddr alpha, \
+	  (ftype*)a,  rs_a, cs_a, \
+	  x0, incx0, \
+	  (ftype*)saddr beta, \
+	  y0, incy0, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
+}
+
+#ifdef BLIS_ENABLE_CBLAS
+INSERT_GENTFUNC_CBLAS( gbmv, gbmv )
+#endif
+
@@ -0,0 +1,124 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+
+//
+// Define CBLAS-to-BLIS interfaces.
+//
+#undef  GENTFUNC
+#define GENTFUNC( ftype, ch, stype, vtype, saddr, cblasname, blisname ) \
+\
+void PASTECBLAS(ch,cblasname) \
+     ( \
+       enum CBLAS_ORDER     order, \
+       enum CBLAS_TRANSPOSE transa, \
+       enum CBLAS_TRANSPOSE transb, \
+       f77_int              m, \
+       f77_int              n, \
+       f77_int              k, \
+       stype                alpha, \
+       const vtype*         a, f77_int lda, \
+       const vtype*         b, f77_int ldb, \
+       stype                beta, \
+             vtype*         c, f77_int ldc  \
+     ) \
+{ \
+	trans_t blis_transa; \
+	trans_t blis_transb; \
+	dim_t   m0, n0, k0; \
+	inc_t   rs_a, cs_a; \
+	inc_t   rs_b, cs_b; \
+	inc_t   rs_c, cs_c; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Perform CBLAS parameter checking. */ \
+	PASTECBLACHK(cblasname) \
+	( \
+	  MKSTR(ch), \
+	  MKSTR(cblasname), \
+	  order, \
+	  transa, \
+	  transb, \
+	  m, \
+	  n, \
+	  k, \
+	  lda, \
+	  ldb, \
+	  ldc  \
+	); \
+\
+	/* Map CBLAS enums to their corresponding BLIS enumerated type value. */ \
+	bli_param_map_cblas_to_blis_trans( transa, &blis_transa ); \
+	bli_param_map_cblas_to_blis_trans( transb, &blis_transb ); \
+\
+	/* Convert/typecast negative values of m, n, and k to zero. */ \
+	bli_convert_blas_dim1( m, m0 ); \
+	bli_convert_blas_dim1( n, n0 ); \
+	bli_convert_blas_dim1( k, k0 ); \
+\
+	/* Set the row and column strides of the matrix operands according to
+	   the storage order. */ \
+	bli_cblas_set_strides( order, lda, &rs_a, &cs_a ); \
+	bli_cblas_set_strides( order, ldb, &rs_b, &cs_b ); \
+	bli_cblas_set_strides( order, ldc, &rs_c, &cs_c ); \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
+	( \
+	  blis_transa, \
+	  blis_transb, \
+	  m0, \
+	  n0, \
+	  k0, \
+	  (ftype*)saddr alpha, \
+	  (ftype*)a, rs_a, cs_a, \
+	  (ftype*)b, rs_b, cs_b, \
+	  (ftype*)saddr beta, \
+	  (ftype*)c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
+}
+
+#ifdef BLIS_ENABLE_CBLAS
+INSERT_GENTFUNC_CBLAS( gemm, gemm )
+#endif
+
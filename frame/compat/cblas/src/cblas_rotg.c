@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -33,30 +33,28 @@
 */
 
 #include "blis.h"
-#include "f77_nrm2_sub.h"
 
 
 //
-// Define CBLAS subrotine wrapper interfaces.
+// Define CBLAS-to-BLIS interfaces.
 //
-#undef  GENTFUNCR2
-#define GENTFUNCR2( ftype_x, ftype_r, chx, chr, blasname, blisname ) \
+// NOTE: Constructing a plane rotation is a scalar computation with no
+// BLIS counterpart, so these functions simply defer to the BLAS routines.
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ftype, ch, cblasname, blasname ) \
 \
-void PASTEF773(chr,chx,blasname,sub) \
+void PASTECBLAS(ch,cblasname) \
      ( \
-       const f77_int* n, \
-       const ftype_x* x, const f77_int* incx, \
-             ftype_r* rval  \
+       ftype* a, \
+       ftype* b, \
+       ftype* c, \
+       ftype* s  \
      ) \
 { \
-	*rval = PASTEF772(chr,chx,blasname) \
-	( \
-	  n, \
-	  x, incx \
-	); \
+	PASTEF77(ch,blasname)( a, b, c, s ); \
 }
 
 #ifdef BLIS_ENABLE_CBLAS
-INSERT_GENTFUNCR2_BLAS( nrm2, NULL )
+INSERT_GENTFUNCRO_CBLAS( rotg, rotg )
 #endif
 
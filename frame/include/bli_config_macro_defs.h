@@ -141,6 +141,28 @@
 #define BLIS_BLAS_INT_TYPE_SIZE     32
 #endif
 
+// Build a second copy of the BLAS compatibility layer alongside the first?
+// This copy always uses 64-bit integers, and each of its symbols carries a
+// "_64_" suffix (e.g. dgemm_64_) rather than "_", so that LP64 and ILP64
+// applications may both link against one library. The source files of the
+// BLAS layer are compiled a second time with BLIS_IS_BUILDING_BLAS64
+// defined in order to produce this copy.
+#ifdef BLIS_DISABLE_BLAS64
+  #undef BLIS_ENABLE_BLAS64
+#endif
+
+#ifdef BLIS_IS_BUILDING_BLAS64
+  #undef  BLIS_BLAS_INT_TYPE_SIZE
+  #define BLIS_BLAS_INT_TYPE_SIZE   64
+#endif
+
+// The suffix appended to the names of the BLAS (Fortran-77) symbols.
+#ifdef BLIS_IS_BUILDING_BLAS64
+  #define BLIS_F77_SUFFIX           _64_
+#else
+  #define BLIS_F77_SUFFIX           _
+#endif
+
 
 // -- CBLAS COMPATIBILITY LAYER ------------------------------------------------
 
@@ -124,6 +124,83 @@ GENTFUNCSCAL( dcomplex, double,   z, d, blasname, blisname )
 
 
 
+// -- Macros for generating CBLAS routines -------------------------------------
+
+// CBLAS passes real scalars by value but complex scalars by address, and it
+// passes complex vectors and matrices as void pointers. Thus, in addition to
+// the datatype, these macros supply the type of scalar arguments (stype),
+// the type of vector and matrix arguments (vtype), and the operator needed
+// to obtain the address of a scalar argument (saddr, if any).
+
+
+// -- Basic one-operand macro --
+
+
+#define INSERT_GENTFUNC_CBLAS( opname, blisname ) \
+\
+GENTFUNC( float,    s, float,       float,  &, opname, blisname ) \
+GENTFUNC( double,   d, double,      double, &, opname, blisname ) \
+GENTFUNC( scomplex, c, const void*, void,    , opname, blisname ) \
+GENTFUNC( dcomplex, z, const void*, void,    , opname, blisname )
+
+
+// -- Basic one-operand macro with real domain only --
+
+
+#define INSERT_GENTFUNCRO_CBLAS( opname, blisname ) \
+\
+GENTFUNCRO( float,    s, opname, blisname ) \
+GENTFUNCRO( double,   d, opname, blisname )
+
+
+// -- Basic one-operand macro with complex domain only and real projection --
+
+
+#define INSERT_GENTFUNCCO_CBLAS( opname, blisname ) \
+\
+GENTFUNCCO( scomplex, float,  c, s, opname, blisname ) \
+GENTFUNCCO( dcomplex, double, z, d, opname, blisname )
+
+
+// -- Basic one-operand macro with conjugation (used only for ger) --
+
+
+#define INSERT_GENTFUNCDOT_CBLAS( opname, blisname ) \
+\
+GENTFUNCDOT( float,    s,  , BLIS_NO_CONJUGATE, float,       float,  &, opname, blisname ) \
+GENTFUNCDOT( double,   d,  , BLIS_NO_CONJUGATE, double,      double, &, opname, blisname ) \
+GENTFUNCDOT( scomplex, c, c, BLIS_CONJUGATE,    const void*, void,    , opname, blisname ) \
+GENTFUNCDOT( scomplex, c, u, BLIS_NO_CONJUGATE, const void*, void,    , opname, blisname ) \
+GENTFUNCDOT( dcomplex, z, c, BLIS_CONJUGATE,    const void*, void,    , opname, blisname ) \
+GENTFUNCDOT( dcomplex, z, u, BLIS_NO_CONJUGATE, const void*, void,    , opname, blisname )
+
+
+// -- Alternate two-operand macro (one char for complex, one for real proj) --
+
+
+#define INSERT_GENTFUNCR2_CBLAS( opname, blisname ) \
+\
+GENTFUNCR2( float,    float,  s,  , float,  opname, blisname ) \
+GENTFUNCR2( double,   double, d,  , double, opname, blisname ) \
+GENTFUNCR2( scomplex, float,  c, s, void,   opname, blisname ) \
+GENTFUNCR2( dcomplex, double, z, d, void,   opname, blisname )
+
+
+// -- Extended two-operand macro (used only for scal) --
+
+
+#define INSERT_GENTFUNCSCAL_CBLAS( opname, blisname ) \
+\
+GENTFUNCSCAL( float,    float,    s,  , float,       float,  &, opname, blisname ) \
+GENTFUNCSCAL( double,   double,   d,  , double,      double, &, opname, blisname ) \
+GENTFUNCSCAL( scomplex, scomplex, c,  , const void*, void,    , opname, blisname ) \
+GENTFUNCSCAL( dcomplex, dcomplex, z,  , const void*, void,    , opname, blisname ) \
+GENTFUNCSCAL( scomplex, float,    c, s, float,       void,   &, opname, blisname ) \
+GENTFUNCSCAL( dcomplex, double,   z, d, double,      void,   &, opname, blisname )
+
+
+
+
 // -- Macros for functions with one operand ------------------------------------
 
 
@@ -54,6 +54,58 @@
 #define BLIS_DEFAULT_NR_THREAD_MAX 4
 #endif
 
+// The minimum number of matrix elements each thread must touch before a
+// level-2 operation (on banded or packed matrices) is parallelized.
+#ifndef BLIS_DEFAULT_L2_MIN_WORK_PER_THREAD
+#define BLIS_DEFAULT_L2_MIN_WORK_PER_THREAD 65536
+#endif
+
+
+// -- Tiny gemm fast path ------------------------------------------------------
+
+// The largest m, n, or k for which the typed (and BLAS) gemm front-ends
+// bypass the object-based framework and compute the product directly from
+// a small on-stack packing buffer. Setting this to 0 disables the path.
+#ifndef BLIS_TINY_GEMM_MAX_DIM
+#define BLIS_TINY_GEMM_MAX_DIM 32
+#endif
+
+// The size (in bytes) of the on-stack buffer into which the tiny gemm path
+// packs its micro-panels of A and B. Problems that would need more space
+// than this fall back to the conventional implementation.
+#ifndef BLIS_TINY_GEMM_BUF_SIZE
+#define BLIS_TINY_GEMM_BUF_SIZE ( 48 * 1024 )
+#endif
+
+
+// -- Out-of-core gemm ---------------------------------------------------------
+
+// The default limit (in bytes) on the tile buffers that bli_gemm_ooc()
+// allocates. The operands themselves are only ever accessed one tile at a
+// time, so they may be much larger than this (or than main memory).
+#ifndef BLIS_GEMM_OOC_MAX_MEM
+#define BLIS_GEMM_OOC_MAX_MEM ( ( siz_t )1 << 30 )
+#endif
+
+
+// -- Induced method selection -------------------------------------------------
+
+// The smallest m, n, and k for which 3m1 is chosen (instead of 1m) for a
+// complex level-3 operation when only the real gemm micro-kernel is
+// optimized, and for which the automatic selection mode (see BLIS_IND_AUTO)
+// considers 3m1. Methods that were enabled explicitly are used regardless
+// of problem size.
+#ifndef BLIS_IND_3M_MIN_DIM
+#define BLIS_IND_3M_MIN_DIM 512
+#endif
+
+// The number of times each candidate method is timed, per shape bucket,
+// before the automatic selection mode (see bli_ind_enable_auto()) settles
+// on the fastest one for that bucket.
+#ifndef BLIS_IND_AUTO_TRIALS
+#define BLIS_IND_AUTO_TRIALS 2
+#endif
+
 
 // -- Memory allocation --------------------------------------------------------
 
@@ -131,6 +131,9 @@
 #define PASTEBLACHK_(op)           bla_ ## op ## _check
 #define PASTEBLACHK(op)            PASTEBLACHK_(op)
 
+#define PASTECBLACHK_(op)          cblas_ ## op ## _check
+#define PASTECBLACHK(op)           PASTECBLACHK_(op)
+
 #define PASTECH_(ch,op)            ch ## op
 #define PASTECH(ch,op)             PASTECH_(ch,op)
 
@@ -143,11 +146,22 @@
 #define MKSTR(s1)                  #s1
 #define STRINGIFY_INT( s )         MKSTR( s )
 
-// Fortran-77 name-mangling macros.
-#define PASTEF770(name)                            name ## _
-#define PASTEF77(ch1,name)           ch1        ## name ## _
-#define PASTEF772(ch1,ch2,name)      ch1 ## ch2 ## name ## _
-#define PASTEF773(ch1,ch2,ch3,name)  ch1 ## ch2 ## ch3 ## name ## _
+// Fortran-77 name-mangling macros. The suffix is expanded at each point of
+// use so that the 64-bit copy of the BLAS compatibility layer, which is
+// built with BLIS_F77_SUFFIX defined to _64_, can share the same source.
+#define PASTEF77S_(ch1,ch2,ch3,name,suf)  ch1 ## ch2 ## ch3 ## name ## suf
+#define PASTEF77S(ch1,ch2,ch3,name,suf)   PASTEF77S_(ch1,ch2,ch3,name,suf)
+
+#define PASTEF770(name)              PASTEF77S(   ,   ,   ,name,BLIS_F77_SUFFIX)
+#define PASTEF77(ch1,name)           PASTEF77S(ch1,   ,   ,name,BLIS_F77_SUFFIX)
+#define PASTEF772(ch1,ch2,name)      PASTEF77S(ch1,ch2,   ,name,BLIS_F77_SUFFIX)
+#define PASTEF773(ch1,ch2,ch3,name)  PASTEF77S(ch1,ch2,ch3,name,BLIS_F77_SUFFIX)
+
+// CBLAS name-mangling macros.
+#define PASTECBLAS_(ch1,name)        cblas_ ## ch1 ## name
+#define PASTECBLAS(ch1,name)         PASTECBLAS_(ch1,name)
+#define PASTECBLAS2_(ch1,ch2,name)   cblas_ ## ch1 ## ch2 ## name
+#define PASTECBLAS2(ch1,ch2,name)    PASTECBLAS2_(ch1,ch2,name)
 
 // -- Include other groups of macros
 
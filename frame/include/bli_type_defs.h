@@ -637,6 +637,8 @@ typedef enum
 	BLIS_DOTV_KER,
 	BLIS_DOTXV_KER,
 	BLIS_INVERTV_KER,
+	BLIS_ROTV_KER,
+	BLIS_ROTMV_KER,
 	BLIS_SCALV_KER,
 	BLIS_SCAL2V_KER,
 	BLIS_SETV_KER,
@@ -645,7 +647,7 @@ typedef enum
 	BLIS_XPBYV_KER
 } l1vkr_t;
 
-#define BLIS_NUM_LEVEL1V_KERS 14
+#define BLIS_NUM_LEVEL1V_KERS 16
 
 
 typedef enum
@@ -734,6 +736,14 @@ typedef enum
 #define BLIS_NUM_UNPACKM_KERS 32
 
 
+typedef enum
+{
+	BLIS_TRANSM_KER = 0
+} transmkr_t;
+
+#define BLIS_NUM_TRANSM_KERS  1
+
+
 typedef enum
 {
 	BLIS_GEMM_UKR = 0,
@@ -824,11 +834,12 @@ typedef enum
 	BLIS_AF, // level-1f axpyf fusing factor
 	BLIS_DF, // level-1f dotxf fusing factor
 	BLIS_XF, // level-1f dotxaxpyf fusing factor
+	BLIS_VT, // level-1v/-1m minimum elements per thread (threading threshold)
 
 	BLIS_NO_PART  // used as a placeholder when blocksizes are not applicable.
 } bszid_t;
 
-#define BLIS_NUM_BLKSZS 11
+#define BLIS_NUM_BLKSZS 12
 
 
 // -- Architecture ID type --
@@ -1138,6 +1149,7 @@ typedef struct cntx_s
 
 	func_t    packm_kers[ BLIS_NUM_PACKM_KERS ];
 	func_t    unpackm_kers[ BLIS_NUM_UNPACKM_KERS ];
+	func_t    transm_kers[ BLIS_NUM_TRANSM_KERS ];
 
 	ind_t     method;
 	pack_t    schema_a_block;
@@ -1150,10 +1162,28 @@ typedef struct cntx_s
 
 // -- Runtime type --
 
+// Thread affinity policies, used to bind the threads of a level-3 operation
+// to CPUs (see bli_affinity.c).
+typedef enum
+{
+	BLIS_AFFINITY_DEFAULT = 0,  // use the global policy (from BLIS_AFFINITY)
+	BLIS_AFFINITY_NONE,         // leave thread placement to the OS
+	BLIS_AFFINITY_COMPACT,      // fill one L3 cache domain at a time
+	BLIS_AFFINITY_SCATTER,      // round-robin over L3 cache domains
+	BLIS_AFFINITY_L3,           // one jc group per L3 cache domain
+	BLIS_AFFINITY_LIST          // an explicit list of CPUs
+} affinity_t;
+
+#define BLIS_NUM_AFFINITY_TYPES 6
+
 typedef struct rntm_s
 {
-	dim_t     num_threads;
-	dim_t     thrloop[ BLIS_NUM_LOOPS ];
+	dim_t      num_threads;
+	dim_t      thrloop[ BLIS_NUM_LOOPS ];
+
+	affinity_t affinity;
+	dim_t      num_cpus;
+	dim_t*     cpus;
 
 } rntm_t;
 
@@ -1253,6 +1283,7 @@ typedef enum
 
 	// Architecture-related errors
 	BLIS_INVALID_ARCH_ID                       = (-140),
+	BLIS_UNREGISTERED_ARCH_ID                  = (-141),
 
 	// Blocksize-related errors
 	BLIS_MC_DEF_NONMULTIPLE_OF_MR              = (-150),
@@ -1262,7 +1293,11 @@ typedef enum
 	BLIS_KC_DEF_NONMULTIPLE_OF_KR              = (-154),
 	BLIS_KC_MAX_NONMULTIPLE_OF_KR              = (-155),
 
-	BLIS_ERROR_CODE_MAX                        = (-160)
+	// File-related errors
+	BLIS_FILE_OPEN_FAILURE                     = (-160),
+	BLIS_FILE_MAP_FAILURE                      = (-161),
+
+	BLIS_ERROR_CODE_MAX                        = (-170)
 } err_t;
 
 #endif
@@ -65,6 +65,11 @@ extern "C" {
 #include "bli_macro_defs.h"
 
 
+// -- Profiling definitions --
+
+#include "bli_prof.h"
+
+
 // -- Threading definitions --
 
 #include "bli_thread.h"
@@ -94,12 +99,14 @@ extern "C" {
 #include "bli_const.h"
 #include "bli_obj.h"
 #include "bli_obj_scalar.h"
+#include "bli_obj_file.h"
 #include "bli_blksz.h"
 #include "bli_func.h"
 #include "bli_mbool.h"
 #include "bli_cntx.h"
 #include "bli_rntm.h"
 #include "bli_gks.h"
+#include "bli_gks_blksz.h"
 #include "bli_ind.h"
 #include "bli_membrk.h"
 #include "bli_pool.h"
@@ -111,6 +118,7 @@ extern "C" {
 #include "bli_auxinfo.h"
 #include "bli_param_map.h"
 #include "bli_clock.h"
+#include "bli_perfctr.h"
 #include "bli_check.h"
 #include "bli_error.h"
 #include "bli_f2c.h"
@@ -49,20 +49,14 @@ static char* bli_ind_impl_str[BLIS_NUM_IND_METHODS] =
 
 void bli_ind_init( void )
 {
-	// Enable the default induced method (1m) if one or both complex domain
-	// gemm micro-kernels are unoptimized in the native context.
+	// Record which complex micro-kernels are optimized, which determines
+	// the default choice of induced method.
+	bli_l3_ind_init();
 
-	// NOTE: Instead of calling bli_gks_query_cntx(), we call
-	// bli_gks_query_cntx_noinit() to avoid the call to bli_init_once().
-	cntx_t* cntx     = bli_gks_query_cntx_noinit();
-
-	bool_t  c_is_ref = bli_gks_cntx_l3_nat_ukr_is_ref
-	                   ( BLIS_SCOMPLEX, BLIS_GEMM_UKR, cntx );
-	bool_t  z_is_ref = bli_gks_cntx_l3_nat_ukr_is_ref
-	                   ( BLIS_DCOMPLEX, BLIS_GEMM_UKR, cntx );
-
-	if ( c_is_ref ) bli_ind_enable_dt( BLIS_1M, BLIS_SCOMPLEX );
-	if ( z_is_ref ) bli_ind_enable_dt( BLIS_1M, BLIS_DCOMPLEX );
+	// Enable the automatic (timing-based) selection of induced methods if
+	// requested via the environment.
+	if ( bli_thread_get_env( "BLIS_IND_AUTO", 0 ) != 0 )
+		bli_ind_enable_auto();
 }
 
 void bli_ind_finalize( void )
@@ -137,6 +131,28 @@ void bli_ind_oper_enable_only( opid_t oper, ind_t method, num_t dt )
 
 // -----------------------------------------------------------------------------
 
+void bli_ind_enable_auto( void )
+{
+	bli_l3_ind_auto_set_enable( TRUE );
+}
+
+void bli_ind_disable_auto( void )
+{
+	bli_l3_ind_auto_set_enable( FALSE );
+}
+
+bool_t bli_ind_auto_is_enabled( void )
+{
+	return bli_l3_ind_auto_get_enable();
+}
+
+void bli_ind_auto_reset( void )
+{
+	bli_l3_ind_auto_reset();
+}
+
+// -----------------------------------------------------------------------------
+
 bool_t bli_ind_oper_is_impl( opid_t oper, ind_t method )
 {
 	bool_t is_impl = FALSE;
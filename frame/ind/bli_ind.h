@@ -37,6 +37,7 @@
 
 // level-3 induced method management
 #include "bli_l3_ind.h"
+#include "bli_l3_ind_auto.h"
 
 // level-3 object APIs
 #include "bli_l3_ind_oapi.h"
@@ -64,6 +65,11 @@ void   bli_ind_disable_all_dt( num_t dt );
 
 void   bli_ind_oper_enable_only( opid_t oper, ind_t method, num_t dt );
 
+void   bli_ind_enable_auto( void );
+void   bli_ind_disable_auto( void );
+bool_t bli_ind_auto_is_enabled( void );
+void   bli_ind_auto_reset( void );
+
 bool_t bli_ind_oper_is_impl( opid_t oper, ind_t method );
 //bool_t bli_ind_oper_has_avail( opid_t oper, num_t dt );
 void*  bli_ind_oper_get_avail( opid_t oper, num_t dt );
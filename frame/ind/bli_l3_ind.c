@@ -82,6 +82,43 @@ bool_t bli_l3_ind_oper_st[BLIS_NUM_IND_METHODS][BLIS_NUM_LEVEL3_OPS][2] =
              {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE},   {TRUE,TRUE}    },
 };
 
+// Whether the status of the induced methods for an operation and datatype
+// has been set explicitly (via bli_l3_ind_oper_set_enable() and the APIs
+// built on it). Until it has, bli_l3_ind_oper_find_avail_dims() chooses a
+// method on its own.
+
+static BLIS_THREAD_LOCAL
+bool_t bli_l3_ind_oper_st_set[BLIS_NUM_LEVEL3_OPS][2] = { { FALSE } };
+
+// Whether the context for the running architecture provides an optimized
+// real gemm micro-kernel but only a reference complex one, in which case
+// induced methods are faster than native execution. Set by
+// bli_l3_ind_init().
+
+static bool_t bli_l3_ind_prefer_real_ukr[2] = { FALSE, FALSE };
+
+// -----------------------------------------------------------------------------
+
+static bool_t bli_l3_ind_prefers_real_ukr( num_t dt, cntx_t* cntx )
+{
+	bool_t c_is_ref = bli_gks_cntx_l3_nat_ukr_is_ref
+	                  ( dt, BLIS_GEMM_UKR, cntx );
+	bool_t r_is_ref = bli_gks_cntx_l3_nat_ukr_is_ref
+	                  ( bli_dt_proj_to_real( dt ), BLIS_GEMM_UKR, cntx );
+
+	return ( c_is_ref && !r_is_ref );
+}
+
+void bli_l3_ind_init( void )
+{
+	// NOTE: Instead of calling bli_gks_query_cntx(), we call
+	// bli_gks_query_cntx_noinit() to avoid the call to bli_init_once().
+	cntx_t* cntx = bli_gks_query_cntx_noinit();
+
+	bli_l3_ind_prefer_real_ukr[ 0 ] = bli_l3_ind_prefers_real_ukr( BLIS_SCOMPLEX, cntx );
+	bli_l3_ind_prefer_real_ukr[ 1 ] = bli_l3_ind_prefers_real_ukr( BLIS_DCOMPLEX, cntx );
+}
+
 // -----------------------------------------------------------------------------
 
 #undef  GENFUNC
@@ -90,6 +127,13 @@ bool_t bli_l3_ind_oper_st[BLIS_NUM_IND_METHODS][BLIS_NUM_LEVEL3_OPS][2] =
 void*  PASTEMAC(opname,ind_get_avail)( num_t dt ) \
 { \
 	return bli_ind_oper_get_avail( optype, dt ); \
+} \
+\
+void*  PASTEMAC(opname,ind_get_avail_auto)( num_t dt, dim_t m, dim_t n, dim_t k, rntm_t* rntm, ind_t* method, gint_t* trial ) \
+{ \
+	*method = bli_l3_ind_auto_find_avail( optype, dt, m, n, k, rntm, trial ); \
+\
+	return bli_l3_ind_oper_get_func( optype, *method ); \
 }
 /*
 bool_t PASTEMAC(opname,ind_has_avail)( num_t dt )
@@ -130,6 +174,12 @@ bool_t bli_l3_ind_oper_is_avail( opid_t oper, ind_t method, num_t dt )
 // -----------------------------------------------------------------------------
 
 ind_t bli_l3_ind_oper_find_avail( opid_t oper, num_t dt )
+{
+	// Without problem dimensions, choose as if for a small problem.
+	return bli_l3_ind_oper_find_avail_dims( oper, dt, 0, 0, 0 );
+}
+
+ind_t bli_l3_ind_oper_find_avail_dims( opid_t oper, num_t dt, dim_t m, dim_t n, dim_t k )
 {
 	bli_init_once();
 
@@ -141,6 +191,35 @@ ind_t bli_l3_ind_oper_find_avail( opid_t oper, num_t dt )
 	// If the operation is not level-3, return native execution.
 	if ( !bli_opid_is_level3( oper ) ) return BLIS_NAT;
 
+	const num_t idt = bli_ind_map_cdt_to_index( dt );
+
+	// If no induced method has been enabled or disabled explicitly for the
+	// current operation and datatype, choose one based on the available
+	// micro-kernels and the problem size.
+	if ( !bli_l3_ind_oper_st_set[ oper ][ idt ] )
+	{
+		// Use native execution unless an induced method can cast the
+		// operation in terms of an optimized real gemm micro-kernel that
+		// has no optimized complex counterpart. (A reference complex
+		// micro-kernel is still faster than 1m on a reference real one.)
+		// This holds for trsm too: with an optimized complex gemm
+		// micro-kernel, native trsm was measured to be faster than 1m even
+		// with reference gemmtrsm micro-kernels.
+		if ( !bli_l3_ind_prefer_real_ukr[ idt ] ) return BLIS_NAT;
+
+		// 3m1 performs a quarter fewer flops than 1m, but packs and
+		// accumulates an extra copy of each operand, which is only
+		// amortized when all of the problem dimensions are large. It is
+		// not used for trsm, where its reduced accuracy would propagate
+		// through the triangular solve.
+		if ( oper != BLIS_TRSM &&
+		     bli_l3_ind_oper_get_func( oper, BLIS_3M1 ) != NULL &&
+		     bli_min( m, bli_min( n, k ) ) >= BLIS_IND_3M_MIN_DIM )
+			return BLIS_3M1;
+
+		return BLIS_1M;
+	}
+
 	// Iterate over all induced methods and search for the first one
 	// that is available (ie: both implemented and enabled) for the
 	// current operation and datatype.
@@ -235,6 +314,7 @@ void bli_l3_ind_oper_set_enable( opid_t oper, ind_t method, num_t dt, bool_t sta
 	// BEGIN CRITICAL SECTION
 	{
 		bli_l3_ind_oper_st[ method ][ oper ][ idt ] = status;
+		bli_l3_ind_oper_st_set[ oper ][ idt ] = TRUE;
 	}
 	// END CRITICAL SECTION
 
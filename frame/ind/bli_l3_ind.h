@@ -40,7 +40,8 @@
 #undef  GENPROT
 #define GENPROT( opname ) \
 \
-void*  PASTEMAC(opname,ind_get_avail)( num_t dt );
+void*  PASTEMAC(opname,ind_get_avail)( num_t dt ); \
+void*  PASTEMAC(opname,ind_get_avail_auto)( num_t dt, dim_t m, dim_t n, dim_t k, rntm_t* rntm, ind_t* method, gint_t* trial );
 /*bool_t PASTEMAC(opname,ind_has_avail)( num_t dt ); */
 
 GENPROT( gemm )
@@ -58,7 +59,10 @@ GENPROT( trsm )
 
 //bool_t bli_l3_ind_oper_is_avail( opid_t oper, ind_t method, num_t dt );
 
+void   bli_l3_ind_init( void );
+
 ind_t  bli_l3_ind_oper_find_avail( opid_t oper, num_t dt );
+ind_t  bli_l3_ind_oper_find_avail_dims( opid_t oper, num_t dt, dim_t m, dim_t n, dim_t k );
 
 void   bli_l3_ind_set_enable_dt( ind_t method, num_t dt, bool_t status );
 
@@ -0,0 +1,357 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The automatic selection mode chooses among native execution, 1m, and
+// 3m1 for each complex level-3 operation by timing the candidates on the
+// application's own calls. Problems are grouped into buckets according to
+// the binary logarithms of m, n, and k and of the number of threads. The
+// first few calls that fall into a bucket are dispatched to each candidate
+// in turn, and once every candidate has been timed BLIS_IND_AUTO_TRIALS
+// times, the method with the lowest time per unit of work is used for all
+// subsequent calls in that bucket.
+
+#define BLIS_IND_AUTO_NUM_SLOTS  128
+#define BLIS_IND_AUTO_NUM_CANDS  3
+
+// The candidate methods, in the order in which they are tried.
+static ind_t bli_l3_ind_auto_cands[BLIS_IND_AUTO_NUM_CANDS] =
+{
+	BLIS_NAT, BLIS_1M, BLIS_3M1
+};
+
+typedef struct
+{
+	gint_t key;
+	ind_t  best;
+	bool_t elig[BLIS_IND_AUTO_NUM_CANDS];
+	dim_t  n_issued[BLIS_IND_AUTO_NUM_CANDS];
+	dim_t  n_done[BLIS_IND_AUTO_NUM_CANDS];
+	double time[BLIS_IND_AUTO_NUM_CANDS];
+} ind_auto_slot_t;
+
+static ind_auto_slot_t bli_l3_ind_auto_slots[BLIS_IND_AUTO_NUM_SLOTS];
+
+// The number of slots currently in use. Slots are claimed in order.
+static dim_t  bli_l3_ind_auto_n_used = 0;
+
+static bool_t bli_l3_ind_auto_enabled = FALSE;
+
+// A mutex to allow synchronous access to the slots.
+static pthread_mutex_t auto_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// -----------------------------------------------------------------------------
+
+void bli_l3_ind_auto_set_enable( bool_t status )
+{
+	bli_l3_ind_auto_enabled = status;
+}
+
+bool_t bli_l3_ind_auto_get_enable( void )
+{
+	return bli_l3_ind_auto_enabled;
+}
+
+void bli_l3_ind_auto_reset( void )
+{
+	pthread_mutex_lock( &auto_mutex );
+	bli_l3_ind_auto_n_used = 0;
+	pthread_mutex_unlock( &auto_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_l3_ind_auto_dim_bucket( dim_t x )
+{
+	dim_t b = 0;
+
+	// Bucket 0 holds x < 128, bucket 1 holds 128 <= x < 256, and so on,
+	// up to bucket 6, which holds everything from 4096 upward.
+	for ( x /= 128; x > 0 && b < 6; x /= 2 ) ++b;
+
+	return b;
+}
+
+static dim_t bli_l3_ind_auto_nt_bucket( rntm_t* rntm )
+{
+	dim_t nt = bli_rntm_num_threads( rntm );
+	dim_t b  = 0;
+
+	// If the ways of parallelism were set individually, the total number
+	// of threads is their product.
+	if ( nt < 1 )
+	{
+		nt = bli_max( bli_rntm_jc_ways( rntm ), 1 ) *
+		     bli_max( bli_rntm_pc_ways( rntm ), 1 ) *
+		     bli_max( bli_rntm_ic_ways( rntm ), 1 ) *
+		     bli_max( bli_rntm_jr_ways( rntm ), 1 ) *
+		     bli_max( bli_rntm_ir_ways( rntm ), 1 );
+	}
+
+	for ( nt /= 2; nt > 0 && b < 7; nt /= 2 ) ++b;
+
+	return b;
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_l3_ind_auto_init_slot
+     (
+       ind_auto_slot_t* slot,
+       gint_t           key,
+       opid_t           oper,
+       dim_t            mb,
+       dim_t            nb,
+       dim_t            kb,
+       dim_t            tb
+     )
+{
+	dim_t i;
+
+	slot->key  = key;
+	slot->best = BLIS_NAT;
+
+	for ( i = 0; i < BLIS_IND_AUTO_NUM_CANDS; ++i )
+	{
+		slot->elig[ i ]     = ( bli_l3_ind_oper_get_func
+		                        ( oper, bli_l3_ind_auto_cands[ i ] ) != NULL );
+		slot->n_issued[ i ] = 0;
+		slot->n_done[ i ]   = 0;
+		slot->time[ i ]     = 0.0;
+	}
+
+	// Only consider 3m1 for buckets in which k and each thread's share of
+	// the m x n output are large enough (see BLIS_IND_3M_MIN_DIM) for the
+	// method's extra packing and accumulation to be amortized. Every
+	// problem in a bucket is at least 64 * 2^b in the corresponding
+	// dimension (or 2^b threads), so the test is made on those bounds.
+	{
+		const double k_min  = 64.0 * ( double )( 1 << kb );
+		const double mn_min = 64.0 * ( double )( 1 << mb ) *
+		                      64.0 * ( double )( 1 << nb ) /
+		                      ( double )( 1 << tb );
+		const double d_min  = ( double )BLIS_IND_3M_MIN_DIM;
+
+		if ( k_min < d_min || mn_min < d_min * d_min )
+			slot->elig[ 2 ] = FALSE;
+	}
+}
+
+static void bli_l3_ind_auto_decide( ind_auto_slot_t* slot )
+{
+	double t_best = -1.0;
+	dim_t  i;
+
+	for ( i = 0; i < BLIS_IND_AUTO_NUM_CANDS; ++i )
+	{
+		if ( !slot->elig[ i ] ) continue;
+
+		// Wait until every eligible candidate has been timed.
+		if ( slot->n_done[ i ] < BLIS_IND_AUTO_TRIALS ) return;
+
+		if ( t_best < 0.0 || slot->time[ i ] < t_best )
+		{
+			t_best     = slot->time[ i ];
+			slot->best = bli_l3_ind_auto_cands[ i ];
+		}
+	}
+
+	// Mark the bucket as decided.
+	slot->key = -slot->key - 1;
+}
+
+// -----------------------------------------------------------------------------
+
+static ind_auto_slot_t* bli_l3_ind_auto_find_slot( gint_t key )
+{
+	dim_t i;
+
+	for ( i = 0; i < bli_l3_ind_auto_n_used; ++i )
+	{
+		ind_auto_slot_t* slot = &bli_l3_ind_auto_slots[ i ];
+
+		if ( slot->key == key || slot->key == -key - 1 ) return slot;
+	}
+
+	return NULL;
+}
+
+ind_t bli_l3_ind_auto_find_avail
+     (
+       opid_t  oper,
+       num_t   dt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm,
+       gint_t* trial
+     )
+{
+	*trial = -1;
+
+	// Use the conventional selection for real datatypes, for non-level-3
+	// operations, and when the automatic mode is disabled.
+	if ( !bli_l3_ind_auto_enabled || !bli_is_complex( dt ) ||
+	     !bli_opid_is_level3( oper ) )
+		return bli_l3_ind_oper_find_avail_dims( oper, dt, m, n, k );
+
+	const dim_t mb = bli_l3_ind_auto_dim_bucket( m );
+	const dim_t nb = bli_l3_ind_auto_dim_bucket( n );
+	const dim_t kb = bli_l3_ind_auto_dim_bucket( k );
+	const dim_t tb = bli_l3_ind_auto_nt_bucket( rntm );
+
+	// Problems in the smallest bucket are too short to be timed reliably
+	// and too small for 3m1, so they also use the conventional selection.
+	if ( mb == 0 || nb == 0 || kb == 0 )
+		return bli_l3_ind_oper_find_avail_dims( oper, dt, m, n, k );
+
+	// Pack the bucket coordinates into a (non-negative) key. Decided
+	// buckets store their key as -key - 1.
+	const gint_t key = ( ( ( ( ( gint_t )oper * 2 +
+	                           bli_ind_map_cdt_to_index( dt ) ) * 8 +
+	                           mb ) * 8 + nb ) * 8 + kb ) * 8 + tb;
+
+	ind_t method;
+
+	// Acquire the mutex protecting the slots.
+	pthread_mutex_lock( &auto_mutex );
+
+	// BEGIN CRITICAL SECTION
+	{
+		ind_auto_slot_t* slot = bli_l3_ind_auto_find_slot( key );
+
+		// Claim a new slot if the bucket has not been seen before.
+		if ( slot == NULL &&
+		     bli_l3_ind_auto_n_used < BLIS_IND_AUTO_NUM_SLOTS )
+		{
+			slot = &bli_l3_ind_auto_slots[ bli_l3_ind_auto_n_used ];
+			bli_l3_ind_auto_n_used += 1;
+
+			bli_l3_ind_auto_init_slot( slot, key, oper, mb, nb, kb, tb );
+		}
+
+		if ( slot == NULL )
+		{
+			// The table is full, so fall back to the conventional choice.
+			method = bli_l3_ind_oper_find_avail_dims( oper, dt, m, n, k );
+		}
+		else if ( slot->key < 0 )
+		{
+			// The bucket has been decided.
+			method = slot->best;
+		}
+		else
+		{
+			dim_t i, i_min = -1;
+
+			// Dispatch to the eligible candidate that has been tried the
+			// fewest times so far.
+			for ( i = 0; i < BLIS_IND_AUTO_NUM_CANDS; ++i )
+			{
+				if ( !slot->elig[ i ] ) continue;
+				if ( i_min < 0 || slot->n_issued[ i ] < slot->n_issued[ i_min ] )
+					i_min = i;
+			}
+
+			if ( slot->n_issued[ i_min ] < BLIS_IND_AUTO_TRIALS )
+			{
+				slot->n_issued[ i_min ] += 1;
+				method = bli_l3_ind_auto_cands[ i_min ];
+				*trial = key;
+			}
+			else
+			{
+				// Every trial has been issued, but some are still running
+				// in other application threads. Execute natively (without
+				// timing) in the meantime.
+				method = BLIS_NAT;
+			}
+		}
+	}
+	// END CRITICAL SECTION
+
+	// Release the mutex protecting the slots.
+	pthread_mutex_unlock( &auto_mutex );
+
+	return method;
+}
+
+void bli_l3_ind_auto_record
+     (
+       gint_t trial,
+       ind_t  method,
+       dim_t  m,
+       dim_t  n,
+       dim_t  k,
+       double time
+     )
+{
+	dim_t i;
+
+	if ( trial < 0 ) return;
+
+	// Normalize the time by the size of the problem so that calls with
+	// different shapes within the same bucket can be compared.
+	const double t_norm = time / ( ( double )m * ( double )n * ( double )k );
+
+	// Acquire the mutex protecting the slots.
+	pthread_mutex_lock( &auto_mutex );
+
+	// BEGIN CRITICAL SECTION
+	{
+		ind_auto_slot_t* slot = bli_l3_ind_auto_find_slot( trial );
+
+		// Ignore the result if the table was reset, or the bucket decided,
+		// while the call was executing.
+		if ( slot != NULL && slot->key >= 0 )
+		{
+			for ( i = 0; i < BLIS_IND_AUTO_NUM_CANDS; ++i )
+			{
+				if ( bli_l3_ind_auto_cands[ i ] != method ) continue;
+
+				// Keep the fastest of the trials for each candidate.
+				if ( slot->n_done[ i ] == 0 || t_norm < slot->time[ i ] )
+					slot->time[ i ] = t_norm;
+				slot->n_done[ i ] += 1;
+			}
+
+			bli_l3_ind_auto_decide( slot );
+		}
+	}
+	// END CRITICAL SECTION
+
+	// Release the mutex protecting the slots.
+	pthread_mutex_unlock( &auto_mutex );
+}
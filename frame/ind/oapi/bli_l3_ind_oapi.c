@@ -54,13 +54,27 @@ void PASTEMAC(opname,imeth) \
 	bli_init_once(); \
 \
 	num_t                dt   = bli_obj_dt( c ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( c ); \
+	dim_t                n    = bli_obj_width( c ); \
+	dim_t                k    = bli_obj_width_after_trans( a ); \
+	ind_t                method; \
+	gint_t               trial; \
 \
 	/* Initialize a local runtime with global settings if necessary. */ \
 	rntm_t rntm_l; \
 	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail_auto) \
+	                            ( dt, m, n, k, rntm, &method, &trial ); \
+\
+	/* Time the call if it is a trial of the automatic selection mode. */ \
+	double t_start = ( trial >= 0 ? bli_clock() : 0.0 ); \
 \
 	func( alpha, a, b, beta, c, cntx, rntm ); \
+\
+	if ( trial >= 0 ) \
+		bli_l3_ind_auto_record( trial, method, m, n, k, \
+		                        bli_clock() - t_start ); \
 }
 
 GENFRONT( gemm, ind )
@@ -88,13 +102,27 @@ void PASTEMAC(opname,imeth) \
 	bli_init_once(); \
 \
 	num_t                dt   = bli_obj_dt( c ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( c ); \
+	dim_t                n    = bli_obj_width( c ); \
+	dim_t                k    = bli_obj_width_after_trans( a ); \
+	ind_t                method; \
+	gint_t               trial; \
 \
 	/* Initialize a local runtime with global settings if necessary. */ \
 	rntm_t rntm_l; \
 	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail_auto) \
+	                            ( dt, m, n, k, rntm, &method, &trial ); \
+\
+	/* Time the call if it is a trial of the automatic selection mode. */ \
+	double t_start = ( trial >= 0 ? bli_clock() : 0.0 ); \
 \
 	func( side, alpha, a, b, beta, c, cntx, rntm ); \
+\
+	if ( trial >= 0 ) \
+		bli_l3_ind_auto_record( trial, method, m, n, k, \
+		                        bli_clock() - t_start ); \
 }
 
 GENFRONT( hemm, ind )
@@ -120,13 +148,27 @@ void PASTEMAC(opname,imeth) \
 	bli_init_once(); \
 \
 	num_t                dt   = bli_obj_dt( c ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( c ); \
+	dim_t                n    = bli_obj_width( c ); \
+	dim_t                k    = bli_obj_width_after_trans( a ); \
+	ind_t                method; \
+	gint_t               trial; \
 \
 	/* Initialize a local runtime with global settings if necessary. */ \
 	rntm_t rntm_l; \
 	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail_auto) \
+	                            ( dt, m, n, k, rntm, &method, &trial ); \
+\
+	/* Time the call if it is a trial of the automatic selection mode. */ \
+	double t_start = ( trial >= 0 ? bli_clock() : 0.0 ); \
 \
 	func( alpha, a, beta, c, cntx, rntm ); \
+\
+	if ( trial >= 0 ) \
+		bli_l3_ind_auto_record( trial, method, m, n, k, \
+		                        bli_clock() - t_start ); \
 }
 
 GENFRONT( herk, ind )
@@ -151,13 +193,27 @@ void PASTEMAC(opname,imeth) \
 	bli_init_once(); \
 \
 	num_t                dt   = bli_obj_dt( b ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( b ); \
+	dim_t                n    = bli_obj_width( b ); \
+	dim_t                k    = bli_obj_width_after_trans( a ); \
+	ind_t                method; \
+	gint_t               trial; \
 \
 	/* Initialize a local runtime with global settings if necessary. */ \
 	rntm_t rntm_l; \
 	if ( rntm == NULL ) { rntm = &rntm_l; bli_thread_init_rntm( rntm ); } \
+\
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail_auto) \
+	                            ( dt, m, n, k, rntm, &method, &trial ); \
+\
+	/* Time the call if it is a trial of the automatic selection mode. */ \
+	double t_start = ( trial >= 0 ? bli_clock() : 0.0 ); \
 \
 	func( side, alpha, a, b, cntx, rntm ); \
+\
+	if ( trial >= 0 ) \
+		bli_l3_ind_auto_record( trial, method, m, n, k, \
+		                        bli_clock() - t_start ); \
 }
 
 GENFRONT( trmm, ind )
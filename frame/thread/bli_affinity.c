@@ -0,0 +1,479 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// pthread_setaffinity_np() and the CPU_* macros are GNU extensions.
+#define _GNU_SOURCE
+
+#include "blis.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+// NOTE: This string array must be kept up-to-date with the affinity_t
+// enumeration that is typedef'ed in bli_type_defs.h.
+static char* affinity_str[ BLIS_NUM_AFFINITY_TYPES ] =
+{
+	"default",
+	"none",
+	"compact",
+	"scatter",
+	"l3",
+	"list",
+};
+
+char* bli_affinity_string( affinity_t affinity )
+{
+	return affinity_str[ affinity ];
+}
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_affinity_parse_list( char* str, dim_t* list, dim_t max )
+{
+	// Parse a CPU list such as "0,2,4-7" (the format used by sysfs and by
+	// taskset -c) into list, returning the number of CPUs parsed, or -1 if
+	// the string is malformed.
+
+	dim_t n = 0;
+	char* s = str;
+
+	while ( *s != '\0' && *s != '\n' )
+	{
+		char* end;
+		long  lo, hi;
+
+		lo = strtol( s, &end, 10 );
+		if ( end == s || lo < 0 ) return -1;
+		s  = end;
+		hi = lo;
+
+		if ( *s == '-' )
+		{
+			++s;
+			hi = strtol( s, &end, 10 );
+			if ( end == s || hi < lo ) return -1;
+			s = end;
+		}
+
+		for ( long cpu = lo; cpu <= hi; ++cpu )
+		{
+			if ( n == max ) return -1;
+			list[ n++ ] = cpu;
+		}
+
+		if      ( *s == ',' ) ++s;
+		else if ( *s != '\0' && *s != '\n' ) return -1;
+	}
+
+	return n;
+}
+
+bool_t bli_affinity_parse
+     (
+       char*       str,
+       affinity_t* affinity,
+       dim_t*      n_cpus,
+       dim_t*      cpus
+     )
+{
+	// Parse the value of the BLIS_AFFINITY environment variable: one of the
+	// policy names, or an explicit CPU list, which is stored to cpus (which
+	// must have room for BLIS_AFFINITY_MAX_CPUS elements). Return FALSE if
+	// the string is neither.
+
+	dim_t n;
+
+	*n_cpus = 0;
+
+	for ( affinity_t i = BLIS_AFFINITY_NONE; i < BLIS_AFFINITY_LIST; ++i )
+	{
+		if ( strcmp( str, affinity_str[ i ] ) == 0 )
+		{
+			*affinity = i;
+			return TRUE;
+		}
+	}
+
+	n = bli_affinity_parse_list( str, cpus, BLIS_AFFINITY_MAX_CPUS );
+
+	if ( n <= 0 ) return FALSE;
+
+	*affinity = BLIS_AFFINITY_LIST;
+	*n_cpus   = n;
+
+	return TRUE;
+}
+
+// -----------------------------------------------------------------------------
+
+// The CPUs available to BLIS, sorted so that the CPUs sharing an L3 cache
+// (a "domain") are contiguous, and within each domain so that the first
+// hardware thread of every core precedes any second hardware thread.
+static dim_t topo_n_cpus = 0;
+static dim_t topo_cpu[ BLIS_AFFINITY_MAX_CPUS ];
+
+// The offset into topo_cpu and the number of CPUs for each domain.
+static dim_t topo_n_doms = 0;
+static dim_t topo_dom_start[ BLIS_AFFINITY_MAX_CPUS ];
+static dim_t topo_dom_size[ BLIS_AFFINITY_MAX_CPUS ];
+
+static pthread_once_t topo_once = PTHREAD_ONCE_INIT;
+
+#ifdef __linux__
+
+typedef struct
+{
+	dim_t dom;
+	dim_t smt;
+	dim_t cpu;
+} topo_entry_t;
+
+static int bli_affinity_entry_cmp( const void* a_void, const void* b_void )
+{
+	const topo_entry_t* a = a_void;
+	const topo_entry_t* b = b_void;
+
+	if ( a->dom != b->dom ) return a->dom < b->dom ? -1 : 1;
+	if ( a->smt != b->smt ) return a->smt < b->smt ? -1 : 1;
+	if ( a->cpu != b->cpu ) return a->cpu < b->cpu ? -1 : 1;
+	return 0;
+}
+
+static dim_t bli_affinity_read_list( char* path, dim_t* list, dim_t max )
+{
+	char  buf[ 4096 ];
+	FILE* file = fopen( path, "r" );
+	dim_t n    = -1;
+
+	if ( file == NULL ) return -1;
+
+	if ( fgets( buf, sizeof( buf ), file ) != NULL )
+		n = bli_affinity_parse_list( buf, list, max );
+
+	fclose( file );
+
+	return n;
+}
+
+static dim_t bli_affinity_query_domain( dim_t cpu )
+{
+	// Identify the L3 cache shared by the given CPU by the lowest-numbered
+	// CPU that shares it. If sysfs does not describe an L3 cache, fall back
+	// to the physical package.
+
+	char  path[ 128 ];
+	dim_t list[ BLIS_AFFINITY_MAX_CPUS ];
+	dim_t n;
+
+	for ( dim_t index = 0; index < 16; ++index )
+	{
+		snprintf( path, sizeof( path ),
+		          "/sys/devices/system/cpu/cpu%ld/cache/index%ld/level",
+		          ( long )cpu, ( long )index );
+
+		n = bli_affinity_read_list( path, list, BLIS_AFFINITY_MAX_CPUS );
+
+		if ( n < 0 ) break;
+		if ( n != 1 || list[ 0 ] != 3 ) continue;
+
+		snprintf( path, sizeof( path ),
+		          "/sys/devices/system/cpu/cpu%ld/cache/index%ld/shared_cpu_list",
+		          ( long )cpu, ( long )index );
+
+		n = bli_affinity_read_list( path, list, BLIS_AFFINITY_MAX_CPUS );
+
+		if ( n > 0 ) return list[ 0 ];
+	}
+
+	snprintf( path, sizeof( path ),
+	          "/sys/devices/system/cpu/cpu%ld/topology/physical_package_id",
+	          ( long )cpu );
+
+	n = bli_affinity_read_list( path, list, BLIS_AFFINITY_MAX_CPUS );
+
+	// Offset package ids so that they never collide with CPU ids.
+	if ( n == 1 ) return BLIS_AFFINITY_MAX_CPUS + list[ 0 ];
+
+	return 0;
+}
+
+static dim_t bli_affinity_query_smt( dim_t cpu )
+{
+	// Return the rank of the given CPU among the hardware threads of its
+	// core (0 for the first hardware thread).
+
+	char  path[ 128 ];
+	dim_t list[ BLIS_AFFINITY_MAX_CPUS ];
+	dim_t n;
+	dim_t rank = 0;
+
+	snprintf( path, sizeof( path ),
+	          "/sys/devices/system/cpu/cpu%ld/topology/thread_siblings_list",
+	          ( long )cpu );
+
+	n = bli_affinity_read_list( path, list, BLIS_AFFINITY_MAX_CPUS );
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		if ( list[ i ] < cpu ) ++rank;
+	}
+
+	return rank;
+}
+
+#endif
+
+static void bli_affinity_init_topology( void )
+{
+#ifdef __linux__
+	// The CPUs available to BLIS are those in the affinity mask of the
+	// thread that first runs a multithreaded operation (normally the mask
+	// of the whole process, as set by e.g. taskset or numactl).
+
+	cpu_set_t     set;
+	topo_entry_t* entries;
+	dim_t         n = 0;
+
+	if ( sched_getaffinity( 0, sizeof( set ), &set ) != 0 ) return;
+
+	entries = bli_malloc_intl( sizeof( topo_entry_t ) * BLIS_AFFINITY_MAX_CPUS );
+
+	for ( dim_t cpu = 0; cpu < BLIS_AFFINITY_MAX_CPUS && cpu < CPU_SETSIZE; ++cpu )
+	{
+		if ( !CPU_ISSET( cpu, &set ) ) continue;
+
+		entries[ n ].dom = bli_affinity_query_domain( cpu );
+		entries[ n ].smt = bli_affinity_query_smt( cpu );
+		entries[ n ].cpu = cpu;
+		++n;
+	}
+
+	qsort( entries, n, sizeof( topo_entry_t ), bli_affinity_entry_cmp );
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		topo_cpu[ i ] = entries[ i ].cpu;
+
+		// Start a new domain whenever the L3 cache changes.
+		if ( i == 0 || entries[ i ].dom != entries[ i - 1 ].dom )
+		{
+			topo_dom_start[ topo_n_doms ] = i;
+			topo_dom_size[ topo_n_doms ]  = 0;
+			++topo_n_doms;
+		}
+
+		++topo_dom_size[ topo_n_doms - 1 ];
+	}
+
+	topo_n_cpus = n;
+
+	bli_free_intl( entries );
+#endif
+}
+
+dim_t bli_affinity_num_domains( void )
+{
+	// Return the number of L3 cache domains spanned by the CPUs available to
+	// BLIS, or 1 if the topology is unknown.
+
+	pthread_once( &topo_once, bli_affinity_init_topology );
+
+	return bli_max( topo_n_doms, 1 );
+}
+
+dim_t bli_affinity_num_cpus( void )
+{
+	// Return the number of CPUs available to BLIS, or 1 if the topology is
+	// unknown.
+
+	pthread_once( &topo_once, bli_affinity_init_topology );
+
+	return bli_max( topo_n_cpus, 1 );
+}
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_affinity_cpu_in_domain( dim_t dom, dim_t slot, bool_t spill )
+{
+	// Return the CPU at the given slot within a domain. A slot beyond the
+	// end of the domain either wraps around within the domain or, if spill
+	// is TRUE, spills over into the domains that follow it.
+
+	if ( !spill ) slot %= topo_dom_size[ dom ];
+
+	return topo_cpu[ ( topo_dom_start[ dom ] + slot ) % topo_n_cpus ];
+}
+
+bool_t bli_affinity_map
+     (
+       rntm_t* rntm,
+       dim_t   n_threads,
+       dim_t*  cpu_of_thread
+     )
+{
+	// Determine the CPU to which each of the n_threads threads of a level-3
+	// operation should be bound, storing -1 for threads that are not to be
+	// bound. Return whether any thread is to be bound.
+	//
+	// Thread ids are assigned to the jc, ic, and jr communicators in
+	// contiguous ranges (see bli_thrinfo_create_for_cntl()), so binding
+	// consecutive thread ids to CPUs that share a cache places each group
+	// of threads that shares a packed block next to that block.
+
+	affinity_t affinity = bli_rntm_affinity( rntm );
+	dim_t      n_cpus   = bli_rntm_affinity_num_cpus( rntm );
+	dim_t*     cpus     = bli_rntm_affinity_cpus( rntm );
+	rntm_t     global;
+
+	for ( dim_t id = 0; id < n_threads; ++id ) cpu_of_thread[ id ] = -1;
+
+	// Fall back to the global policy if the rntm_t does not specify one.
+	if ( affinity == BLIS_AFFINITY_DEFAULT )
+	{
+		bli_thread_init_rntm_from_global( &global );
+
+		affinity = bli_rntm_affinity( &global );
+		n_cpus   = bli_rntm_affinity_num_cpus( &global );
+		cpus     = bli_rntm_affinity_cpus( &global );
+	}
+
+	// Operations that run on a single thread are never bound, since they
+	// may well be called concurrently from several application threads.
+	if ( n_threads <= 1 ) return FALSE;
+	if ( affinity == BLIS_AFFINITY_DEFAULT ||
+	     affinity == BLIS_AFFINITY_NONE ) return FALSE;
+
+	if ( affinity == BLIS_AFFINITY_LIST )
+	{
+		if ( n_cpus <= 0 || cpus == NULL ) return FALSE;
+
+		for ( dim_t id = 0; id < n_threads; ++id )
+			cpu_of_thread[ id ] = cpus[ id % n_cpus ];
+
+		return TRUE;
+	}
+
+	pthread_once( &topo_once, bli_affinity_init_topology );
+
+	if ( topo_n_cpus == 0 ) return FALSE;
+
+	if ( affinity == BLIS_AFFINITY_COMPACT )
+	{
+		for ( dim_t id = 0; id < n_threads; ++id )
+			cpu_of_thread[ id ] = topo_cpu[ id % topo_n_cpus ];
+	}
+	else if ( affinity == BLIS_AFFINITY_SCATTER )
+	{
+		for ( dim_t id = 0; id < n_threads; ++id )
+		{
+			dim_t dom  = id % topo_n_doms;
+			dim_t slot = id / topo_n_doms;
+
+			cpu_of_thread[ id ] = bli_affinity_cpu_in_domain( dom, slot, FALSE );
+		}
+	}
+	else // if ( affinity == BLIS_AFFINITY_L3 )
+	{
+		// Assign the threads of each jc group to a single domain, cycling
+		// through the domains if there are more groups than domains. Only
+		// a group that is larger than its domain spills over into the
+		// next one.
+		dim_t jc_ways = bli_max( bli_rntm_jc_ways( rntm ), 1 );
+		dim_t n_group = bli_max( n_threads / jc_ways, 1 );
+
+		for ( dim_t id = 0; id < n_threads; ++id )
+		{
+			dim_t group = id / n_group;
+			dim_t dom   = group % topo_n_doms;
+			dim_t slot  = ( group / topo_n_doms ) * n_group + id % n_group;
+
+			bool_t spill = ( n_group > topo_dom_size[ dom ] );
+
+			cpu_of_thread[ id ] = bli_affinity_cpu_in_domain( dom, slot, spill );
+		}
+	}
+
+	return TRUE;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_affinity_bind( dim_t cpu, affinity_thr_t* aff )
+{
+	// Bind the calling thread to the given CPU (if it is non-negative),
+	// saving its current affinity mask in aff so that it may be restored
+	// by bli_affinity_unbind().
+
+	aff->bound = FALSE;
+
+	if ( cpu < 0 ) return;
+
+#ifdef __linux__
+	cpu_set_t* saved = ( cpu_set_t* )aff->mask;
+	cpu_set_t  set;
+
+	if ( cpu >= CPU_SETSIZE ) return;
+
+	if ( pthread_getaffinity_np( pthread_self(), sizeof( aff->mask ), saved ) != 0 )
+		return;
+
+	CPU_ZERO( &set );
+	CPU_SET( cpu, &set );
+
+	// If the CPU is not available (e.g. an explicit list named a CPU outside
+	// of the process's mask), the thread is simply left where it is.
+	if ( pthread_setaffinity_np( pthread_self(), sizeof( set ), &set ) != 0 )
+		return;
+
+	aff->bound = TRUE;
+#endif
+}
+
+void bli_affinity_unbind( affinity_thr_t* aff )
+{
+	// Restore the affinity mask that the calling thread had before it was
+	// bound by bli_affinity_bind().
+
+	if ( !aff->bound ) return;
+
+#ifdef __linux__
+	pthread_setaffinity_np( pthread_self(), sizeof( aff->mask ),
+	                        ( cpu_set_t* )aff->mask );
+#endif
+
+	aff->bound = FALSE;
+}
+
@@ -0,0 +1,74 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_AFFINITY_H
+#define BLIS_AFFINITY_H
+
+// The maximum number of CPUs that can be named in an affinity mask.
+#define BLIS_AFFINITY_MAX_CPUS 1024
+
+// The state a thread saves before it is bound to a CPU, so that its
+// original affinity mask can be restored afterwards.
+typedef struct affinity_thr_s
+{
+	bool_t   bound;
+	uint64_t mask[ BLIS_AFFINITY_MAX_CPUS / 64 ];
+} affinity_thr_t;
+
+bool_t bli_affinity_parse
+     (
+       char*       str,
+       affinity_t* affinity,
+       dim_t*      n_cpus,
+       dim_t*      cpus
+     );
+
+char*  bli_affinity_string( affinity_t affinity );
+
+dim_t  bli_affinity_num_cpus( void );
+dim_t  bli_affinity_num_domains( void );
+
+bool_t bli_affinity_map
+     (
+       rntm_t* rntm,
+       dim_t   n_threads,
+       dim_t*  cpu_of_thread
+     );
+
+void   bli_affinity_bind( dim_t cpu, affinity_thr_t* aff );
+void   bli_affinity_unbind( affinity_thr_t* aff );
+
+#endif
+
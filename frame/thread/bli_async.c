@@ -0,0 +1,285 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The queue of submitted requests, in the order in which they were
+// submitted, and the state of the worker threads that execute them. The
+// workers are started when requests are submitted, so applications that
+// never use the async API never create them.
+static async_t*        queue_head    = NULL;
+static async_t*        queue_tail    = NULL;
+
+static dim_t           workers_req   = 1;
+static dim_t           workers_run   = 0;
+static bool_t          shutting_down = FALSE;
+
+static pthread_mutex_t async_mutex   = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  work_cond     = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  done_cond     = PTHREAD_COND_INITIALIZER;
+
+// -----------------------------------------------------------------------------
+
+void bli_async_init( void )
+{
+	pthread_mutex_lock( &async_mutex );
+
+	// If BLIS is being re-initialized after bli_async_finalize(), make sure
+	// that the workers from before have exited, and then allow the workers
+	// started by the next submission to wait for requests again.
+	while ( 0 < workers_run )
+		pthread_cond_wait( &done_cond, &async_mutex );
+
+	shutting_down = FALSE;
+
+	pthread_mutex_unlock( &async_mutex );
+
+	bli_async_set_num_workers
+	(
+	  bli_thread_get_env( "BLIS_ASYNC_NUM_WORKERS", 1 )
+	);
+}
+
+void bli_async_finalize( void )
+{
+	pthread_mutex_lock( &async_mutex );
+
+	// Let the workers drain the queue, and then wait for all of them to
+	// exit so that no operation is still running when the rest of BLIS is
+	// finalized.
+	shutting_down = TRUE;
+
+	pthread_cond_broadcast( &work_cond );
+
+	while ( 0 < workers_run )
+		pthread_cond_wait( &done_cond, &async_mutex );
+
+	pthread_mutex_unlock( &async_mutex );
+}
+
+dim_t bli_async_num_workers( void )
+{
+	dim_t n_workers;
+
+	pthread_mutex_lock( &async_mutex );
+
+	n_workers = workers_req;
+
+	pthread_mutex_unlock( &async_mutex );
+
+	return n_workers;
+}
+
+void bli_async_set_num_workers( dim_t n_workers )
+{
+	pthread_mutex_lock( &async_mutex );
+
+	workers_req = bli_max( n_workers, 1 );
+
+	// Wake any idle workers so that extras notice they should exit. New
+	// workers are started by the next submission.
+	pthread_cond_broadcast( &work_cond );
+
+	pthread_mutex_unlock( &async_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+static void* bli_async_worker( void* arg )
+{
+	pthread_mutex_lock( &async_mutex );
+
+	while ( TRUE )
+	{
+		async_t* req;
+
+		while ( queue_head == NULL && !shutting_down &&
+		        workers_run <= workers_req )
+			pthread_cond_wait( &work_cond, &async_mutex );
+
+		// Exit if there are more workers than requested, or if BLIS is
+		// being finalized and the queue has been drained.
+		if ( workers_run > workers_req ) break;
+		if ( queue_head == NULL ) break;
+
+		req        = queue_head;
+		queue_head = req->next;
+		if ( queue_head == NULL ) queue_tail = NULL;
+
+		pthread_mutex_unlock( &async_mutex );
+
+		req->exec( req );
+
+		// The callback is invoked before the request is marked as done so
+		// that it may still use the request. Consequently, a callback must
+		// not call bli_async_wait() (or bli_async_free()) on its own
+		// request, since the former would never return.
+		if ( req->cb != NULL ) req->cb( req, req->cb_data );
+
+		pthread_mutex_lock( &async_mutex );
+
+		req->done = TRUE;
+
+		if ( req->detached ) bli_free_intl( req );
+
+		pthread_cond_broadcast( &done_cond );
+	}
+
+	workers_run -= 1;
+
+	pthread_cond_broadcast( &done_cond );
+
+	pthread_mutex_unlock( &async_mutex );
+
+	return NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+async_t* bli_async_create
+     (
+       async_exec_ft exec,
+       cntx_t*       cntx,
+       rntm_t*       rntm,
+       async_cb_ft   cb,
+       void*         cb_data
+     )
+{
+	async_t* req = bli_malloc_intl( sizeof( async_t ) );
+
+	req->exec     = exec;
+	req->cntx     = cntx;
+	req->cb       = cb;
+	req->cb_data  = cb_data;
+	req->done     = FALSE;
+	req->detached = FALSE;
+	req->next     = NULL;
+
+	// Capture the threading settings now, since the calling thread's own
+	// settings (if any) are not visible to the worker that executes the
+	// request.
+	if ( rntm == NULL ) bli_thread_init_rntm( &req->rntm );
+	else                req->rntm = *rntm;
+
+	return req;
+}
+
+void bli_async_save_scalar( obj_t* obj, obj_t* saved )
+{
+	// Scalar objects (alpha and beta) are often temporaries, so we save a
+	// copy of their value rather than a reference to it. (The global
+	// constants may be referenced since they persist.)
+	if ( !bli_obj_is_const( obj ) )
+		bli_obj_scalar_init_detached_copy_of( bli_obj_dt( obj ),
+		                                      BLIS_NO_CONJUGATE,
+		                                      obj, saved );
+	else
+		*saved = *obj;
+}
+
+void bli_async_save_obj( obj_t* obj, obj_t* saved )
+{
+	// Matrix operands always reference the caller's buffer, even when they
+	// happen to be 1x1, since the output operand must be updated in place.
+	*saved = *obj;
+}
+
+void bli_async_submit( async_t* req )
+{
+	pthread_mutex_lock( &async_mutex );
+
+	if ( queue_tail == NULL ) queue_head       = req;
+	else                      queue_tail->next = req;
+	queue_tail = req;
+
+	// Start as many workers as are needed to reach the requested number.
+	while ( workers_run < workers_req )
+	{
+		pthread_t worker;
+
+		if ( pthread_create( &worker, NULL, bli_async_worker, NULL ) != 0 )
+			break;
+
+		pthread_detach( worker );
+
+		workers_run += 1;
+	}
+
+	pthread_cond_signal( &work_cond );
+
+	pthread_mutex_unlock( &async_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+bool_t bli_async_test( async_t* req )
+{
+	bool_t done;
+
+	pthread_mutex_lock( &async_mutex );
+
+	done = req->done;
+
+	pthread_mutex_unlock( &async_mutex );
+
+	return done;
+}
+
+void bli_async_wait( async_t* req )
+{
+	pthread_mutex_lock( &async_mutex );
+
+	while ( !req->done )
+		pthread_cond_wait( &done_cond, &async_mutex );
+
+	pthread_mutex_unlock( &async_mutex );
+}
+
+void bli_async_free( async_t* req )
+{
+	bool_t done;
+
+	pthread_mutex_lock( &async_mutex );
+
+	// If the request has not completed, leave it to the worker to free it
+	// once it does.
+	done = req->done;
+
+	if ( !done ) req->detached = TRUE;
+
+	pthread_mutex_unlock( &async_mutex );
+
+	if ( done ) bli_free_intl( req );
+}
+
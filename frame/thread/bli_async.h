@@ -0,0 +1,96 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_ASYNC_H
+#define BLIS_ASYNC_H
+
+// A request for an operation that is executed asynchronously by one of the
+// BLIS async worker threads. The operands are saved within the request
+// when it is created, so the caller's obj_t structs need not outlive the
+// call that submitted it (though their buffers must remain valid until the
+// operation completes).
+
+struct async_s;
+
+typedef void (*async_exec_ft)( struct async_s* req );
+// A completion callback is invoked by the worker thread that executed the
+// operation, before the request is marked as done. It must therefore not
+// call bli_async_wait() or bli_async_free() on its own request; waiting on
+// it would deadlock.
+typedef void (*async_cb_ft)( struct async_s* req, void* data );
+
+#define BLIS_ASYNC_MAX_OBJS 5
+
+typedef struct async_s
+{
+	async_exec_ft   exec;
+
+	obj_t           obj[ BLIS_ASYNC_MAX_OBJS ];
+	side_t          side;
+	cntx_t*         cntx;
+	rntm_t          rntm;
+
+	async_cb_ft     cb;
+	void*           cb_data;
+
+	bool_t          done;
+	bool_t          detached;
+
+	struct async_s* next;
+} async_t;
+
+void     bli_async_init( void );
+void     bli_async_finalize( void );
+
+async_t* bli_async_create
+     (
+       async_exec_ft exec,
+       cntx_t*       cntx,
+       rntm_t*       rntm,
+       async_cb_ft   cb,
+       void*         cb_data
+     );
+void     bli_async_save_scalar( obj_t* obj, obj_t* saved );
+void     bli_async_save_obj( obj_t* obj, obj_t* saved );
+void     bli_async_submit( async_t* req );
+
+bool_t   bli_async_test( async_t* req );
+void     bli_async_wait( async_t* req );
+void     bli_async_free( async_t* req );
+
+dim_t    bli_async_num_workers( void );
+void     bli_async_set_num_workers( dim_t n_workers );
+
+#endif
+
@@ -0,0 +1,153 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// The process-wide thread budget: the total number of threads that all
+// concurrently executing level-3 operations may use, and the number of
+// those threads currently in use. A size of zero disables the budget.
+// Both are accessed atomically so that, while the budget is disabled,
+// operations need not serialize on the mutex: the size is only modified
+// with the mutex held, but it is read without the mutex as the flag that
+// says whether the budget is enabled, and the count of threads in use is
+// updated without the mutex whenever the budget is disabled.
+static dim_t           budget_size  = 0;
+static dim_t           budget_used  = 0;
+
+static pthread_mutex_t budget_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  budget_cond  = PTHREAD_COND_INITIALIZER;
+
+// -----------------------------------------------------------------------------
+
+void bli_budget_init( void )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	// Read the size of the budget from BLIS_THREAD_BUDGET. A negative value
+	// sizes the budget to the number of CPUs available to the process.
+	dim_t n_threads = bli_thread_get_env( "BLIS_THREAD_BUDGET", 0 );
+
+	if ( n_threads != 0 ) bli_budget_set_size( n_threads );
+#endif
+}
+
+dim_t bli_budget_size( void )
+{
+	return __atomic_load_n( &budget_size, __ATOMIC_SEQ_CST );
+}
+
+void bli_budget_set_size( dim_t n_threads )
+{
+	if ( n_threads < 0 ) n_threads = bli_affinity_num_cpus();
+
+	pthread_mutex_lock( &budget_mutex );
+
+	__atomic_store_n( &budget_size, n_threads, __ATOMIC_SEQ_CST );
+
+	// Wake any callers waiting on the old budget so that they reevaluate
+	// the new one.
+	pthread_cond_broadcast( &budget_cond );
+
+	pthread_mutex_unlock( &budget_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_budget_acquire( rntm_t* rntm )
+{
+	dim_t n_req = bli_rntm_num_threads( rntm );
+	dim_t n_got = n_req;
+	dim_t n_used;
+	dim_t n_use;
+
+	// Note that threads are counted even when the budget is disabled so
+	// that enabling it later accounts for operations that are already
+	// running. When the budget is disabled (the default), counting them is
+	// all there is to do, and the mutex is not needed.
+	if ( __atomic_load_n( &budget_size, __ATOMIC_SEQ_CST ) <= 0 )
+	{
+		__atomic_add_fetch( &budget_used, n_req, __ATOMIC_SEQ_CST );
+
+		return n_req;
+	}
+
+	pthread_mutex_lock( &budget_mutex );
+
+	// If the budget is still in effect, wait until at least one thread is
+	// free and then take as many of the requested threads as are available.
+	// (Operations that found the budget disabled may still add their
+	// threads to the count, so it is read once per test.)
+	while ( 0 < budget_size &&
+	        budget_size <= ( n_used = __atomic_load_n( &budget_used,
+	                                                   __ATOMIC_SEQ_CST ) ) )
+		pthread_cond_wait( &budget_cond, &budget_mutex );
+
+	if ( 0 < budget_size )
+		n_got = bli_min( n_req, budget_size - n_used );
+
+	__atomic_add_fetch( &budget_used, n_got, __ATOMIC_SEQ_CST );
+
+	pthread_mutex_unlock( &budget_mutex );
+
+	if ( n_got == n_req ) return n_req;
+
+	// Scale the ways of parallelism back to fit within the threads that
+	// were granted, and return any that the new factorization cannot use.
+	bli_rntm_limit_ways( n_got, rntm );
+
+	n_use = bli_rntm_num_threads( rntm );
+
+	if ( n_use < n_got ) bli_budget_release( n_got - n_use );
+
+	return n_use;
+}
+
+void bli_budget_release( dim_t n_threads )
+{
+	__atomic_sub_fetch( &budget_used, n_threads, __ATOMIC_SEQ_CST );
+
+	// Callers only wait while the budget is enabled, and disabling it wakes
+	// them (see bli_budget_set_size()), so there is nobody to wake if the
+	// budget is disabled. Otherwise, broadcast with the mutex held so that
+	// a caller that has just found the budget exhausted is waiting by the
+	// time the broadcast occurs.
+	if ( __atomic_load_n( &budget_size, __ATOMIC_SEQ_CST ) <= 0 ) return;
+
+	pthread_mutex_lock( &budget_mutex );
+
+	pthread_cond_broadcast( &budget_cond );
+
+	pthread_mutex_unlock( &budget_mutex );
+}
+
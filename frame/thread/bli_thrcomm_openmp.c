@@ -218,12 +218,23 @@ void bli_l3_thread_decorator
        cntl_t*     cntl
      )
 {
-	// Query the total number of threads from the context.
-	dim_t       n_threads = bli_rntm_num_threads( rntm );
+	// Negotiate the number of threads with the process-wide thread budget.
+	// If fewer threads are granted than were requested, the ways of
+	// parallelism are scaled back within a local copy of the rntm_t, since
+	// the caller may reuse its rntm_t for subsequent calls (e.g. her2k).
+	rntm_t      rntm_l    = *rntm;
+	dim_t       n_threads = bli_budget_acquire( &rntm_l );
+
+	rntm = &rntm_l;
 
 	// Allcoate a global communicator for the root thrinfo_t structures.
 	thrcomm_t*  gl_comm   = bli_thrcomm_create( n_threads );
 
+	// Determine the CPU (if any) to which each thread will be bound.
+	dim_t*      cpus      = bli_malloc_intl( n_threads * sizeof( dim_t ) );
+
+	bli_affinity_map( rntm, n_threads, cpus );
+
 #ifdef PRINT_THRINFO
 	thrinfo_t** threads   = bli_malloc_intl( n_threads * sizeof( thrinfo_t* ) );
 #endif
@@ -236,6 +247,15 @@ void bli_l3_thread_decorator
 		cntl_t*    cntl_use;
 		thrinfo_t* thread;
 
+		affinity_thr_t aff;
+
+		BLIS_PERFCTR_DECL( perfctr );
+
+		// Bind the current thread to its CPU, if an affinity policy is in
+		// use. The original mask is restored below, since the threads of
+		// the OpenMP runtime outlive the operation.
+		bli_affinity_bind( cpus[id], &aff );
+
 		// Alias thread-local copies of A, B, and C. These will be the objects
 		// we pass down the algorithmic function stack. Making thread-local
 		// alaises IS ABSOLUTELY IMPORTANT and MUST BE DONE because each thread
@@ -251,6 +271,9 @@ void bli_l3_thread_decorator
 		// Create the root node of the current thread's thrinfo_t structure.
 		bli_l3_thrinfo_create_root( id, gl_comm, rntm, cntl_use, &thread );
 
+		// Count hardware events for this thread, if requested.
+		BLIS_PERFCTR_BEGIN( perfctr );
+
 		func
 		(
 		  alpha,
@@ -264,6 +287,8 @@ void bli_l3_thread_decorator
 		  thread
 		);
 
+		BLIS_PERFCTR_END( perfctr, family, id );
+
 		// Free the control tree, if one was created locally.
 		bli_l3_cntl_free_if( &a_t, &b_t, &c_t, cntl, cntl_use, thread );
 
@@ -273,8 +298,16 @@ void bli_l3_thread_decorator
 		// Free the current thread's thrinfo_t structure.
 		bli_l3_thrinfo_free( thread );
 #endif
+
+		// Restore the thread's original affinity mask.
+		bli_affinity_unbind( &aff );
 	}
 
+	bli_free_intl( cpus );
+
+	// Return the threads to the process-wide thread budget.
+	bli_budget_release( n_threads );
+
 	// We shouldn't free the global communicator since it was already freed
 	// by the global communicator's chief thread in bli_l3_thrinfo_free()
 	// (called above).
@@ -287,5 +320,42 @@ void bli_l3_thread_decorator
 #endif
 }
 
-#endif
+// -----------------------------------------------------------------------------
+
+void bli_thread_launch
+     (
+       dim_t         n_threads,
+       thread_func_t func,
+       void*         params
+     )
+{
+	// Skip the parallel region entirely if we only need one thread.
+	if ( n_threads <= 1 )
+	{
+		thrinfo_t thread;
+
+		bli_thrinfo_init_single( &thread );
+
+		func( params, &thread );
+
+		return;
+	}
+
+	// Allocate a global communicator shared by all threads.
+	thrcomm_t* gl_comm = bli_thrcomm_create( n_threads );
+
+	_Pragma( "omp parallel num_threads(n_threads)" )
+	{
+		dim_t     id = omp_get_thread_num();
+		thrinfo_t thread;
+
+		// Each thread is its own work unit within the global communicator.
+		bli_thrinfo_init( &thread, gl_comm, id, n_threads, id, FALSE, NULL );
+
+		func( params, &thread );
+	}
+
+	bli_thrcomm_free( gl_comm );
+}
 
+#endif
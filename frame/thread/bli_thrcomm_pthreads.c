@@ -142,6 +142,7 @@ typedef struct thread_data
 	rntm_t*    rntm;
 	cntl_t*    cntl;
 	dim_t      id;
+	dim_t      cpu;
 	thrcomm_t* gl_comm;
 } thread_data_t;
 
@@ -161,11 +162,18 @@ void* bli_l3_thread_entry( void* data_void )
 	rntm_t*        rntm     = data->rntm;
 	cntl_t*        cntl     = data->cntl;
 	dim_t          id       = data->id;
+	dim_t          cpu      = data->cpu;
 	thrcomm_t*     gl_comm  = data->gl_comm;
 
 	obj_t          a_t, b_t, c_t;
 	cntl_t*        cntl_use;
 	thrinfo_t*     thread;
+	affinity_thr_t aff;
+
+	BLIS_PERFCTR_DECL( perfctr );
+
+	// Bind the current thread to its CPU, if an affinity policy is in use.
+	bli_affinity_bind( cpu, &aff );
 
 	// Alias thread-local copies of A, B, and C. These will be the objects
 	// we pass down the algorithmic function stack. Making thread-local
@@ -182,6 +190,9 @@ void* bli_l3_thread_entry( void* data_void )
 	// Create the root node of the current thread's thrinfo_t structure.
 	bli_l3_thrinfo_create_root( id, gl_comm, rntm, cntl_use, &thread );
 
+	// Count hardware events for this thread, if requested.
+	BLIS_PERFCTR_BEGIN( perfctr );
+
 	func
 	(
 	  alpha,
@@ -195,12 +206,17 @@ void* bli_l3_thread_entry( void* data_void )
 	  thread
 	);
 
+	BLIS_PERFCTR_END( perfctr, family, id );
+
 	// Free the control tree, if one was created locally.
 	bli_l3_cntl_free_if( &a_t, &b_t, &c_t, cntl, cntl_use, thread );
 
 	// Free the current thread's thrinfo_t structure.
 	bli_l3_thrinfo_free( thread );
 
+	// Restore the thread's original affinity mask.
+	bli_affinity_unbind( &aff );
+
 	return NULL;
 }
 
@@ -218,17 +234,28 @@ void bli_l3_thread_decorator
        cntl_t*     cntl
      )
 {
-	// Query the total number of threads from the context.
-	dim_t          n_threads = bli_rntm_num_threads( rntm );
+	// Negotiate the number of threads with the process-wide thread budget.
+	// If fewer threads are granted than were requested, the ways of
+	// parallelism are scaled back within a local copy of the rntm_t, since
+	// the caller may reuse its rntm_t for subsequent calls (e.g. her2k).
+	rntm_t         rntm_l    = *rntm;
+	dim_t          n_threads = bli_budget_acquire( &rntm_l );
+
+	rntm = &rntm_l;
 
 	// Allocate an array of pthread objects and auxiliary data structs to pass
 	// to the thread entry functions.
 	pthread_t*     pthreads  = bli_malloc_intl( sizeof( pthread_t     ) * n_threads );
 	thread_data_t* datas     = bli_malloc_intl( sizeof( thread_data_t ) * n_threads );
 
+	dim_t*         cpus      = bli_malloc_intl( sizeof( dim_t         ) * n_threads );
+
 	// Allocate a global communicator for the root thrinfo_t structures.
 	thrcomm_t*     gl_comm   = bli_thrcomm_create( n_threads );
 
+	// Determine the CPU (if any) to which each thread will be bound.
+	bli_affinity_map( rntm, n_threads, cpus );
+
 	// NOTE: We must iterate backwards so that the chief thread (thread id 0)
 	// can spawn all other threads before proceeding with its own computation.
 	for ( dim_t id = n_threads - 1; 0 <= id; id-- )
@@ -245,6 +272,7 @@ void bli_l3_thread_decorator
 		datas[id].rntm    = rntm;
 		datas[id].cntl    = cntl;
 		datas[id].id      = id;
+		datas[id].cpu     = cpus[id];
 		datas[id].gl_comm = gl_comm;
 
 		// Spawn additional threads for ids greater than 1.
@@ -264,10 +292,95 @@ void bli_l3_thread_decorator
 		pthread_join( pthreads[id], NULL );
 	}
 
+	// Return the threads to the process-wide thread budget.
+	bli_budget_release( n_threads );
+
 	bli_free_intl( pthreads );
 	bli_free_intl( datas );
+	bli_free_intl( cpus );
 }
 
+// -----------------------------------------------------------------------------
 
-#endif
+// A data structure to assist in passing arguments to generic threads.
+typedef struct thread_launch_data
+{
+	thread_func_t func;
+	void*         params;
+	dim_t         id;
+	thrcomm_t*    gl_comm;
+} thread_launch_data_t;
+
+// Entry point for threads spawned by bli_thread_launch().
+void* bli_thread_launch_entry( void* data_void )
+{
+	thread_launch_data_t* data = data_void;
+
+	thrcomm_t* gl_comm   = data->gl_comm;
+	dim_t      id        = data->id;
+	dim_t      n_threads = bli_thrcomm_num_threads( gl_comm );
+
+	thrinfo_t  thread;
+
+	// Each thread is its own work unit within the global communicator.
+	bli_thrinfo_init( &thread, gl_comm, id, n_threads, id, FALSE, NULL );
+
+	data->func( data->params, &thread );
+
+	return NULL;
+}
+
+void bli_thread_launch
+     (
+       dim_t         n_threads,
+       thread_func_t func,
+       void*         params
+     )
+{
+	// Skip the thread creation overhead entirely if we only need one thread.
+	if ( n_threads <= 1 )
+	{
+		thrinfo_t thread;
+
+		bli_thrinfo_init_single( &thread );
+
+		func( params, &thread );
 
+		return;
+	}
+
+	pthread_t*            pthreads = bli_malloc_intl( sizeof( pthread_t ) * n_threads );
+	thread_launch_data_t* datas    = bli_malloc_intl( sizeof( thread_launch_data_t ) * n_threads );
+
+	// Allocate a global communicator shared by all threads.
+	thrcomm_t*            gl_comm  = bli_thrcomm_create( n_threads );
+
+	// NOTE: As with bli_l3_thread_decorator(), we iterate backwards so that
+	// the chief thread can spawn all other threads before it begins its own
+	// share of the work.
+	for ( dim_t id = n_threads - 1; 0 <= id; id-- )
+	{
+		datas[id].func    = func;
+		datas[id].params  = params;
+		datas[id].id      = id;
+		datas[id].gl_comm = gl_comm;
+
+		if ( id != 0 )
+			pthread_create( &pthreads[id], NULL, &bli_thread_launch_entry, &datas[id] );
+		else
+			bli_thread_launch_entry( ( void* )(&datas[0]) );
+	}
+
+	// Thread 0 waits for additional threads to finish.
+	for ( dim_t id = 1; id < n_threads; id++ )
+	{
+		pthread_join( pthreads[id], NULL );
+	}
+
+	bli_thrcomm_free( gl_comm );
+
+	bli_free_intl( pthreads );
+	bli_free_intl( datas );
+}
+
+#endif
@@ -95,6 +95,8 @@ void bli_l3_thread_decorator
 	cntl_t*    cntl_use;
 	thrinfo_t* thread;
 
+	BLIS_PERFCTR_DECL( perfctr );
+
 	// NOTE: Unlike with the _openmp.c and _pthreads.c variants, we don't
 	// need to alias objects for A, B, and C since they were already aliased
 	// in bli_*_front(). However, we may add aliasing here in the future so
@@ -108,6 +110,9 @@ void bli_l3_thread_decorator
 	// Create the root node of the thread's thrinfo_t structure.
 	bli_l3_thrinfo_create_root( id, gl_comm, rntm, cntl_use, &thread );
 
+	// Count hardware events for this thread, if requested.
+	BLIS_PERFCTR_BEGIN( perfctr );
+
 	func
 	(
 	  alpha,
@@ -121,6 +126,8 @@ void bli_l3_thread_decorator
 	  thread
 	);
 
+	BLIS_PERFCTR_END( perfctr, family, id );
+
 	// Free the control tree, if one was created locally.
 	bli_l3_cntl_free_if( a, b, c, cntl, cntl_use, thread );
 
@@ -132,6 +139,21 @@ void bli_l3_thread_decorator
 	// (called above).
 }
 
+// -----------------------------------------------------------------------------
 
-#endif
+void bli_thread_launch
+     (
+       dim_t         n_threads,
+       thread_func_t func,
+       void*         params
+     )
+{
+	thrinfo_t thread;
+
+	// For sequential execution, we always use only one thread.
+	bli_thrinfo_init_single( &thread );
 
+	func( params, &thread );
+}
+
+#endif
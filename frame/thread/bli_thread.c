@@ -42,6 +42,15 @@ thrcomm_t BLIS_SINGLE_COMM           = {};
 // The global rntm_t structure, which holds the global thread settings.
 static rntm_t global_rntm;
 
+// Storage for the explicit list of CPUs referenced by global_rntm, if any.
+static dim_t  global_cpus[ BLIS_AFFINITY_MAX_CPUS ];
+
+// The calling thread's own thread settings, if any. When set, these take
+// the place of global_rntm for operations invoked from that thread without
+// an explicit rntm_t (such as calls through the BLAS compatibility layer).
+static BLIS_THREAD_LOCAL rntm_t local_rntm;
+static BLIS_THREAD_LOCAL bool_t local_rntm_is_set = FALSE;
+
 // -----------------------------------------------------------------------------
 
 void bli_thread_init( void )
@@ -53,6 +62,12 @@ void bli_thread_init( void )
 	// Read the environment variables and use them to initialize the
 	// global runtime object.
 	bli_thread_init_rntm_from_env( &global_rntm );
+
+	// Size the process-wide thread budget, if one was requested.
+	bli_budget_init();
+
+	// Read the number of async worker threads to use, if one was requested.
+	bli_async_init();
 }
 
 void bli_thread_finalize( void )
@@ -1293,6 +1308,30 @@ dim_t bli_thread_get_num_threads( void )
 	return bli_rntm_num_threads( &global_rntm );
 }
 
+affinity_t bli_thread_get_affinity( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_affinity( &global_rntm );
+}
+
+dim_t bli_thread_get_budget( void )
+{
+	// We must ensure that the budget has been initialized.
+	bli_init_once();
+
+	return bli_budget_size();
+}
+
+dim_t bli_thread_get_num_async_workers( void )
+{
+	// We must ensure that the async queue has been initialized.
+	bli_init_once();
+
+	return bli_async_num_workers();
+}
+
 // ----------------------------------------------------------------------------
 
 // A mutex to allow synchronous access to global_rntm.
@@ -1320,9 +1359,129 @@ void bli_thread_set_num_threads( dim_t n_threads )
 	pthread_mutex_unlock( &global_rntm_mutex );
 }
 
+void bli_thread_set_affinity( affinity_t affinity )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Acquire the mutex protecting global_rntm.
+	pthread_mutex_lock( &global_rntm_mutex );
+
+	// The global policy cannot defer to itself.
+	if ( affinity == BLIS_AFFINITY_DEFAULT ) affinity = BLIS_AFFINITY_NONE;
+
+	bli_rntm_set_affinity( affinity, &global_rntm );
+
+	// Release the mutex protecting global_rntm.
+	pthread_mutex_unlock( &global_rntm_mutex );
+}
+
+void bli_thread_set_affinity_cpus( dim_t n_cpus, dim_t* cpus )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Acquire the mutex protecting global_rntm.
+	pthread_mutex_lock( &global_rntm_mutex );
+
+	// Unlike bli_rntm_set_affinity_cpus(), copy the list, so that the
+	// caller need not keep it around.
+	n_cpus = bli_min( n_cpus, BLIS_AFFINITY_MAX_CPUS );
+	memcpy( global_cpus, cpus, sizeof( dim_t ) * n_cpus );
+
+	bli_rntm_set_affinity_cpus( n_cpus, global_cpus, &global_rntm );
+
+	// Release the mutex protecting global_rntm.
+	pthread_mutex_unlock( &global_rntm_mutex );
+}
+
+void bli_thread_set_budget( dim_t n_threads )
+{
+	// We must ensure that the budget has been initialized, lest the value
+	// set here be overwritten by BLIS_THREAD_BUDGET later on.
+	bli_init_once();
+
+	bli_budget_set_size( n_threads );
+}
+
+void bli_thread_set_num_async_workers( dim_t n_workers )
+{
+	// We must ensure that the async queue has been initialized, lest the
+	// value set here be overwritten by BLIS_ASYNC_NUM_WORKERS later on.
+	bli_init_once();
+
+	bli_async_set_num_workers( n_workers );
+}
+
+// ----------------------------------------------------------------------------
+
+// The following functions modify only the calling thread's settings, and so
+// they require no locking. The first call to one of the setters seeds the
+// local settings with a copy of the global settings.
+
+void bli_thread_set_ways_local( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	if ( !local_rntm_is_set )
+	{
+		bli_thread_init_rntm_from_global( &local_rntm );
+		local_rntm_is_set = TRUE;
+	}
+
+	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, &local_rntm );
+}
+
+void bli_thread_set_num_threads_local( dim_t n_threads )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	if ( !local_rntm_is_set )
+	{
+		bli_thread_init_rntm_from_global( &local_rntm );
+		local_rntm_is_set = TRUE;
+	}
+
+	bli_rntm_set_num_threads_only( n_threads, &local_rntm );
+}
+
+void bli_thread_set_rntm_local( rntm_t* rntm )
+{
+	// A NULL rntm_t reverts the calling thread to the global settings.
+	if ( rntm == NULL )
+	{
+		local_rntm_is_set = FALSE;
+		return;
+	}
+
+	// NOTE: The copy is shallow, so any list of CPUs referenced by rntm
+	// must remain valid for as long as the local settings are in effect.
+	local_rntm        = *rntm;
+	local_rntm_is_set = TRUE;
+}
+
+void bli_thread_clear_local( void )
+{
+	local_rntm_is_set = FALSE;
+}
+
 // ----------------------------------------------------------------------------
 
 void bli_thread_init_rntm( rntm_t* rntm )
+{
+	// Prefer the calling thread's own settings, if it has any.
+	if ( local_rntm_is_set )
+	{
+		*rntm = local_rntm;
+		return;
+	}
+
+	bli_thread_init_rntm_from_global( rntm );
+}
+
+void bli_thread_init_rntm_from_global( rntm_t* rntm )
 {
 	// Acquire the mutex protecting global_rntm.
 	pthread_mutex_lock( &global_rntm_mutex );
@@ -1344,8 +1503,10 @@ void bli_thread_init_rntm_from_env
 	// function is only called from bli_thread_init(), which is only called
 	// by bli_init_once().
 
-	dim_t nt;
-	dim_t jc, pc, ic, jr, ir;
+	dim_t      nt;
+	dim_t      jc, pc, ic, jr, ir;
+	affinity_t affinity = BLIS_AFFINITY_NONE;
+	dim_t      n_cpus   = 0;
 
 #ifdef BLIS_ENABLE_MULTITHREADING
 
@@ -1384,6 +1545,18 @@ void bli_thread_init_rntm_from_env
 	// are all unset, OR nt is unset and the ways for each loop
 	// are all set.
 
+	// Read the thread affinity policy (or explicit list of CPUs).
+	char* str = getenv( "BLIS_AFFINITY" );
+
+	if ( str != NULL && *str != '\0' &&
+	     !bli_affinity_parse( str, &affinity, &n_cpus, global_cpus ) )
+	{
+		bli_print_msg( "Ignoring unknown policy in BLIS_AFFINITY.",
+		               __FILE__, __LINE__ );
+		affinity = BLIS_AFFINITY_NONE;
+		n_cpus   = 0;
+	}
+
 #else
 
 	// When multithreading is disabled, always set the rntm_t ways
@@ -1396,6 +1569,8 @@ void bli_thread_init_rntm_from_env
 	// Save the results back in the runtime object.
 	bli_rntm_set_num_threads_only( nt, rntm );
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
+	bli_rntm_set_affinity_only( affinity, rntm );
+	bli_rntm_set_affinity_cpus_only( n_cpus, n_cpus > 0 ? global_cpus : NULL, rntm );
 
 #if 0
 	printf( "bli_thread_init_rntm_from_env()\n" );
@@ -1403,3 +1578,53 @@ void bli_thread_init_rntm_from_env
 #endif
 }
 
+
+// ----------------------------------------------------------------------------
+
+dim_t bli_thread_calc_num_threads_for_work
+     (
+       siz_t   work,
+       siz_t   work_min,
+       rntm_t* rntm
+     )
+{
+	dim_t nt = bli_rntm_num_threads( rntm );
+
+	// If the total number of threads was not set, then the ways of
+	// parallelism (if any were set) determine the total. Operations that
+	// partition their work along a single dimension (such as those in
+	// levels 1v, 1m, and 2) simply use the product of all ways.
+	if ( nt < 1 )
+	{
+		dim_t jc = bli_rntm_jc_ways( rntm );
+		dim_t pc = bli_rntm_pc_ways( rntm );
+		dim_t ic = bli_rntm_ic_ways( rntm );
+		dim_t jr = bli_rntm_jr_ways( rntm );
+		dim_t ir = bli_rntm_ir_ways( rntm );
+
+		nt = 1;
+
+		if ( jc > 0 ) nt *= jc;
+		if ( pc > 0 ) nt *= pc;
+		if ( ic > 0 ) nt *= ic;
+		if ( jr > 0 ) nt *= jr;
+		if ( ir > 0 ) nt *= ir;
+	}
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+	// Give each thread at least work_min units of work so that the cost
+	// of spawning threads does not exceed the work being parallelized.
+	if ( work_min > 0 )
+	{
+		dim_t nt_work = ( dim_t )( work / work_min );
+
+		if ( nt_work < nt ) nt = nt_work;
+	}
+
+	if ( nt < 1 ) nt = 1;
+#else
+	nt = 1;
+#endif
+
+	return nt;
+}
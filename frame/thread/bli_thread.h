@@ -42,6 +42,15 @@
 // Include thread info (thrinfo_t) object definitions and prototypes.
 #include "bli_thrinfo.h"
 
+// Include thread affinity definitions and prototypes.
+#include "bli_affinity.h"
+
+// Include process-wide thread budget prototypes.
+#include "bli_budget.h"
+
+// Include asynchronous operation (request queue) prototypes.
+#include "bli_async.h"
+
 // Include some operation-specific thrinfo_t prototypes.
 // Note that the bli_packm_thrinfo.h must be included before the others!
 #include "bli_packm_thrinfo.h"
@@ -170,6 +179,22 @@ void bli_l3_thread_decorator
        cntl_t* cntl
      );
 
+// Generic internal function type, used by operations (such as those in
+// levels 1v, 1m, and 2) that partition their work without a control tree.
+typedef void (*thread_func_t)
+     (
+       void*      params,
+       thrinfo_t* thread
+     );
+
+// Generic thread launcher prototype
+void bli_thread_launch
+     (
+       dim_t         n_threads,
+       thread_func_t func,
+       void*         params
+     );
+
 // -----------------------------------------------------------------------------
 
 // Factorization and partitioning prototypes
@@ -211,9 +236,32 @@ void  bli_thread_set_jr_nt( dim_t value );
 void  bli_thread_set_ir_nt( dim_t value );
 void  bli_thread_set_num_threads( dim_t value );
 
+affinity_t bli_thread_get_affinity( void );
+void  bli_thread_set_affinity( affinity_t value );
+void  bli_thread_set_affinity_cpus( dim_t n_cpus, dim_t* cpus );
+
+dim_t bli_thread_get_budget( void );
+void  bli_thread_set_budget( dim_t n_threads );
+
+dim_t bli_thread_get_num_async_workers( void );
+void  bli_thread_set_num_async_workers( dim_t n_workers );
+
+void  bli_thread_set_ways_local( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir );
+void  bli_thread_set_num_threads_local( dim_t value );
+void  bli_thread_set_rntm_local( rntm_t* rntm );
+void  bli_thread_clear_local( void );
+
 void  bli_thread_init_rntm( rntm_t* rntm );
+void  bli_thread_init_rntm_from_global( rntm_t* rntm );
 
 void  bli_thread_init_rntm_from_env( rntm_t* rntm );
 
+dim_t bli_thread_calc_num_threads_for_work
+     (
+       siz_t   work,
+       siz_t   work_min,
+       rntm_t* rntm
+     );
+
 #endif
 
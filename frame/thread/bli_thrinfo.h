@@ -127,7 +127,11 @@ static void* bli_thread_obroadcast( thrinfo_t* t, void* p )
 
 static void bli_thread_obarrier( thrinfo_t* t )
 {
+	BLIS_PROF_DECL( t0 );
+
+	BLIS_PROF_START( t0 );
 	bli_thrcomm_barrier( t->ocomm, t->ocomm_id );
+	BLIS_PROF_STOP( BLIS_PROF_BARRIER, t0 );
 }
 
 
@@ -364,12 +364,22 @@ void PASTEMAC(ch,varname) \
 		PASTEMAC2(ch,chr,copys)( sumsqc, sumsq ); \
 \
 		f_exp_raised = fetestexcept( FE_OVERFLOW | FE_INVALID );\
+\
+		/* Floating-point exception flags are kept per thread, so an
+		   overflow that occurs within a thread spawned by a parallelized
+		   dotv is not visible here. Catch those cases by rejecting any
+		   sum of squares that is not finite. */ \
+		if ( bli_isinf( sumsq ) || bli_isnan( sumsq ) ) f_exp_raised = TRUE; \
 \
 		if ( !f_exp_raised ) \
 		{ \
 		    PASTEMAC(chr,sqrt2s)( sumsq, *norm ); \
 		    return; \
 		} \
+\
+		/* Discard the (non-finite) result of dotv so that sumsqv starts
+		   from the initial values of scale and sumsq. */ \
+		PASTEMAC(chr,copys)( *one, sumsq ); \
 	} \
 \
 	/* Compute the sum of the squares of the vector. */ \
@@ -1118,14 +1128,12 @@ INSERT_GENTFUNC_BASIC( randnm_unb_var1, randnv )
 #undef  GENTFUNCR
 #define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
 \
-void PASTEMAC(ch,varname) \
+static void PASTEMAC2(ch,varname,_seq) \
      ( \
        dim_t    n, \
        ctype*   x, inc_t incx, \
        ctype_r* scale, \
-       ctype_r* sumsq, \
-       cntx_t*  cntx, \
-       rntm_t*  rntm  \
+       ctype_r* sumsq  \
      ) \
 { \
 	const ctype_r zero_r = *PASTEMAC(chr,0); \
@@ -1201,6 +1209,109 @@ void PASTEMAC(ch,varname) \
 	/* Store final values of scale and sumsq to output variables. */ \
 	PASTEMAC(chr,copys)( scale_r, *scale ); \
 	PASTEMAC(chr,copys)( sumsq_r, *sumsq ); \
+} \
+\
+static void PASTEMAC2(ch,varname,_thr) \
+     ( \
+       void*      params_v, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	l1v_params_t* params = params_v; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	ctype_r*      scale  = params->scale; \
+	ctype_r*      sumsq  = params->sumsq; \
+	dim_t         tid    = bli_thread_work_id( thread ); \
+	dim_t         start, end; \
+\
+	bli_thread_get_range_sub( thread, params->n, bli_l1v_thread_bf( dt ), \
+	                          FALSE, &start, &end ); \
+\
+	/* Each thread accumulates its own (scale, sumsq) pair, starting from \
+	   the same initial values used by normfv. */ \
+	PASTEMAC(chr,copys)( *PASTEMAC(chr,0), scale[ tid ] ); \
+	PASTEMAC(chr,copys)( *PASTEMAC(chr,1), sumsq[ tid ] ); \
+\
+	PASTEMAC2(ch,varname,_seq) \
+	( \
+	  end - start, \
+	  x + start*incx, incx, \
+	  &scale[ tid ], \
+	  &sumsq[ tid ]  \
+	); \
+} \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t    n, \
+       ctype*   x, inc_t incx, \
+       ctype_r* scale, \
+       ctype_r* sumsq, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	const num_t   dt = PASTEMAC(ch,type); \
+\
+	l1v_params_t  params; \
+	ctype_r*      scale_parts; \
+	ctype_r*      sumsq_parts; \
+	ctype_r       scale_r; \
+	ctype_r       sumsq_r; \
+	ctype_r       ratio; \
+	dim_t         n_threads; \
+	dim_t         i; \
+\
+	n_threads = bli_l1v_thread_num_threads( dt, n, cntx, rntm ); \
+\
+	if ( n_threads == 1 ) \
+	{ \
+		PASTEMAC2(ch,varname,_seq)( n, x, incx, scale, sumsq ); \
+		return; \
+	} \
+\
+	scale_parts = bli_malloc_intl( 2 * n_threads * sizeof( ctype_r ) ); \
+	sumsq_parts = scale_parts + n_threads; \
+\
+	params.n     = n; \
+	params.x     = x; params.incx = incx; \
+	params.scale = scale_parts; \
+	params.sumsq = sumsq_parts; \
+\
+	bli_thread_launch( n_threads, PASTEMAC2(ch,varname,_thr), &params ); \
+\
+	/* Merge the partial results into scale and sumsq in order of thread \
+	   id so that the result is reproducible. Each merge rescales the pair \
+	   with the smaller scale to the larger one, as ?lassq() would. */ \
+	PASTEMAC(chr,copys)( *scale, scale_r ); \
+	PASTEMAC(chr,copys)( *sumsq, sumsq_r ); \
+\
+	for ( i = 0; i < n_threads; ++i ) \
+	{ \
+		if ( scale_parts[ i ] > *PASTEMAC(chr,0) || bli_isnan( scale_parts[ i ] ) ) \
+		{ \
+			if ( scale_r < scale_parts[ i ] ) \
+			{ \
+				ratio   = scale_r / scale_parts[ i ]; \
+				sumsq_r = sumsq_parts[ i ] + sumsq_r * ratio * ratio; \
+\
+				PASTEMAC(chr,copys)( scale_parts[ i ], scale_r ); \
+			} \
+			else \
+			{ \
+				ratio   = scale_parts[ i ] / scale_r; \
+				sumsq_r = sumsq_r + sumsq_parts[ i ] * ratio * ratio; \
+			} \
+		} \
+	} \
+\
+	PASTEMAC(chr,copys)( scale_r, *scale ); \
+	PASTEMAC(chr,copys)( sumsq_r, *sumsq ); \
+\
+	bli_free_intl( scale_parts ); \
 }
 
 INSERT_GENTFUNCR_BASIC0( sumsqv_unb_var1 )
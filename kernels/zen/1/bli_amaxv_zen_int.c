@@ -376,6 +376,262 @@ void bli_damaxv_zen_int
 
 // -----------------------------------------------------------------------------
 
+// The complex kernels below search for the element with the largest sum of
+// the absolute values of its real and imaginary components. When x has unit
+// stride, the leading elements are searched with vector code, in which each
+// lane tracks the largest value that it has seen and the index at which
+// that value first occurred. The lanes are then reduced, preferring the
+// smallest index in case of a tie. If any NaN is encountered by the vector
+// code, the entire vector is searched again with scalar code so that NaN
+// is handled exactly as it is by the reference kernel.
+
+void bli_camaxv_zen_int
+     (
+       dim_t              n,
+       scomplex* restrict x, inc_t incx,
+       dim_t*    restrict i_max,
+       cntx_t*   restrict cntx
+     )
+{
+	float*  minus_one = PASTEMAC(s,m1);
+	dim_t*  zero_i    = PASTEMAC(i,0);
+
+	float   abs_chi1;
+	float   abs_chi1_max;
+	dim_t   i_max_l;
+	dim_t   i;
+	dim_t   n_vec = 0;
+
+	/* If the vector length is zero, return early. This directly emulates
+	   the behavior of netlib BLAS's i?amax() routines. */
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(i,copys)( *zero_i, *i_max );
+		return;
+	}
+
+	/* Initialize the index of the maximum absolute value to zero. */
+	PASTEMAC(i,copys)( *zero_i, i_max_l );
+
+	/* Initialize the maximum absolute value search candidate with
+	   -1, which is guaranteed to be less than all values we will
+	   compute. */
+	PASTEMAC(s,copys)( *minus_one, abs_chi1_max );
+
+	// The indices are tracked as 32-bit integers within the vector code.
+	if ( incx == 1 && n >= 8 && n <= INT32_MAX )
+	{
+		v8sf_t  x0v, x1v, abs_vec, max_vec, mask_vec, nan_vec;
+		v8sf_t  sign_mask;
+		__m256i idx_vec, maxInx_vec, inc_vec;
+		int32_t maxInx[8];
+
+		n_vec = ( n / 8 ) * 8;
+
+		// Within each iteration, the horizontal addition below leaves the
+		// absolute values of elements 0, 1, 4, 5, 2, 3, 6, 7 in that order.
+		idx_vec    = _mm256_setr_epi32( 0, 1, 4, 5, 2, 3, 6, 7 );
+		inc_vec    = _mm256_set1_epi32( 8 );
+		maxInx_vec = _mm256_setzero_si256();
+		max_vec.v  = _mm256_set1_ps( -1 );
+		nan_vec.v  = _mm256_setzero_ps();
+		sign_mask.v = _mm256_set1_ps( -0.f );
+
+		for ( i = 0; i < n_vec; i += 8 )
+		{
+			x0v.v      = _mm256_loadu_ps( ( float* )( x + i + 0 ) );
+			x1v.v      = _mm256_loadu_ps( ( float* )( x + i + 4 ) );
+
+			// Get the absolute values of the real and imaginary components
+			// and add them together.
+			x0v.v      = _mm256_andnot_ps( sign_mask.v, x0v.v );
+			x1v.v      = _mm256_andnot_ps( sign_mask.v, x1v.v );
+			abs_vec.v  = _mm256_hadd_ps( x0v.v, x1v.v );
+
+			nan_vec.v  = _mm256_or_ps( nan_vec.v,
+			             _mm256_cmp_ps( abs_vec.v, abs_vec.v, _CMP_UNORD_Q ) );
+
+			mask_vec.v = _mm256_cmp_ps( abs_vec.v, max_vec.v, _CMP_GT_OQ );
+
+			max_vec.v  = _mm256_blendv_ps( max_vec.v, abs_vec.v, mask_vec.v );
+			maxInx_vec = _mm256_castps_si256
+			             ( _mm256_blendv_ps( _mm256_castsi256_ps( maxInx_vec ),
+			                                 _mm256_castsi256_ps( idx_vec ),
+			                                 mask_vec.v ) );
+
+			idx_vec    = _mm256_add_epi32( idx_vec, inc_vec );
+		}
+
+		if ( _mm256_movemask_ps( nan_vec.v ) != 0 )
+		{
+			// Start over with scalar code.
+			n_vec = 0;
+		}
+		else
+		{
+			_mm256_storeu_si256( ( __m256i* )maxInx, maxInx_vec );
+
+			for ( i = 0; i < 8; ++i )
+			{
+				if ( abs_chi1_max < max_vec.f[i] ||
+				     ( abs_chi1_max == max_vec.f[i] && maxInx[i] < i_max_l ) )
+				{
+					abs_chi1_max = max_vec.f[i];
+					i_max_l      = maxInx[i];
+				}
+			}
+		}
+	}
+
+	for ( i = n_vec; i < n; ++i )
+	{
+		scomplex* chi1 = x + (i  )*incx;
+
+		/* Add the absolute values of the real and imaginary components of
+		   chi1 together. */
+		abs_chi1 = fabsf( bli_creal( *chi1 ) ) + fabsf( bli_cimag( *chi1 ) );
+
+		/* If the absolute value of the current element exceeds that of
+		   the previous largest, save it and its index. If NaN is
+		   encountered, then treat it the same as if it were a valid
+		   value that was smaller than any previously seen. This
+		   behavior mimics that of LAPACK's ?lange(). */
+		if ( abs_chi1_max < abs_chi1 || isnan( abs_chi1 ) )
+		{
+			abs_chi1_max = abs_chi1;
+			i_max_l      = i;
+		}
+	}
+
+	/* Store final index to output variable. */
+	*i_max = i_max_l;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zamaxv_zen_int
+     (
+       dim_t              n,
+       dcomplex* restrict x, inc_t incx,
+       dim_t*    restrict i_max,
+       cntx_t*   restrict cntx
+     )
+{
+	double* minus_one = PASTEMAC(d,m1);
+	dim_t*  zero_i    = PASTEMAC(i,0);
+
+	double  abs_chi1;
+	double  abs_chi1_max;
+	dim_t   i_max_l;
+	dim_t   i;
+	dim_t   n_vec = 0;
+
+	/* If the vector length is zero, return early. This directly emulates
+	   the behavior of netlib BLAS's i?amax() routines. */
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(i,copys)( *zero_i, *i_max );
+		return;
+	}
+
+	/* Initialize the index of the maximum absolute value to zero. */
+	PASTEMAC(i,copys)( *zero_i, i_max_l );
+
+	/* Initialize the maximum absolute value search candidate with
+	   -1, which is guaranteed to be less than all values we will
+	   compute. */
+	PASTEMAC(d,copys)( *minus_one, abs_chi1_max );
+
+	if ( incx == 1 && n >= 4 )
+	{
+		v4df_t  x0v, x1v, abs_vec, max_vec, mask_vec, nan_vec;
+		v4df_t  sign_mask;
+		__m256i idx_vec, maxInx_vec, inc_vec;
+		int64_t maxInx[4];
+
+		n_vec = ( n / 4 ) * 4;
+
+		// Within each iteration, the horizontal addition below leaves the
+		// absolute values of elements 0, 2, 1, 3 in that order.
+		idx_vec    = _mm256_setr_epi64x( 0, 2, 1, 3 );
+		inc_vec    = _mm256_set1_epi64x( 4 );
+		maxInx_vec = _mm256_setzero_si256();
+		max_vec.v  = _mm256_set1_pd( -1 );
+		nan_vec.v  = _mm256_setzero_pd();
+		sign_mask.v = _mm256_set1_pd( -0.0 );
+
+		for ( i = 0; i < n_vec; i += 4 )
+		{
+			x0v.v      = _mm256_loadu_pd( ( double* )( x + i + 0 ) );
+			x1v.v      = _mm256_loadu_pd( ( double* )( x + i + 2 ) );
+
+			// Get the absolute values of the real and imaginary components
+			// and add them together.
+			x0v.v      = _mm256_andnot_pd( sign_mask.v, x0v.v );
+			x1v.v      = _mm256_andnot_pd( sign_mask.v, x1v.v );
+			abs_vec.v  = _mm256_hadd_pd( x0v.v, x1v.v );
+
+			nan_vec.v  = _mm256_or_pd( nan_vec.v,
+			             _mm256_cmp_pd( abs_vec.v, abs_vec.v, _CMP_UNORD_Q ) );
+
+			mask_vec.v = _mm256_cmp_pd( abs_vec.v, max_vec.v, _CMP_GT_OQ );
+
+			max_vec.v  = _mm256_blendv_pd( max_vec.v, abs_vec.v, mask_vec.v );
+			maxInx_vec = _mm256_castpd_si256
+			             ( _mm256_blendv_pd( _mm256_castsi256_pd( maxInx_vec ),
+			                                 _mm256_castsi256_pd( idx_vec ),
+			                                 mask_vec.v ) );
+
+			idx_vec    = _mm256_add_epi64( idx_vec, inc_vec );
+		}
+
+		if ( _mm256_movemask_pd( nan_vec.v ) != 0 )
+		{
+			// Start over with scalar code.
+			n_vec = 0;
+		}
+		else
+		{
+			_mm256_storeu_si256( ( __m256i* )maxInx, maxInx_vec );
+
+			for ( i = 0; i < 4; ++i )
+			{
+				if ( abs_chi1_max < max_vec.d[i] ||
+				     ( abs_chi1_max == max_vec.d[i] && maxInx[i] < i_max_l ) )
+				{
+					abs_chi1_max = max_vec.d[i];
+					i_max_l      = maxInx[i];
+				}
+			}
+		}
+	}
+
+	for ( i = n_vec; i < n; ++i )
+	{
+		dcomplex* chi1 = x + (i  )*incx;
+
+		/* Add the absolute values of the real and imaginary components of
+		   chi1 together. */
+		abs_chi1 = fabs( bli_zreal( *chi1 ) ) + fabs( bli_zimag( *chi1 ) );
+
+		/* If the absolute value of the current element exceeds that of
+		   the previous largest, save it and its index. If NaN is
+		   encountered, then treat it the same as if it were a valid
+		   value that was smaller than any previously seen. This
+		   behavior mimics that of LAPACK's ?lange(). */
+		if ( abs_chi1_max < abs_chi1 || isnan( abs_chi1 ) )
+		{
+			abs_chi1_max = abs_chi1;
+			i_max_l      = i;
+		}
+	}
+
+	/* Store final index to output variable. */
+	*i_max = i_max_l;
+}
+
+// -----------------------------------------------------------------------------
+
 #if 0
 #undef  GENTFUNCR
 #define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
@@ -247,3 +247,273 @@ void bli_daxpyv_zen_int
 	}
 }
 
+
+// -----------------------------------------------------------------------------
+
+// The complex kernels below operate on vectors of interleaved real and
+// imaginary components. The product chi * conjx( x ) is formed from the
+// vector x and the vector xs, in which the real and imaginary components of
+// each element are swapped, as
+//
+//   c1 * x + c2 * xs
+//
+// where c1 = ( cr,  cr ) and c2 = ( -ci, ci ) if x is not conjugated, and
+// c1 = ( cr, -cr ) and c2 = (  ci, ci ) if it is. Thus conjugation costs
+// nothing inside the loop.
+
+void bli_caxpyv_zen_int
+     (
+       conj_t             conjx,
+       dim_t              n,
+       scomplex* restrict alpha,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        n_elem_per_reg = 4;
+	const dim_t        n_iter_unroll  = 4;
+
+	const float        alpha_r        = bli_creal( *alpha );
+	const float        alpha_i        = bli_cimag( *alpha );
+
+	dim_t              i;
+	dim_t              n_viter;
+	dim_t              n_left;
+
+	scomplex* restrict x0;
+	scomplex* restrict y0;
+
+	v8sf_t             c1v, c2v;
+	v8sf_t             x0v, x1v, x2v, x3v;
+	v8sf_t             y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(c,eq0)( *alpha ) ) return;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Set up the coefficient vectors according to the conjugation of x.
+	if ( bli_is_conj( conjx ) )
+	{
+		c1v.v = _mm256_set_ps( -alpha_r, alpha_r, -alpha_r, alpha_r,
+		                       -alpha_r, alpha_r, -alpha_r, alpha_r );
+		c2v.v = _mm256_set1_ps( alpha_i );
+	}
+	else
+	{
+		c1v.v = _mm256_set1_ps( alpha_r );
+		c2v.v = _mm256_set_ps( alpha_i, -alpha_i, alpha_i, -alpha_i,
+		                       alpha_i, -alpha_i, alpha_i, -alpha_i );
+	}
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v.v = _mm256_loadu_ps( ( float* )( x0 + 0*n_elem_per_reg ) );
+		x1v.v = _mm256_loadu_ps( ( float* )( x0 + 1*n_elem_per_reg ) );
+		x2v.v = _mm256_loadu_ps( ( float* )( x0 + 2*n_elem_per_reg ) );
+		x3v.v = _mm256_loadu_ps( ( float* )( x0 + 3*n_elem_per_reg ) );
+
+		y0v.v = _mm256_loadu_ps( ( float* )( y0 + 0*n_elem_per_reg ) );
+		y1v.v = _mm256_loadu_ps( ( float* )( y0 + 1*n_elem_per_reg ) );
+		y2v.v = _mm256_loadu_ps( ( float* )( y0 + 2*n_elem_per_reg ) );
+		y3v.v = _mm256_loadu_ps( ( float* )( y0 + 3*n_elem_per_reg ) );
+
+		// perform : y += c1 * x;
+		y0v.v = _mm256_fmadd_ps( c1v.v, x0v.v, y0v.v );
+		y1v.v = _mm256_fmadd_ps( c1v.v, x1v.v, y1v.v );
+		y2v.v = _mm256_fmadd_ps( c1v.v, x2v.v, y2v.v );
+		y3v.v = _mm256_fmadd_ps( c1v.v, x3v.v, y3v.v );
+
+		// Swap the real and imaginary components of x.
+		x0v.v = _mm256_permute_ps( x0v.v, 0xB1 );
+		x1v.v = _mm256_permute_ps( x1v.v, 0xB1 );
+		x2v.v = _mm256_permute_ps( x2v.v, 0xB1 );
+		x3v.v = _mm256_permute_ps( x3v.v, 0xB1 );
+
+		// perform : y += c2 * xs;
+		y0v.v = _mm256_fmadd_ps( c2v.v, x0v.v, y0v.v );
+		y1v.v = _mm256_fmadd_ps( c2v.v, x1v.v, y1v.v );
+		y2v.v = _mm256_fmadd_ps( c2v.v, x2v.v, y2v.v );
+		y3v.v = _mm256_fmadd_ps( c2v.v, x3v.v, y3v.v );
+
+		// Store the output.
+		_mm256_storeu_ps( ( float* )( y0 + 0*n_elem_per_reg ), y0v.v );
+		_mm256_storeu_ps( ( float* )( y0 + 1*n_elem_per_reg ), y1v.v );
+		_mm256_storeu_ps( ( float* )( y0 + 2*n_elem_per_reg ), y2v.v );
+		_mm256_storeu_ps( ( float* )( y0 + 3*n_elem_per_reg ), y3v.v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,axpyjs)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(c,axpys)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zaxpyv_zen_int
+     (
+       conj_t             conjx,
+       dim_t              n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        n_elem_per_reg = 2;
+	const dim_t        n_iter_unroll  = 4;
+
+	const double       alpha_r        = bli_zreal( *alpha );
+	const double       alpha_i        = bli_zimag( *alpha );
+
+	dim_t              i;
+	dim_t              n_viter;
+	dim_t              n_left;
+
+	dcomplex* restrict x0;
+	dcomplex* restrict y0;
+
+	v4df_t             c1v, c2v;
+	v4df_t             x0v, x1v, x2v, x3v;
+	v4df_t             y0v, y1v, y2v, y3v;
+
+	// If the vector dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(z,eq0)( *alpha ) ) return;
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Set up the coefficient vectors according to the conjugation of x.
+	if ( bli_is_conj( conjx ) )
+	{
+		c1v.v = _mm256_set_pd( -alpha_r, alpha_r, -alpha_r, alpha_r );
+		c2v.v = _mm256_set1_pd( alpha_i );
+	}
+	else
+	{
+		c1v.v = _mm256_set1_pd( alpha_r );
+		c2v.v = _mm256_set_pd( alpha_i, -alpha_i, alpha_i, -alpha_i );
+	}
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v.v = _mm256_loadu_pd( ( double* )( x0 + 0*n_elem_per_reg ) );
+		x1v.v = _mm256_loadu_pd( ( double* )( x0 + 1*n_elem_per_reg ) );
+		x2v.v = _mm256_loadu_pd( ( double* )( x0 + 2*n_elem_per_reg ) );
+		x3v.v = _mm256_loadu_pd( ( double* )( x0 + 3*n_elem_per_reg ) );
+
+		y0v.v = _mm256_loadu_pd( ( double* )( y0 + 0*n_elem_per_reg ) );
+		y1v.v = _mm256_loadu_pd( ( double* )( y0 + 1*n_elem_per_reg ) );
+		y2v.v = _mm256_loadu_pd( ( double* )( y0 + 2*n_elem_per_reg ) );
+		y3v.v = _mm256_loadu_pd( ( double* )( y0 + 3*n_elem_per_reg ) );
+
+		// perform : y += c1 * x;
+		y0v.v = _mm256_fmadd_pd( c1v.v, x0v.v, y0v.v );
+		y1v.v = _mm256_fmadd_pd( c1v.v, x1v.v, y1v.v );
+		y2v.v = _mm256_fmadd_pd( c1v.v, x2v.v, y2v.v );
+		y3v.v = _mm256_fmadd_pd( c1v.v, x3v.v, y3v.v );
+
+		// Swap the real and imaginary components of x.
+		x0v.v = _mm256_permute_pd( x0v.v, 0x5 );
+		x1v.v = _mm256_permute_pd( x1v.v, 0x5 );
+		x2v.v = _mm256_permute_pd( x2v.v, 0x5 );
+		x3v.v = _mm256_permute_pd( x3v.v, 0x5 );
+
+		// perform : y += c2 * xs;
+		y0v.v = _mm256_fmadd_pd( c2v.v, x0v.v, y0v.v );
+		y1v.v = _mm256_fmadd_pd( c2v.v, x1v.v, y1v.v );
+		y2v.v = _mm256_fmadd_pd( c2v.v, x2v.v, y2v.v );
+		y3v.v = _mm256_fmadd_pd( c2v.v, x3v.v, y3v.v );
+
+		// Store the output.
+		_mm256_storeu_pd( ( double* )( y0 + 0*n_elem_per_reg ), y0v.v );
+		_mm256_storeu_pd( ( double* )( y0 + 1*n_elem_per_reg ), y1v.v );
+		_mm256_storeu_pd( ( double* )( y0 + 2*n_elem_per_reg ), y2v.v );
+		_mm256_storeu_pd( ( double* )( y0 + 3*n_elem_per_reg ), y3v.v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	if ( bli_is_conj( conjx ) )
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,axpyjs)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n_left; ++i )
+		{
+			PASTEMAC(z,axpys)( *alpha, *x0, *y0 );
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
@@ -281,3 +281,269 @@ void bli_ddotv_zen_int
 	PASTEMAC(d,copys)( rho0, *rho );
 }
 
+
+// -----------------------------------------------------------------------------
+
+void bli_cdotv_zen_int
+     (
+       conj_t             conjx,
+       conj_t             conjy,
+       dim_t              n,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       scomplex* restrict rho,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        n_elem_per_reg = 4;
+	const dim_t        n_iter_unroll  = 2;
+
+	dim_t              i;
+	dim_t              n_viter;
+	dim_t              n_left;
+
+	scomplex* restrict x0;
+	scomplex* restrict y0;
+	scomplex           rho0;
+	float              rhoa_r, rhoa_i, rhob_r, rhob_i;
+	float              sx, sy;
+
+	v8sf_t             rhoa0v, rhoa1v, rhob0v, rhob1v;
+	v8sf_t             x0v, y0v;
+	v8sf_t             x1v, y1v;
+
+	// If the vector dimension is zero, set rho to zero and return early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(c,set0s)( *rho );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Initialize the unrolled iterations' accumulators to zero. The rhoa
+	// vectors accumulate the element-wise products of x and y, and the
+	// rhob vectors accumulate those of x and ys, where ys is y with its
+	// real and imaginary components swapped.
+	rhoa0v.v = _mm256_setzero_ps();
+	rhoa1v.v = _mm256_setzero_ps();
+	rhob0v.v = _mm256_setzero_ps();
+	rhob1v.v = _mm256_setzero_ps();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x and y input vector elements.
+		x0v.v = _mm256_loadu_ps( ( float* )( x0 + 0*n_elem_per_reg ) );
+		y0v.v = _mm256_loadu_ps( ( float* )( y0 + 0*n_elem_per_reg ) );
+
+		x1v.v = _mm256_loadu_ps( ( float* )( x0 + 1*n_elem_per_reg ) );
+		y1v.v = _mm256_loadu_ps( ( float* )( y0 + 1*n_elem_per_reg ) );
+
+		// Accumulate the products of x and y.
+		rhoa0v.v = _mm256_fmadd_ps( x0v.v, y0v.v, rhoa0v.v );
+		rhoa1v.v = _mm256_fmadd_ps( x1v.v, y1v.v, rhoa1v.v );
+
+		// Swap the real and imaginary components of y.
+		y0v.v = _mm256_permute_ps( y0v.v, 0xB1 );
+		y1v.v = _mm256_permute_ps( y1v.v, 0xB1 );
+
+		// Accumulate the products of x and ys.
+		rhob0v.v = _mm256_fmadd_ps( x0v.v, y0v.v, rhob0v.v );
+		rhob1v.v = _mm256_fmadd_ps( x1v.v, y1v.v, rhob1v.v );
+
+		x0 += ( n_elem_per_reg * n_iter_unroll );
+		y0 += ( n_elem_per_reg * n_iter_unroll );
+	}
+
+	// Accumulate the unrolled vectors into a single vector of each kind.
+	rhoa0v.v += rhoa1v.v;
+	rhob0v.v += rhob1v.v;
+
+	// Accumulate the even (real) and odd (imaginary) elements of each
+	// vector into scalars.
+	rhoa_r = 0.0F; rhoa_i = 0.0F;
+	rhob_r = 0.0F; rhob_i = 0.0F;
+
+	for ( i = 0; i < 2*n_elem_per_reg; i += 2 )
+	{
+		rhoa_r += rhoa0v.f[i]; rhoa_i += rhoa0v.f[i+1];
+		rhob_r += rhob0v.f[i]; rhob_i += rhob0v.f[i+1];
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const float x0r = PASTEMAC(c,real)( *x0 );
+		const float x0i = PASTEMAC(c,imag)( *x0 );
+		const float y0r = PASTEMAC(c,real)( *y0 );
+		const float y0i = PASTEMAC(c,imag)( *y0 );
+
+		rhoa_r += x0r * y0r; rhoa_i += x0i * y0i;
+		rhob_r += x0r * y0i; rhob_i += x0i * y0r;
+
+		x0 += incx;
+		y0 += incy;
+	}
+
+	// Combine the partial sums according to the conjugation of x and y.
+	// If sx and sy are -1 when x and y are conjugated (and 1 otherwise),
+	// then the real part of the dot product is rhoa_r - sx * sy * rhoa_i
+	// and the imaginary part is sy * rhob_r + sx * rhob_i.
+	sx = ( bli_is_conj( conjx ) ? -1.0F : 1.0F );
+	sy = ( bli_is_conj( conjy ) ? -1.0F : 1.0F );
+
+	PASTEMAC(c,sets)( rhoa_r - sx * sy * rhoa_i,
+	                   sy * rhob_r + sx * rhob_i, rho0 );
+
+	// Copy the final result into the output variable.
+	PASTEMAC(c,copys)( rho0, *rho );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zdotv_zen_int
+     (
+       conj_t             conjx,
+       conj_t             conjy,
+       dim_t              n,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       dcomplex* restrict rho,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        n_elem_per_reg = 2;
+	const dim_t        n_iter_unroll  = 2;
+
+	dim_t              i;
+	dim_t              n_viter;
+	dim_t              n_left;
+
+	dcomplex* restrict x0;
+	dcomplex* restrict y0;
+	dcomplex           rho0;
+	double             rhoa_r, rhoa_i, rhob_r, rhob_i;
+	double             sx, sy;
+
+	v4df_t             rhoa0v, rhoa1v, rhob0v, rhob1v;
+	v4df_t             x0v, y0v;
+	v4df_t             x1v, y1v;
+
+	// If the vector dimension is zero, set rho to zero and return early.
+	if ( bli_zero_dim1( n ) )
+	{
+		PASTEMAC(z,set0s)( *rho );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 || incy != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Initialize the unrolled iterations' accumulators to zero. The rhoa
+	// vectors accumulate the element-wise products of x and y, and the
+	// rhob vectors accumulate those of x and ys, where ys is y with its
+	// real and imaginary components swapped.
+	rhoa0v.v = _mm256_setzero_pd();
+	rhoa1v.v = _mm256_setzero_pd();
+	rhob0v.v = _mm256_setzero_pd();
+	rhob1v.v = _mm256_setzero_pd();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x and y input vector elements.
+		x0v.v = _mm256_loadu_pd( ( double* )( x0 + 0*n_elem_per_reg ) );
+		y0v.v = _mm256_loadu_pd( ( double* )( y0 + 0*n_elem_per_reg ) );
+
+		x1v.v = _mm256_loadu_pd( ( double* )( x0 + 1*n_elem_per_reg ) );
+		y1v.v = _mm256_loadu_pd( ( double* )( y0 + 1*n_elem_per_reg ) );
+
+		// Accumulate the products of x and y.
+		rhoa0v.v = _mm256_fmadd_pd( x0v.v, y0v.v, rhoa0v.v );
+		rhoa1v.v = _mm256_fmadd_pd( x1v.v, y1v.v, rhoa1v.v );
+
+		// Swap the real and imaginary components of y.
+		y0v.v = _mm256_permute_pd( y0v.v, 0x5 );
+		y1v.v = _mm256_permute_pd( y1v.v, 0x5 );
+
+		// Accumulate the products of x and ys.
+		rhob0v.v = _mm256_fmadd_pd( x0v.v, y0v.v, rhob0v.v );
+		rhob1v.v = _mm256_fmadd_pd( x1v.v, y1v.v, rhob1v.v );
+
+		x0 += ( n_elem_per_reg * n_iter_unroll );
+		y0 += ( n_elem_per_reg * n_iter_unroll );
+	}
+
+	// Accumulate the unrolled vectors into a single vector of each kind.
+	rhoa0v.v += rhoa1v.v;
+	rhob0v.v += rhob1v.v;
+
+	// Accumulate the even (real) and odd (imaginary) elements of each
+	// vector into scalars.
+	rhoa_r = 0.0; rhoa_i = 0.0;
+	rhob_r = 0.0; rhob_i = 0.0;
+
+	for ( i = 0; i < 2*n_elem_per_reg; i += 2 )
+	{
+		rhoa_r += rhoa0v.d[i]; rhoa_i += rhoa0v.d[i+1];
+		rhob_r += rhob0v.d[i]; rhob_i += rhob0v.d[i+1];
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		const double x0r = PASTEMAC(z,real)( *x0 );
+		const double x0i = PASTEMAC(z,imag)( *x0 );
+		const double y0r = PASTEMAC(z,real)( *y0 );
+		const double y0i = PASTEMAC(z,imag)( *y0 );
+
+		rhoa_r += x0r * y0r; rhoa_i += x0i * y0i;
+		rhob_r += x0r * y0i; rhob_i += x0i * y0r;
+
+		x0 += incx;
+		y0 += incy;
+	}
+
+	// Combine the partial sums according to the conjugation of x and y.
+	// If sx and sy are -1 when x and y are conjugated (and 1 otherwise),
+	// then the real part of the dot product is rhoa_r - sx * sy * rhoa_i
+	// and the imaginary part is sy * rhob_r + sx * rhob_i.
+	sx = ( bli_is_conj( conjx ) ? -1.0 : 1.0 );
+	sy = ( bli_is_conj( conjy ) ? -1.0 : 1.0 );
+
+	PASTEMAC(z,sets)( rhoa_r - sx * sy * rhoa_i,
+	                   sy * rhob_r + sx * rhob_i, rho0 );
+
+	// Copy the final result into the output variable.
+	PASTEMAC(z,copys)( rho0, *rho );
+}
@@ -0,0 +1,347 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_srotmv_zen_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*  restrict param,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+
+	dim_t            i;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	float            flag;
+	float            h11, h21, h12, h22;
+
+	__m256           h11v, h21v, h12v, h22v;
+	__m256           xv[4];
+	__m256           yv[4];
+	__m256           tv[4];
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Decode the modified Givens matrix H from the parameter vector. See
+	// the reference kernel for a description of the flag values.
+	flag = param[0];
+
+	if ( flag == -2.0 ) return;
+
+	if ( flag < 0.0 )
+	{
+		h11 = param[1]; h21 = param[2];
+		h12 = param[3]; h22 = param[4];
+	}
+	else if ( flag == 0.0 )
+	{
+		h11 = 1.0;      h21 = param[2];
+		h12 = param[3]; h22 = 1.0;
+	}
+	else
+	{
+		h11 = param[1]; h21 = -1.0;
+		h12 = 1.0;      h22 = param[4];
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		// Broadcast the elements of H to all elements of a vector register.
+		h11v = _mm256_broadcast_ss( &h11 );
+		h21v = _mm256_broadcast_ss( &h21 );
+		h12v = _mm256_broadcast_ss( &h12 );
+		h22v = _mm256_broadcast_ss( &h22 );
+
+		for ( i = 0; (i + 31) < n; i += 32 )
+		{
+			xv[0] = _mm256_loadu_ps( x0 + 0*n_elem_per_reg );
+			xv[1] = _mm256_loadu_ps( x0 + 1*n_elem_per_reg );
+			xv[2] = _mm256_loadu_ps( x0 + 2*n_elem_per_reg );
+			xv[3] = _mm256_loadu_ps( x0 + 3*n_elem_per_reg );
+
+			yv[0] = _mm256_loadu_ps( y0 + 0*n_elem_per_reg );
+			yv[1] = _mm256_loadu_ps( y0 + 1*n_elem_per_reg );
+			yv[2] = _mm256_loadu_ps( y0 + 2*n_elem_per_reg );
+			yv[3] = _mm256_loadu_ps( y0 + 3*n_elem_per_reg );
+
+			// x := h11 * x + h12 * y
+			tv[0] = _mm256_mul_ps( h12v, yv[0] );
+			tv[1] = _mm256_mul_ps( h12v, yv[1] );
+			tv[2] = _mm256_mul_ps( h12v, yv[2] );
+			tv[3] = _mm256_mul_ps( h12v, yv[3] );
+			tv[0] = _mm256_fmadd_ps( h11v, xv[0], tv[0] );
+			tv[1] = _mm256_fmadd_ps( h11v, xv[1], tv[1] );
+			tv[2] = _mm256_fmadd_ps( h11v, xv[2], tv[2] );
+			tv[3] = _mm256_fmadd_ps( h11v, xv[3], tv[3] );
+
+			// y := h21 * x + h22 * y
+			xv[0] = _mm256_mul_ps( h21v, xv[0] );
+			xv[1] = _mm256_mul_ps( h21v, xv[1] );
+			xv[2] = _mm256_mul_ps( h21v, xv[2] );
+			xv[3] = _mm256_mul_ps( h21v, xv[3] );
+			yv[0] = _mm256_fmadd_ps( h22v, yv[0], xv[0] );
+			yv[1] = _mm256_fmadd_ps( h22v, yv[1], xv[1] );
+			yv[2] = _mm256_fmadd_ps( h22v, yv[2], xv[2] );
+			yv[3] = _mm256_fmadd_ps( h22v, yv[3], xv[3] );
+
+			_mm256_storeu_ps( (x0 + 0*n_elem_per_reg), tv[0] );
+			_mm256_storeu_ps( (x0 + 1*n_elem_per_reg), tv[1] );
+			_mm256_storeu_ps( (x0 + 2*n_elem_per_reg), tv[2] );
+			_mm256_storeu_ps( (x0 + 3*n_elem_per_reg), tv[3] );
+
+			_mm256_storeu_ps( (y0 + 0*n_elem_per_reg), yv[0] );
+			_mm256_storeu_ps( (y0 + 1*n_elem_per_reg), yv[1] );
+			_mm256_storeu_ps( (y0 + 2*n_elem_per_reg), yv[2] );
+			_mm256_storeu_ps( (y0 + 3*n_elem_per_reg), yv[3] );
+
+			x0 += 4*n_elem_per_reg;
+			y0 += 4*n_elem_per_reg;
+		}
+
+		for ( ; (i + 7) < n; i += 8 )
+		{
+			xv[0] = _mm256_loadu_ps( x0 );
+			yv[0] = _mm256_loadu_ps( y0 );
+
+			tv[0] = _mm256_mul_ps( h12v, yv[0] );
+			tv[0] = _mm256_fmadd_ps( h11v, xv[0], tv[0] );
+
+			xv[0] = _mm256_mul_ps( h21v, xv[0] );
+			yv[0] = _mm256_fmadd_ps( h22v, yv[0], xv[0] );
+
+			_mm256_storeu_ps( x0, tv[0] );
+			_mm256_storeu_ps( y0, yv[0] );
+
+			x0 += 1*n_elem_per_reg;
+			y0 += 1*n_elem_per_reg;
+		}
+
+		for ( ; (i + 0) < n; i += 1 )
+		{
+			const float x0c = *x0;
+			const float y0c = *y0;
+
+			*x0 = h11 * x0c + h12 * y0c;
+			*y0 = h21 * x0c + h22 * y0c;
+
+			x0 += 1;
+			y0 += 1;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			const float x0c = *x0;
+			const float y0c = *y0;
+
+			*x0 = h11 * x0c + h12 * y0c;
+			*y0 = h21 * x0c + h22 * y0c;
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_drotmv_zen_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double* restrict param,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+
+	dim_t            i;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	double           flag;
+	double           h11, h21, h12, h22;
+
+	__m256d          h11v, h21v, h12v, h22v;
+	__m256d          xv[4];
+	__m256d          yv[4];
+	__m256d          tv[4];
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Decode the modified Givens matrix H from the parameter vector. See
+	// the reference kernel for a description of the flag values.
+	flag = param[0];
+
+	if ( flag == -2.0 ) return;
+
+	if ( flag < 0.0 )
+	{
+		h11 = param[1]; h21 = param[2];
+		h12 = param[3]; h22 = param[4];
+	}
+	else if ( flag == 0.0 )
+	{
+		h11 = 1.0;      h21 = param[2];
+		h12 = param[3]; h22 = 1.0;
+	}
+	else
+	{
+		h11 = param[1]; h21 = -1.0;
+		h12 = 1.0;      h22 = param[4];
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		// Broadcast the elements of H to all elements of a vector register.
+		h11v = _mm256_broadcast_sd( &h11 );
+		h21v = _mm256_broadcast_sd( &h21 );
+		h12v = _mm256_broadcast_sd( &h12 );
+		h22v = _mm256_broadcast_sd( &h22 );
+
+		for ( i = 0; (i + 15) < n; i += 16 )
+		{
+			xv[0] = _mm256_loadu_pd( x0 + 0*n_elem_per_reg );
+			xv[1] = _mm256_loadu_pd( x0 + 1*n_elem_per_reg );
+			xv[2] = _mm256_loadu_pd( x0 + 2*n_elem_per_reg );
+			xv[3] = _mm256_loadu_pd( x0 + 3*n_elem_per_reg );
+
+			yv[0] = _mm256_loadu_pd( y0 + 0*n_elem_per_reg );
+			yv[1] = _mm256_loadu_pd( y0 + 1*n_elem_per_reg );
+			yv[2] = _mm256_loadu_pd( y0 + 2*n_elem_per_reg );
+			yv[3] = _mm256_loadu_pd( y0 + 3*n_elem_per_reg );
+
+			// x := h11 * x + h12 * y
+			tv[0] = _mm256_mul_pd( h12v, yv[0] );
+			tv[1] = _mm256_mul_pd( h12v, yv[1] );
+			tv[2] = _mm256_mul_pd( h12v, yv[2] );
+			tv[3] = _mm256_mul_pd( h12v, yv[3] );
+			tv[0] = _mm256_fmadd_pd( h11v, xv[0], tv[0] );
+			tv[1] = _mm256_fmadd_pd( h11v, xv[1], tv[1] );
+			tv[2] = _mm256_fmadd_pd( h11v, xv[2], tv[2] );
+			tv[3] = _mm256_fmadd_pd( h11v, xv[3], tv[3] );
+
+			// y := h21 * x + h22 * y
+			xv[0] = _mm256_mul_pd( h21v, xv[0] );
+			xv[1] = _mm256_mul_pd( h21v, xv[1] );
+			xv[2] = _mm256_mul_pd( h21v, xv[2] );
+			xv[3] = _mm256_mul_pd( h21v, xv[3] );
+			yv[0] = _mm256_fmadd_pd( h22v, yv[0], xv[0] );
+			yv[1] = _mm256_fmadd_pd( h22v, yv[1], xv[1] );
+			yv[2] = _mm256_fmadd_pd( h22v, yv[2], xv[2] );
+			yv[3] = _mm256_fmadd_pd( h22v, yv[3], xv[3] );
+
+			_mm256_storeu_pd( (x0 + 0*n_elem_per_reg), tv[0] );
+			_mm256_storeu_pd( (x0 + 1*n_elem_per_reg), tv[1] );
+			_mm256_storeu_pd( (x0 + 2*n_elem_per_reg), tv[2] );
+			_mm256_storeu_pd( (x0 + 3*n_elem_per_reg), tv[3] );
+
+			_mm256_storeu_pd( (y0 + 0*n_elem_per_reg), yv[0] );
+			_mm256_storeu_pd( (y0 + 1*n_elem_per_reg), yv[1] );
+			_mm256_storeu_pd( (y0 + 2*n_elem_per_reg), yv[2] );
+			_mm256_storeu_pd( (y0 + 3*n_elem_per_reg), yv[3] );
+
+			x0 += 4*n_elem_per_reg;
+			y0 += 4*n_elem_per_reg;
+		}
+
+		for ( ; (i + 3) < n; i += 4 )
+		{
+			xv[0] = _mm256_loadu_pd( x0 );
+			yv[0] = _mm256_loadu_pd( y0 );
+
+			tv[0] = _mm256_mul_pd( h12v, yv[0] );
+			tv[0] = _mm256_fmadd_pd( h11v, xv[0], tv[0] );
+
+			xv[0] = _mm256_mul_pd( h21v, xv[0] );
+			yv[0] = _mm256_fmadd_pd( h22v, yv[0], xv[0] );
+
+			_mm256_storeu_pd( x0, tv[0] );
+			_mm256_storeu_pd( y0, yv[0] );
+
+			x0 += 1*n_elem_per_reg;
+			y0 += 1*n_elem_per_reg;
+		}
+
+		for ( ; (i + 0) < n; i += 1 )
+		{
+			const double x0c = *x0;
+			const double y0c = *y0;
+
+			*x0 = h11 * x0c + h12 * y0c;
+			*y0 = h21 * x0c + h22 * y0c;
+
+			x0 += 1;
+			y0 += 1;
+		}
+	}
+	else
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			const double x0c = *x0;
+			const double y0c = *y0;
+
+			*x0 = h11 * x0c + h12 * y0c;
+			*y0 = h21 * x0c + h22 * y0c;
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
@@ -0,0 +1,303 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_srotv_zen_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*  restrict c,
+       float*  restrict s,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+
+	dim_t            i;
+
+	float*  restrict x0;
+	float*  restrict y0;
+
+	__m256           cv, sv;
+	__m256           xv[4];
+	__m256           yv[4];
+	__m256           tv[4];
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		// Broadcast the rotation coefficients to all elements of a vector
+		// register.
+		cv = _mm256_broadcast_ss( c );
+		sv = _mm256_broadcast_ss( s );
+
+		for ( i = 0; (i + 31) < n; i += 32 )
+		{
+			xv[0] = _mm256_loadu_ps( x0 + 0*n_elem_per_reg );
+			xv[1] = _mm256_loadu_ps( x0 + 1*n_elem_per_reg );
+			xv[2] = _mm256_loadu_ps( x0 + 2*n_elem_per_reg );
+			xv[3] = _mm256_loadu_ps( x0 + 3*n_elem_per_reg );
+
+			yv[0] = _mm256_loadu_ps( y0 + 0*n_elem_per_reg );
+			yv[1] = _mm256_loadu_ps( y0 + 1*n_elem_per_reg );
+			yv[2] = _mm256_loadu_ps( y0 + 2*n_elem_per_reg );
+			yv[3] = _mm256_loadu_ps( y0 + 3*n_elem_per_reg );
+
+			// x := c * x + s * y
+			tv[0] = _mm256_mul_ps( sv, yv[0] );
+			tv[1] = _mm256_mul_ps( sv, yv[1] );
+			tv[2] = _mm256_mul_ps( sv, yv[2] );
+			tv[3] = _mm256_mul_ps( sv, yv[3] );
+			tv[0] = _mm256_fmadd_ps( cv, xv[0], tv[0] );
+			tv[1] = _mm256_fmadd_ps( cv, xv[1], tv[1] );
+			tv[2] = _mm256_fmadd_ps( cv, xv[2], tv[2] );
+			tv[3] = _mm256_fmadd_ps( cv, xv[3], tv[3] );
+
+			// y := c * y - s * x
+			xv[0] = _mm256_mul_ps( sv, xv[0] );
+			xv[1] = _mm256_mul_ps( sv, xv[1] );
+			xv[2] = _mm256_mul_ps( sv, xv[2] );
+			xv[3] = _mm256_mul_ps( sv, xv[3] );
+			yv[0] = _mm256_fmsub_ps( cv, yv[0], xv[0] );
+			yv[1] = _mm256_fmsub_ps( cv, yv[1], xv[1] );
+			yv[2] = _mm256_fmsub_ps( cv, yv[2], xv[2] );
+			yv[3] = _mm256_fmsub_ps( cv, yv[3], xv[3] );
+
+			_mm256_storeu_ps( (x0 + 0*n_elem_per_reg), tv[0] );
+			_mm256_storeu_ps( (x0 + 1*n_elem_per_reg), tv[1] );
+			_mm256_storeu_ps( (x0 + 2*n_elem_per_reg), tv[2] );
+			_mm256_storeu_ps( (x0 + 3*n_elem_per_reg), tv[3] );
+
+			_mm256_storeu_ps( (y0 + 0*n_elem_per_reg), yv[0] );
+			_mm256_storeu_ps( (y0 + 1*n_elem_per_reg), yv[1] );
+			_mm256_storeu_ps( (y0 + 2*n_elem_per_reg), yv[2] );
+			_mm256_storeu_ps( (y0 + 3*n_elem_per_reg), yv[3] );
+
+			x0 += 4*n_elem_per_reg;
+			y0 += 4*n_elem_per_reg;
+		}
+
+		for ( ; (i + 7) < n; i += 8 )
+		{
+			xv[0] = _mm256_loadu_ps( x0 );
+			yv[0] = _mm256_loadu_ps( y0 );
+
+			tv[0] = _mm256_mul_ps( sv, yv[0] );
+			tv[0] = _mm256_fmadd_ps( cv, xv[0], tv[0] );
+
+			xv[0] = _mm256_mul_ps( sv, xv[0] );
+			yv[0] = _mm256_fmsub_ps( cv, yv[0], xv[0] );
+
+			_mm256_storeu_ps( x0, tv[0] );
+			_mm256_storeu_ps( y0, yv[0] );
+
+			x0 += 1*n_elem_per_reg;
+			y0 += 1*n_elem_per_reg;
+		}
+
+		for ( ; (i + 0) < n; i += 1 )
+		{
+			const float x0c = *x0;
+			const float y0c = *y0;
+
+			*x0 = (*c) * x0c + (*s) * y0c;
+			*y0 = (*c) * y0c - (*s) * x0c;
+
+			x0 += 1;
+			y0 += 1;
+		}
+	}
+	else
+	{
+		const float cc = *c;
+		const float sc = *s;
+
+		for ( i = 0; i < n; ++i )
+		{
+			const float x0c = *x0;
+			const float y0c = *y0;
+
+			*x0 = cc * x0c + sc * y0c;
+			*y0 = cc * y0c - sc * x0c;
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_drotv_zen_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double* restrict c,
+       double* restrict s,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+
+	dim_t            i;
+
+	double* restrict x0;
+	double* restrict y0;
+
+	__m256d          cv, sv;
+	__m256d          xv[4];
+	__m256d          yv[4];
+	__m256d          tv[4];
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		// Broadcast the rotation coefficients to all elements of a vector
+		// register.
+		cv = _mm256_broadcast_sd( c );
+		sv = _mm256_broadcast_sd( s );
+
+		for ( i = 0; (i + 15) < n; i += 16 )
+		{
+			xv[0] = _mm256_loadu_pd( x0 + 0*n_elem_per_reg );
+			xv[1] = _mm256_loadu_pd( x0 + 1*n_elem_per_reg );
+			xv[2] = _mm256_loadu_pd( x0 + 2*n_elem_per_reg );
+			xv[3] = _mm256_loadu_pd( x0 + 3*n_elem_per_reg );
+
+			yv[0] = _mm256_loadu_pd( y0 + 0*n_elem_per_reg );
+			yv[1] = _mm256_loadu_pd( y0 + 1*n_elem_per_reg );
+			yv[2] = _mm256_loadu_pd( y0 + 2*n_elem_per_reg );
+			yv[3] = _mm256_loadu_pd( y0 + 3*n_elem_per_reg );
+
+			// x := c * x + s * y
+			tv[0] = _mm256_mul_pd( sv, yv[0] );
+			tv[1] = _mm256_mul_pd( sv, yv[1] );
+			tv[2] = _mm256_mul_pd( sv, yv[2] );
+			tv[3] = _mm256_mul_pd( sv, yv[3] );
+			tv[0] = _mm256_fmadd_pd( cv, xv[0], tv[0] );
+			tv[1] = _mm256_fmadd_pd( cv, xv[1], tv[1] );
+			tv[2] = _mm256_fmadd_pd( cv, xv[2], tv[2] );
+			tv[3] = _mm256_fmadd_pd( cv, xv[3], tv[3] );
+
+			// y := c * y - s * x
+			xv[0] = _mm256_mul_pd( sv, xv[0] );
+			xv[1] = _mm256_mul_pd( sv, xv[1] );
+			xv[2] = _mm256_mul_pd( sv, xv[2] );
+			xv[3] = _mm256_mul_pd( sv, xv[3] );
+			yv[0] = _mm256_fmsub_pd( cv, yv[0], xv[0] );
+			yv[1] = _mm256_fmsub_pd( cv, yv[1], xv[1] );
+			yv[2] = _mm256_fmsub_pd( cv, yv[2], xv[2] );
+			yv[3] = _mm256_fmsub_pd( cv, yv[3], xv[3] );
+
+			_mm256_storeu_pd( (x0 + 0*n_elem_per_reg), tv[0] );
+			_mm256_storeu_pd( (x0 + 1*n_elem_per_reg), tv[1] );
+			_mm256_storeu_pd( (x0 + 2*n_elem_per_reg), tv[2] );
+			_mm256_storeu_pd( (x0 + 3*n_elem_per_reg), tv[3] );
+
+			_mm256_storeu_pd( (y0 + 0*n_elem_per_reg), yv[0] );
+			_mm256_storeu_pd( (y0 + 1*n_elem_per_reg), yv[1] );
+			_mm256_storeu_pd( (y0 + 2*n_elem_per_reg), yv[2] );
+			_mm256_storeu_pd( (y0 + 3*n_elem_per_reg), yv[3] );
+
+			x0 += 4*n_elem_per_reg;
+			y0 += 4*n_elem_per_reg;
+		}
+
+		for ( ; (i + 3) < n; i += 4 )
+		{
+			xv[0] = _mm256_loadu_pd( x0 );
+			yv[0] = _mm256_loadu_pd( y0 );
+
+			tv[0] = _mm256_mul_pd( sv, yv[0] );
+			tv[0] = _mm256_fmadd_pd( cv, xv[0], tv[0] );
+
+			xv[0] = _mm256_mul_pd( sv, xv[0] );
+			yv[0] = _mm256_fmsub_pd( cv, yv[0], xv[0] );
+
+			_mm256_storeu_pd( x0, tv[0] );
+			_mm256_storeu_pd( y0, yv[0] );
+
+			x0 += 1*n_elem_per_reg;
+			y0 += 1*n_elem_per_reg;
+		}
+
+		for ( ; (i + 0) < n; i += 1 )
+		{
+			const double x0c = *x0;
+			const double y0c = *y0;
+
+			*x0 = (*c) * x0c + (*s) * y0c;
+			*y0 = (*c) * y0c - (*s) * x0c;
+
+			x0 += 1;
+			y0 += 1;
+		}
+	}
+	else
+	{
+		const double cc = *c;
+		const double sc = *s;
+
+		for ( i = 0; i < n; ++i )
+		{
+			const double x0c = *x0;
+			const double y0c = *y0;
+
+			*x0 = cc * x0c + sc * y0c;
+			*y0 = cc * y0c - sc * x0c;
+
+			x0 += incx;
+			y0 += incy;
+		}
+	}
+}
+
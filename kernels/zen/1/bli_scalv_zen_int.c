@@ -251,3 +251,244 @@ void bli_dscalv_zen_int
 	}
 }
 
+
+// -----------------------------------------------------------------------------
+
+void bli_cscalv_zen_int
+     (
+       conj_t             conjalpha,
+       dim_t              n,
+       scomplex* restrict alpha,
+       scomplex* restrict x, inc_t incx,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        n_elem_per_reg = 4;
+	const dim_t        n_iter_unroll  = 4;
+
+	dim_t              i;
+	dim_t              n_viter;
+	dim_t              n_left;
+
+	scomplex* restrict x0;
+	scomplex           alpha_conj;
+	float              alpha_r, alpha_i;
+
+	v8sf_t             c1v, c2v;
+	v8sf_t             x0v, x1v, x2v, x3v;
+	v8sf_t             t0v, t1v, t2v, t3v;
+
+	// If the vector dimension is zero, or if alpha is unit, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(c,eq1)( *alpha ) ) return;
+
+	// If alpha is zero, use setv (in case y contains NaN or Inf).
+	if ( PASTEMAC(c,eq0)( *alpha ) )
+	{
+		scomplex*    zero = bli_c0;
+		csetv_ker_ft f    = bli_cntx_get_l1v_ker_dt( BLIS_SCOMPLEX, BLIS_SETV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  zero,
+		  x, incx,
+		  cntx
+		);
+		return;
+	}
+
+	// Apply conjalpha to alpha once, up front.
+	PASTEMAC(c,copycjs)( conjalpha, *alpha, alpha_conj );
+
+	alpha_r = PASTEMAC(c,real)( alpha_conj );
+	alpha_i = PASTEMAC(c,imag)( alpha_conj );
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Set up the coefficient vectors so that alpha * x = c1 * x + c2 * xs,
+	// where xs is x with its real and imaginary components swapped.
+	c1v.v = _mm256_set1_ps( alpha_r );
+	c2v.v = _mm256_set_ps( alpha_i, -alpha_i, alpha_i, -alpha_i,
+	                       alpha_i, -alpha_i, alpha_i, -alpha_i );
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v.v = _mm256_loadu_ps( ( float* )( x0 + 0*n_elem_per_reg ) );
+		x1v.v = _mm256_loadu_ps( ( float* )( x0 + 1*n_elem_per_reg ) );
+		x2v.v = _mm256_loadu_ps( ( float* )( x0 + 2*n_elem_per_reg ) );
+		x3v.v = _mm256_loadu_ps( ( float* )( x0 + 3*n_elem_per_reg ) );
+
+		// Swap the real and imaginary components of x.
+		t0v.v = _mm256_permute_ps( x0v.v, 0xB1 );
+		t1v.v = _mm256_permute_ps( x1v.v, 0xB1 );
+		t2v.v = _mm256_permute_ps( x2v.v, 0xB1 );
+		t3v.v = _mm256_permute_ps( x3v.v, 0xB1 );
+
+		// perform : x := c2 * xs;
+		t0v.v = _mm256_mul_ps( c2v.v, t0v.v );
+		t1v.v = _mm256_mul_ps( c2v.v, t1v.v );
+		t2v.v = _mm256_mul_ps( c2v.v, t2v.v );
+		t3v.v = _mm256_mul_ps( c2v.v, t3v.v );
+
+		// perform : x := c1 * x + c2 * xs;
+		x0v.v = _mm256_fmadd_ps( c1v.v, x0v.v, t0v.v );
+		x1v.v = _mm256_fmadd_ps( c1v.v, x1v.v, t1v.v );
+		x2v.v = _mm256_fmadd_ps( c1v.v, x2v.v, t2v.v );
+		x3v.v = _mm256_fmadd_ps( c1v.v, x3v.v, t3v.v );
+
+		// Store the output.
+		_mm256_storeu_ps( ( float* )( x0 + 0*n_elem_per_reg ), x0v.v );
+		_mm256_storeu_ps( ( float* )( x0 + 1*n_elem_per_reg ), x1v.v );
+		_mm256_storeu_ps( ( float* )( x0 + 2*n_elem_per_reg ), x2v.v );
+		_mm256_storeu_ps( ( float* )( x0 + 3*n_elem_per_reg ), x3v.v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		PASTEMAC(c,scals)( alpha_conj, *x0 );
+
+		x0 += incx;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zscalv_zen_int
+     (
+       conj_t             conjalpha,
+       dim_t              n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict x, inc_t incx,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        n_elem_per_reg = 2;
+	const dim_t        n_iter_unroll  = 4;
+
+	dim_t              i;
+	dim_t              n_viter;
+	dim_t              n_left;
+
+	dcomplex* restrict x0;
+	dcomplex           alpha_conj;
+	double             alpha_r, alpha_i;
+
+	v4df_t             c1v, c2v;
+	v4df_t             x0v, x1v, x2v, x3v;
+	v4df_t             t0v, t1v, t2v, t3v;
+
+	// If the vector dimension is zero, or if alpha is unit, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(z,eq1)( *alpha ) ) return;
+
+	// If alpha is zero, use setv (in case y contains NaN or Inf).
+	if ( PASTEMAC(z,eq0)( *alpha ) )
+	{
+		dcomplex*    zero = bli_z0;
+		zsetv_ker_ft f    = bli_cntx_get_l1v_ker_dt( BLIS_DCOMPLEX, BLIS_SETV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  zero,
+		  x, incx,
+		  cntx
+		);
+		return;
+	}
+
+	// Apply conjalpha to alpha once, up front.
+	PASTEMAC(z,copycjs)( conjalpha, *alpha, alpha_conj );
+
+	alpha_r = PASTEMAC(z,real)( alpha_conj );
+	alpha_i = PASTEMAC(z,imag)( alpha_conj );
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override n_viter and n_left to use scalar code
+	// for all iterations.
+	if ( incx != 1 )
+	{
+		n_viter = 0;
+		n_left  = n;
+	}
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Set up the coefficient vectors so that alpha * x = c1 * x + c2 * xs,
+	// where xs is x with its real and imaginary components swapped.
+	c1v.v = _mm256_set1_pd( alpha_r );
+	c2v.v = _mm256_set_pd( alpha_i, -alpha_i, alpha_i, -alpha_i );
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v.v = _mm256_loadu_pd( ( double* )( x0 + 0*n_elem_per_reg ) );
+		x1v.v = _mm256_loadu_pd( ( double* )( x0 + 1*n_elem_per_reg ) );
+		x2v.v = _mm256_loadu_pd( ( double* )( x0 + 2*n_elem_per_reg ) );
+		x3v.v = _mm256_loadu_pd( ( double* )( x0 + 3*n_elem_per_reg ) );
+
+		// Swap the real and imaginary components of x.
+		t0v.v = _mm256_permute_pd( x0v.v, 0x5 );
+		t1v.v = _mm256_permute_pd( x1v.v, 0x5 );
+		t2v.v = _mm256_permute_pd( x2v.v, 0x5 );
+		t3v.v = _mm256_permute_pd( x3v.v, 0x5 );
+
+		// perform : x := c2 * xs;
+		t0v.v = _mm256_mul_pd( c2v.v, t0v.v );
+		t1v.v = _mm256_mul_pd( c2v.v, t1v.v );
+		t2v.v = _mm256_mul_pd( c2v.v, t2v.v );
+		t3v.v = _mm256_mul_pd( c2v.v, t3v.v );
+
+		// perform : x := c1 * x + c2 * xs;
+		x0v.v = _mm256_fmadd_pd( c1v.v, x0v.v, t0v.v );
+		x1v.v = _mm256_fmadd_pd( c1v.v, x1v.v, t1v.v );
+		x2v.v = _mm256_fmadd_pd( c1v.v, x2v.v, t2v.v );
+		x3v.v = _mm256_fmadd_pd( c1v.v, x3v.v, t3v.v );
+
+		// Store the output.
+		_mm256_storeu_pd( ( double* )( x0 + 0*n_elem_per_reg ), x0v.v );
+		_mm256_storeu_pd( ( double* )( x0 + 1*n_elem_per_reg ), x1v.v );
+		_mm256_storeu_pd( ( double* )( x0 + 2*n_elem_per_reg ), x2v.v );
+		_mm256_storeu_pd( ( double* )( x0 + 3*n_elem_per_reg ), x3v.v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < n_left; ++i )
+	{
+		PASTEMAC(z,scals)( alpha_conj, *x0 );
+
+		x0 += incx;
+	}
+}
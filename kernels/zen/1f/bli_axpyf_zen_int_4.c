@@ -0,0 +1,432 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2017, Advanced Micro Devices, Inc.
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/* Union data structure to access AVX registers
+   One 256-bit AVX register holds 8 SP elements. */
+typedef union
+{
+	__m256  v;
+	float   f[8] __attribute__((aligned(64)));
+} v8sf_t;
+
+/* Union data structure to access AVX registers
+*  One 256-bit AVX register holds 4 DP elements. */
+typedef union
+{
+	__m256d v;
+	double  d[4] __attribute__((aligned(64)));
+} v4df_t;
+
+// -----------------------------------------------------------------------------
+
+// These kernels form the products chi_j * conja( a_j ) from the vector a_j
+// and the vector as_j, in which the real and imaginary components of each
+// element are swapped, as c1_j * a_j + c2_j * as_j, where
+// c1_j = ( cr, cr ) and c2_j = ( -ci, ci ) if A is not conjugated, and
+// c1_j = ( cr, -cr ) and c2_j = ( ci, ci ) if it is. Thus conjugation costs
+// nothing inside the loop.
+
+void bli_caxpyf_zen_int_4
+     (
+       conj_t             conja,
+       conj_t             conjx,
+       dim_t              m,
+       dim_t              b_n,
+       scomplex* restrict alpha,
+       scomplex* restrict a, inc_t inca, inc_t lda,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        fuse_fac       = 4;
+
+	const dim_t        n_elem_per_reg = 4;
+	const dim_t        n_iter_unroll  = 1;
+
+	dim_t              i, j;
+	dim_t              m_viter;
+	dim_t              m_left;
+
+	scomplex* restrict a0;
+	scomplex* restrict a1;
+	scomplex* restrict a2;
+	scomplex* restrict a3;
+
+	scomplex* restrict y0;
+
+	scomplex           chi[4];
+	float              chi_r, chi_i;
+
+	v8sf_t             c1v[4], c2v[4];
+
+	v8sf_t             a0v, a1v, a2v, a3v;
+	v8sf_t             y0v;
+
+	// If either dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim2( m, b_n ) || PASTEMAC(c,eq0)( *alpha ) ) return;
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over axpyv.
+	if ( b_n != fuse_fac )
+	{
+		caxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_SCOMPLEX, BLIS_AXPYV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			scomplex* a1   = a + (0  )*inca + (i  )*lda;
+			scomplex* chi1 = x + (i  )*incx;
+			scomplex* y1   = y + (0  )*incy;
+			scomplex  alpha_chi1;
+
+			PASTEMAC(c,copycjs)( conjx, *chi1, alpha_chi1 );
+			PASTEMAC(c,scals)( *alpha, alpha_chi1 );
+
+			f
+			(
+			  conja,
+			  m,
+			  &alpha_chi1,
+			  a1, inca,
+			  y1, incy,
+			  cntx
+			);
+		}
+
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	m_viter = ( m ) / ( n_elem_per_reg * n_iter_unroll );
+	m_left  = ( m ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override m_viter and m_left to use scalar code
+	// for all iterations.
+	if ( inca != 1 || incy != 1 )
+	{
+		m_viter = 0;
+		m_left  = m;
+	}
+
+	a0   = a + 0*lda;
+	a1   = a + 1*lda;
+	a2   = a + 2*lda;
+	a3   = a + 3*lda;
+	y0   = y;
+
+	// Scale each chi scalar by alpha, and set up the coefficient vectors
+	// according to the conjugation of A.
+	for ( j = 0; j < fuse_fac; ++j )
+	{
+		PASTEMAC(c,copycjs)( conjx, *( x + j*incx ), chi[j] );
+		PASTEMAC(c,scals)( *alpha, chi[j] );
+
+		chi_r = PASTEMAC(c,real)( chi[j] );
+		chi_i = PASTEMAC(c,imag)( chi[j] );
+
+		if ( bli_is_conj( conja ) )
+		{
+			c1v[j].v = _mm256_set_ps( -chi_r, chi_r, -chi_r, chi_r,
+			                          -chi_r, chi_r, -chi_r, chi_r );
+			c2v[j].v = _mm256_set1_ps( chi_i );
+		}
+		else
+		{
+			c1v[j].v = _mm256_set1_ps( chi_r );
+			c2v[j].v = _mm256_set_ps( chi_i, -chi_i, chi_i, -chi_i,
+			                          chi_i, -chi_i, chi_i, -chi_i );
+		}
+	}
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < m_viter; ++i )
+	{
+		// Load the input values.
+		y0v.v = _mm256_loadu_ps( ( float* )( y0 ) );
+		a0v.v = _mm256_loadu_ps( ( float* )( a0 ) );
+		a1v.v = _mm256_loadu_ps( ( float* )( a1 ) );
+		a2v.v = _mm256_loadu_ps( ( float* )( a2 ) );
+		a3v.v = _mm256_loadu_ps( ( float* )( a3 ) );
+
+		// perform : y += c1 * a;
+		y0v.v = _mm256_fmadd_ps( a0v.v, c1v[0].v, y0v.v );
+		y0v.v = _mm256_fmadd_ps( a1v.v, c1v[1].v, y0v.v );
+		y0v.v = _mm256_fmadd_ps( a2v.v, c1v[2].v, y0v.v );
+		y0v.v = _mm256_fmadd_ps( a3v.v, c1v[3].v, y0v.v );
+
+		// Swap the real and imaginary components of a.
+		a0v.v = _mm256_permute_ps( a0v.v, 0xB1 );
+		a1v.v = _mm256_permute_ps( a1v.v, 0xB1 );
+		a2v.v = _mm256_permute_ps( a2v.v, 0xB1 );
+		a3v.v = _mm256_permute_ps( a3v.v, 0xB1 );
+
+		// perform : y += c2 * as;
+		y0v.v = _mm256_fmadd_ps( a0v.v, c2v[0].v, y0v.v );
+		y0v.v = _mm256_fmadd_ps( a1v.v, c2v[1].v, y0v.v );
+		y0v.v = _mm256_fmadd_ps( a2v.v, c2v[2].v, y0v.v );
+		y0v.v = _mm256_fmadd_ps( a3v.v, c2v[3].v, y0v.v );
+
+		// Store the output.
+		_mm256_storeu_ps( ( float* )( y0 ), y0v.v );
+
+		y0 += n_elem_per_reg;
+		a0 += n_elem_per_reg;
+		a1 += n_elem_per_reg;
+		a2 += n_elem_per_reg;
+		a3 += n_elem_per_reg;
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < m_left; ++i )
+	{
+		if ( bli_is_conj( conja ) )
+		{
+			PASTEMAC(c,axpyjs)( chi[0], *a0, *y0 );
+			PASTEMAC(c,axpyjs)( chi[1], *a1, *y0 );
+			PASTEMAC(c,axpyjs)( chi[2], *a2, *y0 );
+			PASTEMAC(c,axpyjs)( chi[3], *a3, *y0 );
+		}
+		else
+		{
+			PASTEMAC(c,axpys)( chi[0], *a0, *y0 );
+			PASTEMAC(c,axpys)( chi[1], *a1, *y0 );
+			PASTEMAC(c,axpys)( chi[2], *a2, *y0 );
+			PASTEMAC(c,axpys)( chi[3], *a3, *y0 );
+		}
+
+		a0 += inca;
+		a1 += inca;
+		a2 += inca;
+		a3 += inca;
+		y0 += incy;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+// These kernels form the products chi_j * conja( a_j ) from the vector a_j
+// and the vector as_j, in which the real and imaginary components of each
+// element are swapped, as c1_j * a_j + c2_j * as_j, where
+// c1_j = ( cr, cr ) and c2_j = ( -ci, ci ) if A is not conjugated, and
+// c1_j = ( cr, -cr ) and c2_j = ( ci, ci ) if it is. Thus conjugation costs
+// nothing inside the loop.
+
+void bli_zaxpyf_zen_int_4
+     (
+       conj_t             conja,
+       conj_t             conjx,
+       dim_t              m,
+       dim_t              b_n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict a, inc_t inca, inc_t lda,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        fuse_fac       = 4;
+
+	const dim_t        n_elem_per_reg = 2;
+	const dim_t        n_iter_unroll  = 1;
+
+	dim_t              i, j;
+	dim_t              m_viter;
+	dim_t              m_left;
+
+	dcomplex* restrict a0;
+	dcomplex* restrict a1;
+	dcomplex* restrict a2;
+	dcomplex* restrict a3;
+
+	dcomplex* restrict y0;
+
+	dcomplex           chi[4];
+	double             chi_r, chi_i;
+
+	v4df_t             c1v[4], c2v[4];
+
+	v4df_t             a0v, a1v, a2v, a3v;
+	v4df_t             y0v;
+
+	// If either dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim2( m, b_n ) || PASTEMAC(z,eq0)( *alpha ) ) return;
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over axpyv.
+	if ( b_n != fuse_fac )
+	{
+		zaxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DCOMPLEX, BLIS_AXPYV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			dcomplex* a1   = a + (0  )*inca + (i  )*lda;
+			dcomplex* chi1 = x + (i  )*incx;
+			dcomplex* y1   = y + (0  )*incy;
+			dcomplex  alpha_chi1;
+
+			PASTEMAC(z,copycjs)( conjx, *chi1, alpha_chi1 );
+			PASTEMAC(z,scals)( *alpha, alpha_chi1 );
+
+			f
+			(
+			  conja,
+			  m,
+			  &alpha_chi1,
+			  a1, inca,
+			  y1, incy,
+			  cntx
+			);
+		}
+
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	m_viter = ( m ) / ( n_elem_per_reg * n_iter_unroll );
+	m_left  = ( m ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, override m_viter and m_left to use scalar code
+	// for all iterations.
+	if ( inca != 1 || incy != 1 )
+	{
+		m_viter = 0;
+		m_left  = m;
+	}
+
+	a0   = a + 0*lda;
+	a1   = a + 1*lda;
+	a2   = a + 2*lda;
+	a3   = a + 3*lda;
+	y0   = y;
+
+	// Scale each chi scalar by alpha, and set up the coefficient vectors
+	// according to the conjugation of A.
+	for ( j = 0; j < fuse_fac; ++j )
+	{
+		PASTEMAC(z,copycjs)( conjx, *( x + j*incx ), chi[j] );
+		PASTEMAC(z,scals)( *alpha, chi[j] );
+
+		chi_r = PASTEMAC(z,real)( chi[j] );
+		chi_i = PASTEMAC(z,imag)( chi[j] );
+
+		if ( bli_is_conj( conja ) )
+		{
+			c1v[j].v = _mm256_set_pd( -chi_r, chi_r, -chi_r, chi_r );
+			c2v[j].v = _mm256_set1_pd( chi_i );
+		}
+		else
+		{
+			c1v[j].v = _mm256_set1_pd( chi_r );
+			c2v[j].v = _mm256_set_pd( chi_i, -chi_i, chi_i, -chi_i );
+		}
+	}
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < m_viter; ++i )
+	{
+		// Load the input values.
+		y0v.v = _mm256_loadu_pd( ( double* )( y0 ) );
+		a0v.v = _mm256_loadu_pd( ( double* )( a0 ) );
+		a1v.v = _mm256_loadu_pd( ( double* )( a1 ) );
+		a2v.v = _mm256_loadu_pd( ( double* )( a2 ) );
+		a3v.v = _mm256_loadu_pd( ( double* )( a3 ) );
+
+		// perform : y += c1 * a;
+		y0v.v = _mm256_fmadd_pd( a0v.v, c1v[0].v, y0v.v );
+		y0v.v = _mm256_fmadd_pd( a1v.v, c1v[1].v, y0v.v );
+		y0v.v = _mm256_fmadd_pd( a2v.v, c1v[2].v, y0v.v );
+		y0v.v = _mm256_fmadd_pd( a3v.v, c1v[3].v, y0v.v );
+
+		// Swap the real and imaginary components of a.
+		a0v.v = _mm256_permute_pd( a0v.v, 0x5 );
+		a1v.v = _mm256_permute_pd( a1v.v, 0x5 );
+		a2v.v = _mm256_permute_pd( a2v.v, 0x5 );
+		a3v.v = _mm256_permute_pd( a3v.v, 0x5 );
+
+		// perform : y += c2 * as;
+		y0v.v = _mm256_fmadd_pd( a0v.v, c2v[0].v, y0v.v );
+		y0v.v = _mm256_fmadd_pd( a1v.v, c2v[1].v, y0v.v );
+		y0v.v = _mm256_fmadd_pd( a2v.v, c2v[2].v, y0v.v );
+		y0v.v = _mm256_fmadd_pd( a3v.v, c2v[3].v, y0v.v );
+
+		// Store the output.
+		_mm256_storeu_pd( ( double* )( y0 ), y0v.v );
+
+		y0 += n_elem_per_reg;
+		a0 += n_elem_per_reg;
+		a1 += n_elem_per_reg;
+		a2 += n_elem_per_reg;
+		a3 += n_elem_per_reg;
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < m_left; ++i )
+	{
+		if ( bli_is_conj( conja ) )
+		{
+			PASTEMAC(z,axpyjs)( chi[0], *a0, *y0 );
+			PASTEMAC(z,axpyjs)( chi[1], *a1, *y0 );
+			PASTEMAC(z,axpyjs)( chi[2], *a2, *y0 );
+			PASTEMAC(z,axpyjs)( chi[3], *a3, *y0 );
+		}
+		else
+		{
+			PASTEMAC(z,axpys)( chi[0], *a0, *y0 );
+			PASTEMAC(z,axpys)( chi[1], *a1, *y0 );
+			PASTEMAC(z,axpys)( chi[2], *a2, *y0 );
+			PASTEMAC(z,axpys)( chi[3], *a3, *y0 );
+		}
+
+		a0 += inca;
+		a1 += inca;
+		a2 += inca;
+		a3 += inca;
+		y0 += incy;
+	}
+}
+
@@ -0,0 +1,456 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2017, Advanced Micro Devices, Inc.
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/* Union data structure to access AVX registers
+   One 256-bit AVX register holds 8 SP elements. */
+typedef union
+{
+	__m256  v;
+	float   f[8] __attribute__((aligned(64)));
+} v8sf_t;
+
+/* Union data structure to access AVX registers
+*  One 256-bit AVX register holds 4 DP elements. */
+typedef union
+{
+	__m256d v;
+	double  d[4] __attribute__((aligned(64)));
+} v4df_t;
+
+// -----------------------------------------------------------------------------
+
+// These kernels accumulate, for each column a_j of A, the element-wise
+// products of a_j and x in the vector rhoa_j and those of a_j and xs in the
+// vector rhob_j, where xs is x with its real and imaginary components
+// swapped. The conjugation of A and x is applied only when the partial
+// sums are combined into the final dot products.
+
+void bli_cdotxf_zen_int_4
+     (
+       conj_t             conjat,
+       conj_t             conjx,
+       dim_t              m,
+       dim_t              b_n,
+       scomplex* restrict alpha,
+       scomplex* restrict a, inc_t inca, inc_t lda,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict beta,
+       scomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        fuse_fac       = 4;
+	const dim_t        n_elem_per_reg = 4;
+
+	dim_t              i, j, k;
+	dim_t              m_viter;
+	dim_t              m_left;
+
+	scomplex* restrict a0;
+	scomplex* restrict x0;
+
+	scomplex           rho;
+	float              rhoa_r[4], rhoa_i[4];
+	float              rhob_r[4], rhob_i[4];
+	float              sa, sx;
+	float              ta[ 8 ], tb[ 8 ];
+
+	v8sf_t             rhoav[4], rhobv[4];
+	v8sf_t             x0v, xs0v, a0v;
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(c,eq0)( *alpha ) )
+	{
+		cscalv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_SCOMPLEX, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over dotxv.
+	if ( b_n != fuse_fac )
+	{
+		cdotxv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_SCOMPLEX, BLIS_DOTXV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			scomplex* a1   = a + (0  )*inca + (i  )*lda;
+			scomplex* x1   = x + (0  )*incx;
+			scomplex* psi1 = y + (i  )*incy;
+
+			f
+			(
+			  conjat,
+			  conjx,
+			  m,
+			  alpha,
+			  a1, inca,
+			  x1, incx,
+			  beta,
+			  psi1,
+			  cntx
+			);
+		}
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+
+	// Compute the number of vectorized and leftover iterations.
+	m_viter = ( m ) / ( n_elem_per_reg );
+	m_left  = ( m ) % ( n_elem_per_reg );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads, override m_viter and m_left to use scalar code for all
+	// iterations.
+	if ( inca != 1 || incx != 1 )
+	{
+		m_viter = 0;
+		m_left  = m;
+	}
+
+	// Initialize the accumulators to zero.
+	rhoav[0].v = _mm256_setzero_ps();
+	rhoav[1].v = _mm256_setzero_ps();
+	rhoav[2].v = _mm256_setzero_ps();
+	rhoav[3].v = _mm256_setzero_ps();
+	rhobv[0].v = _mm256_setzero_ps();
+	rhobv[1].v = _mm256_setzero_ps();
+	rhobv[2].v = _mm256_setzero_ps();
+	rhobv[3].v = _mm256_setzero_ps();
+
+	for ( i = 0; i < m_viter; ++i )
+	{
+		x0  = x + i*n_elem_per_reg;
+		a0  = a + i*n_elem_per_reg;
+
+		// Load x, and form xs by swapping its real and imaginary
+		// components.
+		x0v.v  = _mm256_loadu_ps( ( float* )( x0 ) );
+		xs0v.v = _mm256_permute_ps( x0v.v, 0xB1 );
+
+		a0v.v  = _mm256_loadu_ps( ( float* )( a0 + 0*lda ) );
+		rhoav[0].v = _mm256_fmadd_ps( a0v.v, x0v.v,  rhoav[0].v );
+		rhobv[0].v = _mm256_fmadd_ps( a0v.v, xs0v.v, rhobv[0].v );
+
+		a0v.v  = _mm256_loadu_ps( ( float* )( a0 + 1*lda ) );
+		rhoav[1].v = _mm256_fmadd_ps( a0v.v, x0v.v,  rhoav[1].v );
+		rhobv[1].v = _mm256_fmadd_ps( a0v.v, xs0v.v, rhobv[1].v );
+
+		a0v.v  = _mm256_loadu_ps( ( float* )( a0 + 2*lda ) );
+		rhoav[2].v = _mm256_fmadd_ps( a0v.v, x0v.v,  rhoav[2].v );
+		rhobv[2].v = _mm256_fmadd_ps( a0v.v, xs0v.v, rhobv[2].v );
+
+		a0v.v  = _mm256_loadu_ps( ( float* )( a0 + 3*lda ) );
+		rhoav[3].v = _mm256_fmadd_ps( a0v.v, x0v.v,  rhoav[3].v );
+		rhobv[3].v = _mm256_fmadd_ps( a0v.v, xs0v.v, rhobv[3].v );
+	}
+
+	// Accumulate the even (real) and odd (imaginary) elements of each
+	// vector into scalars.
+	for ( j = 0; j < fuse_fac; ++j )
+	{
+		_mm256_storeu_ps( ta, rhoav[j].v );
+		_mm256_storeu_ps( tb, rhobv[j].v );
+
+		rhoa_r[j] = 0.0F; rhoa_i[j] = 0.0F;
+		rhob_r[j] = 0.0F; rhob_i[j] = 0.0F;
+
+		for ( k = 0; k < 8; k += 2 )
+		{
+			rhoa_r[j] += ta[k]; rhoa_i[j] += ta[k+1];
+			rhob_r[j] += tb[k]; rhob_i[j] += tb[k+1];
+		}
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = m - m_left; i < m; ++i )
+	{
+		const float x0r = PASTEMAC(c,real)( *( x + i*incx ) );
+		const float x0i = PASTEMAC(c,imag)( *( x + i*incx ) );
+
+		for ( j = 0; j < fuse_fac; ++j )
+		{
+			const float a0r = PASTEMAC(c,real)( *( a + i*inca + j*lda ) );
+			const float a0i = PASTEMAC(c,imag)( *( a + i*inca + j*lda ) );
+
+			rhoa_r[j] += a0r * x0r; rhoa_i[j] += a0i * x0i;
+			rhob_r[j] += a0r * x0i; rhob_i[j] += a0i * x0r;
+		}
+	}
+
+	// Combine the partial sums according to the conjugation of A and x.
+	// If sa and sx are -1 when A and x are conjugated (and 1 otherwise),
+	// then the real part of each dot product is rhoa_r - sa * sx * rhoa_i
+	// and the imaginary part is sx * rhob_r + sa * rhob_i. Then update
+	// y := beta * y + alpha * rho.
+	sa = ( bli_is_conj( conjat ) ? -1.0F : 1.0F );
+	sx = ( bli_is_conj( conjx  ) ? -1.0F : 1.0F );
+
+	for ( j = 0; j < fuse_fac; ++j )
+	{
+		scomplex* restrict psi1 = y + j*incy;
+
+		PASTEMAC(c,sets)( rhoa_r[j] - sa * sx * rhoa_i[j],
+		                   sx * rhob_r[j] + sa * rhob_i[j], rho );
+
+		if ( PASTEMAC(c,eq0)( *beta ) )
+		{
+			PASTEMAC(c,scal2s)( *alpha, rho, *psi1 );
+		}
+		else
+		{
+			PASTEMAC(c,scals)( *beta, *psi1 );
+			PASTEMAC(c,axpys)( *alpha, rho, *psi1 );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+// These kernels accumulate, for each column a_j of A, the element-wise
+// products of a_j and x in the vector rhoa_j and those of a_j and xs in the
+// vector rhob_j, where xs is x with its real and imaginary components
+// swapped. The conjugation of A and x is applied only when the partial
+// sums are combined into the final dot products.
+
+void bli_zdotxf_zen_int_4
+     (
+       conj_t             conjat,
+       conj_t             conjx,
+       dim_t              m,
+       dim_t              b_n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict a, inc_t inca, inc_t lda,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict beta,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t        fuse_fac       = 4;
+	const dim_t        n_elem_per_reg = 2;
+
+	dim_t              i, j, k;
+	dim_t              m_viter;
+	dim_t              m_left;
+
+	dcomplex* restrict a0;
+	dcomplex* restrict x0;
+
+	dcomplex           rho;
+	double             rhoa_r[4], rhoa_i[4];
+	double             rhob_r[4], rhob_i[4];
+	double             sa, sx;
+	double             ta[ 4 ], tb[ 4 ];
+
+	v4df_t             rhoav[4], rhobv[4];
+	v4df_t             x0v, xs0v, a0v;
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(z,eq0)( *alpha ) )
+	{
+		zscalv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DCOMPLEX, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over dotxv.
+	if ( b_n != fuse_fac )
+	{
+		zdotxv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DCOMPLEX, BLIS_DOTXV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			dcomplex* a1   = a + (0  )*inca + (i  )*lda;
+			dcomplex* x1   = x + (0  )*incx;
+			dcomplex* psi1 = y + (i  )*incy;
+
+			f
+			(
+			  conjat,
+			  conjx,
+			  m,
+			  alpha,
+			  a1, inca,
+			  x1, incx,
+			  beta,
+			  psi1,
+			  cntx
+			);
+		}
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+
+	// Compute the number of vectorized and leftover iterations.
+	m_viter = ( m ) / ( n_elem_per_reg );
+	m_left  = ( m ) % ( n_elem_per_reg );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads, override m_viter and m_left to use scalar code for all
+	// iterations.
+	if ( inca != 1 || incx != 1 )
+	{
+		m_viter = 0;
+		m_left  = m;
+	}
+
+	// Initialize the accumulators to zero.
+	rhoav[0].v = _mm256_setzero_pd();
+	rhoav[1].v = _mm256_setzero_pd();
+	rhoav[2].v = _mm256_setzero_pd();
+	rhoav[3].v = _mm256_setzero_pd();
+	rhobv[0].v = _mm256_setzero_pd();
+	rhobv[1].v = _mm256_setzero_pd();
+	rhobv[2].v = _mm256_setzero_pd();
+	rhobv[3].v = _mm256_setzero_pd();
+
+	for ( i = 0; i < m_viter; ++i )
+	{
+		x0  = x + i*n_elem_per_reg;
+		a0  = a + i*n_elem_per_reg;
+
+		// Load x, and form xs by swapping its real and imaginary
+		// components.
+		x0v.v  = _mm256_loadu_pd( ( double* )( x0 ) );
+		xs0v.v = _mm256_permute_pd( x0v.v, 0x5 );
+
+		a0v.v  = _mm256_loadu_pd( ( double* )( a0 + 0*lda ) );
+		rhoav[0].v = _mm256_fmadd_pd( a0v.v, x0v.v,  rhoav[0].v );
+		rhobv[0].v = _mm256_fmadd_pd( a0v.v, xs0v.v, rhobv[0].v );
+
+		a0v.v  = _mm256_loadu_pd( ( double* )( a0 + 1*lda ) );
+		rhoav[1].v = _mm256_fmadd_pd( a0v.v, x0v.v,  rhoav[1].v );
+		rhobv[1].v = _mm256_fmadd_pd( a0v.v, xs0v.v, rhobv[1].v );
+
+		a0v.v  = _mm256_loadu_pd( ( double* )( a0 + 2*lda ) );
+		rhoav[2].v = _mm256_fmadd_pd( a0v.v, x0v.v,  rhoav[2].v );
+		rhobv[2].v = _mm256_fmadd_pd( a0v.v, xs0v.v, rhobv[2].v );
+
+		a0v.v  = _mm256_loadu_pd( ( double* )( a0 + 3*lda ) );
+		rhoav[3].v = _mm256_fmadd_pd( a0v.v, x0v.v,  rhoav[3].v );
+		rhobv[3].v = _mm256_fmadd_pd( a0v.v, xs0v.v, rhobv[3].v );
+	}
+
+	// Accumulate the even (real) and odd (imaginary) elements of each
+	// vector into scalars.
+	for ( j = 0; j < fuse_fac; ++j )
+	{
+		_mm256_storeu_pd( ta, rhoav[j].v );
+		_mm256_storeu_pd( tb, rhobv[j].v );
+
+		rhoa_r[j] = 0.0; rhoa_i[j] = 0.0;
+		rhob_r[j] = 0.0; rhob_i[j] = 0.0;
+
+		for ( k = 0; k < 4; k += 2 )
+		{
+			rhoa_r[j] += ta[k]; rhoa_i[j] += ta[k+1];
+			rhob_r[j] += tb[k]; rhob_i[j] += tb[k+1];
+		}
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = m - m_left; i < m; ++i )
+	{
+		const double x0r = PASTEMAC(z,real)( *( x + i*incx ) );
+		const double x0i = PASTEMAC(z,imag)( *( x + i*incx ) );
+
+		for ( j = 0; j < fuse_fac; ++j )
+		{
+			const double a0r = PASTEMAC(z,real)( *( a + i*inca + j*lda ) );
+			const double a0i = PASTEMAC(z,imag)( *( a + i*inca + j*lda ) );
+
+			rhoa_r[j] += a0r * x0r; rhoa_i[j] += a0i * x0i;
+			rhob_r[j] += a0r * x0i; rhob_i[j] += a0i * x0r;
+		}
+	}
+
+	// Combine the partial sums according to the conjugation of A and x.
+	// If sa and sx are -1 when A and x are conjugated (and 1 otherwise),
+	// then the real part of each dot product is rhoa_r - sa * sx * rhoa_i
+	// and the imaginary part is sx * rhob_r + sa * rhob_i. Then update
+	// y := beta * y + alpha * rho.
+	sa = ( bli_is_conj( conjat ) ? -1.0 : 1.0 );
+	sx = ( bli_is_conj( conjx  ) ? -1.0 : 1.0 );
+
+	for ( j = 0; j < fuse_fac; ++j )
+	{
+		dcomplex* restrict psi1 = y + j*incy;
+
+		PASTEMAC(z,sets)( rhoa_r[j] - sa * sx * rhoa_i[j],
+		                   sx * rhob_r[j] + sa * rhob_i[j], rho );
+
+		if ( PASTEMAC(z,eq0)( *beta ) )
+		{
+			PASTEMAC(z,scal2s)( *alpha, rho, *psi1 );
+		}
+		else
+		{
+			PASTEMAC(z,scals)( *beta, *psi1 );
+			PASTEMAC(z,axpys)( *alpha, rho, *psi1 );
+		}
+	}
+}
+
@@ -0,0 +1,370 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// These kernels compute B := alpha * A^T, where A is m x n and B is n x m.
+// When A and B are both column-stored (or both row-stored), the matrices
+// are traversed in square tiles sized to fit comfortably within the L1
+// cache, and each tile is transposed in registers in blocks of 4x4 (double)
+// or 8x8 (float) elements. Any other storage combination is handled with
+// scalar code.
+
+#define BLIS_STRANSM_ZEN_TILE 64
+#define BLIS_DTRANSM_ZEN_TILE 32
+
+// -----------------------------------------------------------------------------
+
+static void bli_stransm_zen_int_edge
+     (
+       dim_t            m,
+       dim_t            n,
+       float            alpha,
+       float*  restrict a, inc_t rs_a, inc_t cs_a,
+       float*  restrict b, inc_t rs_b, inc_t cs_b
+     )
+{
+	dim_t i, j;
+
+	for ( j = 0; j < n; ++j )
+	for ( i = 0; i < m; ++i )
+		*(b + j*rs_b + i*cs_b) = alpha * *(a + i*rs_a + j*cs_a);
+}
+
+void bli_stransm_zen_int
+     (
+       conj_t           conja,
+       dim_t            m,
+       dim_t            n,
+       float*  restrict alpha,
+       float*  restrict a, inc_t rs_a, inc_t cs_a,
+       float*  restrict b, inc_t rs_b, inc_t cs_b,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      tile           = BLIS_STRANSM_ZEN_TILE;
+
+	const float      alpha_s        = *alpha;
+	const bool_t     is_unit        = PASTEMAC(s,eq1)( alpha_s );
+
+	dim_t            ii, jj, i, j;
+	dim_t            m_cur, n_cur;
+	dim_t            m_vec, n_vec;
+
+	float*  restrict a1;
+	float*  restrict b1;
+
+	__m256           alphav;
+	__m256           r0, r1, r2, r3, r4, r5, r6, r7;
+	__m256           t0, t1, t2, t3, t4, t5, t6, t7;
+
+	// Conjugation is a no-op in the real domain.
+	( void )conja;
+
+	if ( bli_zero_dim2( m, n ) ) return;
+
+	// If alpha is zero, set B to zero, ignoring the contents of A (which
+	// may contain NaN or Inf).
+	if ( PASTEMAC(s,eq0)( alpha_s ) )
+	{
+		for ( j = 0; j < n; ++j )
+		for ( i = 0; i < m; ++i )
+			*(b + j*rs_b + i*cs_b) = 0.0F;
+
+		return;
+	}
+
+	// If A and B are both row-stored, transpose the operation so that
+	// both matrices are column-stored.
+	if ( cs_a == 1 && cs_b == 1 )
+	{
+		bli_swap_dims( &m, &n );
+		bli_swap_incs( &rs_a, &cs_a );
+		bli_swap_incs( &rs_b, &cs_b );
+	}
+
+	// If either matrix is not column-stored, use scalar code.
+	if ( rs_a != 1 || rs_b != 1 )
+	{
+		bli_stransm_zen_int_edge( m, n, alpha_s, a, rs_a, cs_a, b, rs_b, cs_b );
+		return;
+	}
+
+	// Broadcast the alpha scalar to all elements of a vector register.
+	alphav = _mm256_broadcast_ss( alpha );
+
+	for ( jj = 0; jj < n; jj += tile )
+	{
+		n_cur = bli_min( tile, n - jj );
+		n_vec = ( n_cur / n_elem_per_reg ) * n_elem_per_reg;
+
+		for ( ii = 0; ii < m; ii += tile )
+		{
+			m_cur = bli_min( tile, m - ii );
+			m_vec = ( m_cur / n_elem_per_reg ) * n_elem_per_reg;
+
+			a1 = a + ii + jj*cs_a;
+			b1 = b + jj + ii*cs_b;
+
+			for ( j = 0; j < n_vec; j += n_elem_per_reg )
+			for ( i = 0; i < m_vec; i += n_elem_per_reg )
+			{
+				float* restrict ap = a1 + i + j*cs_a;
+				float* restrict bp = b1 + j + i*cs_b;
+
+				// Load eight columns of an 8x8 block of A.
+				r0 = _mm256_loadu_ps( ap + 0*cs_a );
+				r1 = _mm256_loadu_ps( ap + 1*cs_a );
+				r2 = _mm256_loadu_ps( ap + 2*cs_a );
+				r3 = _mm256_loadu_ps( ap + 3*cs_a );
+				r4 = _mm256_loadu_ps( ap + 4*cs_a );
+				r5 = _mm256_loadu_ps( ap + 5*cs_a );
+				r6 = _mm256_loadu_ps( ap + 6*cs_a );
+				r7 = _mm256_loadu_ps( ap + 7*cs_a );
+
+				// Interleave pairs of columns.
+				t0 = _mm256_unpacklo_ps( r0, r1 );
+				t1 = _mm256_unpackhi_ps( r0, r1 );
+				t2 = _mm256_unpacklo_ps( r2, r3 );
+				t3 = _mm256_unpackhi_ps( r2, r3 );
+				t4 = _mm256_unpacklo_ps( r4, r5 );
+				t5 = _mm256_unpackhi_ps( r4, r5 );
+				t6 = _mm256_unpacklo_ps( r6, r7 );
+				t7 = _mm256_unpackhi_ps( r6, r7 );
+
+				// Gather groups of four within each 128-bit lane.
+				r0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+				r1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+				r2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+				r3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+				r4 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+				r5 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+				r6 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+				r7 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+				// Exchange 128-bit lanes to form the rows of the block.
+				t0 = _mm256_permute2f128_ps( r0, r4, 0x20 );
+				t1 = _mm256_permute2f128_ps( r1, r5, 0x20 );
+				t2 = _mm256_permute2f128_ps( r2, r6, 0x20 );
+				t3 = _mm256_permute2f128_ps( r3, r7, 0x20 );
+				t4 = _mm256_permute2f128_ps( r0, r4, 0x31 );
+				t5 = _mm256_permute2f128_ps( r1, r5, 0x31 );
+				t6 = _mm256_permute2f128_ps( r2, r6, 0x31 );
+				t7 = _mm256_permute2f128_ps( r3, r7, 0x31 );
+
+				if ( !is_unit )
+				{
+					t0 = _mm256_mul_ps( alphav, t0 );
+					t1 = _mm256_mul_ps( alphav, t1 );
+					t2 = _mm256_mul_ps( alphav, t2 );
+					t3 = _mm256_mul_ps( alphav, t3 );
+					t4 = _mm256_mul_ps( alphav, t4 );
+					t5 = _mm256_mul_ps( alphav, t5 );
+					t6 = _mm256_mul_ps( alphav, t6 );
+					t7 = _mm256_mul_ps( alphav, t7 );
+				}
+
+				// Store the rows of the block of A as columns of B.
+				_mm256_storeu_ps( bp + 0*cs_b, t0 );
+				_mm256_storeu_ps( bp + 1*cs_b, t1 );
+				_mm256_storeu_ps( bp + 2*cs_b, t2 );
+				_mm256_storeu_ps( bp + 3*cs_b, t3 );
+				_mm256_storeu_ps( bp + 4*cs_b, t4 );
+				_mm256_storeu_ps( bp + 5*cs_b, t5 );
+				_mm256_storeu_ps( bp + 6*cs_b, t6 );
+				_mm256_storeu_ps( bp + 7*cs_b, t7 );
+			}
+
+			// Handle the edge cases: the bottom rows of the tile of A (for
+			// all columns) and the rightmost columns (for the remaining
+			// rows).
+			bli_stransm_zen_int_edge( m_cur - m_vec, n_cur, alpha_s,
+			                          a1 + m_vec, 1, cs_a,
+			                          b1 + m_vec*cs_b, 1, cs_b );
+			bli_stransm_zen_int_edge( m_vec, n_cur - n_vec, alpha_s,
+			                          a1 + n_vec*cs_a, 1, cs_a,
+			                          b1 + n_vec, 1, cs_b );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_dtransm_zen_int_edge
+     (
+       dim_t            m,
+       dim_t            n,
+       double           alpha,
+       double* restrict a, inc_t rs_a, inc_t cs_a,
+       double* restrict b, inc_t rs_b, inc_t cs_b
+     )
+{
+	dim_t i, j;
+
+	for ( j = 0; j < n; ++j )
+	for ( i = 0; i < m; ++i )
+		*(b + j*rs_b + i*cs_b) = alpha * *(a + i*rs_a + j*cs_a);
+}
+
+void bli_dtransm_zen_int
+     (
+       conj_t           conja,
+       dim_t            m,
+       dim_t            n,
+       double* restrict alpha,
+       double* restrict a, inc_t rs_a, inc_t cs_a,
+       double* restrict b, inc_t rs_b, inc_t cs_b,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      tile           = BLIS_DTRANSM_ZEN_TILE;
+
+	const double     alpha_d        = *alpha;
+	const bool_t     is_unit        = PASTEMAC(d,eq1)( alpha_d );
+
+	dim_t            ii, jj, i, j;
+	dim_t            m_cur, n_cur;
+	dim_t            m_vec, n_vec;
+
+	double* restrict a1;
+	double* restrict b1;
+
+	__m256d          alphav;
+	__m256d          r0, r1, r2, r3;
+	__m256d          t0, t1, t2, t3;
+
+	// Conjugation is a no-op in the real domain.
+	( void )conja;
+
+	if ( bli_zero_dim2( m, n ) ) return;
+
+	// If alpha is zero, set B to zero, ignoring the contents of A (which
+	// may contain NaN or Inf).
+	if ( PASTEMAC(d,eq0)( alpha_d ) )
+	{
+		for ( j = 0; j < n; ++j )
+		for ( i = 0; i < m; ++i )
+			*(b + j*rs_b + i*cs_b) = 0.0;
+
+		return;
+	}
+
+	// If A and B are both row-stored, transpose the operation so that
+	// both matrices are column-stored.
+	if ( cs_a == 1 && cs_b == 1 )
+	{
+		bli_swap_dims( &m, &n );
+		bli_swap_incs( &rs_a, &cs_a );
+		bli_swap_incs( &rs_b, &cs_b );
+	}
+
+	// If either matrix is not column-stored, use scalar code.
+	if ( rs_a != 1 || rs_b != 1 )
+	{
+		bli_dtransm_zen_int_edge( m, n, alpha_d, a, rs_a, cs_a, b, rs_b, cs_b );
+		return;
+	}
+
+	// Broadcast the alpha scalar to all elements of a vector register.
+	alphav = _mm256_broadcast_sd( alpha );
+
+	for ( jj = 0; jj < n; jj += tile )
+	{
+		n_cur = bli_min( tile, n - jj );
+		n_vec = ( n_cur / n_elem_per_reg ) * n_elem_per_reg;
+
+		for ( ii = 0; ii < m; ii += tile )
+		{
+			m_cur = bli_min( tile, m - ii );
+			m_vec = ( m_cur / n_elem_per_reg ) * n_elem_per_reg;
+
+			a1 = a + ii + jj*cs_a;
+			b1 = b + jj + ii*cs_b;
+
+			for ( j = 0; j < n_vec; j += n_elem_per_reg )
+			for ( i = 0; i < m_vec; i += n_elem_per_reg )
+			{
+				double* restrict ap = a1 + i + j*cs_a;
+				double* restrict bp = b1 + j + i*cs_b;
+
+				// Load four columns of a 4x4 block of A.
+				r0 = _mm256_loadu_pd( ap + 0*cs_a );
+				r1 = _mm256_loadu_pd( ap + 1*cs_a );
+				r2 = _mm256_loadu_pd( ap + 2*cs_a );
+				r3 = _mm256_loadu_pd( ap + 3*cs_a );
+
+				// Interleave pairs of columns.
+				t0 = _mm256_unpacklo_pd( r0, r1 );
+				t1 = _mm256_unpackhi_pd( r0, r1 );
+				t2 = _mm256_unpacklo_pd( r2, r3 );
+				t3 = _mm256_unpackhi_pd( r2, r3 );
+
+				// Exchange 128-bit lanes to form the rows of the block.
+				r0 = _mm256_permute2f128_pd( t0, t2, 0x20 );
+				r1 = _mm256_permute2f128_pd( t1, t3, 0x20 );
+				r2 = _mm256_permute2f128_pd( t0, t2, 0x31 );
+				r3 = _mm256_permute2f128_pd( t1, t3, 0x31 );
+
+				if ( !is_unit )
+				{
+					r0 = _mm256_mul_pd( alphav, r0 );
+					r1 = _mm256_mul_pd( alphav, r1 );
+					r2 = _mm256_mul_pd( alphav, r2 );
+					r3 = _mm256_mul_pd( alphav, r3 );
+				}
+
+				// Store the rows of the block of A as columns of B.
+				_mm256_storeu_pd( bp + 0*cs_b, r0 );
+				_mm256_storeu_pd( bp + 1*cs_b, r1 );
+				_mm256_storeu_pd( bp + 2*cs_b, r2 );
+				_mm256_storeu_pd( bp + 3*cs_b, r3 );
+			}
+
+			// Handle the edge cases: the bottom rows of the tile of A (for
+			// all columns) and the rightmost columns (for the remaining
+			// rows).
+			bli_dtransm_zen_int_edge( m_cur - m_vec, n_cur, alpha_d,
+			                          a1 + m_vec, 1, cs_a,
+			                          b1 + m_vec*cs_b, 1, cs_b );
+			bli_dtransm_zen_int_edge( m_vec, n_cur - n_vec, alpha_d,
+			                          a1 + n_vec*cs_a, 1, cs_a,
+			                          b1 + n_vec, 1, cs_b );
+		}
+	}
+}
+
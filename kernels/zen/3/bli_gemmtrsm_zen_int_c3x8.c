@@ -0,0 +1,280 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// These micro-kernels fuse the scomplex 3x8 gemm micro-kernel (from the
+// d6x8 family of assembly kernels) with a triangular solve written using
+// AVX2 intrinsics. The packed micro-panels use the native (interleaved)
+// complex format: a11 is stored by columns with a column stride of
+// PACKMR, b11 is stored by rows with a row stride of PACKNR, and the
+// diagonal of a11 holds the inverses of the original diagonal elements.
+
+// Compute alpha * x, where alpha is given by broadcasts of its real and
+// imaginary components and x contains interleaved complex elements.
+static inline __m256 bli_cscal_zen_int_v( __m256 ar, __m256 ai, __m256 x )
+{
+	__m256 xs = _mm256_permute_ps( x, 0xB1 );
+
+	return _mm256_fmaddsub_ps( ar, x, _mm256_mul_ps( ai, xs ) );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ctrsm_l_zen_int_3x8
+     (
+       scomplex*  restrict a11,
+       scomplex*  restrict b11,
+       scomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t m    = 3;
+	const dim_t n    = 8;
+
+	const inc_t cs_a = 3;
+	const inc_t rs_b = 8;
+
+	__m256      b0v[ 3 ], b1v[ 3 ];
+	dim_t       i, j, l;
+
+	for ( i = 0; i < m; ++i )
+	{
+		scomplex* restrict b1      = b11 + i*rs_b;
+		scomplex* restrict c1      = c11 + i*rs_c;
+		scomplex* restrict alpha11 = a11 + i + i*cs_a;
+
+		__m256 x0v = _mm256_loadu_ps( ( float* )( b1 + 0 ) );
+		__m256 x1v = _mm256_loadu_ps( ( float* )( b1 + 4 ) );
+
+		// b1 = b1 - a10t * B0;
+		for ( l = 0; l < i; ++l )
+		{
+			scomplex* restrict alpha10 = a11 + i + l*cs_a;
+
+			__m256 ar = _mm256_broadcast_ss( ( float* )alpha10 + 0 );
+			__m256 ai = _mm256_broadcast_ss( ( float* )alpha10 + 1 );
+
+			x0v = _mm256_sub_ps( x0v, bli_cscal_zen_int_v( ar, ai, b0v[ l ] ) );
+			x1v = _mm256_sub_ps( x1v, bli_cscal_zen_int_v( ar, ai, b1v[ l ] ) );
+		}
+
+		// b1 = b1 / alpha11; (alpha11 holds the inverse.)
+		{
+			__m256 ar = _mm256_broadcast_ss( ( float* )alpha11 + 0 );
+			__m256 ai = _mm256_broadcast_ss( ( float* )alpha11 + 1 );
+
+			x0v = bli_cscal_zen_int_v( ar, ai, x0v );
+			x1v = bli_cscal_zen_int_v( ar, ai, x1v );
+		}
+
+		b0v[ i ] = x0v;
+		b1v[ i ] = x1v;
+
+		// Store the result back to b11 and output it to c11.
+		_mm256_storeu_ps( ( float* )( b1 + 0 ), x0v );
+		_mm256_storeu_ps( ( float* )( b1 + 4 ), x1v );
+
+		if ( cs_c == 1 )
+		{
+			_mm256_storeu_ps( ( float* )( c1 + 0 ), x0v );
+			_mm256_storeu_ps( ( float* )( c1 + 4 ), x1v );
+		}
+		else
+		{
+			for ( j = 0; j < n; ++j )
+				PASTEMAC(c,copys)( *( b1 + j ), *( c1 + j*cs_c ) );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cgemmtrsm_l_zen_int_3x8
+     (
+       dim_t               k,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a10,
+       scomplex*  restrict a11,
+       scomplex*  restrict b01,
+       scomplex*  restrict b11,
+       scomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t rs_b = 8;
+	const inc_t cs_b = 1;
+
+	// b11 = alpha * b11 - a10 * b01;
+	bli_cgemm_zen_asm_3x8
+	(
+	  k,
+	  PASTEMAC(c,m1),
+	  a10,
+	  b01,
+	  alpha,
+	  b11, rs_b, cs_b,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	bli_ctrsm_l_zen_int_3x8
+	(
+	  a11,
+	  b11,
+	  c11, rs_c, cs_c,
+	  data,
+	  cntx
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ctrsm_u_zen_int_3x8
+     (
+       scomplex*  restrict a11,
+       scomplex*  restrict b11,
+       scomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t m    = 3;
+	const dim_t n    = 8;
+
+	const inc_t cs_a = 3;
+	const inc_t rs_b = 8;
+
+	__m256      b0v[ 3 ], b1v[ 3 ];
+	dim_t       iter, i, j, l;
+
+	for ( iter = 0; iter < m; ++iter )
+	{
+		i = m - iter - 1;
+
+		scomplex* restrict b1      = b11 + i*rs_b;
+		scomplex* restrict c1      = c11 + i*rs_c;
+		scomplex* restrict alpha11 = a11 + i + i*cs_a;
+
+		__m256 x0v = _mm256_loadu_ps( ( float* )( b1 + 0 ) );
+		__m256 x1v = _mm256_loadu_ps( ( float* )( b1 + 4 ) );
+
+		// b1 = b1 - a12t * B2;
+		for ( l = i + 1; l < m; ++l )
+		{
+			scomplex* restrict alpha12 = a11 + i + l*cs_a;
+
+			__m256 ar = _mm256_broadcast_ss( ( float* )alpha12 + 0 );
+			__m256 ai = _mm256_broadcast_ss( ( float* )alpha12 + 1 );
+
+			x0v = _mm256_sub_ps( x0v, bli_cscal_zen_int_v( ar, ai, b0v[ l ] ) );
+			x1v = _mm256_sub_ps( x1v, bli_cscal_zen_int_v( ar, ai, b1v[ l ] ) );
+		}
+
+		// b1 = b1 / alpha11; (alpha11 holds the inverse.)
+		{
+			__m256 ar = _mm256_broadcast_ss( ( float* )alpha11 + 0 );
+			__m256 ai = _mm256_broadcast_ss( ( float* )alpha11 + 1 );
+
+			x0v = bli_cscal_zen_int_v( ar, ai, x0v );
+			x1v = bli_cscal_zen_int_v( ar, ai, x1v );
+		}
+
+		b0v[ i ] = x0v;
+		b1v[ i ] = x1v;
+
+		// Store the result back to b11 and output it to c11.
+		_mm256_storeu_ps( ( float* )( b1 + 0 ), x0v );
+		_mm256_storeu_ps( ( float* )( b1 + 4 ), x1v );
+
+		if ( cs_c == 1 )
+		{
+			_mm256_storeu_ps( ( float* )( c1 + 0 ), x0v );
+			_mm256_storeu_ps( ( float* )( c1 + 4 ), x1v );
+		}
+		else
+		{
+			for ( j = 0; j < n; ++j )
+				PASTEMAC(c,copys)( *( b1 + j ), *( c1 + j*cs_c ) );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cgemmtrsm_u_zen_int_3x8
+     (
+       dim_t               k,
+       scomplex*  restrict alpha,
+       scomplex*  restrict a12,
+       scomplex*  restrict a11,
+       scomplex*  restrict b21,
+       scomplex*  restrict b11,
+       scomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t rs_b = 8;
+	const inc_t cs_b = 1;
+
+	// b11 = alpha * b11 - a12 * b21;
+	bli_cgemm_zen_asm_3x8
+	(
+	  k,
+	  PASTEMAC(c,m1),
+	  a12,
+	  b21,
+	  alpha,
+	  b11, rs_b, cs_b,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	bli_ctrsm_u_zen_int_3x8
+	(
+	  a11,
+	  b11,
+	  c11, rs_c, cs_c,
+	  data,
+	  cntx
+	);
+}
@@ -0,0 +1,280 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// These micro-kernels fuse the dcomplex 3x4 gemm micro-kernel (from the
+// d6x8 family of assembly kernels) with a triangular solve written using
+// AVX2 intrinsics. The packed micro-panels use the native (interleaved)
+// complex format: a11 is stored by columns with a column stride of
+// PACKMR, b11 is stored by rows with a row stride of PACKNR, and the
+// diagonal of a11 holds the inverses of the original diagonal elements.
+
+// Compute alpha * x, where alpha is given by broadcasts of its real and
+// imaginary components and x contains interleaved complex elements.
+static inline __m256d bli_zscal_zen_int_v( __m256d ar, __m256d ai, __m256d x )
+{
+	__m256d xs = _mm256_permute_pd( x, 0x5 );
+
+	return _mm256_fmaddsub_pd( ar, x, _mm256_mul_pd( ai, xs ) );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ztrsm_l_zen_int_3x4
+     (
+       dcomplex*  restrict a11,
+       dcomplex*  restrict b11,
+       dcomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t m    = 3;
+	const dim_t n    = 4;
+
+	const inc_t cs_a = 3;
+	const inc_t rs_b = 4;
+
+	__m256d     b0v[ 3 ], b1v[ 3 ];
+	dim_t       i, j, l;
+
+	for ( i = 0; i < m; ++i )
+	{
+		dcomplex* restrict b1      = b11 + i*rs_b;
+		dcomplex* restrict c1      = c11 + i*rs_c;
+		dcomplex* restrict alpha11 = a11 + i + i*cs_a;
+
+		__m256d x0v = _mm256_loadu_pd( ( double* )( b1 + 0 ) );
+		__m256d x1v = _mm256_loadu_pd( ( double* )( b1 + 2 ) );
+
+		// b1 = b1 - a10t * B0;
+		for ( l = 0; l < i; ++l )
+		{
+			dcomplex* restrict alpha10 = a11 + i + l*cs_a;
+
+			__m256d ar = _mm256_broadcast_sd( ( double* )alpha10 + 0 );
+			__m256d ai = _mm256_broadcast_sd( ( double* )alpha10 + 1 );
+
+			x0v = _mm256_sub_pd( x0v, bli_zscal_zen_int_v( ar, ai, b0v[ l ] ) );
+			x1v = _mm256_sub_pd( x1v, bli_zscal_zen_int_v( ar, ai, b1v[ l ] ) );
+		}
+
+		// b1 = b1 / alpha11; (alpha11 holds the inverse.)
+		{
+			__m256d ar = _mm256_broadcast_sd( ( double* )alpha11 + 0 );
+			__m256d ai = _mm256_broadcast_sd( ( double* )alpha11 + 1 );
+
+			x0v = bli_zscal_zen_int_v( ar, ai, x0v );
+			x1v = bli_zscal_zen_int_v( ar, ai, x1v );
+		}
+
+		b0v[ i ] = x0v;
+		b1v[ i ] = x1v;
+
+		// Store the result back to b11 and output it to c11.
+		_mm256_storeu_pd( ( double* )( b1 + 0 ), x0v );
+		_mm256_storeu_pd( ( double* )( b1 + 2 ), x1v );
+
+		if ( cs_c == 1 )
+		{
+			_mm256_storeu_pd( ( double* )( c1 + 0 ), x0v );
+			_mm256_storeu_pd( ( double* )( c1 + 2 ), x1v );
+		}
+		else
+		{
+			for ( j = 0; j < n; ++j )
+				PASTEMAC(z,copys)( *( b1 + j ), *( c1 + j*cs_c ) );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zgemmtrsm_l_zen_int_3x4
+     (
+       dim_t               k,
+       dcomplex*  restrict alpha,
+       dcomplex*  restrict a10,
+       dcomplex*  restrict a11,
+       dcomplex*  restrict b01,
+       dcomplex*  restrict b11,
+       dcomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t rs_b = 4;
+	const inc_t cs_b = 1;
+
+	// b11 = alpha * b11 - a10 * b01;
+	bli_zgemm_zen_asm_3x4
+	(
+	  k,
+	  PASTEMAC(z,m1),
+	  a10,
+	  b01,
+	  alpha,
+	  b11, rs_b, cs_b,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	bli_ztrsm_l_zen_int_3x4
+	(
+	  a11,
+	  b11,
+	  c11, rs_c, cs_c,
+	  data,
+	  cntx
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ztrsm_u_zen_int_3x4
+     (
+       dcomplex*  restrict a11,
+       dcomplex*  restrict b11,
+       dcomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t m    = 3;
+	const dim_t n    = 4;
+
+	const inc_t cs_a = 3;
+	const inc_t rs_b = 4;
+
+	__m256d     b0v[ 3 ], b1v[ 3 ];
+	dim_t       iter, i, j, l;
+
+	for ( iter = 0; iter < m; ++iter )
+	{
+		i = m - iter - 1;
+
+		dcomplex* restrict b1      = b11 + i*rs_b;
+		dcomplex* restrict c1      = c11 + i*rs_c;
+		dcomplex* restrict alpha11 = a11 + i + i*cs_a;
+
+		__m256d x0v = _mm256_loadu_pd( ( double* )( b1 + 0 ) );
+		__m256d x1v = _mm256_loadu_pd( ( double* )( b1 + 2 ) );
+
+		// b1 = b1 - a12t * B2;
+		for ( l = i + 1; l < m; ++l )
+		{
+			dcomplex* restrict alpha12 = a11 + i + l*cs_a;
+
+			__m256d ar = _mm256_broadcast_sd( ( double* )alpha12 + 0 );
+			__m256d ai = _mm256_broadcast_sd( ( double* )alpha12 + 1 );
+
+			x0v = _mm256_sub_pd( x0v, bli_zscal_zen_int_v( ar, ai, b0v[ l ] ) );
+			x1v = _mm256_sub_pd( x1v, bli_zscal_zen_int_v( ar, ai, b1v[ l ] ) );
+		}
+
+		// b1 = b1 / alpha11; (alpha11 holds the inverse.)
+		{
+			__m256d ar = _mm256_broadcast_sd( ( double* )alpha11 + 0 );
+			__m256d ai = _mm256_broadcast_sd( ( double* )alpha11 + 1 );
+
+			x0v = bli_zscal_zen_int_v( ar, ai, x0v );
+			x1v = bli_zscal_zen_int_v( ar, ai, x1v );
+		}
+
+		b0v[ i ] = x0v;
+		b1v[ i ] = x1v;
+
+		// Store the result back to b11 and output it to c11.
+		_mm256_storeu_pd( ( double* )( b1 + 0 ), x0v );
+		_mm256_storeu_pd( ( double* )( b1 + 2 ), x1v );
+
+		if ( cs_c == 1 )
+		{
+			_mm256_storeu_pd( ( double* )( c1 + 0 ), x0v );
+			_mm256_storeu_pd( ( double* )( c1 + 2 ), x1v );
+		}
+		else
+		{
+			for ( j = 0; j < n; ++j )
+				PASTEMAC(z,copys)( *( b1 + j ), *( c1 + j*cs_c ) );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_zgemmtrsm_u_zen_int_3x4
+     (
+       dim_t               k,
+       dcomplex*  restrict alpha,
+       dcomplex*  restrict a12,
+       dcomplex*  restrict a11,
+       dcomplex*  restrict b21,
+       dcomplex*  restrict b11,
+       dcomplex*  restrict c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const inc_t rs_b = 4;
+	const inc_t cs_b = 1;
+
+	// b11 = alpha * b11 - a12 * b21;
+	bli_zgemm_zen_asm_3x4
+	(
+	  k,
+	  PASTEMAC(z,m1),
+	  a12,
+	  b21,
+	  alpha,
+	  b11, rs_b, cs_b,
+	  data,
+	  cntx
+	);
+
+	// b11 = inv(a11) * b11;
+	// c11 = b11;
+	bli_ztrsm_u_zen_int_3x4
+	(
+	  a11,
+	  b11,
+	  c11, rs_c, cs_c,
+	  data,
+	  cntx
+	);
+}
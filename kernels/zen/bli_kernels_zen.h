@@ -37,10 +37,14 @@
 // amaxv (intrinsics)
 AMAXV_KER_PROT( float,    s, amaxv_zen_int )
 AMAXV_KER_PROT( double,   d, amaxv_zen_int )
+AMAXV_KER_PROT( scomplex, c, amaxv_zen_int )
+AMAXV_KER_PROT( dcomplex, z, amaxv_zen_int )
 
 // axpyv (intrinsics)
 AXPYV_KER_PROT( float,    s, axpyv_zen_int )
 AXPYV_KER_PROT( double,   d, axpyv_zen_int )
+AXPYV_KER_PROT( scomplex, c, axpyv_zen_int )
+AXPYV_KER_PROT( dcomplex, z, axpyv_zen_int )
 
 	// axpyv (intrinsics unrolled x10)
 	AXPYV_KER_PROT( float,    s, axpyv_zen_int10 )
@@ -49,6 +53,8 @@ AXPYV_KER_PROT( double,   d, axpyv_zen_int )
 // dotv (intrinsics)
 DOTV_KER_PROT( float,    s, dotv_zen_int )
 DOTV_KER_PROT( double,   d, dotv_zen_int )
+DOTV_KER_PROT( scomplex, c, dotv_zen_int )
+DOTV_KER_PROT( dcomplex, z, dotv_zen_int )
 
 	// dotv (intrinsics, unrolled x10)
 	DOTV_KER_PROT( float,    s, dotv_zen_int10 )
@@ -57,24 +63,46 @@ DOTV_KER_PROT( double,   d, dotv_zen_int )
 // dotxv (intrinsics)
 DOTXV_KER_PROT( float,    s, dotxv_zen_int )
 DOTXV_KER_PROT( double,   d, dotxv_zen_int )
+DOTXV_KER_PROT( scomplex, c, dotxv_zen_int )
+DOTXV_KER_PROT( dcomplex, z, dotxv_zen_int )
+
+// rotv (intrinsics)
+ROTV_KER_PROT( float,    float,  s, s, rotv_zen_int )
+ROTV_KER_PROT( double,   double, d, d, rotv_zen_int )
+
+// rotmv (intrinsics)
+ROTMV_KER_PROT( float,    float,  s, s, rotmv_zen_int )
+ROTMV_KER_PROT( double,   double, d, d, rotmv_zen_int )
 
 // scalv (intrinsics)
 SCALV_KER_PROT( float,    s, scalv_zen_int )
 SCALV_KER_PROT( double,   d, scalv_zen_int )
+SCALV_KER_PROT( scomplex, c, scalv_zen_int )
+SCALV_KER_PROT( dcomplex, z, scalv_zen_int )
 
 	// scalv (intrinsics unrolled x10)
 	SCALV_KER_PROT( float,    s, scalv_zen_int10 )
 	SCALV_KER_PROT( double,   d, scalv_zen_int10 )
 
+// -- level-1m --
+
+// transm (intrinsics)
+TRANSM_KER_PROT( float,    s, transm_zen_int )
+TRANSM_KER_PROT( double,   d, transm_zen_int )
+
 // -- level-1f --
 
 // axpyf (intrinsics)
 AXPYF_KER_PROT( float,    s, axpyf_zen_int_8 )
 AXPYF_KER_PROT( double,   d, axpyf_zen_int_8 )
+AXPYF_KER_PROT( scomplex, c, axpyf_zen_int_4 )
+AXPYF_KER_PROT( dcomplex, z, axpyf_zen_int_4 )
 
 // dotxf (intrinsics)
 DOTXF_KER_PROT( float,    s, dotxf_zen_int_8 )
 DOTXF_KER_PROT( double,   d, dotxf_zen_int_8 )
+DOTXF_KER_PROT( scomplex, c, dotxf_zen_int_4 )
+DOTXF_KER_PROT( dcomplex, z, dotxf_zen_int_4 )
 
 // -- level-3 --
 
@@ -98,6 +126,22 @@ GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_zen_asm_6x8 )
 GEMMTRSM_UKR_PROT( float,    s, gemmtrsm_u_zen_asm_6x16 )
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_zen_asm_6x8 )
 
+// gemmtrsm_l (intrinsics c3x8, z3x4)
+GEMMTRSM_UKR_PROT( scomplex, c, gemmtrsm_l_zen_int_3x8 )
+GEMMTRSM_UKR_PROT( dcomplex, z, gemmtrsm_l_zen_int_3x4 )
+
+// gemmtrsm_u (intrinsics c3x8, z3x4)
+GEMMTRSM_UKR_PROT( scomplex, c, gemmtrsm_u_zen_int_3x8 )
+GEMMTRSM_UKR_PROT( dcomplex, z, gemmtrsm_u_zen_int_3x4 )
+
+// trsm_l (intrinsics c3x8, z3x4)
+TRSM_UKR_PROT( scomplex, c, trsm_l_zen_int_3x8 )
+TRSM_UKR_PROT( dcomplex, z, trsm_l_zen_int_3x4 )
+
+// trsm_u (intrinsics c3x8, z3x4)
+TRSM_UKR_PROT( scomplex, c, trsm_u_zen_int_3x8 )
+TRSM_UKR_PROT( dcomplex, z, trsm_u_zen_int_3x4 )
+
 
 // gemm (asm d8x6)
 //GEMM_UKR_PROT( float,    s, gemm_zen_asm_16x6 )
@@ -0,0 +1,197 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_DIST_H
+#define BLIS_DIST_H
+
+// This header defines the distributed-memory level-3 layer, which
+// computes gemm, herk, and trsm on matrices that are distributed over a
+// two-dimensional grid of MPI processes with a block-cyclic (ScaLAPACK-
+// style) distribution. Each process stores its local submatrix as an
+// ordinary column-stored BLIS object, and all local computation is
+// performed by BLIS.
+
+#include <mpi.h>
+#include "blis.h"
+
+
+// -- Process grid -------------------------------------------------------------
+
+typedef struct
+{
+	MPI_Comm comm;     // All processes in the grid.
+	MPI_Comm row_comm; // The processes in my grid row, ranked by grid column.
+	MPI_Comm col_comm; // The processes in my grid column, ranked by grid row.
+
+	int      nprow;
+	int      npcol;
+	int      myrow;
+	int      mycol;
+} bli_dist_grid_t;
+
+void bli_dist_grid_create
+     (
+       MPI_Comm         comm,
+       int              nprow,
+       int              npcol,
+       bli_dist_grid_t* grid
+     );
+
+void bli_dist_grid_free
+     (
+       bli_dist_grid_t* grid
+     );
+
+
+// -- Distributed matrix -------------------------------------------------------
+
+// Global element ( i, j ) belongs to block ( i / nb, j / nb ), which is
+// owned by grid process ( ( i / nb ) % nprow, ( j / nb ) % npcol ). Each
+// process stores the blocks it owns, in order, in a column-stored local
+// object.
+typedef struct
+{
+	bli_dist_grid_t* grid;
+
+	dim_t            m;
+	dim_t            n;
+	dim_t            nb;
+
+	obj_t            local;
+} bli_dist_obj_t;
+
+void bli_dist_obj_create
+     (
+       num_t            dt,
+       dim_t            m,
+       dim_t            n,
+       dim_t            nb,
+       bli_dist_grid_t* grid,
+       bli_dist_obj_t*  a
+     );
+
+void bli_dist_obj_free
+     (
+       bli_dist_obj_t*  a
+     );
+
+void bli_dist_obj_copy_from_global
+     (
+       obj_t*           g,
+       bli_dist_obj_t*  a
+     );
+
+void bli_dist_obj_copy_to_global
+     (
+       bli_dist_obj_t*  a,
+       obj_t*           g
+     );
+
+static num_t bli_dist_obj_dt( bli_dist_obj_t* a )
+{
+	return bli_obj_dt( &a->local );
+}
+
+// Return the address of element ( il, jl ) of the local matrix of a.
+static void* bli_dist_obj_buffer_at( bli_dist_obj_t* a, dim_t il, dim_t jl )
+{
+	return ( char* )bli_obj_buffer_at_off( &a->local ) +
+	       ( il + jl * bli_obj_col_stride( &a->local ) ) *
+	       bli_dt_size( bli_dist_obj_dt( a ) );
+}
+
+// Return the number of the first n global indices (rows or columns) that
+// are owned by process iproc out of nprocs, given a block size of nb.
+static dim_t bli_dist_local_dim( dim_t n, dim_t nb, int iproc, int nprocs )
+{
+	const dim_t n_blk_full = n / nb;
+	const dim_t n_cyc      = n_blk_full / nprocs;
+	const dim_t n_blk_rem  = n_blk_full % nprocs;
+
+	dim_t       n_loc      = n_cyc * nb;
+
+	if      ( iproc <  n_blk_rem ) n_loc += nb;
+	else if ( iproc == n_blk_rem ) n_loc += n % nb;
+
+	return n_loc;
+}
+
+// Return the global index of local index i_loc on process iproc.
+static dim_t bli_dist_global_index( dim_t i_loc, dim_t nb, int iproc, int nprocs )
+{
+	return ( ( i_loc / nb ) * nprocs + iproc ) * nb + i_loc % nb;
+}
+
+
+// -- Operations ---------------------------------------------------------------
+
+// C := beta * C + alpha * A * B
+void bli_dist_gemm
+     (
+       obj_t*          alpha,
+       bli_dist_obj_t* a,
+       bli_dist_obj_t* b,
+       obj_t*          beta,
+       bli_dist_obj_t* c
+     );
+
+// C := beta * C + alpha * A * A^H, referencing and updating only the uploc
+// triangle of C. (alpha and beta must be real.)
+void bli_dist_herk
+     (
+       uplo_t          uploc,
+       obj_t*          alpha,
+       bli_dist_obj_t* a,
+       obj_t*          beta,
+       bli_dist_obj_t* c
+     );
+
+// B := alpha * inv( A ) * B, where A is triangular and stored in its uploa
+// triangle.
+void bli_dist_trsm
+     (
+       uplo_t          uploa,
+       diag_t          diaga,
+       obj_t*          alpha,
+       bli_dist_obj_t* a,
+       bli_dist_obj_t* b
+     );
+
+
+// -- Internal ----------------------------------------------------------------
+
+#include "bli_dist_ker.h"
+
+#endif
+
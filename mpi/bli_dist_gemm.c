@@ -0,0 +1,191 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "bli_dist.h"
+
+//
+// SUMMA. At step s, the process column that owns the s-th block column
+// of A packs its part of that block column into MR micro-panels and
+// broadcasts it within each process row, and the process row that owns the
+// s-th block row of B packs its part into NR micro-panels and broadcasts
+// it within each process column. Every process then updates its local C
+// directly from the received buffers. The broadcasts for step s+1 are
+// posted before the local update of step s begins, so that communication
+// overlaps with computation.
+//
+
+typedef struct
+{
+	void*       a_p;
+	void*       b_p;
+	MPI_Request reqs[2];
+} bli_dist_gemm_buf_t;
+
+static void bli_dist_gemm_post
+     (
+       dim_t                s,
+       bli_dist_obj_t*      a,
+       bli_dist_obj_t*      b,
+       bli_dist_gemm_buf_t* buf,
+       cntx_t*              cntx
+     )
+{
+	bli_dist_grid_t* grid  = a->grid;
+	const num_t      dt    = bli_dist_obj_dt( a );
+	const dim_t      nb    = a->nb;
+	const dim_t      kb    = bli_min( nb, a->n - s * nb );
+	const dim_t      m_loc = bli_obj_length( &a->local );
+	const dim_t      n_loc = bli_obj_width( &b->local );
+	const int        pcol  = s % grid->npcol;
+	const int        prow  = s % grid->nprow;
+	const siz_t      siz_a = bli_dist_packa_size( dt, m_loc, kb, cntx );
+	const siz_t      siz_b = bli_dist_packb_size( dt, kb, n_loc, cntx );
+
+	if ( grid->mycol == pcol )
+	{
+		const dim_t jl = ( s / grid->npcol ) * nb;
+
+		bli_dist_packa
+		(
+		  dt, BLIS_NO_CONJUGATE,
+		  m_loc, kb,
+		  bli_dist_obj_buffer_at( a, 0, jl ),
+		  1, bli_obj_col_stride( &a->local ),
+		  buf->a_p,
+		  cntx
+		);
+	}
+
+	if ( grid->myrow == prow )
+	{
+		const dim_t il = ( s / grid->nprow ) * nb;
+
+		bli_dist_packb
+		(
+		  dt, BLIS_NO_CONJUGATE,
+		  kb, n_loc,
+		  bli_dist_obj_buffer_at( b, il, 0 ),
+		  1, bli_obj_col_stride( &b->local ),
+		  buf->b_p,
+		  cntx
+		);
+	}
+
+	MPI_Ibcast( buf->a_p, ( int )siz_a, MPI_BYTE, pcol, grid->row_comm, &buf->reqs[0] );
+	MPI_Ibcast( buf->b_p, ( int )siz_b, MPI_BYTE, prow, grid->col_comm, &buf->reqs[1] );
+}
+
+void bli_dist_gemm
+     (
+       obj_t*          alpha,
+       bli_dist_obj_t* a,
+       bli_dist_obj_t* b,
+       obj_t*          beta,
+       bli_dist_obj_t* c
+     )
+{
+	const num_t         dt    = bli_dist_obj_dt( c );
+	const dim_t         nb    = c->nb;
+	const dim_t         k     = a->n;
+	const dim_t         n_blk = ( k + nb - 1 ) / nb;
+	const dim_t         m_loc = bli_obj_length( &c->local );
+	const dim_t         n_loc = bli_obj_width( &c->local );
+
+	bli_dist_gemm_buf_t buf[2];
+	cntx_t*             cntx;
+	rntm_t              rntm;
+	void*               buf_alpha;
+	dim_t               s;
+
+	if ( bli_dist_obj_dt( a ) != dt || bli_dist_obj_dt( b ) != dt )
+		bli_check_error_code( BLIS_INCONSISTENT_DATATYPES );
+
+	if ( a->m != c->m || b->n != c->n || b->m != k ||
+	     a->nb != nb || b->nb != nb ||
+	     a->grid != c->grid || b->grid != c->grid )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	bli_scalm( beta, &c->local );
+
+	if ( k == 0 || bli_obj_equals( alpha, &BLIS_ZERO ) ) return;
+
+	cntx      = bli_gks_query_cntx();
+	buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	bli_thread_init_rntm( &rntm );
+
+	for ( s = 0; s < 2; ++s )
+	{
+		buf[s].a_p = bli_malloc_user( bli_dist_packa_size( dt, m_loc, nb, cntx ) + 1 );
+		buf[s].b_p = bli_malloc_user( bli_dist_packb_size( dt, nb, n_loc, cntx ) + 1 );
+	}
+
+	bli_dist_gemm_post( 0, a, b, &buf[0], cntx );
+
+	for ( s = 0; s < n_blk; ++s )
+	{
+		bli_dist_gemm_buf_t* cur = &buf[ s % 2 ];
+		bli_dist_gemm_buf_t* nxt = &buf[ ( s + 1 ) % 2 ];
+		const dim_t          kb  = bli_min( nb, k - s * nb );
+		const int            n_r = ( s + 1 < n_blk ? 2 : 0 );
+
+		// Start communicating the panels for the next step. The buffers it
+		// uses were last read by the local update of the previous step.
+		if ( s + 1 < n_blk )
+			bli_dist_gemm_post( s + 1, a, b, nxt, cntx );
+
+		MPI_Waitall( 2, cur->reqs, MPI_STATUSES_IGNORE );
+
+		bli_dist_gemm_ker
+		(
+		  dt, BLIS_DENSE,
+		  m_loc, n_loc, kb,
+		  buf_alpha,
+		  cur->a_p,
+		  cur->b_p,
+		  bli_dist_obj_buffer_at( c, 0, 0 ), bli_obj_col_stride( &c->local ),
+		  NULL, NULL,
+		  nxt->reqs, n_r,
+		  cntx,
+		  &rntm
+		);
+	}
+
+	for ( s = 0; s < 2; ++s )
+	{
+		bli_free_user( buf[s].a_p );
+		bli_free_user( buf[s].b_p );
+	}
+}
+
@@ -0,0 +1,85 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "bli_dist.h"
+
+void bli_dist_grid_create
+     (
+       MPI_Comm         comm,
+       int              nprow,
+       int              npcol,
+       bli_dist_grid_t* grid
+     )
+{
+	int size, rank;
+
+	MPI_Comm_size( comm, &size );
+	MPI_Comm_rank( comm, &rank );
+
+	// If neither grid dimension was given, choose the most nearly square
+	// grid with no more rows than columns. If only one was given, derive
+	// the other from the number of processes.
+	if ( nprow <= 0 && npcol <= 0 )
+	{
+		for ( nprow = 1; ( nprow + 1 ) * ( nprow + 1 ) <= size; ++nprow ) ;
+		while ( size % nprow != 0 ) --nprow;
+	}
+	if      ( nprow <= 0 ) nprow = size / npcol;
+	else if ( npcol <= 0 ) npcol = size / nprow;
+
+	if ( nprow * npcol != size )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	MPI_Comm_dup( comm, &grid->comm );
+
+	// Processes are placed on the grid in row-major order.
+	grid->nprow = nprow;
+	grid->npcol = npcol;
+	grid->myrow = rank / npcol;
+	grid->mycol = rank % npcol;
+
+	MPI_Comm_split( grid->comm, grid->myrow, grid->mycol, &grid->row_comm );
+	MPI_Comm_split( grid->comm, grid->mycol, grid->myrow, &grid->col_comm );
+}
+
+void bli_dist_grid_free
+     (
+       bli_dist_grid_t* grid
+     )
+{
+	MPI_Comm_free( &grid->row_comm );
+	MPI_Comm_free( &grid->col_comm );
+	MPI_Comm_free( &grid->comm );
+}
+
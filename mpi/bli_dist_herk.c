@@ -0,0 +1,344 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "bli_dist.h"
+
+//
+// C := beta * C + alpha * A * A^H, computed as in SUMMA (see
+// bli_dist_gemm.c), except that the B operand of each step, ( A_s )^H, is
+// not stored anywhere and must be formed from the panel A_s itself. After
+// the packed A_s has been broadcast within each process row, every process
+// extracts the rows of A_s that correspond to the local columns of C held
+// by its process column, and an allgather within each process column then
+// gives every process all of the rows it needs. Micro-tiles of C that lie
+// entirely outside of the uploc triangle are skipped.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+static void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploc, \
+       dim_t   m, \
+       dim_t   n, \
+       void*   beta0, \
+       void*   c0, inc_t cs_c, \
+       dim_t*  gi, \
+       dim_t*  gj \
+     ) \
+{ \
+	ctype* restrict beta = beta0; \
+	ctype* restrict c    = c0; \
+	dim_t           i, j; \
+\
+	for ( j = 0; j < n; ++j ) \
+	for ( i = 0; i < m; ++i ) \
+	{ \
+		ctype* restrict cij = c + i + j * cs_c; \
+\
+		if ( ( bli_is_lower( uploc ) && gi[i] < gj[j] ) || \
+		     ( bli_is_upper( uploc ) && gi[i] > gj[j] ) ) continue; \
+\
+		if ( PASTEMAC(ch,eq0)( *beta ) ) \
+		{ \
+			PASTEMAC(ch,set0s)( *cij ); \
+		} \
+		else if ( !PASTEMAC(ch,eq1)( *beta ) ) \
+		{ \
+			PASTEMAC(ch,scals)( *beta, *cij ); \
+		} \
+\
+		/* The diagonal of a Hermitian matrix is real. */ \
+		if ( gi[i] == gj[j] ) PASTEMAC(ch,seti0s)( *cij ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( dist_herk_scal )
+
+typedef void (*FUNCPTR_T)
+     (
+       uplo_t  uploc,
+       dim_t   m,
+       dim_t   n,
+       void*   beta,
+       void*   c, inc_t cs_c,
+       dim_t*  gi,
+       dim_t*  gj
+     );
+
+static FUNCPTR_T GENARRAY(ftypes_scal,dist_herk_scal);
+
+static void bli_dist_herk_post
+     (
+       dim_t            s,
+       bli_dist_obj_t*  a,
+       void*            a_p,
+       MPI_Request*     req,
+       cntx_t*          cntx
+     )
+{
+	bli_dist_grid_t* grid  = a->grid;
+	const num_t      dt    = bli_dist_obj_dt( a );
+	const dim_t      nb    = a->nb;
+	const dim_t      kb    = bli_min( nb, a->n - s * nb );
+	const dim_t      m_loc = bli_obj_length( &a->local );
+	const int        pcol  = s % grid->npcol;
+
+	if ( grid->mycol == pcol )
+		bli_dist_packa
+		(
+		  dt, BLIS_NO_CONJUGATE,
+		  m_loc, kb,
+		  bli_dist_obj_buffer_at( a, 0, ( s / grid->npcol ) * nb ),
+		  1, bli_obj_col_stride( &a->local ),
+		  a_p,
+		  cntx
+		);
+
+	MPI_Ibcast( a_p, ( int )bli_dist_packa_size( dt, m_loc, kb, cntx ),
+	            MPI_BYTE, pcol, grid->row_comm, req );
+}
+
+void bli_dist_herk
+     (
+       uplo_t          uploc,
+       obj_t*          alpha,
+       bli_dist_obj_t* a,
+       obj_t*          beta,
+       bli_dist_obj_t* c
+     )
+{
+	bli_dist_grid_t* grid  = c->grid;
+	const num_t      dt    = bli_dist_obj_dt( c );
+	const siz_t      dt_sz = bli_dt_size( dt );
+	const dim_t      nb    = c->nb;
+	const dim_t      k     = a->n;
+	const dim_t      n_blk = ( k + nb - 1 ) / nb;
+	const dim_t      m_loc = bli_obj_length( &c->local );
+	const dim_t      n_loc = bli_obj_width( &c->local );
+	const inc_t      cs_c  = bli_obj_col_stride( &c->local );
+
+	cntx_t*          cntx  = bli_gks_query_cntx();
+	rntm_t           rntm;
+	void*            buf_alpha;
+	dim_t*           gi;
+	dim_t*           gj;
+	dim_t*           sel;
+	dim_t*           dst;
+	int*             cnts;
+	int*             offs;
+	int*             cnts_b;
+	int*             offs_b;
+	dim_t            n_sel;
+	void*            a_p[2];
+	MPI_Request      reqs[2];
+	char*            w;
+	char*            y;
+	char*            z;
+	char*            x;
+	void*            b_p;
+	dim_t            i, j, l, s;
+	int              r;
+
+	if ( bli_dist_obj_dt( a ) != dt )
+		bli_check_error_code( BLIS_INCONSISTENT_DATATYPES );
+
+	if ( !bli_is_lower( uploc ) && !bli_is_upper( uploc ) )
+		bli_check_error_code( BLIS_INVALID_UPLO );
+
+	if ( c->m != c->n || a->m != c->m || a->nb != nb || a->grid != grid )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	bli_check_error_code( bli_check_real_valued_object( alpha ) );
+	bli_check_error_code( bli_check_real_valued_object( beta ) );
+
+	// Record the global indices of the local rows and columns of C.
+	gi = bli_malloc_intl( ( m_loc + 1 ) * sizeof( dim_t ) );
+	gj = bli_malloc_intl( ( n_loc + 1 ) * sizeof( dim_t ) );
+
+	for ( i = 0; i < m_loc; ++i )
+		gi[i] = bli_dist_global_index( i, nb, grid->myrow, grid->nprow );
+	for ( j = 0; j < n_loc; ++j )
+		gj[j] = bli_dist_global_index( j, nb, grid->mycol, grid->npcol );
+
+	ftypes_scal[dt]
+	(
+	  uploc, m_loc, n_loc,
+	  bli_obj_buffer_for_1x1( dt, beta ),
+	  bli_dist_obj_buffer_at( c, 0, 0 ), cs_c,
+	  gi, gj
+	);
+
+	if ( k == 0 || bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_free_intl( gi );
+		bli_free_intl( gj );
+		return;
+	}
+
+	buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	bli_thread_init_rntm( &rntm );
+
+	// The local columns of C held by my process column are the rows of
+	// A whose block index is congruent to mycol (modulo npcol). Find the
+	// ones among my local rows, and then, for each process in my process
+	// column, how many of them it holds and where each one belongs among
+	// my local columns of C.
+	sel    = bli_malloc_intl( ( m_loc + 1 ) * sizeof( dim_t ) );
+	dst    = bli_malloc_intl( ( n_loc + 1 ) * sizeof( dim_t ) );
+	cnts   = bli_malloc_intl( grid->nprow * sizeof( int ) );
+	offs   = bli_malloc_intl( grid->nprow * sizeof( int ) );
+	cnts_b = bli_malloc_intl( grid->nprow * sizeof( int ) );
+	offs_b = bli_malloc_intl( grid->nprow * sizeof( int ) );
+
+	for ( n_sel = 0, i = 0; i < m_loc; ++i )
+		if ( ( gi[i] / nb ) % grid->npcol == grid->mycol ) sel[ n_sel++ ] = i;
+
+	for ( l = 0, r = 0; r < grid->nprow; ++r )
+	{
+		const dim_t m_r = bli_dist_local_dim( c->m, nb, r, grid->nprow );
+
+		offs[r] = l;
+
+		for ( i = 0; i < m_r; ++i )
+		{
+			const dim_t g = bli_dist_global_index( i, nb, r, grid->nprow );
+			const dim_t b = g / nb;
+
+			if ( b % grid->npcol == grid->mycol )
+				dst[ l++ ] = ( b / grid->npcol ) * nb + g % nb;
+		}
+
+		cnts[r] = l - offs[r];
+	}
+
+	a_p[0] = bli_malloc_user( bli_dist_packa_size( dt, m_loc, nb, cntx ) + 1 );
+	a_p[1] = bli_malloc_user( bli_dist_packa_size( dt, m_loc, nb, cntx ) + 1 );
+	b_p    = bli_malloc_user( bli_dist_packb_size( dt, nb, n_loc, cntx ) + 1 );
+	w      = bli_malloc_user( m_loc * nb * dt_sz + 1 );
+	y      = bli_malloc_user( n_sel * nb * dt_sz + 1 );
+	z      = bli_malloc_user( n_loc * nb * dt_sz + 1 );
+	x      = bli_malloc_user( n_loc * nb * dt_sz + 1 );
+
+	bli_dist_herk_post( 0, a, a_p[0], &reqs[0], cntx );
+
+	for ( s = 0; s < n_blk; ++s )
+	{
+		const dim_t kb  = bli_min( nb, k - s * nb );
+		const int   cur = s % 2;
+		const int   nxt = ( s + 1 ) % 2;
+		const int   n_r = ( s + 1 < n_blk ? 1 : 0 );
+
+		if ( s + 1 < n_blk )
+			bli_dist_herk_post( s + 1, a, a_p[nxt], &reqs[nxt], cntx );
+
+		MPI_Wait( &reqs[cur], MPI_STATUS_IGNORE );
+
+		// Extract the selected rows of the panel into y (n_sel x kb), and
+		// gather them from every process in my process column into z, which
+		// holds one n_sel-row block per process.
+		bli_dist_unpacka( dt, m_loc, kb, a_p[cur], w, 1, m_loc, cntx );
+
+		for ( l = 0; l < kb; ++l )
+		for ( i = 0; i < n_sel; ++i )
+			memcpy( y + ( i + l * n_sel ) * dt_sz,
+			        w + ( sel[i] + l * m_loc ) * dt_sz, dt_sz );
+
+		for ( r = 0; r < grid->nprow; ++r )
+		{
+			cnts_b[r] = ( int )( cnts[r] * kb * dt_sz );
+			offs_b[r] = ( int )( offs[r] * kb * dt_sz );
+		}
+
+		MPI_Allgatherv( y, ( int )( n_sel * kb * dt_sz ), MPI_BYTE,
+		                z, cnts_b, offs_b, MPI_BYTE, grid->col_comm );
+
+		// Put the gathered rows in the order of my local columns of C (as
+		// the n_loc x kb matrix x), and then pack x^H as the B operand.
+		for ( r = 0; r < grid->nprow; ++r )
+		{
+			char* z_r = z + offs_b[r];
+
+			for ( l = 0; l < kb; ++l )
+			for ( i = 0; i < cnts[r]; ++i )
+				memcpy( x + ( dst[ offs[r] + i ] + l * n_loc ) * dt_sz,
+				        z_r + ( i + l * cnts[r] ) * dt_sz, dt_sz );
+		}
+
+		bli_dist_packb( dt, BLIS_CONJUGATE, kb, n_loc, x, n_loc, 1, b_p, cntx );
+
+		bli_dist_gemm_ker
+		(
+		  dt, uploc,
+		  m_loc, n_loc, kb,
+		  buf_alpha,
+		  a_p[cur],
+		  b_p,
+		  bli_dist_obj_buffer_at( c, 0, 0 ), cs_c,
+		  gi, gj,
+		  &reqs[nxt], n_r,
+		  cntx,
+		  &rntm
+		);
+	}
+
+	// Clear the imaginary parts that rounding may have left on the
+	// diagonal.
+	ftypes_scal[dt]
+	(
+	  uploc, m_loc, n_loc,
+	  bli_obj_buffer_for_1x1( dt, &BLIS_ONE ),
+	  bli_dist_obj_buffer_at( c, 0, 0 ), cs_c,
+	  gi, gj
+	);
+
+	bli_free_user( a_p[0] );
+	bli_free_user( a_p[1] );
+	bli_free_user( b_p );
+	bli_free_user( w );
+	bli_free_user( y );
+	bli_free_user( z );
+	bli_free_user( x );
+
+	bli_free_intl( gi );
+	bli_free_intl( gj );
+	bli_free_intl( sel );
+	bli_free_intl( dst );
+	bli_free_intl( cnts );
+	bli_free_intl( offs );
+	bli_free_intl( cnts_b );
+	bli_free_intl( offs_b );
+}
+
@@ -0,0 +1,518 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "bli_dist.h"
+
+// The local matrices are column-stored, so if the gemm micro-kernel prefers
+// to access C by rows, we compute C^T := C^T + B^T A^T instead. In that
+// case the panels of A are packed with the NR register blocksize (as "B"
+// operands) and those of B with MR.
+static bool_t bli_dist_ker_swaps( num_t dt, cntx_t* cntx )
+{
+	return bli_cntx_l3_nat_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx );
+}
+
+// Compute the micro-panel stride the same way bli_packm_init() does.
+static inc_t bli_dist_ker_ps( dim_t bmult_pack, dim_t k )
+{
+	inc_t ps = bmult_pack * k;
+
+	if ( bli_is_odd( ps ) ) ps += 1;
+
+	return ps;
+}
+
+static siz_t bli_dist_pack_size
+     (
+       num_t   dt,
+       bszid_t bmult_id,
+       dim_t   dim,
+       dim_t   k,
+       cntx_t* cntx
+     )
+{
+	const dim_t bmult      = bli_cntx_get_blksz_def_dt( dt, bmult_id, cntx );
+	const dim_t bmult_pack = bli_cntx_get_blksz_max_dt( dt, bmult_id, cntx );
+	const dim_t n_panels   = ( dim + bmult - 1 ) / bmult;
+
+	return ( siz_t )n_panels * bli_dist_ker_ps( bmult_pack, k )
+	                         * bli_dt_size( dt );
+}
+
+siz_t bli_dist_packa_size( num_t dt, dim_t m, dim_t k, cntx_t* cntx )
+{
+	bszid_t bmult_id = ( bli_dist_ker_swaps( dt, cntx ) ? BLIS_NR : BLIS_MR );
+
+	return bli_dist_pack_size( dt, bmult_id, m, k, cntx );
+}
+
+siz_t bli_dist_packb_size( num_t dt, dim_t k, dim_t n, cntx_t* cntx )
+{
+	bszid_t bmult_id = ( bli_dist_ker_swaps( dt, cntx ) ? BLIS_MR : BLIS_NR );
+
+	return bli_dist_pack_size( dt, bmult_id, n, k, cntx );
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+static void PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conja, \
+       bszid_t bmult_id, \
+       dim_t   dim, \
+       dim_t   k, \
+       void*   a0, inc_t inca, inc_t lda, \
+       void*   p0, \
+       cntx_t* cntx \
+     ) \
+{ \
+	ctype* restrict a          = a0; \
+	ctype* restrict p          = p0; \
+	const num_t     dt         = PASTEMAC(ch,type); \
+	const dim_t     bmult      = bli_cntx_get_blksz_def_dt( dt, bmult_id, cntx ); \
+	const dim_t     bmult_pack = bli_cntx_get_blksz_max_dt( dt, bmult_id, cntx ); \
+	const inc_t     ps         = bli_dist_ker_ps( bmult_pack, k ); \
+\
+	ctype* restrict zero       = PASTEMAC(ch,0); \
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	dim_t           i; \
+\
+	for ( i = 0; i < dim; i += bmult ) \
+	{ \
+		ctype* restrict p1      = p + ( i / bmult ) * ps; \
+		dim_t           dim_cur = bli_min( bmult, dim - i ); \
+\
+		PASTEMAC(ch,packm_cxk) \
+		( \
+		  conja, \
+		  dim_cur, \
+		  k, \
+		  one, \
+		  a + i * inca, inca, lda, \
+		  p1,                 bmult_pack, \
+		  cntx \
+		); \
+\
+		/* Zero the unused part of the micro-panel so that the micro-kernel \
+		   may compute a full MR x NR tile. */ \
+		if ( dim_cur != bmult_pack ) \
+			PASTEMAC2(ch,setm,BLIS_TAPI_EX_SUF) \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  0, \
+			  BLIS_NONUNIT_DIAG, \
+			  BLIS_DENSE, \
+			  bmult_pack - dim_cur, \
+			  k, \
+			  zero, \
+			  p1 + dim_cur, 1, bmult_pack, \
+			  cntx, \
+			  NULL \
+			); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( dist_packm )
+
+typedef void (*FUNCPTR_T)
+     (
+       conj_t  conja,
+       bszid_t bmult_id,
+       dim_t   dim,
+       dim_t   k,
+       void*   a, inc_t inca, inc_t lda,
+       void*   p,
+       cntx_t* cntx
+     );
+
+static FUNCPTR_T GENARRAY(ftypes_packm,dist_packm);
+
+void bli_dist_packa
+     (
+       num_t   dt,
+       conj_t  conja,
+       dim_t   m,
+       dim_t   k,
+       void*   a, inc_t rs_a, inc_t cs_a,
+       void*   p,
+       cntx_t* cntx
+     )
+{
+	bszid_t bmult_id = ( bli_dist_ker_swaps( dt, cntx ) ? BLIS_NR : BLIS_MR );
+
+	ftypes_packm[dt]( conja, bmult_id, m, k, a, rs_a, cs_a, p, cntx );
+}
+
+void bli_dist_packb
+     (
+       num_t   dt,
+       conj_t  conjb,
+       dim_t   k,
+       dim_t   n,
+       void*   b, inc_t rs_b, inc_t cs_b,
+       void*   p,
+       cntx_t* cntx
+     )
+{
+	bszid_t bmult_id = ( bli_dist_ker_swaps( dt, cntx ) ? BLIS_MR : BLIS_NR );
+
+	ftypes_packm[dt]( conjb, bmult_id, n, k, b, cs_b, rs_b, p, cntx );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+static void PASTEMAC(ch,opname) \
+     ( \
+       bszid_t bmult_id, \
+       dim_t   dim, \
+       dim_t   k, \
+       void*   p0, \
+       void*   a0, inc_t inca, inc_t lda, \
+       cntx_t* cntx \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+	const dim_t     bmult      = bli_cntx_get_blksz_def_dt( dt, bmult_id, cntx ); \
+	const dim_t     bmult_pack = bli_cntx_get_blksz_max_dt( dt, bmult_id, cntx ); \
+	const inc_t     ps         = bli_dist_ker_ps( bmult_pack, k ); \
+\
+	ctype* restrict p          = p0; \
+	ctype* restrict a          = a0; \
+	dim_t           i, l; \
+\
+	for ( l = 0; l < k; ++l ) \
+	for ( i = 0; i < dim; ++i ) \
+	{ \
+		PASTEMAC(ch,copys)( *( p + ( i / bmult ) * ps + l * bmult_pack + i % bmult ), \
+		                    *( a + i * inca + l * lda ) ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( dist_unpackm )
+
+typedef void (*FUNCPTR_UNPACK_T)
+     (
+       bszid_t bmult_id,
+       dim_t   dim,
+       dim_t   k,
+       void*   p,
+       void*   a, inc_t inca, inc_t lda,
+       cntx_t* cntx
+     );
+
+static FUNCPTR_UNPACK_T GENARRAY(ftypes_unpackm,dist_unpackm);
+
+void bli_dist_unpacka
+     (
+       num_t   dt,
+       dim_t   m,
+       dim_t   k,
+       void*   p,
+       void*   a, inc_t rs_a, inc_t cs_a,
+       cntx_t* cntx
+     )
+{
+	bszid_t bmult_id = ( bli_dist_ker_swaps( dt, cntx ) ? BLIS_NR : BLIS_MR );
+
+	ftypes_unpackm[dt]( bmult_id, m, k, p, a, rs_a, cs_a, cntx );
+}
+
+// -----------------------------------------------------------------------------
+
+typedef struct
+{
+	uplo_t       uploc;
+	dim_t        m;
+	dim_t        n;
+	dim_t        k;
+	void*        alpha;
+	void*        a_p;
+	void*        b_p;
+	void*        c;
+	inc_t        rs_c;
+	inc_t        cs_c;
+	dim_t*       gi;
+	dim_t*       gj;
+	MPI_Request* reqs;
+	int          n_reqs;
+	cntx_t*      cntx;
+} bli_dist_ker_params_t;
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+static void PASTEMAC(ch,opname) \
+     ( \
+       bli_dist_ker_params_t* params, \
+       thrinfo_t*             thread \
+     ) \
+{ \
+	const num_t     dt       = PASTEMAC(ch,type); \
+	cntx_t*         cntx     = params->cntx; \
+\
+	const uplo_t    uploc    = params->uploc; \
+	const dim_t     m        = params->m; \
+	const dim_t     n        = params->n; \
+	const dim_t     k        = params->k; \
+	ctype* restrict alpha    = params->alpha; \
+	ctype* restrict a_p      = params->a_p; \
+	ctype* restrict b_p      = params->b_p; \
+	ctype* restrict c        = params->c; \
+	const inc_t     rs_c     = params->rs_c; \
+	const inc_t     cs_c     = params->cs_c; \
+	const dim_t*    gi       = params->gi; \
+	const dim_t*    gj       = params->gj; \
+\
+	const dim_t     MR       = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     NR       = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     PACKMR   = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     PACKNR   = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     MC       = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t     NC       = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+	const inc_t     ps_a     = bli_dist_ker_ps( PACKMR, k ); \
+	const inc_t     ps_b     = bli_dist_ker_ps( PACKNR, k ); \
+\
+	const bool_t    col_pref = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t     rs_ct    = ( col_pref ? 1 : NR ); \
+	const inc_t     cs_ct    = ( col_pref ? MR : 1 ); \
+\
+	ctype           ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	ctype* restrict zero     = PASTEMAC(ch,0); \
+	ctype* restrict one      = PASTEMAC(ch,1); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	dim_t           m_start, m_end; \
+	dim_t           jc, ic, jr, ir; \
+	dim_t           i, j; \
+	auxinfo_t       aux; \
+\
+	/* Each thread updates the rows of C within its own subrange of the m \
+	   dimension. */ \
+	bli_thread_get_range_sub( thread, m, MR, FALSE, &m_start, &m_end ); \
+\
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+	bli_auxinfo_set_is_a( 1, &aux ); \
+	bli_auxinfo_set_is_b( 1, &aux ); \
+\
+	for ( jc = 0; jc < n; jc += NC ) \
+	{ \
+		const dim_t jc_end = bli_min( jc + NC, n ); \
+\
+		for ( ic = m_start; ic < m_end; ic += MC ) \
+		{ \
+			const dim_t ic_end = bli_min( ic + MC, m_end ); \
+\
+			for ( jr = jc; jr < jc_end; jr += NR ) \
+			{ \
+				ctype* restrict b1    = b_p + ( jr / NR ) * ps_b; \
+				const dim_t     n_cur = bli_min( NR, jc_end - jr ); \
+\
+				for ( ir = ic; ir < ic_end; ir += MR ) \
+				{ \
+					ctype* restrict a1    = a_p + ( ir / MR ) * ps_a; \
+					ctype* restrict c11   = c + ir * rs_c + jr * cs_c; \
+					const dim_t     m_cur = bli_min( MR, ic_end - ir ); \
+					bool_t          full  = TRUE; \
+\
+					/* Skip micro-tiles that lie entirely outside the stored \
+					   triangle, and note those that straddle its edge. Since \
+					   the local-to-global index maps are increasing, only the \
+					   corners of the micro-tile need to be checked. */ \
+					if ( bli_is_lower( uploc ) ) \
+					{ \
+						if ( gi[ ir + m_cur - 1 ] < gj[ jr ] ) continue; \
+						full = ( gi[ ir ] >= gj[ jr + n_cur - 1 ] ); \
+					} \
+					else if ( bli_is_upper( uploc ) ) \
+					{ \
+						if ( gi[ ir ] > gj[ jr + n_cur - 1 ] ) continue; \
+						full = ( gi[ ir + m_cur - 1 ] <= gj[ jr ] ); \
+					} \
+\
+					bli_auxinfo_set_next_a( a1 + ps_a, &aux ); \
+					bli_auxinfo_set_next_b( b1, &aux ); \
+\
+					if ( full && m_cur == MR && n_cur == NR ) \
+					{ \
+						gemm_ukr \
+						( \
+						  k, \
+						  alpha, \
+						  a1, \
+						  b1, \
+						  one, \
+						  c11, rs_c, cs_c, \
+						  &aux, \
+						  cntx \
+						); \
+						continue; \
+					} \
+\
+					gemm_ukr \
+					( \
+					  k, \
+					  alpha, \
+					  a1, \
+					  b1, \
+					  zero, \
+					  ct, rs_ct, cs_ct, \
+					  &aux, \
+					  cntx \
+					); \
+\
+					if ( full ) \
+					{ \
+						PASTEMAC(ch,xpbys_mxn)( m_cur, n_cur, \
+						                        ct,  rs_ct, cs_ct, \
+						                        one, \
+						                        c11, rs_c,  cs_c ); \
+						continue; \
+					} \
+\
+					/* Add only the elements that lie within the triangle. */ \
+					for ( j = 0; j < n_cur; ++j ) \
+					for ( i = 0; i < m_cur; ++i ) \
+					{ \
+						const dim_t gi_i = gi[ ir + i ]; \
+						const dim_t gj_j = gj[ jr + j ]; \
+\
+						if ( ( bli_is_lower( uploc ) && gi_i >= gj_j ) || \
+						     ( bli_is_upper( uploc ) && gi_i <= gj_j ) ) \
+							PASTEMAC(ch,adds)( *( ct  + i * rs_ct + j * cs_ct ), \
+							                   *( c11 + i * rs_c  + j * cs_c  ) ); \
+					} \
+				} \
+			} \
+\
+			/* Let pending communication make progress between blocks. Only \
+			   the calling thread may call MPI (MPI_THREAD_FUNNELED). */ \
+			if ( bli_thread_am_ochief( thread ) && params->n_reqs > 0 ) \
+			{ \
+				int flag; \
+\
+				MPI_Testall( params->n_reqs, params->reqs, &flag, \
+				             MPI_STATUSES_IGNORE ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( dist_gemm_ker_thread )
+
+typedef void (*FUNCPTR_KER_T)
+     (
+       bli_dist_ker_params_t* params,
+       thrinfo_t*             thread
+     );
+
+static FUNCPTR_KER_T GENARRAY(ftypes_ker,dist_gemm_ker_thread);
+
+typedef struct
+{
+	num_t                 dt;
+	bli_dist_ker_params_t ker;
+} bli_dist_ker_launch_t;
+
+static void bli_dist_gemm_ker_thread( void* params, thrinfo_t* thread )
+{
+	bli_dist_ker_launch_t* launch = params;
+
+	ftypes_ker[ launch->dt ]( &launch->ker, thread );
+}
+
+void bli_dist_gemm_ker
+     (
+       num_t        dt,
+       uplo_t       uploc,
+       dim_t        m,
+       dim_t        n,
+       dim_t        k,
+       void*        alpha,
+       void*        a_p,
+       void*        b_p,
+       void*        c, inc_t cs_c,
+       dim_t*       gi,
+       dim_t*       gj,
+       MPI_Request* reqs,
+       int          n_reqs,
+       cntx_t*      cntx,
+       rntm_t*      rntm
+     )
+{
+	bli_dist_ker_launch_t launch;
+	bli_dist_ker_params_t* p = &launch.ker;
+	dim_t                  n_threads;
+
+	if ( m == 0 || n == 0 || k == 0 ) return;
+
+	launch.dt   = dt;
+	p->alpha    = alpha;
+	p->k        = k;
+	p->c        = c;
+	p->reqs     = reqs;
+	p->n_reqs   = n_reqs;
+	p->cntx     = cntx;
+
+	// Compute C^T = B^T A^T if the micro-kernel prefers to access C by rows.
+	// The panels were already packed accordingly (see above).
+	if ( bli_dist_ker_swaps( dt, cntx ) )
+	{
+		p->m     = n;    p->n     = m;
+		p->a_p   = b_p;  p->b_p   = a_p;
+		p->rs_c  = cs_c; p->cs_c  = 1;
+		p->gi    = gj;   p->gj    = gi;
+		p->uploc = ( bli_is_lower( uploc ) ? BLIS_UPPER :
+		             bli_is_upper( uploc ) ? BLIS_LOWER : uploc );
+	}
+	else
+	{
+		p->m     = m;    p->n     = n;
+		p->a_p   = a_p;  p->b_p   = b_p;
+		p->rs_c  = 1;    p->cs_c  = cs_c;
+		p->gi    = gi;   p->gj    = gj;
+		p->uploc = uploc;
+	}
+
+	n_threads = bli_thread_calc_num_threads_for_work( 0, 0, rntm );
+
+	bli_thread_launch( n_threads, bli_dist_gemm_ker_thread, &launch );
+}
+
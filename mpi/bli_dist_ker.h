@@ -0,0 +1,109 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Prototypes for the local computation shared by the distributed
+// operations. Broadcast buffers hold panels that are already packed into
+// the micro-panel format expected by the gemm micro-kernel, so that every
+// process can compute its local update directly from the buffer it
+// received, without repacking.
+//
+
+// Return the size, in bytes, of the buffer needed to pack an m x k panel
+// of A (or a k x n panel of B).
+siz_t bli_dist_packa_size( num_t dt, dim_t m, dim_t k, cntx_t* cntx );
+siz_t bli_dist_packb_size( num_t dt, dim_t k, dim_t n, cntx_t* cntx );
+
+// Pack the m x k panel of A (or the k x n panel of B) at a, with the given
+// strides, into p, optionally conjugating it.
+void bli_dist_packa
+     (
+       num_t   dt,
+       conj_t  conja,
+       dim_t   m,
+       dim_t   k,
+       void*   a, inc_t rs_a, inc_t cs_a,
+       void*   p,
+       cntx_t* cntx
+     );
+
+void bli_dist_packb
+     (
+       num_t   dt,
+       conj_t  conjb,
+       dim_t   k,
+       dim_t   n,
+       void*   b, inc_t rs_b, inc_t cs_b,
+       void*   p,
+       cntx_t* cntx
+     );
+
+// Copy an m x k panel of A that was packed by bli_dist_packa() back to
+// conventional storage at a.
+void bli_dist_unpacka
+     (
+       num_t   dt,
+       dim_t   m,
+       dim_t   k,
+       void*   p,
+       void*   a, inc_t rs_a, inc_t cs_a,
+       cntx_t* cntx
+     );
+
+// Compute C := C + alpha * A * B, where A and B were packed by the
+// functions above and C is an m x n column-stored matrix. If uploc is
+// BLIS_LOWER (or BLIS_UPPER), only the elements for which gi[i] >= gj[j]
+// (or gi[i] <= gj[j]) are updated, where gi and gj map the local row and
+// column indices of C to global indices. While the local threads compute,
+// the calling thread tests the n_reqs requests in reqs so that pending
+// nonblocking communication keeps making progress.
+void bli_dist_gemm_ker
+     (
+       num_t        dt,
+       uplo_t       uploc,
+       dim_t        m,
+       dim_t        n,
+       dim_t        k,
+       void*        alpha,
+       void*        a_p,
+       void*        b_p,
+       void*        c, inc_t cs_c,
+       dim_t*       gi,
+       dim_t*       gj,
+       MPI_Request* reqs,
+       int          n_reqs,
+       cntx_t*      cntx,
+       rntm_t*      rntm
+     );
+
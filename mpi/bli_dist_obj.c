@@ -0,0 +1,160 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "bli_dist.h"
+
+void bli_dist_obj_create
+     (
+       num_t            dt,
+       dim_t            m,
+       dim_t            n,
+       dim_t            nb,
+       bli_dist_grid_t* grid,
+       bli_dist_obj_t*  a
+     )
+{
+	dim_t m_loc, n_loc;
+
+	if ( nb < 1 )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	m_loc = bli_dist_local_dim( m, nb, grid->myrow, grid->nprow );
+	n_loc = bli_dist_local_dim( n, nb, grid->mycol, grid->npcol );
+
+	a->grid = grid;
+	a->m    = m;
+	a->n    = n;
+	a->nb   = nb;
+
+	// The local matrix is always column-stored.
+	bli_obj_create( dt, m_loc, n_loc, 1, bli_max( m_loc, 1 ), &a->local );
+}
+
+void bli_dist_obj_free
+     (
+       bli_dist_obj_t*  a
+     )
+{
+	bli_obj_free( &a->local );
+}
+
+// -----------------------------------------------------------------------------
+
+// Apply f to every pair of corresponding nb x nb (or smaller) blocks of the
+// global matrix g and the local matrix of a.
+static void bli_dist_obj_foreach_block
+     (
+       obj_t*           g,
+       bli_dist_obj_t*  a,
+       void           (*f)( obj_t* g_blk, obj_t* a_blk )
+     )
+{
+	bli_dist_grid_t* grid  = a->grid;
+	const dim_t      nb    = a->nb;
+	const dim_t      m_loc = bli_obj_length( &a->local );
+	const dim_t      n_loc = bli_obj_width( &a->local );
+	dim_t            il, jl;
+
+	if ( bli_obj_length( g ) != a->m || bli_obj_width( g ) != a->n )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	for ( jl = 0; jl < n_loc; jl += nb )
+	{
+		const dim_t jg    = bli_dist_global_index( jl, nb, grid->mycol, grid->npcol );
+		const dim_t n_blk = bli_min( nb, n_loc - jl );
+
+		for ( il = 0; il < m_loc; il += nb )
+		{
+			const dim_t ig    = bli_dist_global_index( il, nb, grid->myrow, grid->nprow );
+			const dim_t m_blk = bli_min( nb, m_loc - il );
+			obj_t       g_blk, a_blk;
+
+			bli_acquire_mpart( ig, jg, m_blk, n_blk, g,         &g_blk );
+			bli_acquire_mpart( il, jl, m_blk, n_blk, &a->local, &a_blk );
+
+			f( &g_blk, &a_blk );
+		}
+	}
+}
+
+static void bli_dist_obj_copy_blk_from( obj_t* g_blk, obj_t* a_blk )
+{
+	bli_copym( g_blk, a_blk );
+}
+
+static void bli_dist_obj_copy_blk_to( obj_t* g_blk, obj_t* a_blk )
+{
+	bli_copym( a_blk, g_blk );
+}
+
+void bli_dist_obj_copy_from_global
+     (
+       obj_t*           g,
+       bli_dist_obj_t*  a
+     )
+{
+	// Every process holds all of g, so no communication is needed.
+	bli_dist_obj_foreach_block( g, a, bli_dist_obj_copy_blk_from );
+}
+
+void bli_dist_obj_copy_to_global
+     (
+       bli_dist_obj_t*  a,
+       obj_t*           g
+     )
+{
+	const num_t  dt   = bli_obj_dt( g );
+	MPI_Datatype type = ( bli_is_double_prec( dt ) ? MPI_DOUBLE : MPI_FLOAT );
+	int          count;
+
+	// The elements of g are summed across processes, so g must be stored
+	// contiguously by columns.
+	if ( !bli_obj_is_col_stored( g ) ||
+	     bli_obj_col_stride( g ) != bli_obj_length( g ) )
+		bli_check_error_code( BLIS_INVALID_COL_STRIDE );
+
+	// Every element of g is owned by exactly one process. Each process
+	// writes its own elements into an otherwise zero matrix, and the
+	// matrices are then summed.
+	bli_setm( &BLIS_ZERO, g );
+
+	bli_dist_obj_foreach_block( g, a, bli_dist_obj_copy_blk_to );
+
+	count = ( int )( bli_obj_length( g ) * bli_obj_width( g ) );
+	if ( bli_is_complex( dt ) ) count *= 2;
+
+	MPI_Allreduce( MPI_IN_PLACE, bli_obj_buffer( g ), count, type,
+	               MPI_SUM, a->grid->comm );
+}
+
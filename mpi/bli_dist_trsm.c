@@ -0,0 +1,251 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "bli_dist.h"
+
+//
+// B := alpha * inv( A ) * B, for A lower (upper) triangular, proceeds one
+// diagonal block at a time, from the top-left (bottom-right) corner:
+//
+//   1. The process holding the diagonal block A11 broadcasts it within
+//      its process row, and that process row solves A11 * X1 = B1 for its
+//      part of the current block row B1 of B.
+//   2. Each process in that row packs its part of the solution X1 into NR
+//      micro-panels and broadcasts it within its process column.
+//   3. The process column holding the block column of A below (above) A11
+//      packs its part of that panel into MR micro-panels and broadcasts it
+//      within each process row, and every process updates its part of the
+//      remaining rows of B with B2 := B2 - A21 * X1 (B0 := B0 - A01 * X1).
+//
+// The panel of A used in step 3 does not depend on B, so the panel for
+// the next block is broadcast while the current update is computed.
+//
+
+// Return the block index of the s-th step.
+static dim_t bli_dist_trsm_blk( uplo_t uploa, dim_t s, dim_t n_blk )
+{
+	return ( bli_is_lower( uploa ) ? s : n_blk - 1 - s );
+}
+
+// Find the range of local rows updated at the step for block blk.
+static void bli_dist_trsm_rows
+     (
+       uplo_t          uploa,
+       dim_t           blk,
+       bli_dist_obj_t* b,
+       dim_t*          i_start,
+       dim_t*          i_end
+     )
+{
+	bli_dist_grid_t* grid = b->grid;
+	const dim_t      nb   = b->nb;
+
+	if ( bli_is_lower( uploa ) )
+	{
+		*i_start = bli_dist_local_dim( bli_min( ( blk + 1 ) * nb, b->m ), nb,
+		                               grid->myrow, grid->nprow );
+		*i_end   = bli_obj_length( &b->local );
+	}
+	else
+	{
+		*i_start = 0;
+		*i_end   = bli_dist_local_dim( blk * nb, nb, grid->myrow, grid->nprow );
+	}
+}
+
+static void bli_dist_trsm_post
+     (
+       uplo_t           uploa,
+       dim_t            blk,
+       bli_dist_obj_t*  a,
+       bli_dist_obj_t*  b,
+       void*            a_p,
+       MPI_Request*     req,
+       cntx_t*          cntx
+     )
+{
+	bli_dist_grid_t* grid = a->grid;
+	const num_t      dt   = bli_dist_obj_dt( a );
+	const dim_t      nb   = a->nb;
+	const dim_t      kb   = bli_min( nb, a->n - blk * nb );
+	const int        pcol = blk % grid->npcol;
+	dim_t            i_start, i_end;
+
+	bli_dist_trsm_rows( uploa, blk, b, &i_start, &i_end );
+
+	if ( grid->mycol == pcol )
+		bli_dist_packa
+		(
+		  dt, BLIS_NO_CONJUGATE,
+		  i_end - i_start, kb,
+		  bli_dist_obj_buffer_at( a, i_start, ( blk / grid->npcol ) * nb ),
+		  1, bli_obj_col_stride( &a->local ),
+		  a_p,
+		  cntx
+		);
+
+	MPI_Ibcast( a_p, ( int )bli_dist_packa_size( dt, i_end - i_start, kb, cntx ),
+	            MPI_BYTE, pcol, grid->row_comm, req );
+}
+
+void bli_dist_trsm
+     (
+       uplo_t          uploa,
+       diag_t          diaga,
+       obj_t*          alpha,
+       bli_dist_obj_t* a,
+       bli_dist_obj_t* b
+     )
+{
+	bli_dist_grid_t* grid  = b->grid;
+	const num_t      dt    = bli_dist_obj_dt( b );
+	const siz_t      dt_sz = bli_dt_size( dt );
+	const dim_t      nb    = b->nb;
+	const dim_t      m     = b->m;
+	const dim_t      n_blk = ( m + nb - 1 ) / nb;
+	const dim_t      m_loc = bli_obj_length( &b->local );
+	const dim_t      n_loc = bli_obj_width( &b->local );
+
+	cntx_t*          cntx  = bli_gks_query_cntx();
+	rntm_t           rntm;
+	void*            a_p[2];
+	MPI_Request      reqs[2];
+	MPI_Request      req_b;
+	void*            a11;
+	void*            b_p;
+	dim_t            s;
+
+	if ( bli_dist_obj_dt( a ) != dt )
+		bli_check_error_code( BLIS_INCONSISTENT_DATATYPES );
+
+	if ( !bli_is_lower( uploa ) && !bli_is_upper( uploa ) )
+		bli_check_error_code( BLIS_INVALID_UPLO );
+
+	if ( a->m != a->n || a->m != m || a->nb != nb || a->grid != grid )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	bli_scalm( alpha, &b->local );
+
+	if ( m == 0 || b->n == 0 ) return;
+
+	bli_thread_init_rntm( &rntm );
+
+	a_p[0] = bli_malloc_user( bli_dist_packa_size( dt, m_loc, nb, cntx ) + 1 );
+	a_p[1] = bli_malloc_user( bli_dist_packa_size( dt, m_loc, nb, cntx ) + 1 );
+	b_p    = bli_malloc_user( bli_dist_packb_size( dt, nb, n_loc, cntx ) + 1 );
+	a11    = bli_malloc_user( nb * nb * dt_sz );
+
+	bli_dist_trsm_post( uploa, bli_dist_trsm_blk( uploa, 0, n_blk ),
+	                    a, b, a_p[0], &reqs[0], cntx );
+
+	for ( s = 0; s < n_blk; ++s )
+	{
+		const dim_t blk  = bli_dist_trsm_blk( uploa, s, n_blk );
+		const dim_t kb   = bli_min( nb, m - blk * nb );
+		const int   prow = blk % grid->nprow;
+		const int   pcol = blk % grid->npcol;
+		const int   cur  = s % 2;
+		const int   nxt  = ( s + 1 ) % 2;
+		const int   n_r  = ( s + 1 < n_blk ? 1 : 0 );
+		dim_t       i_start, i_end;
+
+		if ( s + 1 < n_blk )
+			bli_dist_trsm_post( uploa, bli_dist_trsm_blk( uploa, s + 1, n_blk ),
+			                    a, b, a_p[nxt], &reqs[nxt], cntx );
+
+		if ( grid->myrow == prow )
+		{
+			const dim_t il = ( blk / grid->nprow ) * nb;
+			obj_t       a11_obj, a11_loc, b1;
+
+			bli_obj_create_with_attached_buffer( dt, kb, kb, a11, 1, kb, &a11_obj );
+
+			if ( grid->mycol == pcol )
+			{
+				bli_acquire_mpart( il, ( blk / grid->npcol ) * nb, kb, kb,
+				                   &a->local, &a11_loc );
+				bli_copym( &a11_loc, &a11_obj );
+			}
+
+			MPI_Bcast( a11, ( int )( kb * kb * dt_sz ), MPI_BYTE, pcol,
+			           grid->row_comm );
+
+			bli_obj_set_struc( BLIS_TRIANGULAR, &a11_obj );
+			bli_obj_set_uplo( uploa, &a11_obj );
+			bli_obj_set_diag( diaga, &a11_obj );
+
+			bli_acquire_mpart( il, 0, kb, n_loc, &b->local, &b1 );
+
+			bli_trsm( BLIS_LEFT, &BLIS_ONE, &a11_obj, &b1 );
+
+			bli_dist_packb
+			(
+			  dt, BLIS_NO_CONJUGATE,
+			  kb, n_loc,
+			  bli_dist_obj_buffer_at( b, il, 0 ),
+			  1, bli_obj_col_stride( &b->local ),
+			  b_p,
+			  cntx
+			);
+		}
+
+		MPI_Ibcast( b_p, ( int )bli_dist_packb_size( dt, kb, n_loc, cntx ),
+		            MPI_BYTE, prow, grid->col_comm, &req_b );
+
+		MPI_Wait( &req_b, MPI_STATUS_IGNORE );
+		MPI_Wait( &reqs[cur], MPI_STATUS_IGNORE );
+
+		bli_dist_trsm_rows( uploa, blk, b, &i_start, &i_end );
+
+		bli_dist_gemm_ker
+		(
+		  dt, BLIS_DENSE,
+		  i_end - i_start, n_loc, kb,
+		  bli_obj_buffer_for_1x1( dt, &BLIS_MINUS_ONE ),
+		  a_p[cur],
+		  b_p,
+		  bli_dist_obj_buffer_at( b, i_start, 0 ), bli_obj_col_stride( &b->local ),
+		  NULL, NULL,
+		  &reqs[nxt], n_r,
+		  cntx,
+		  &rntm
+		);
+	}
+
+	bli_free_user( a_p[0] );
+	bli_free_user( a_p[1] );
+	bli_free_user( b_p );
+	bli_free_user( a11 );
+}
+
@@ -0,0 +1,206 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "bli_dist.h"
+
+// Broadcast the contents of the contiguous, column-stored matrix a from
+// rank 0 to every other process.
+static void bcast_global( obj_t* a )
+{
+	MPI_Bcast( bli_obj_buffer( a ),
+	           ( int )( bli_obj_length( a ) * bli_obj_width( a ) *
+	                    bli_obj_elem_size( a ) ),
+	           MPI_BYTE, 0, MPI_COMM_WORLD );
+}
+
+int main( int argc, char** argv )
+{
+	obj_t a, b;
+	obj_t b_save, b_ref;
+	obj_t alpha;
+	obj_t norm;
+	bli_dist_grid_t grid;
+	bli_dist_obj_t  ad, bd;
+	uplo_t uploa;
+	dim_t m, n, nb;
+	dim_t p;
+	dim_t p_begin, p_end, p_inc;
+	int   m_input, n_input;
+	num_t dt;
+	int   r, n_repeats;
+	double resid, resid_i;
+
+	double dtime;
+	double dtime_save;
+	double gflops;
+
+	n_repeats = 3;
+
+	if ( argc < 7 )
+	{
+		printf( "Usage:\n" );
+		printf( "test_dist_trsm.x m n nb p_begin p_inc p_end [nprow npcol]:\n" );
+		exit( 1 );
+	}
+
+	int world_rank, provided;
+	MPI_Init_thread( NULL, NULL, MPI_THREAD_FUNNELED, &provided );
+	MPI_Comm_rank( MPI_COMM_WORLD, &world_rank );
+
+	bli_init();
+
+	m_input = strtol( argv[1], NULL, 10 );
+	n_input = strtol( argv[2], NULL, 10 );
+	nb      = strtol( argv[3], NULL, 10 );
+	p_begin = strtol( argv[4], NULL, 10 );
+	p_inc   = strtol( argv[5], NULL, 10 );
+	p_end   = strtol( argv[6], NULL, 10 );
+
+	bli_dist_grid_create( MPI_COMM_WORLD,
+	                      argc > 7 ? strtol( argv[7], NULL, 10 ) : 0,
+	                      argc > 8 ? strtol( argv[8], NULL, 10 ) : 0,
+	                      &grid );
+
+#if 1
+	dt = BLIS_DOUBLE;
+#else
+	dt = BLIS_DCOMPLEX;
+#endif
+
+	uploa = BLIS_LOWER;
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		if ( m_input < 0 ) m = p * ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p * ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( bli_dt_proj_to_real( dt ), 1, 1, 0, 0, &norm );
+
+		// The global matrices are stored contiguously on every process.
+		bli_obj_create( dt, m, m, 1, bli_max( m, 1 ), &a );
+		bli_obj_create( dt, m, n, 1, bli_max( m, 1 ), &b );
+		bli_obj_create( dt, m, n, 1, bli_max( m, 1 ), &b_save );
+		bli_obj_create( dt, m, n, 1, bli_max( m, 1 ), &b_ref );
+
+		// Make A diagonally dominant so that the solution is accurate.
+		bli_setsc( ( double )m, 0.0, &alpha );
+
+		if ( world_rank == 0 )
+		{
+			bli_randm( &a );
+			bli_randm( &b );
+			bli_setd( &alpha, &a );
+		}
+
+		bcast_global( &a );
+		bcast_global( &b );
+
+		bli_setsc(  (0.9/1.0), 0.2, &alpha );
+
+		bli_dist_obj_create( dt, m, m, nb, &grid, &ad );
+		bli_dist_obj_create( dt, m, n, nb, &grid, &bd );
+
+		bli_dist_obj_copy_from_global( &a, &ad );
+
+		dtime_save = 1.0e9;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			bli_dist_obj_copy_from_global( &b, &bd );
+
+			MPI_Barrier( MPI_COMM_WORLD );
+
+			dtime = bli_clock();
+
+			bli_dist_trsm( uploa,
+			               BLIS_NONUNIT_DIAG,
+			               &alpha,
+			               &ad,
+			               &bd );
+
+			MPI_Barrier( MPI_COMM_WORLD );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+		}
+
+		// Compare against a local solve with the same triangle of A.
+		bli_copym( &b, &b_ref );
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_uplo( uploa, &a );
+		bli_trsm( BLIS_LEFT, &alpha, &a, &b_ref );
+
+		bli_dist_obj_copy_to_global( &bd, &b_save );
+
+		bli_subm( &b_ref, &b_save );
+		bli_normfm( &b_save, &norm );
+		bli_getsc( &norm, &resid, &resid_i );
+
+		gflops = ( 1.0 * m * m * n ) / ( dtime_save * 1.0e9 );
+
+		if ( bli_is_complex( dt ) ) gflops *= 4.0;
+
+		if ( world_rank == 0 )
+		{
+			printf( "data_dist_trsm_blis" );
+			printf( "( %2lu, 1:5 ) = [ %4lu %4lu  %10.3e  %6.3f  %8.2e ];\n",
+			        ( unsigned long )(p - p_begin + 1)/p_inc + 1,
+			        ( unsigned long )m,
+			        ( unsigned long )n, dtime_save, gflops, resid );
+		}
+
+		bli_dist_obj_free( &ad );
+		bli_dist_obj_free( &bd );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &norm );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &b_save );
+		bli_obj_free( &b_ref );
+	}
+
+	bli_dist_grid_free( &grid );
+
+	bli_finalize();
+
+	MPI_Finalize();
+
+	return 0;
+}
+
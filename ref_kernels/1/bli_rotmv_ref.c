@@ -0,0 +1,120 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict param, \
+       cntx_t*  restrict cntx  \
+     ) \
+{ \
+	ctype* restrict chi1; \
+	ctype* restrict psi1; \
+	ctype_r         flag; \
+	ctype_r         h11, h21, h12, h22; \
+	ctype           chi1t; \
+	dim_t           i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* The parameter vector follows the BLAS rotm convention: param[0]
+	   is a flag that determines which elements of the 2x2 modified
+	   Givens matrix H are read from param[1..4] (stored column-wise)
+	   and which are implied:
+	     flag = -2:  H = [ 1    0   ;   0    1   ]
+	     flag = -1:  H = [ h11  h12 ;   h21  h22 ]
+	     flag =  0:  H = [ 1    h12 ;   h21  1   ]
+	     flag =  1:  H = [ h11  1   ;  -1    h22 ]  */ \
+	flag = param[0]; \
+\
+	if ( flag == -2.0 ) return; \
+\
+	if ( flag < 0.0 ) \
+	{ \
+		h11 = param[1]; h21 = param[2]; \
+		h12 = param[3]; h22 = param[4]; \
+	} \
+	else if ( flag == 0.0 ) \
+	{ \
+		h11 = 1.0;      h21 = param[2]; \
+		h12 = param[3]; h22 = 1.0; \
+	} \
+	else \
+	{ \
+		h11 = param[1]; h21 = -1.0; \
+		h12 = 1.0;      h22 = param[4]; \
+	} \
+\
+	chi1 = x; \
+	psi1 = y; \
+\
+	/* Apply H to each pair of elements of x and y:
+	     x := h11 * x + h12 * y
+	     y := h21 * x + h22 * y  */ \
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( h11, chi1[i], chi1t ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h12, psi1[i], chi1t ); \
+			PASTEMAC2(chr,ch,scals)( h22, psi1[i] ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h21, chi1[i], psi1[i] ); \
+			PASTEMAC(ch,copys)( chi1t, chi1[i] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( h11, *chi1, chi1t ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h12, *psi1, chi1t ); \
+			PASTEMAC2(chr,ch,scals)( h22, *psi1 ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h21, *chi1, *psi1 ); \
+			PASTEMAC(ch,copys)( chi1t, *chi1 ); \
+\
+			chi1 += incx; \
+			psi1 += incy; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC2( rotmv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
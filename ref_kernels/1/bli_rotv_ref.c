@@ -0,0 +1,100 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict c, \
+       ctype_r* restrict s, \
+       cntx_t*  restrict cntx  \
+     ) \
+{ \
+	ctype* restrict chi1; \
+	ctype* restrict psi1; \
+	ctype_r         cv; \
+	ctype_r         sv; \
+	ctype_r         minus_sv; \
+	ctype           chi1t; \
+	dim_t           i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	cv       = *c; \
+	sv       = *s; \
+	minus_sv = -sv; \
+\
+	chi1 = x; \
+	psi1 = y; \
+\
+	/* Apply the plane rotation
+	     x :=  c * x + s * y
+	     y := -s * x + c * y
+	   where c and s are real, and thus the same rotation is applied to
+	   the real and imaginary parts when x and y are complex. */ \
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( cv, chi1[i], chi1t ); \
+			PASTEMAC3(chr,ch,ch,axpys)( sv, psi1[i], chi1t ); \
+			PASTEMAC2(chr,ch,scals)( cv, psi1[i] ); \
+			PASTEMAC3(chr,ch,ch,axpys)( minus_sv, chi1[i], psi1[i] ); \
+			PASTEMAC(ch,copys)( chi1t, chi1[i] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( cv, *chi1, chi1t ); \
+			PASTEMAC3(chr,ch,ch,axpys)( sv, *psi1, chi1t ); \
+			PASTEMAC2(chr,ch,scals)( cv, *psi1 ); \
+			PASTEMAC3(chr,ch,ch,axpys)( minus_sv, *chi1, *psi1 ); \
+			PASTEMAC(ch,copys)( chi1t, *chi1 ); \
+\
+			chi1 += incx; \
+			psi1 += incy; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC2( rotv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
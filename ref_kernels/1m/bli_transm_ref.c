@@ -0,0 +1,108 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The reference transpose kernel computes B := alpha * conja( A )^T, where A
+// is m x n and B is n x m, by traversing A and B in square tiles so that
+// the elements of each tile of B are written while the corresponding tile
+// of A is still resident in cache, regardless of how A and B are stored.
+
+#define BLIS_TRANSM_REF_TILE 16
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	const dim_t tile = BLIS_TRANSM_REF_TILE; \
+\
+	dim_t       ii, jj, i, j; \
+	dim_t       m_cur, n_cur; \
+\
+	if ( bli_zero_dim2( m, n ) ) return; \
+\
+	/* If alpha is zero, set B to zero, ignoring the contents of A (which
+	   may contain NaN or Inf). */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		for ( i = 0; i < m; ++i ) \
+		for ( j = 0; j < n; ++j ) \
+			PASTEMAC(ch,set0s)( *(b + j*rs_b + i*cs_b) ); \
+\
+		return; \
+	} \
+\
+	for ( jj = 0; jj < n; jj += tile ) \
+	{ \
+		n_cur = bli_min( tile, n - jj ); \
+\
+		for ( ii = 0; ii < m; ii += tile ) \
+		{ \
+			ctype* restrict a1 = a + ii*rs_a + jj*cs_a; \
+			ctype* restrict b1 = b + jj*rs_b + ii*cs_b; \
+\
+			m_cur = bli_min( tile, m - ii ); \
+\
+			if ( bli_is_conj( conja ) ) \
+			{ \
+				for ( j = 0; j < n_cur; ++j ) \
+				for ( i = 0; i < m_cur; ++i ) \
+					PASTEMAC3(ch,ch,ch,scal2js)( *alpha, \
+					                             *(a1 + i*rs_a + j*cs_a), \
+					                             *(b1 + j*rs_b + i*cs_b) ); \
+			} \
+			else \
+			{ \
+				for ( j = 0; j < n_cur; ++j ) \
+				for ( i = 0; i < m_cur; ++i ) \
+					PASTEMAC3(ch,ch,ch,scal2s)( *alpha, \
+					                            *(a1 + i*rs_a + j*cs_a), \
+					                            *(b1 + j*rs_b + i*cs_b) ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( transm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
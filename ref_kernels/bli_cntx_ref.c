@@ -239,6 +239,9 @@
 #undef  packm_30xk_1er_ker_name
 #define packm_30xk_1er_ker_name GENARNAME(packm_30xk_1er)
 
+#undef  transm_ker_name
+#define transm_ker_name         GENARNAME(transm)
+
 // Include the level-1m kernel API template.
 #include "bli_l1m_ker.h"
 
@@ -276,6 +279,10 @@
 #define dotxv_ker_name     GENARNAME(dotxv)
 #undef  invertv_ker_name
 #define invertv_ker_name   GENARNAME(invertv)
+#undef  rotv_ker_name
+#define rotv_ker_name      GENARNAME(rotv)
+#undef  rotmv_ker_name
+#define rotmv_ker_name     GENARNAME(rotmv)
 #undef  scalv_ker_name
 #define scalv_ker_name     GENARNAME(scalv)
 #undef  scal2v_ker_name
@@ -339,11 +346,16 @@ void GENBARNAME(cntx_init)
 	bli_blksz_init_easy( &blkszs[ BLIS_DF ],    8,    4,    4,    2 );
 	bli_blksz_init_easy( &blkszs[ BLIS_XF ],    8,    4,    4,    2 );
 
+	// The minimum number of elements given to each thread when a level-1v
+	// or level-1m operation is parallelized (roughly 512KB of each operand).
+	// Setting a value to zero disables level-1v/-1m multithreading.
+	bli_blksz_init_easy( &blkszs[ BLIS_VT ], 131072, 65536, 65536, 32768 );
+
 	// Initialize the context with the default blocksize objects and their
 	// multiples.
 	bli_cntx_set_blkszs
 	(
-	  BLIS_NAT, 11,
+	  BLIS_NAT, 12,
 	  BLIS_NC, &blkszs[ BLIS_NC ], BLIS_NR,
 	  BLIS_KC, &blkszs[ BLIS_KC ], BLIS_KR,
 	  BLIS_MC, &blkszs[ BLIS_MC ], BLIS_MR,
@@ -355,6 +367,7 @@ void GENBARNAME(cntx_init)
 	  BLIS_AF, &blkszs[ BLIS_AF ], BLIS_AF,
 	  BLIS_DF, &blkszs[ BLIS_DF ], BLIS_DF,
 	  BLIS_XF, &blkszs[ BLIS_XF ], BLIS_XF,
+	  BLIS_VT, &blkszs[ BLIS_VT ], BLIS_VT,
 	  cntx
 	);
 
@@ -411,6 +424,8 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_DOTV_KER ],    dotv_ker_name    );
 	gen_func_init( &funcs[ BLIS_DOTXV_KER ],   dotxv_ker_name   );
 	gen_func_init( &funcs[ BLIS_INVERTV_KER ], invertv_ker_name );
+	gen_func_init( &funcs[ BLIS_ROTV_KER ],    rotv_ker_name    );
+	gen_func_init( &funcs[ BLIS_ROTMV_KER ],   rotmv_ker_name   );
 	gen_func_init( &funcs[ BLIS_SCALV_KER ],   scalv_ker_name   );
 	gen_func_init( &funcs[ BLIS_SCAL2V_KER ],  scal2v_ker_name  );
 	gen_func_init( &funcs[ BLIS_SETV_KER ],    setv_ker_name    );
@@ -459,6 +474,13 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_UNPACKM_16XK_KER ], unpackm_16xk_ker_name );
 
 
+	// -- Set level-1m transpose kernels ---------------------------------------
+
+	funcs = bli_cntx_transm_kers_buf( cntx );
+
+	gen_func_init( &funcs[ BLIS_TRANSM_KER ], transm_ker_name );
+
+
 	// -- Set miscellaneous fields ---------------------------------------------
 
 	bli_cntx_set_method( BLIS_NAT, cntx );
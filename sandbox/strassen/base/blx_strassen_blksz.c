@@ -0,0 +1,71 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "blix.h"
+
+//
+// The cache blocksizes used by the ABC Strassen products. Every micro-tile
+// of every Strassen product is added into as many as four submatrices of C
+// once per rank-kc update, so the cost of updating C, relative to the
+// flops performed by the micro-kernel, is inversely proportional to kc.
+// We therefore lengthen kc by a factor of BLX_STRASSEN_KC_SCALE and shrink
+// mc and nc by the same factor, which keeps the packed blocks of A and B
+// the same size as those of the conventional implementation (and thus
+// within the same levels of cache, and the same memory pool blocks).
+//
+
+dim_t blx_strassen_mc( cntx_t* cntx )
+{
+	const dim_t MR = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MR, cntx );
+	const dim_t MC = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MC, cntx );
+
+	return bli_max( MR, ( MC / BLX_STRASSEN_KC_SCALE ) / MR * MR );
+}
+
+dim_t blx_strassen_kc( cntx_t* cntx )
+{
+	const dim_t KC = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, cntx );
+
+	return KC * BLX_STRASSEN_KC_SCALE;
+}
+
+dim_t blx_strassen_nc( cntx_t* cntx )
+{
+	const dim_t NR = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_NR, cntx );
+	const dim_t NC = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_NC, cntx );
+
+	return bli_max( NR, ( NC / BLX_STRASSEN_KC_SCALE ) / NR * NR );
+}
+
@@ -0,0 +1,309 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "blix.h"
+
+// Return the blocksize, no larger than b_max and (unless it covers all of
+// n) a multiple of b_mult, that partitions n into the fewest and most evenly
+// sized blocks. This keeps a loop from ending with a sliver of a block,
+// which would otherwise be common since Strassen submatrices are often
+// just over a multiple of the cache blocksizes (e.g. 4096 vs. 4080).
+static dim_t blx_gemm_abc_blksz
+     (
+       dim_t n,
+       dim_t b_max,
+       dim_t b_mult
+     )
+{
+	dim_t n_blk, b;
+
+	if ( n <= b_max ) return b_max;
+
+	n_blk = ( n + b_max - 1 ) / b_max;
+	b     = ( n + n_blk - 1 ) / n_blk;
+	b     = ( ( b + b_mult - 1 ) / b_mult ) * b_mult;
+
+	return bli_min( b, b_max );
+}
+
+//
+// Compute one "ABC" Strassen product:
+//
+//   C_z := C_z + c->coef[z] * alpha * ( sum_i a->coef[i] * A_i )
+//                                   * ( sum_j b->coef[j] * B_j )
+//
+// for every term z of c, where each A_i is m x k, each B_j is k x n, and
+// each C_z is m x n. This is the conventional five-loop gemm algorithm,
+// except that the sums of A and B are formed while packing (see
+// blx_dpackm_sum()), and the micro-tile computed by the micro-kernel is
+// added to every C_z before moving on, so no temporary matrices are ever
+// formed.
+//
+// Each thread calling this function computes the rows of C within its own
+// subrange of the m dimension, and the threads share the packed block of B
+// in b_pack. Since the subrange depends only on m and the number of
+// threads, consecutive products with the same dimensions update disjoint
+// regions of C from one thread to the next, which is what allows the
+// products of a Strassen level to be computed one after another without
+// synchronizing on C.
+//
+
+void blx_dgemm_abc
+     (
+       dim_t      m,
+       dim_t      n,
+       dim_t      k,
+       double     alpha,
+       blx_sum_t* a, inc_t rs_a, inc_t cs_a,
+       blx_sum_t* b, inc_t rs_b, inc_t cs_b,
+       blx_sum_t* c, inc_t rs_c, inc_t cs_c,
+       double*    a_pack,
+       double*    b_pack,
+       cntx_t*    cntx,
+       thrinfo_t* thread
+     )
+{
+	const num_t     dt       = BLIS_DOUBLE;
+
+	const dim_t     MR       = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t     NR       = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t     PACKMR   = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+	const dim_t     PACKNR   = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	const dim_t     MC_max   = blx_strassen_mc( cntx );
+	const dim_t     KC_max   = blx_strassen_kc( cntx );
+	const dim_t     NC_max   = blx_strassen_nc( cntx );
+
+	const bool_t    col_pref = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx );
+	const inc_t     rs_ct    = ( col_pref ? 1 : NR );
+	const inc_t     cs_ct    = ( col_pref ? MR : 1 );
+
+	dgemm_ukr_ft    gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+
+	double          ct[ BLIS_STACK_BUF_MAX_SIZE
+	                    / sizeof( double ) ]
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+	double* restrict zero    = bli_d0;
+	double* restrict one     = bli_d1;
+	double          alpha_c;
+	dim_t           ic_start, ic_end;
+	dim_t           jr_start, jr_end;
+	dim_t           jc, pc, ic, i, j, ii, jj, z;
+	dim_t           nc_cur, kc_cur, mc_cur;
+	dim_t           m_iter, n_iter;
+	dim_t           m_cur, n_cur;
+	inc_t           ps_a, ps_b;
+	auxinfo_t       aux;
+
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+
+	// Determine the rows of C for which this thread is responsible.
+	bli_thread_get_range_sub( thread, m, MR, FALSE, &ic_start, &ic_end );
+
+	const dim_t     MC       = blx_gemm_abc_blksz( ic_end - ic_start, MC_max, MR );
+	const dim_t     KC       = blx_gemm_abc_blksz( k, KC_max, 1 );
+	const dim_t     NC       = blx_gemm_abc_blksz( n, NC_max, NR );
+
+	for ( jc = 0; jc < n; jc += NC )
+	{
+		nc_cur = bli_min( NC, n - jc );
+		n_iter = ( nc_cur + NR - 1 ) / NR;
+
+		// Determine the micro-panels of B that this thread packs.
+		bli_thread_get_range_sub( thread, nc_cur, NR, FALSE, &jr_start, &jr_end );
+
+		for ( pc = 0; pc < k; pc += KC )
+		{
+			kc_cur = bli_min( KC, k - pc );
+
+			// Compute the micro-panel strides the same way bli_packm_init()
+			// does.
+			ps_a = PACKMR * kc_cur; if ( bli_is_odd( ps_a ) ) ps_a += 1;
+			ps_b = PACKNR * kc_cur; if ( bli_is_odd( ps_b ) ) ps_b += 1;
+
+			// Wait until every thread is finished with the previous contents
+			// of the packed block of B before overwriting it.
+			bli_thread_obarrier( thread );
+
+			for ( j = jr_start; j < jr_end; j += NR )
+			{
+				n_cur = bli_min( NR, jr_end - j );
+
+				blx_dpackm_sum
+				(
+				  n_cur, PACKNR, kc_cur,
+				  b, pc*rs_b + ( jc + j )*cs_b, cs_b, rs_b,
+				  b_pack + ( j / NR ) * ps_b,   PACKNR,
+				  cntx
+				);
+			}
+
+			bli_thread_obarrier( thread );
+
+			for ( ic = ic_start; ic < ic_end; ic += MC )
+			{
+				mc_cur = bli_min( MC, ic_end - ic );
+				m_iter = ( mc_cur + MR - 1 ) / MR;
+
+				// Pack this thread's block of A into its private buffer.
+				for ( i = 0; i < m_iter; ++i )
+				{
+					m_cur = bli_min( MR, mc_cur - i * MR );
+
+					blx_dpackm_sum
+					(
+					  m_cur, PACKMR, kc_cur,
+					  a, ( ic + i * MR )*rs_a + pc*cs_a, rs_a, cs_a,
+					  a_pack + i * ps_a,                 PACKMR,
+					  cntx
+					);
+				}
+
+				// The macro-kernel.
+				for ( j = 0; j < n_iter; ++j )
+				{
+					double* restrict b1 = b_pack + j * ps_b;
+
+					n_cur = bli_min( NR, nc_cur - j * NR );
+
+					for ( i = 0; i < m_iter; ++i )
+					{
+						double* restrict a1   = a_pack + i * ps_a;
+						double* restrict a2   = a1 + ps_a;
+						double* restrict b2   = b1;
+						const dim_t      coff = ( ic + i * MR )*rs_c +
+						                        ( jc + j * NR )*cs_c;
+
+						m_cur = bli_min( MR, mc_cur - i * MR );
+
+						// Compute the addresses of the next micro-panels of
+						// A and B.
+						if ( i == m_iter - 1 )
+						{
+							a2 = a_pack;
+							b2 = ( j == n_iter - 1 ? b_pack : b1 + ps_b );
+						}
+
+						bli_auxinfo_set_next_a( a2, &aux );
+						bli_auxinfo_set_next_b( b2, &aux );
+
+						if ( c->n_terms == 1 && m_cur == MR && n_cur == NR )
+						{
+							// With only one submatrix of C to update, the
+							// micro-kernel can accumulate into it directly.
+							alpha_c = alpha * c->coef[0];
+
+							gemm_ukr
+							(
+							  kc_cur,
+							  &alpha_c,
+							  a1,
+							  b1,
+							  one,
+							  c->buf[0] + coff, rs_c, cs_c,
+							  &aux,
+							  cntx
+							);
+						}
+						else
+						{
+							// The micro-kernel only prefetches the micro-tile
+							// it writes (ct), so prefetch the micro-tiles of C
+							// that are about to be updated while it runs.
+							for ( z = 0; z < c->n_terms; ++z )
+							{
+								double* restrict cz = c->buf[z] + coff;
+
+								if ( col_pref )
+									for ( jj = 0; jj < NR; ++jj )
+									{
+										__builtin_prefetch( cz + jj*cs_c );
+										__builtin_prefetch( cz + jj*cs_c + ( MR - 1 )*rs_c );
+									}
+								else
+									for ( ii = 0; ii < MR; ++ii )
+									{
+										__builtin_prefetch( cz + ii*rs_c );
+										__builtin_prefetch( cz + ii*rs_c + ( NR - 1 )*cs_c );
+									}
+							}
+
+							gemm_ukr
+							(
+							  kc_cur,
+							  &alpha,
+							  a1,
+							  b1,
+							  zero,
+							  ct, rs_ct, cs_ct,
+							  &aux,
+							  cntx
+							);
+
+							// Add the micro-tile into each submatrix of C
+							// while it is still in cache. The storage of C
+							// matches that of ct (see blx_dstrassen()), so
+							// the inner loop walks both with unit stride.
+							for ( z = 0; z < c->n_terms; ++z )
+							{
+								double* restrict cz    = c->buf[z] + coff;
+								const double     gamma = c->coef[z];
+
+								if ( col_pref )
+								{
+									for ( jj = 0; jj < n_cur; ++jj )
+									for ( ii = 0; ii < m_cur; ++ii )
+										cz[ ii*rs_c + jj*cs_c ] +=
+										  gamma * ct[ ii + jj*MR ];
+								}
+								else
+								{
+									for ( ii = 0; ii < m_cur; ++ii )
+									for ( jj = 0; jj < n_cur; ++jj )
+										cz[ ii*rs_c + jj*cs_c ] +=
+										  gamma * ct[ ii*NR + jj ];
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
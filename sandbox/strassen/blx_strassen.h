@@ -0,0 +1,88 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// -- Strassen depth selection -------------------------------------------------
+
+// The smallest min(m,n,k) for which one level of Strassen is applied. Below
+// this size, the native gemm implementation is used.
+#ifndef BLX_STRASSEN_ONE_LEVEL_MIN_DIM
+#define BLX_STRASSEN_ONE_LEVEL_MIN_DIM  2048
+#endif
+
+// The smallest min(m,n,k) for which two levels of Strassen are applied, or
+// zero if two levels are never applied. Two levels are disabled by default
+// since they were not faster than one level at any size measured (up to
+// 8192; see docs/Sandboxes.md).
+#ifndef BLX_STRASSEN_TWO_LEVEL_MIN_DIM
+#define BLX_STRASSEN_TWO_LEVEL_MIN_DIM  0
+#endif
+
+// The factor by which the Strassen products lengthen kc (and shorten mc and
+// nc) relative to the cache blocksizes of the conventional implementation.
+// See blx_strassen_blksz.c.
+#ifndef BLX_STRASSEN_KC_SCALE
+#define BLX_STRASSEN_KC_SCALE           2
+#endif
+
+// The deepest level of Strassen supported, and the largest number of
+// submatrices of A, B, or C that a single product may reference (two per
+// level, since no row of the Strassen coefficient table has more than two
+// nonzero entries).
+#define BLX_STRASSEN_MAX_DEPTH          2
+#define BLX_STRASSEN_MAX_TERMS          4
+
+// -- Types --------------------------------------------------------------------
+
+// A linear combination of equally-sized submatrices that share the same
+// row and column strides. One of these describes each of the (implicit)
+// operands of a Strassen product:
+//
+//   M := ( sum_i a_coef[i] * A_i ) ( sum_j b_coef[j] * B_j )
+//   C_z := C_z + c_coef[z] * alpha * M   for each z
+//
+typedef struct blx_sum_s
+{
+	dim_t   n_terms;
+	double* buf[ BLX_STRASSEN_MAX_TERMS ];
+	double  coef[ BLX_STRASSEN_MAX_TERMS ];
+} blx_sum_t;
+
+// -- Prototypes ---------------------------------------------------------------
+
+#include "blx_strassen_front.h"
+#include "blx_strassen_int.h"
+#include "blx_gemm_abc.h"
+#include "blx_packm_sum.h"
+#include "blx_strassen_blksz.h"
+
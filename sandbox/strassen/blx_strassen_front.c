@@ -0,0 +1,225 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "blix.h"
+
+static void blx_strassen_fringe
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       obj_t*  alpha,
+       double* a, inc_t rs_a, inc_t cs_a,
+       double* b, inc_t rs_b, inc_t cs_b,
+       double* c, inc_t rs_c, inc_t cs_c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+void blx_strassen_front
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	rntm_t      rntm_l;
+	dim_t       depth;
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+	depth = blx_strassen_depth( m, n, k );
+
+	// Strassen is only implemented for real double-precision operands that
+	// are large enough to amortize the extra packing work. Everything else
+	// (including the trivial alpha = 0 case) is handled by the conventional
+	// implementation.
+	if ( depth == 0 ||
+	     bli_obj_dt( a ) != BLIS_DOUBLE ||
+	     bli_obj_dt( b ) != BLIS_DOUBLE ||
+	     bli_obj_dt( c ) != BLIS_DOUBLE ||
+	     bli_obj_has_trans( c ) ||
+	     bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_gemm_front( alpha, a, b, beta, c, cntx, rntm, NULL );
+		return;
+	}
+
+	double* a_p  = bli_obj_buffer_at_off( a );
+	double* b_p  = bli_obj_buffer_at_off( b );
+	double* c_p  = bli_obj_buffer_at_off( c );
+	inc_t   rs_a = bli_obj_row_stride( a );
+	inc_t   cs_a = bli_obj_col_stride( a );
+	inc_t   rs_b = bli_obj_row_stride( b );
+	inc_t   cs_b = bli_obj_col_stride( b );
+	inc_t   rs_c = bli_obj_row_stride( c );
+	inc_t   cs_c = bli_obj_col_stride( c );
+	double  alpha_r, alpha_i;
+
+	if ( bli_obj_has_trans( a ) ) bli_swap_incs( &rs_a, &cs_a );
+	if ( bli_obj_has_trans( b ) ) bli_swap_incs( &rs_b, &cs_b );
+
+	bli_getsc( alpha, &alpha_r, &alpha_i );
+
+	// Apply beta to all of C up front. Every subsequent update (both the
+	// Strassen products and the fringe products) then simply accumulates
+	// into C.
+	if ( !bli_obj_equals( beta, &BLIS_ONE ) )
+		bli_scalm( beta, c );
+
+	// Strassen operates on the largest leading submatrices whose dimensions
+	// are divisible by 2^depth. The remaining rows, columns, and rank-k
+	// fringe are computed with conventional gemm calls.
+	const dim_t g  = ( ( dim_t )1 ) << depth;
+	const dim_t m0 = m - m % g;
+	const dim_t n0 = n - n % g;
+	const dim_t k0 = k - k % g;
+
+	// Note that we give each call its own copy of the rntm_t, since
+	// bli_gemm_front() records the ways of parallelism it settles on in
+	// the rntm_t that it is passed.
+	rntm_l = *rntm;
+
+	blx_dstrassen
+	(
+	  depth,
+	  m0, n0, k0,
+	  alpha_r,
+	  a_p, rs_a, cs_a,
+	  b_p, rs_b, cs_b,
+	  c_p, rs_c, cs_c,
+	  cntx,
+	  &rntm_l
+	);
+
+	// C(0:m0-1,0:n0-1) += alpha * A(0:m0-1,k0:k-1) * B(k0:k-1,0:n0-1)
+	if ( k0 < k )
+	{
+		rntm_l = *rntm;
+		blx_strassen_fringe
+		(
+		  m0, n0, k - k0,
+		  alpha,
+		  a_p + k0*cs_a, rs_a, cs_a,
+		  b_p + k0*rs_b, rs_b, cs_b,
+		  c_p,           rs_c, cs_c,
+		  cntx, &rntm_l
+		);
+	}
+
+	// C(m0:m-1,0:n-1) += alpha * A(m0:m-1,0:k-1) * B
+	if ( m0 < m )
+	{
+		rntm_l = *rntm;
+		blx_strassen_fringe
+		(
+		  m - m0, n, k,
+		  alpha,
+		  a_p + m0*rs_a, rs_a, cs_a,
+		  b_p,           rs_b, cs_b,
+		  c_p + m0*rs_c, rs_c, cs_c,
+		  cntx, &rntm_l
+		);
+	}
+
+	// C(0:m0-1,n0:n-1) += alpha * A(0:m0-1,0:k-1) * B(0:k-1,n0:n-1)
+	if ( n0 < n )
+	{
+		rntm_l = *rntm;
+		blx_strassen_fringe
+		(
+		  m0, n - n0, k,
+		  alpha,
+		  a_p,           rs_a, cs_a,
+		  b_p + n0*cs_b, rs_b, cs_b,
+		  c_p + n0*cs_c, rs_c, cs_c,
+		  cntx, &rntm_l
+		);
+	}
+}
+
+dim_t blx_strassen_depth
+     (
+       dim_t m,
+       dim_t n,
+       dim_t k
+     )
+{
+	const dim_t mnk_min = bli_min( m, bli_min( n, k ) );
+
+	// Each level of Strassen trades one eighth of the flops for extra
+	// memory traffic in the packing and micro-kernel update stages, so
+	// deeper levels are reserved for larger problems.
+	if ( BLX_STRASSEN_TWO_LEVEL_MIN_DIM > 0 &&
+	     mnk_min >= BLX_STRASSEN_TWO_LEVEL_MIN_DIM ) return 2;
+	if ( mnk_min >= BLX_STRASSEN_ONE_LEVEL_MIN_DIM ) return 1;
+
+	return 0;
+}
+
+static void blx_strassen_fringe
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       obj_t*  alpha,
+       double* a, inc_t rs_a, inc_t cs_a,
+       double* b, inc_t rs_b, inc_t cs_b,
+       double* c, inc_t rs_c, inc_t cs_c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	obj_t ao, bo, co;
+
+	bli_obj_create_with_attached_buffer( BLIS_DOUBLE, m, k, a, rs_a, cs_a, &ao );
+	bli_obj_create_with_attached_buffer( BLIS_DOUBLE, k, n, b, rs_b, cs_b, &bo );
+	bli_obj_create_with_attached_buffer( BLIS_DOUBLE, m, n, c, rs_c, cs_c, &co );
+
+	bli_gemm_front( alpha, &ao, &bo, &BLIS_ONE, &co, cntx, rntm, NULL );
+}
+
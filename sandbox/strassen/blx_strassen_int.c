@@ -0,0 +1,305 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "blix.h"
+
+//
+// The coefficients of one level of Strassen's algorithm. The 2 x 2
+// partitions of A, B, and C are indexed in row-major order (0 = top-left,
+// 1 = top-right, 2 = bottom-left, 3 = bottom-right), and product r is
+//
+//   M_r := ( sum_q u[r][q] A_q ) ( sum_q v[r][q] B_q )
+//   C_q := C_q + w[r][q] M_r
+//
+// Two levels are obtained by applying the same table to each 2 x 2 block
+// of the partitions, i.e. product ( r1, r2 ) uses the Kronecker product of
+// rows r1 and r2 of each table.
+//
+
+static const double blx_strassen_u[7][4] =
+{
+	{  1,  0,  0,  1 },
+	{  0,  0,  1,  1 },
+	{  1,  0,  0,  0 },
+	{  0,  0,  0,  1 },
+	{  1,  1,  0,  0 },
+	{ -1,  0,  1,  0 },
+	{  0,  1,  0, -1 },
+};
+
+static const double blx_strassen_v[7][4] =
+{
+	{  1,  0,  0,  1 },
+	{  1,  0,  0,  0 },
+	{  0,  1,  0, -1 },
+	{ -1,  0,  1,  0 },
+	{  0,  0,  0,  1 },
+	{  1,  1,  0,  0 },
+	{  0,  0,  1,  1 },
+};
+
+static const double blx_strassen_w[7][4] =
+{
+	{  1,  0,  0,  1 },
+	{  0,  0,  1, -1 },
+	{  0,  1,  0,  1 },
+	{  1,  0,  1,  0 },
+	{ -1,  1,  0,  0 },
+	{  0,  0,  0,  1 },
+	{  1,  0,  0,  0 },
+};
+
+typedef struct
+{
+	dim_t   depth;
+	dim_t   m;
+	dim_t   n;
+	dim_t   k;
+	double  alpha;
+	double* a; inc_t rs_a; inc_t cs_a;
+	double* b; inc_t rs_b; inc_t cs_b;
+	double* c; inc_t rs_c; inc_t cs_c;
+	siz_t   a_size;
+	siz_t   b_size;
+	cntx_t* cntx;
+} blx_strassen_params_t;
+
+static void blx_strassen_sum_init
+     (
+       dim_t         depth,
+       dim_t         prod,
+       const double  tab[7][4],
+       double*       x,
+       dim_t         m_sub,
+       dim_t         n_sub,
+       inc_t         rs_x,
+       inc_t         cs_x,
+       blx_sum_t*    sum
+     )
+{
+	dim_t  rows[ BLX_STRASSEN_MAX_TERMS ];
+	dim_t  cols[ BLX_STRASSEN_MAX_TERMS ];
+	double coef[ BLX_STRASSEN_MAX_TERMS ];
+	dim_t  n_terms = 1;
+	dim_t  r, q, t, nt;
+
+	rows[0] = 0; cols[0] = 0; coef[0] = 1.0;
+
+	// Expand the product index, one level (base-7 digit) at a time, from
+	// the outermost level inward. Each level doubles the size of the grid
+	// of blocks and refines each existing term into up to two new terms.
+	for ( dim_t level = depth - 1; 0 <= level; --level )
+	{
+		dim_t pow7 = 1;
+
+		for ( dim_t l = 0; l < level; ++l ) pow7 *= 7;
+
+		r  = ( prod / pow7 ) % 7;
+		nt = 0;
+
+		dim_t  rows_n[ BLX_STRASSEN_MAX_TERMS ];
+		dim_t  cols_n[ BLX_STRASSEN_MAX_TERMS ];
+		double coef_n[ BLX_STRASSEN_MAX_TERMS ];
+
+		for ( t = 0; t < n_terms; ++t )
+		{
+			for ( q = 0; q < 4; ++q )
+			{
+				if ( tab[r][q] == 0.0 ) continue;
+
+				rows_n[nt] = 2 * rows[t] + q / 2;
+				cols_n[nt] = 2 * cols[t] + q % 2;
+				coef_n[nt] = coef[t] * tab[r][q];
+				++nt;
+			}
+		}
+
+		n_terms = nt;
+
+		for ( t = 0; t < n_terms; ++t )
+		{
+			rows[t] = rows_n[t]; cols[t] = cols_n[t]; coef[t] = coef_n[t];
+		}
+	}
+
+	sum->n_terms = n_terms;
+
+	for ( t = 0; t < n_terms; ++t )
+	{
+		sum->buf[t]  = x + rows[t] * m_sub * rs_x + cols[t] * n_sub * cs_x;
+		sum->coef[t] = coef[t];
+	}
+}
+
+static void blx_strassen_thread
+     (
+       void*      params_void,
+       thrinfo_t* thread
+     )
+{
+	blx_strassen_params_t* params = params_void;
+
+	const dim_t depth = params->depth;
+	const dim_t g     = ( ( dim_t )1 ) << depth;
+	const dim_t m_sub = params->m / g;
+	const dim_t n_sub = params->n / g;
+	const dim_t k_sub = params->k / g;
+	cntx_t*     cntx  = params->cntx;
+	membrk_t*   membrk = bli_cntx_get_membrk( cntx );
+
+	dim_t       n_prod = 1;
+	mem_t       a_mem;
+	mem_t       b_mem;
+	mem_t*      b_mem_p;
+	blx_sum_t   a_sum, b_sum, c_sum;
+
+	for ( dim_t l = 0; l < depth; ++l ) n_prod *= 7;
+
+	// Each thread packs its own blocks of A, while the packed block of B
+	// is shared, so only the chief thread checks it out.
+	bli_membrk_acquire_m( membrk, params->a_size, BLIS_BUFFER_FOR_A_BLOCK, &a_mem );
+
+	if ( bli_thread_am_ochief( thread ) )
+		bli_membrk_acquire_m( membrk, params->b_size, BLIS_BUFFER_FOR_B_PANEL, &b_mem );
+
+	b_mem_p = bli_thread_obroadcast( thread, &b_mem );
+
+	double* a_pack = bli_mem_buffer( &a_mem );
+	double* b_pack = bli_mem_buffer( b_mem_p );
+
+	for ( dim_t prod = 0; prod < n_prod; ++prod )
+	{
+		blx_strassen_sum_init( depth, prod, blx_strassen_u, params->a,
+		                       m_sub, k_sub, params->rs_a, params->cs_a, &a_sum );
+		blx_strassen_sum_init( depth, prod, blx_strassen_v, params->b,
+		                       k_sub, n_sub, params->rs_b, params->cs_b, &b_sum );
+		blx_strassen_sum_init( depth, prod, blx_strassen_w, params->c,
+		                       m_sub, n_sub, params->rs_c, params->cs_c, &c_sum );
+
+		blx_dgemm_abc
+		(
+		  m_sub, n_sub, k_sub,
+		  params->alpha,
+		  &a_sum, params->rs_a, params->cs_a,
+		  &b_sum, params->rs_b, params->cs_b,
+		  &c_sum, params->rs_c, params->cs_c,
+		  a_pack,
+		  b_pack,
+		  cntx,
+		  thread
+		);
+	}
+
+	// Make sure every thread is done with the packed block of B before
+	// the chief thread returns it.
+	bli_thread_obarrier( thread );
+
+	bli_membrk_release( &a_mem );
+
+	if ( bli_thread_am_ochief( thread ) )
+		bli_membrk_release( &b_mem );
+}
+
+void blx_dstrassen
+     (
+       dim_t   depth,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       double  alpha,
+       double* a, inc_t rs_a, inc_t cs_a,
+       double* b, inc_t rs_b, inc_t cs_b,
+       double* c, inc_t rs_c, inc_t cs_c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const num_t dt = BLIS_DOUBLE;
+
+	blx_strassen_params_t params;
+	dim_t                 n_threads;
+
+	if ( m == 0 || n == 0 || k == 0 ) return;
+
+	// As in bli_gemm_front(), if the micro-kernel dislikes the storage of
+	// C, compute C^T = B^T A^T instead so that the micro-kernel accesses
+	// C in its preferred manner. (This simply applies Strassen to the
+	// transposed problem.)
+	if ( ( bli_is_row_stored( rs_c, cs_c ) &&
+	       bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ) ) ||
+	     ( bli_is_col_stored( rs_c, cs_c ) &&
+	       bli_cntx_l3_nat_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx ) ) )
+	{
+		double* a_t  = a;    dim_t m_t    = m;
+		inc_t   rs_t = rs_a; inc_t cs_t   = cs_a;
+
+		a    = b;    b    = a_t;
+		m    = n;    n    = m_t;
+		rs_a = cs_b; cs_a = rs_b;
+		rs_b = cs_t; cs_b = rs_t;
+
+		bli_swap_incs( &rs_c, &cs_c );
+	}
+
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	const dim_t MC     = blx_strassen_mc( cntx );
+	const dim_t KC     = blx_strassen_kc( cntx );
+	const dim_t NC     = blx_strassen_nc( cntx );
+
+	params.depth  = depth;
+	params.m      = m;
+	params.n      = n;
+	params.k      = k;
+	params.alpha  = alpha;
+	params.a      = a; params.rs_a = rs_a; params.cs_a = cs_a;
+	params.b      = b; params.rs_b = rs_b; params.cs_b = cs_b;
+	params.c      = c; params.rs_c = rs_c; params.cs_c = cs_c;
+	params.cntx   = cntx;
+
+	// Size the packing buffers for full MC x KC and KC x NC blocks, with
+	// room for each micro-panel stride to be rounded up to an even number.
+	params.a_size = ( ( MC + MR - 1 ) / MR ) * ( PACKMR * KC + 1 ) * sizeof( double );
+	params.b_size = ( ( NC + NR - 1 ) / NR ) * ( PACKNR * KC + 1 ) * sizeof( double );
+
+	// Every thread computes a share of each product, so the number of
+	// threads is simply the total requested via the rntm_t.
+	n_threads = bli_thread_calc_num_threads_for_work( 0, 0, rntm );
+
+	bli_thread_launch( n_threads, blx_strassen_thread, &params );
+}
+
@@ -0,0 +1,170 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "blix.h"
+
+// Sum the n_terms of x into an m x n region of p, walking the n dimension
+// in the inner loop. (Unused terms are never referenced, so that an Inf or
+// NaN in one submatrix cannot leak into the sum via a zero coefficient.)
+static inline void blx_dpackm_sum_2d
+     (
+       dim_t      m,
+       dim_t      n,
+       blx_sum_t* x, dim_t off, inc_t rs_x, inc_t cs_x,
+       double*    p,            inc_t rs_p, inc_t cs_p
+     )
+{
+	const dim_t      n_terms = x->n_terms;
+	double* restrict x0      = x->buf[0] + off;
+	double* restrict x1      = x->buf[1] + off;
+	double* restrict x2      = ( n_terms > 2 ? x->buf[2] + off : NULL );
+	double* restrict x3      = ( n_terms > 3 ? x->buf[3] + off : NULL );
+	const double     k0      = x->coef[0];
+	const double     k1      = x->coef[1];
+	const double     k2      = ( n_terms > 2 ? x->coef[2] : 0.0 );
+	const double     k3      = ( n_terms > 3 ? x->coef[3] : 0.0 );
+	dim_t            i, j;
+
+	for ( i = 0; i < m; ++i )
+	{
+		double* restrict pi = p + i*rs_p;
+		const dim_t      oi = i*rs_x;
+
+		switch ( n_terms )
+		{
+			case 2:
+			for ( j = 0; j < n; ++j )
+				pi[j*cs_p] = k0 * x0[oi + j*cs_x] +
+				             k1 * x1[oi + j*cs_x];
+			break;
+
+			case 3:
+			for ( j = 0; j < n; ++j )
+				pi[j*cs_p] = k0 * x0[oi + j*cs_x] +
+				             k1 * x1[oi + j*cs_x] +
+				             k2 * x2[oi + j*cs_x];
+			break;
+
+			default:
+			for ( j = 0; j < n; ++j )
+				pi[j*cs_p] = k0 * x0[oi + j*cs_x] +
+				             k1 * x1[oi + j*cs_x] +
+				             k2 * x2[oi + j*cs_x] +
+				             k3 * x3[oi + j*cs_x];
+			break;
+		}
+	}
+}
+
+//
+// Pack a linear combination of submatrices into a single micro-panel:
+//
+//   P := sum_t x->coef[t] * X_t
+//
+// where each X_t is the panel_dim x panel_len submatrix that begins off
+// elements into x->buf[t] and has strides incx (along the panel dimension)
+// and ldx (along the panel length). The rows of P beyond panel_dim, up to
+// panel_dim_max, are set to zero so that the micro-kernel may always
+// compute a full micro-tile. This is how the Strassen additions of A and B
+// are folded into packing: each source element is read once and the packed
+// micro-panel is written once, with no temporary sum matrix.
+//
+
+void blx_dpackm_sum
+     (
+       dim_t      panel_dim,
+       dim_t      panel_dim_max,
+       dim_t      panel_len,
+       blx_sum_t* x, dim_t off, inc_t incx, inc_t ldx,
+       double*    p,                        inc_t ldp,
+       cntx_t*    cntx
+     )
+{
+	const dim_t        n_terms = x->n_terms;
+	double*   restrict x0      = x->buf[0] + off;
+	double             kappa0  = x->coef[0];
+	dim_t              i, l;
+
+	if ( n_terms == 1 )
+	{
+		// A single term is just a scaled copy, which the packm kernels
+		// registered in the context already handle.
+		bli_dpackm_cxk
+		(
+		  BLIS_NO_CONJUGATE,
+		  panel_dim,
+		  panel_len,
+		  &kappa0,
+		  x0, incx, ldx,
+		  p,        ldp,
+		  cntx
+		);
+	}
+	else
+	{
+		// Otherwise, sum the terms element by element so that each element
+		// of the micro-panel is written exactly once. The helper is inlined
+		// below with unit inner strides wherever possible so that the
+		// compiler can vectorize the inner loop.
+		if ( incx == 1 )
+		{
+			// The panel dimension is contiguous in memory, so fill one
+			// column of the micro-panel at a time.
+			blx_dpackm_sum_2d( panel_len, panel_dim, x, off, ldx, 1,
+			                   p, ldp, 1 );
+		}
+		else if ( ldx == 1 )
+		{
+			// The panel length is contiguous in memory, so fill one row
+			// of the micro-panel at a time.
+			blx_dpackm_sum_2d( panel_dim, panel_len, x, off, incx, 1,
+			                   p, 1, ldp );
+		}
+		else
+		{
+			blx_dpackm_sum_2d( panel_dim, panel_len, x, off, incx, ldx,
+			                   p, 1, ldp );
+		}
+	}
+
+	// Zero the unused rows of the micro-panel.
+	if ( panel_dim < panel_dim_max )
+	{
+		for ( l = 0; l < panel_len; ++l )
+			for ( i = panel_dim; i < panel_dim_max; ++i )
+				p[i + l*ldp] = 0.0;
+	}
+}
+
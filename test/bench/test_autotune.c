@@ -0,0 +1,239 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The number of candidate values tried for each cache blocksize.
+#define N_CAND 8
+
+// Time gemm on square m = n = k problems using the given context, returning
+// the best performance (in GFLOPS) over n_repeats trials.
+static double time_gemm( num_t dt, dim_t p, dim_t n_repeats, cntx_t* cntx )
+{
+	obj_t  a, b, c;
+	double dtime_save = 1.0e9;
+	double gflops;
+	dim_t  r;
+
+	bli_obj_create( dt, p, p, 0, 0, &a );
+	bli_obj_create( dt, p, p, 0, 0, &b );
+	bli_obj_create( dt, p, p, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		bli_gemmnat( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, cntx, NULL );
+
+		dtime_save = bli_clock_min_diff( dtime_save, dtime );
+	}
+
+	gflops = ( 2.0 * p * p * p ) / ( dtime_save * 1.0e9 );
+
+	if ( bli_is_complex( dt ) ) gflops *= 4.0;
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return gflops;
+}
+
+// Fill cand with up to N_CAND multiples of mult, spread over [lo,hi]. The
+// current value is always included.
+static dim_t make_cands( dim_t cur, dim_t mult, dim_t lo, dim_t hi, dim_t* cand )
+{
+	dim_t n = 0;
+	dim_t i;
+
+	cand[ n++ ] = cur;
+
+	for ( i = 0; i < N_CAND - 1; ++i )
+	{
+		dim_t v = lo + ( i * ( hi - lo ) ) / ( N_CAND - 2 );
+
+		v = bli_max( ( v / mult ) * mult, mult );
+
+		if ( v != cur && ( n == 1 || v != cand[ n - 1 ] ) ) cand[ n++ ] = v;
+	}
+
+	return n;
+}
+
+// Search for the value of blocksize bs_id that maximizes performance,
+// holding the other blocksizes fixed, and store it in the context.
+static double tune_blksz
+     (
+       num_t   dt,
+       bszid_t bs_id,
+       dim_t   mult,
+       dim_t   lo,
+       dim_t   hi,
+       dim_t   p,
+       dim_t   n_repeats,
+       cntx_t* cntx
+     )
+{
+	blksz_t* blksz    = bli_cntx_get_blksz( bs_id, cntx );
+	dim_t    cur      = bli_blksz_get_def( dt, blksz );
+	dim_t    best     = cur;
+	double   best_gf  = 0.0;
+	dim_t    cand[ N_CAND ];
+	dim_t    n_cand   = make_cands( cur, mult, lo, hi, cand );
+	dim_t    i;
+
+	for ( i = 0; i < n_cand; ++i )
+	{
+		double gf;
+
+		bli_blksz_set_def( cand[ i ], dt, blksz );
+		bli_blksz_set_max( cand[ i ], dt, blksz );
+
+		gf = time_gemm( dt, p, n_repeats, cntx );
+
+		if ( gf > best_gf ) { best_gf = gf; best = cand[ i ]; }
+	}
+
+	bli_blksz_set_def( best, dt, blksz );
+	bli_blksz_set_max( best, dt, blksz );
+
+	return best_gf;
+}
+
+static dim_t lcm( dim_t a, dim_t b )
+{
+	dim_t x = a, y = b;
+
+	while ( y != 0 ) { dim_t t = x % y; x = y; y = t; }
+
+	return ( a / x ) * b;
+}
+
+int main( int argc, char** argv )
+{
+	char*   dts       = "sdcz";
+	dim_t   p         = 1600;
+	dim_t   n_repeats = 3;
+	char*   arch_str;
+	cntx_t* cntx_nat;
+
+	if ( argc > 1 && strcmp( argv[1], "-h" ) == 0 )
+	{
+		printf( "\n" );
+		printf( " %s [dts [p [n_repeats]]]\n", argv[0] );
+		printf( "\n" );
+		printf( "  Search for the cache blocksizes MC, KC, and NC that maximize\n" );
+		printf( "  gemm performance on this machine, and print them in the\n" );
+		printf( "  format read via the BLIS_BLKSZ_FILE environment variable.\n" );
+		printf( "\n" );
+		printf( "  dts:       the datatypes to tune (default: sdcz).\n" );
+		printf( "  p:         the problem size m = n = k (default: 1600).\n" );
+		printf( "  n_repeats: the number of trials per measurement (default: 3).\n" );
+		printf( "\n" );
+		printf( "  The number of threads is taken from the BLIS_NUM_THREADS\n" );
+		printf( "  (or related) environment variables.\n" );
+		printf( "\n" );
+
+		exit(1);
+	}
+
+	if ( argc > 1 ) dts       = argv[1];
+	if ( argc > 2 ) p         = atol( argv[2] );
+	if ( argc > 3 ) n_repeats = atol( argv[3] );
+
+	bli_init();
+
+	cntx_nat = bli_gks_query_cntx();
+	arch_str = bli_arch_string( bli_arch_query_id() );
+
+	printf( "# Cache blocksizes tuned for the '%s' sub-configuration\n", arch_str );
+	printf( "# using gemm with m = n = k = %ld (best of %ld trials).\n",
+	        ( long )p, ( long )n_repeats );
+	printf( "[%s]\n", arch_str );
+
+	for ( char* dt_ch = dts; *dt_ch != '\0'; ++dt_ch )
+	{
+		num_t  dt;
+		cntx_t cntx;
+		dim_t  mr, nr, kr;
+		double gf_def, gf;
+
+		if      ( *dt_ch == 's' ) dt = BLIS_FLOAT;
+		else if ( *dt_ch == 'd' ) dt = BLIS_DOUBLE;
+		else if ( *dt_ch == 'c' ) dt = BLIS_SCOMPLEX;
+		else if ( *dt_ch == 'z' ) dt = BLIS_DCOMPLEX;
+		else continue;
+
+		// Complex gemm may be computed via an induced method, in which case
+		// its blocksizes are derived from those of the real domain.
+		if ( bli_ind_oper_find_avail( BLIS_GEMM, dt ) != BLIS_NAT )
+		{
+			printf( "# %c: skipped (gemm uses an induced method).\n", *dt_ch );
+			continue;
+		}
+
+		// Start from a copy of the native context.
+		cntx = *cntx_nat;
+
+		mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, &cntx );
+		nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, &cntx );
+		kr = bli_cntx_get_blksz_def_dt( dt, BLIS_KR, &cntx );
+
+		gf_def = time_gemm( dt, p, n_repeats, &cntx );
+
+		// Tune KC first, since it determines the footprint of the
+		// micro-panels, then MC, and finally NC.
+		gf = tune_blksz( dt, BLIS_KC, kr, 64, 1024, p, n_repeats, &cntx );
+		gf = tune_blksz( dt, BLIS_MC, lcm( mr, nr ), lcm( mr, nr ), 1024,
+		                 p, n_repeats, &cntx );
+		gf = tune_blksz( dt, BLIS_NC, lcm( mr, nr ), 512, 8192,
+		                 p, n_repeats, &cntx );
+
+		printf( "# %c: %.2f GFLOPS (default blocksizes: %.2f GFLOPS)\n",
+		        *dt_ch, gf, gf_def );
+		printf( "MC_%c=%ld KC_%c=%ld NC_%c=%ld\n",
+		        *dt_ch, ( long )bli_cntx_get_blksz_def_dt( dt, BLIS_MC, &cntx ),
+		        *dt_ch, ( long )bli_cntx_get_blksz_def_dt( dt, BLIS_KC, &cntx ),
+		        *dt_ch, ( long )bli_cntx_get_blksz_def_dt( dt, BLIS_NC, &cntx ) );
+		fflush( stdout );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
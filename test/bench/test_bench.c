@@ -0,0 +1,595 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// A unified benchmark runner for level-1v, level-2, and level-3 operations.
+// Each operation is timed across a sweep of problem sizes and shapes,
+// datatypes, thread counts, and storage schemes, and the minimum and
+// median times over several trials are written as CSV or JSON. Given the
+// CSV output of a previous run as a baseline, the runner also flags the
+// cases whose median time regressed by more than a given tolerance.
+
+#define MAX_REPS      64
+#define MAX_LIST      32
+#define MAX_BASELINE  16384
+#define KEY_LEN       128
+
+typedef enum
+{
+	FMT_CSV = 0,
+	FMT_JSON
+} fmt_t;
+
+typedef enum
+{
+	OP_AXPYV = 0,
+	OP_DOTV,
+	OP_GEMV,
+	OP_GER,
+	OP_TRSV,
+	OP_GEMM,
+	OP_HERK,
+	OP_TRMM,
+	OP_TRSM,
+	OP_NUM
+} op_t;
+
+static char* op_str[ OP_NUM ] =
+{
+	"axpyv", "dotv",
+	"gemv", "ger", "trsv",
+	"gemm", "herk", "trmm", "trsm"
+};
+
+typedef enum
+{
+	SHAPE_SQUARE = 0,
+	SHAPE_TALL,
+	SHAPE_SMALL,
+	SHAPE_KHEAVY,
+	SHAPE_NUM
+} shape_t;
+
+static char* shape_str[ SHAPE_NUM ] =
+{
+	"square", "tall", "small", "kheavy"
+};
+
+typedef struct
+{
+	char   key[ KEY_LEN ];
+	double time_med;
+} base_t;
+
+static base_t baseline[ MAX_BASELINE ];
+static dim_t  n_baseline = 0;
+
+
+// -- Problem setup ------------------------------------------------------------
+
+// Map a size in the sweep to the dimensions of a problem of the given shape.
+static void shape_dims( shape_t shape, dim_t p, dim_t* m, dim_t* n, dim_t* k )
+{
+	switch ( shape )
+	{
+		case SHAPE_SQUARE: *m = p;                  *n = p;                  *k = p;     break;
+		case SHAPE_TALL:   *m = 8 * p;              *n = bli_max( p / 8, 1 ); *k = p;     break;
+		case SHAPE_SMALL:  *m = bli_max( p / 16, 4 ); *n = *m;               *k = *m;    break;
+		case SHAPE_KHEAVY: *m = bli_max( p / 4, 1 ); *n = *m;                *k = 8 * p; break;
+		default:           *m = *n = *k = p;
+	}
+}
+
+// Create an m x n matrix stored according to stor: 'c' (column-major),
+// 'r' (row-major), or 'g' (general stride, with neither stride unit).
+static void create_mat( num_t dt, char stor, dim_t m, dim_t n, obj_t* a )
+{
+	if      ( stor == 'r' ) bli_obj_create( dt, m, n, n, 1, a );
+	else if ( stor == 'g' ) bli_obj_create( dt, m, n, 2, 2 * m, a );
+	else                    bli_obj_create( dt, m, n, 0, 0, a );
+
+	bli_randm( a );
+}
+
+// Create a vector of length n, with non-unit stride for general storage.
+static void create_vec( num_t dt, char stor, dim_t n, obj_t* x )
+{
+	if ( stor == 'g' ) bli_obj_create( dt, n, 1, 2, 2 * n, x );
+	else               bli_obj_create( dt, n, 1, 0, 0, x );
+
+	bli_randv( x );
+}
+
+// Make a (lower) triangular matrix well-conditioned by setting its
+// diagonal to m.
+static void make_tri( obj_t* a )
+{
+	obj_t d;
+
+	bli_obj_scalar_init_detached( bli_obj_dt( a ), &d );
+	bli_setsc( ( double )bli_obj_length( a ), 0.0, &d );
+	bli_setd( &d, a );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, a );
+	bli_obj_set_uplo( BLIS_LOWER, a );
+}
+
+// Return the number of flops performed by the operation. (Complex flops
+// are counted as the equivalent real flops.)
+static double op_flops( op_t op, num_t dt, dim_t m, dim_t n, dim_t k )
+{
+	double flops;
+
+	switch ( op )
+	{
+		case OP_AXPYV:
+		case OP_DOTV: flops = 2.0 * m * n;           break;
+		case OP_GEMV:
+		case OP_GER:  flops = 2.0 * m * n;           break;
+		case OP_TRSV: flops = 1.0 * m * m;           break;
+		case OP_GEMM: flops = 2.0 * m * n * k;       break;
+		case OP_HERK: flops = 1.0 * m * ( m + 1 ) * k; break;
+		case OP_TRMM:
+		case OP_TRSM: flops = 1.0 * m * m * n;       break;
+		default:      flops = 0.0;
+	}
+
+	if ( bli_is_complex( dt ) ) flops *= 4.0;
+
+	return flops;
+}
+
+// Time n_reps executions of the operation. The output operand is restored
+// from a saved copy before each trial so that every trial computes the same
+// problem.
+static void time_op
+     (
+       op_t    op,
+       num_t   dt,
+       char    stor,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   n_reps,
+       rntm_t* rntm,
+       double* times
+     )
+{
+	obj_t  a, b, c, c_save, x, y, rho;
+	obj_t* out;
+	dim_t  r;
+
+	// Allocate the operands used by each family of operations. Level-1v
+	// operations use vectors with as many elements as an m x n matrix.
+	switch ( op )
+	{
+		case OP_AXPYV:
+		case OP_DOTV:
+			create_vec( dt, stor, m * n, &x );
+			create_vec( dt, stor, m * n, &y );
+			bli_obj_create_1x1( dt, &rho );
+			out = &y;
+			break;
+		case OP_GEMV:
+		case OP_GER:
+			create_mat( dt, stor, m, n, &a );
+			create_vec( dt, stor, n, &x );
+			create_vec( dt, stor, m, &y );
+			out = ( op == OP_GEMV ? &y : &a );
+			if ( op == OP_GER ) bli_obj_toggle_trans( &x );
+			break;
+		case OP_TRSV:
+			create_mat( dt, stor, m, m, &a );
+			create_vec( dt, stor, m, &x );
+			make_tri( &a );
+			out = &x;
+			break;
+		case OP_GEMM:
+		case OP_HERK:
+			create_mat( dt, stor, m, k, &a );
+			create_mat( dt, stor, k, n, &b );
+			create_mat( dt, stor, m, ( op == OP_GEMM ? n : m ), &c );
+			if ( op == OP_HERK )
+			{
+				bli_obj_set_struc( BLIS_HERMITIAN, &c );
+				bli_obj_set_uplo( BLIS_LOWER, &c );
+			}
+			out = &c;
+			break;
+		case OP_TRMM:
+		case OP_TRSM:
+		default:
+			create_mat( dt, stor, m, m, &a );
+			create_mat( dt, stor, m, n, &b );
+			make_tri( &a );
+			out = &b;
+			break;
+	}
+
+	bli_obj_create( dt, bli_obj_length( out ), bli_obj_width( out ), 0, 0,
+	                &c_save );
+	bli_copym( out, &c_save );
+
+	// Run the operation once, untimed, to warm up the caches and the
+	// memory pools, and then time n_reps trials.
+	for ( r = -1; r < n_reps; ++r )
+	{
+		double dtime;
+
+		bli_copym( &c_save, out );
+
+		dtime = bli_clock();
+
+		switch ( op )
+		{
+			case OP_AXPYV: bli_axpyv_ex( &BLIS_ONE, &x, &y, NULL, rntm );                  break;
+			case OP_DOTV:  bli_dotv_ex( &x, &y, &rho, NULL, rntm );                        break;
+			case OP_GEMV:  bli_gemv_ex( &BLIS_ONE, &a, &x, &BLIS_ONE, &y, NULL, rntm );    break;
+			case OP_GER:   bli_ger_ex( &BLIS_ONE, &y, &x, &a, NULL, rntm );                break;
+			case OP_TRSV:  bli_trsv_ex( &BLIS_ONE, &a, &x, NULL, rntm );                   break;
+			case OP_GEMM:  bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm );    break;
+			case OP_HERK:  bli_herk_ex( &BLIS_ONE, &a, &BLIS_ONE, &c, NULL, rntm );        break;
+			case OP_TRMM:  bli_trmm_ex( BLIS_LEFT, &BLIS_ONE, &a, &b, NULL, rntm );        break;
+			case OP_TRSM:  bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &a, &b, NULL, rntm );        break;
+			default: break;
+		}
+
+		dtime = bli_clock() - dtime;
+
+		if ( r >= 0 ) times[ r ] = dtime;
+	}
+
+	bli_obj_free( &c_save );
+
+	switch ( op )
+	{
+		case OP_AXPYV:
+		case OP_DOTV:
+			bli_obj_free( &x ); bli_obj_free( &y ); bli_obj_free( &rho ); break;
+		case OP_GEMV:
+		case OP_GER:
+			bli_obj_free( &a ); bli_obj_free( &x ); bli_obj_free( &y ); break;
+		case OP_TRSV:
+			bli_obj_free( &a ); bli_obj_free( &x ); break;
+		case OP_GEMM:
+		case OP_HERK:
+			bli_obj_free( &a ); bli_obj_free( &b ); bli_obj_free( &c ); break;
+		default:
+			bli_obj_free( &a ); bli_obj_free( &b ); break;
+	}
+}
+
+static int cmp_double( const void* a, const void* b )
+{
+	double x = *( const double* )a;
+	double y = *( const double* )b;
+
+	return ( x < y ? -1 : ( x > y ? 1 : 0 ) );
+}
+
+
+// -- Baseline comparison ------------------------------------------------------
+
+static void make_key
+     (
+       char* key, op_t op, char dt_ch, shape_t shape,
+       dim_t m, dim_t n, dim_t k, dim_t nt, char stor
+     )
+{
+	snprintf( key, KEY_LEN, "%s,%c,%s,%ld,%ld,%ld,%ld,%c",
+	          op_str[ op ], dt_ch, shape_str[ shape ],
+	          ( long )m, ( long )n, ( long )k, ( long )nt, stor );
+}
+
+// Read the CSV output of a previous run. The first eight fields of each
+// line form the key, and the eleventh is the median time.
+static void read_baseline( char* filename )
+{
+	FILE* fp = fopen( filename, "r" );
+	char  line[ 512 ];
+
+	if ( fp == NULL )
+	{
+		fprintf( stderr, "Could not open baseline file '%s'.\n", filename );
+		exit( 1 );
+	}
+
+	while ( fgets( line, sizeof( line ), fp ) != NULL &&
+	        n_baseline < MAX_BASELINE )
+	{
+		char* p = line;
+		int   field;
+
+		if ( line[0] == '#' || strncmp( line, "op,", 3 ) == 0 ) continue;
+
+		// Find the end of the key and the start of the median time.
+		for ( field = 0; field < 10 && p != NULL; ++field )
+		{
+			p = strchr( p, ',' );
+			if ( p != NULL && field == 7 )
+			{
+				size_t len = bli_min( p - line, KEY_LEN - 1 );
+
+				memcpy( baseline[ n_baseline ].key, line, len );
+				baseline[ n_baseline ].key[ len ] = '\0';
+			}
+			if ( p != NULL ) ++p;
+		}
+
+		if ( p == NULL ) continue;
+
+		baseline[ n_baseline ].time_med = atof( p );
+		++n_baseline;
+	}
+
+	fclose( fp );
+}
+
+static double find_baseline( char* key )
+{
+	dim_t i;
+
+	for ( i = 0; i < n_baseline; ++i )
+		if ( strcmp( baseline[ i ].key, key ) == 0 )
+			return baseline[ i ].time_med;
+
+	return 0.0;
+}
+
+
+// -----------------------------------------------------------------------------
+
+// Parse a comma-separated list of integers.
+static dim_t parse_list( char* str, dim_t* list )
+{
+	dim_t n = 0;
+	char* p = str;
+
+	while ( *p != '\0' && n < MAX_LIST )
+	{
+		list[ n++ ] = strtol( p, &p, 10 );
+		if ( *p == ',' ) ++p;
+		else if ( *p != '\0' ) break;
+	}
+
+	return n;
+}
+
+static bool_t in_list( char* list, char* name )
+{
+	size_t len = strlen( name );
+	char*  p   = list;
+
+	while ( ( p = strstr( p, name ) ) != NULL )
+	{
+		if ( ( p == list || *(p-1) == ',' ) &&
+		     ( p[ len ] == '\0' || p[ len ] == ',' ) ) return TRUE;
+		p += len;
+	}
+
+	return FALSE;
+}
+
+static void usage( char* name )
+{
+	printf( "\n" );
+	printf( " %s [options]\n", name );
+	printf( "\n" );
+	printf( "  -o ops      operations (default: all of %s", op_str[0] );
+	for ( int i = 1; i < OP_NUM; ++i ) printf( ",%s", op_str[i] );
+	printf( ").\n" );
+	printf( "  -s shapes   shapes (default: square,tall,small,kheavy).\n" );
+	printf( "  -p sizes    sizes to sweep (default: 200,400,800).\n" );
+	printf( "  -d dts      datatypes (default: sdcz).\n" );
+	printf( "  -t threads  thread counts (default: 1).\n" );
+	printf( "  -c stors    storage schemes: c (column), r (row), and g (general)\n" );
+	printf( "              (default: c).\n" );
+	printf( "  -r reps     trials per case (default: 5).\n" );
+	printf( "  -f fmt      output format: csv or json (default: csv).\n" );
+	printf( "  -b file     compare against a baseline (the CSV output of a\n" );
+	printf( "              previous run) and flag regressions.\n" );
+	printf( "  -x pct      regression tolerance, in percent (default: 5).\n" );
+	printf( "\n" );
+	printf( "  For a size p, the shapes are m = n = k = p (square); m = 8p,\n" );
+	printf( "  n = p/8, k = p (tall); m = n = k = p/16 (small); and\n" );
+	printf( "  m = n = p/4, k = 8p (kheavy). Level-2 operations use m and n,\n" );
+	printf( "  and level-1v operations use vectors of length m*n.\n" );
+	printf( "\n" );
+	exit( 1 );
+}
+
+int main( int argc, char** argv )
+{
+	char*    ops       = NULL;
+	char*    shapes    = "square,tall,small,kheavy";
+	char*    dts       = "sdcz";
+	char*    stors     = "c";
+	char*    base_file = NULL;
+	dim_t    sizes[ MAX_LIST ]   = { 200, 400, 800 };
+	dim_t    threads[ MAX_LIST ] = { 1 };
+	dim_t    n_sizes   = 3;
+	dim_t    n_threads = 1;
+	dim_t    n_reps    = 5;
+	double   tol       = 5.0;
+	fmt_t    fmt       = FMT_CSV;
+	dim_t    n_regress = 0;
+	bool_t   first     = TRUE;
+	getopt_t state;
+	int      opt;
+
+	bli_getopt_init_state( 0, &state );
+
+	while ( ( opt = bli_getopt( argc, argv, "o:s:p:d:t:c:r:f:b:x:h", &state ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			case 'o': ops       = state.optarg;                          break;
+			case 's': shapes    = state.optarg;                          break;
+			case 'p': n_sizes   = parse_list( state.optarg, sizes );     break;
+			case 'd': dts       = state.optarg;                          break;
+			case 't': n_threads = parse_list( state.optarg, threads );   break;
+			case 'c': stors     = state.optarg;                          break;
+			case 'r': n_reps    = atol( state.optarg );                  break;
+			case 'f': fmt       = ( strcmp( state.optarg, "json" ) == 0
+			                        ? FMT_JSON : FMT_CSV );              break;
+			case 'b': base_file = state.optarg;                          break;
+			case 'x': tol       = atof( state.optarg );                  break;
+			default:  usage( argv[0] );
+		}
+	}
+
+	n_reps = bli_min( bli_max( n_reps, 1 ), MAX_REPS );
+
+	if ( base_file != NULL ) read_baseline( base_file );
+
+	bli_init();
+
+	// Seed the random number generator so that every run computes with the
+	// same operands.
+	srand( 1 );
+
+	if ( fmt == FMT_CSV )
+	{
+		printf( "# blis %s, %s, %ld reps\n", bli_info_get_version_str(),
+		        bli_arch_string( bli_arch_query_id() ), ( long )n_reps );
+		printf( "op,dt,shape,m,n,k,threads,storage,reps,"
+		        "time_min,time_med,gflops_max,gflops_med\n" );
+	}
+	else
+	{
+		printf( "{\n" );
+		printf( "  \"version\": \"%s\",\n", bli_info_get_version_str() );
+		printf( "  \"arch\": \"%s\",\n", bli_arch_string( bli_arch_query_id() ) );
+		printf( "  \"reps\": %ld,\n", ( long )n_reps );
+		printf( "  \"results\": [" );
+	}
+
+	for ( int oi = 0; oi < OP_NUM; ++oi )
+	{
+		if ( ops != NULL && !in_list( ops, op_str[ oi ] ) ) continue;
+
+		for ( char* dt_ch = dts; *dt_ch != '\0'; ++dt_ch )
+		for ( int si = 0; si < SHAPE_NUM; ++si )
+		for ( dim_t pi = 0; pi < n_sizes; ++pi )
+		for ( dim_t ti = 0; ti < n_threads; ++ti )
+		for ( char* st = stors; *st != '\0'; ++st )
+		{
+			op_t   op = oi;
+			num_t  dt;
+			dim_t  m, n, k;
+			double times[ MAX_REPS ];
+			double t_min, t_med, flops;
+			double t_base;
+			rntm_t rntm;
+			char   key[ KEY_LEN ];
+
+			if ( !in_list( shapes, shape_str[ si ] ) ) continue;
+
+			if      ( *dt_ch == 's' ) dt = BLIS_FLOAT;
+			else if ( *dt_ch == 'd' ) dt = BLIS_DOUBLE;
+			else if ( *dt_ch == 'c' ) dt = BLIS_SCOMPLEX;
+			else if ( *dt_ch == 'z' ) dt = BLIS_DCOMPLEX;
+			else continue;
+
+			if ( *st != 'c' && *st != 'r' && *st != 'g' ) continue;
+
+			shape_dims( si, sizes[ pi ], &m, &n, &k );
+
+			// Operations without a k dimension are only run for the shapes
+			// that differ in m and n.
+			if ( op < OP_GEMM && si == SHAPE_KHEAVY ) continue;
+
+			// Vectors are the same in row and column storage.
+			if ( op <= OP_DOTV && *st == 'r' ) continue;
+			if ( op < OP_GEMM ) k = 0;
+			if ( op == OP_TRSV ) n = m;
+
+			bli_rntm_init( &rntm );
+			bli_rntm_set_num_threads( threads[ ti ], &rntm );
+
+			time_op( op, dt, *st, m, n, k, n_reps, &rntm, times );
+
+			qsort( times, n_reps, sizeof( double ), cmp_double );
+
+			t_min = times[ 0 ];
+			t_med = ( n_reps % 2 == 1 ? times[ n_reps / 2 ]
+			          : 0.5 * ( times[ n_reps / 2 - 1 ] + times[ n_reps / 2 ] ) );
+			flops = op_flops( op, dt, m, n, k );
+
+			make_key( key, op, *dt_ch, si, m, n, k, threads[ ti ], *st );
+
+			if ( fmt == FMT_CSV )
+			{
+				printf( "%s,%ld,%.6e,%.6e,%.3f,%.3f\n", key, ( long )n_reps,
+				        t_min, t_med, flops / ( t_min * 1.0e9 ),
+				        flops / ( t_med * 1.0e9 ) );
+			}
+			else
+			{
+				printf( "%s\n    { \"op\": \"%s\", \"dt\": \"%c\", \"shape\": \"%s\", "
+				        "\"m\": %ld, \"n\": %ld, \"k\": %ld, \"threads\": %ld, "
+				        "\"storage\": \"%c\", \"time_min\": %.6e, \"time_med\": %.6e, "
+				        "\"gflops_max\": %.3f, \"gflops_med\": %.3f }",
+				        ( first ? "" : "," ), op_str[ op ], *dt_ch, shape_str[ si ],
+				        ( long )m, ( long )n, ( long )k, ( long )threads[ ti ], *st,
+				        t_min, t_med, flops / ( t_min * 1.0e9 ),
+				        flops / ( t_med * 1.0e9 ) );
+			}
+			first = FALSE;
+			fflush( stdout );
+
+			// Compare the median time against the baseline, if one was given.
+			t_base = find_baseline( key );
+
+			if ( t_base > 0.0 && t_med > t_base * ( 1.0 + tol / 100.0 ) )
+			{
+				fprintf( stderr, "REGRESSION %s: median %.3e s vs. baseline "
+				         "%.3e s (%+.1f%%)\n", key, t_med, t_base,
+				         100.0 * ( t_med / t_base - 1.0 ) );
+				++n_regress;
+			}
+		}
+	}
+
+	if ( fmt == FMT_JSON ) printf( "\n  ]\n}\n" );
+
+	if ( base_file != NULL )
+		fprintf( stderr, "%ld regression(s) beyond %.1f%% against '%s'.\n",
+		         ( long )n_regress, tol, base_file );
+
+	bli_finalize();
+
+	return ( n_regress > 0 ? 2 : 0 );
+}
@@ -0,0 +1,646 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// This driver times the level-3 micro-kernels (gemm, gemmtrsm_l/u, and
+// trsm_l/u) and the packm kernels registered in the native context for
+// the current sub-configuration, on packed micro-panels that are resident
+// in the L1 ("hot"), L2, and L3 caches. Micro-kernel performance is
+// reported in GFLOPS and as a percentage of the theoretical peak of one
+// core, along with the arithmetic intensity of each call. Packing
+// performance is reported in GB/s and bytes/cycle. Together, these two
+// give a simple roofline for each level of the memory hierarchy.
+
+#define FLOPS_PER_TRIAL 2.0e8
+
+typedef enum
+{
+	RES_HOT = 0,
+	RES_L2,
+	RES_L3,
+	RES_NUM
+} res_t;
+
+static char* res_str[ RES_NUM ] = { "hot", "L2", "L3" };
+
+typedef struct
+{
+	double ghz;
+	double fpc_d;      // double-precision flops per cycle.
+	char*  ghz_src;
+	char*  fpc_src;
+} peak_t;
+
+
+// -- Machine parameters -------------------------------------------------------
+
+// Read the size (in bytes) of the cache at the given level from sysfs, or
+// return 0 if it is unavailable.
+static dim_t cache_size( int level )
+{
+	char  path[ 128 ];
+	char  buf[ 32 ];
+	dim_t size = 0;
+	int   i;
+
+	for ( i = 0; i < 8; ++i )
+	{
+		FILE* fp;
+		int   lev;
+
+		sprintf( path, "/sys/devices/system/cpu/cpu0/cache/index%d/level", i );
+		if ( ( fp = fopen( path, "r" ) ) == NULL ) break;
+		lev = ( fscanf( fp, "%d", &lev ) == 1 ? lev : 0 );
+		fclose( fp );
+
+		if ( lev != level ) continue;
+
+		sprintf( path, "/sys/devices/system/cpu/cpu0/cache/index%d/size", i );
+		if ( ( fp = fopen( path, "r" ) ) == NULL ) break;
+		if ( fscanf( fp, "%31s", buf ) == 1 )
+		{
+			char* suf;
+
+			size = strtol( buf, &suf, 10 );
+			if      ( *suf == 'K' ) size *= 1024;
+			else if ( *suf == 'M' ) size *= 1024 * 1024;
+		}
+		fclose( fp );
+		break;
+	}
+
+	return size;
+}
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+
+static uint64_t read_tsc( void )
+{
+	uint32_t lo, hi;
+
+	__asm__ __volatile__ ( "rdtsc" : "=a" (lo), "=d" (hi) );
+
+	return ( ( uint64_t )hi << 32 ) | lo;
+}
+
+// Derive the peak from cpuid: the frequency from leaf 0x16 (or, failing
+// that, the processor brand string or the measured TSC rate), and the
+// flops per cycle from the vector width and the presence of FMA units.
+static void query_peak( peak_t* peak )
+{
+	uint32_t eax, ebx, ecx, edx;
+	uint32_t max_leaf;
+	bool_t   has_avx = FALSE, has_fma = FALSE, has_avx512 = FALSE;
+	double   vec_bytes;
+	double   n_units;
+	char     cpu_name[ 49 ] = { 0 };
+	char*    loc;
+
+	__cpuid( 0, max_leaf, ebx, ecx, edx );
+
+	if ( max_leaf >= 1 )
+	{
+		__cpuid( 1, eax, ebx, ecx, edx );
+		has_avx = ( ecx >> 28 ) & 1;
+		has_fma = ( ecx >> 12 ) & 1;
+	}
+	if ( max_leaf >= 7 )
+	{
+		__cpuid_count( 7, 0, eax, ebx, ecx, edx );
+		has_avx512 = ( ebx >> 16 ) & 1;
+	}
+
+	peak->ghz = 0.0;
+
+	if ( max_leaf >= 0x16 )
+	{
+		__cpuid( 0x16, eax, ebx, ecx, edx );
+		peak->ghz     = ( eax & 0xffff ) / 1000.0;
+		peak->ghz_src = "cpuid";
+	}
+	if ( peak->ghz == 0.0 )
+	{
+		get_cpu_name( cpu_name );
+
+		if ( ( loc = strstr( cpu_name, "GHz" ) ) != NULL )
+		{
+			while ( loc > cpu_name && *(loc-1) != ' ' && *(loc-1) != '@' ) --loc;
+			peak->ghz     = atof( loc );
+			peak->ghz_src = "brand string";
+		}
+	}
+	if ( peak->ghz == 0.0 )
+	{
+		uint64_t t0    = read_tsc();
+		double   dtime = bli_clock();
+
+		while ( bli_clock() - dtime < 0.1 ) ;
+
+		peak->ghz     = ( read_tsc() - t0 ) / ( ( bli_clock() - dtime ) * 1.0e9 );
+		peak->ghz_src = "TSC rate";
+	}
+
+	// Assume two FMA (or one add and one multiply) units, except where
+	// AVX-512 parts are known to have only one.
+	if      ( has_avx512 ) { vec_bytes = 64; n_units = vpu_count(); }
+	else if ( has_avx    ) { vec_bytes = 32; n_units = ( has_fma ? 2 : 1 ); }
+	else                   { vec_bytes = 16; n_units = 1; }
+
+	if ( n_units <= 0 ) n_units = 2;
+
+	peak->fpc_d   = ( vec_bytes / sizeof( double ) ) * 2.0 * n_units;
+	peak->fpc_src = "cpuid";
+}
+
+#else
+
+static void query_peak( peak_t* peak )
+{
+	peak->ghz     = 0.0;
+	peak->fpc_d   = 0.0;
+	peak->ghz_src = "unknown";
+	peak->fpc_src = "unknown";
+}
+
+#endif
+
+// Return the peak GFLOPS of one core for the given datatype, or 0 if it is
+// unknown. (Complex flops are counted as the equivalent real flops.)
+static double peak_gflops( num_t dt, peak_t* peak )
+{
+	double fpc = peak->fpc_d;
+
+	if ( bli_is_single_prec( dt ) ) fpc *= 2.0;
+
+	return fpc * peak->ghz;
+}
+
+
+// -- Panel buffers ------------------------------------------------------------
+
+typedef struct
+{
+	num_t  dt;
+	dim_t  k;
+	dim_t  mr, nr;
+	dim_t  packmr, packnr;
+	siz_t  es;
+	inc_t  ps_a;       // panel stride (in elements) of A micro-panels.
+	inc_t  ps_b;       // panel stride (in elements) of B micro-panels.
+	dim_t  n_pairs;
+	char*  a;
+	char*  b;
+	char*  c;
+	inc_t  rs_c, cs_c;
+} panels_t;
+
+// Allocate enough pairs of A and B micro-panels to fill the given
+// footprint (in bytes). Each micro-panel is followed by the triangular
+// (a11) or rectangular (b11) block read by the gemmtrsm micro-kernels.
+static void panels_create( num_t dt, dim_t k, siz_t footprint, cntx_t* cntx,
+                           panels_t* p )
+{
+	obj_t  ao, a11o;
+	dim_t  i;
+
+	p->dt     = dt;
+	p->k      = k;
+	p->mr     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	p->nr     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	p->packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+	p->packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	p->es     = bli_dt_size( dt );
+	p->ps_a   = p->packmr * ( k + p->mr );
+	p->ps_b   = p->packnr * ( k + p->mr );
+
+	p->n_pairs = footprint / ( ( p->ps_a + p->ps_b ) * p->es );
+	p->n_pairs = bli_max( p->n_pairs, 1 );
+
+	p->a = bli_malloc_user( p->n_pairs * p->ps_a * p->es );
+	p->b = bli_malloc_user( p->n_pairs * p->ps_b * p->es );
+	p->c = bli_malloc_user( p->packmr * p->packnr * p->es );
+
+	bli_obj_create_with_attached_buffer( dt, p->n_pairs * p->ps_a, 1,
+	                                     p->a, 1, p->n_pairs * p->ps_a, &ao );
+	bli_randv( &ao );
+	bli_obj_create_with_attached_buffer( dt, p->n_pairs * p->ps_b, 1,
+	                                     p->b, 1, p->n_pairs * p->ps_b, &ao );
+	bli_randv( &ao );
+	bli_obj_create_with_attached_buffer( dt, p->packmr * p->packnr, 1,
+	                                     p->c, 1, p->packmr * p->packnr, &ao );
+	bli_randv( &ao );
+
+	// Set each (packed, inverted) a11 block to the identity so that the
+	// values in b11 stay bounded over many calls to the trsm micro-kernels.
+	for ( i = 0; i < p->n_pairs; ++i )
+	{
+		char* a11 = p->a + ( i * p->ps_a + k * p->packmr ) * p->es;
+
+		bli_obj_create_with_attached_buffer( dt, p->mr, p->mr, a11,
+		                                     1, p->packmr, &a11o );
+		bli_setm( &BLIS_ZERO, &a11o );
+		bli_setd( &BLIS_ONE, &a11o );
+	}
+
+	if ( bli_cntx_l3_nat_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx ) )
+	{ p->rs_c = p->nr; p->cs_c = 1; }
+	else
+	{ p->rs_c = 1; p->cs_c = p->mr; }
+}
+
+static void panels_free( panels_t* p )
+{
+	bli_free_user( p->a );
+	bli_free_user( p->b );
+	bli_free_user( p->c );
+}
+
+
+// -- Micro-kernel timing ------------------------------------------------------
+
+// Time n_iter calls to the given micro-kernel, cycling through the pairs of
+// micro-panels, and return the best time over n_repeats trials.
+static double time_ukr( l3ukr_t ukr_id, panels_t* p, dim_t n_iter,
+                        dim_t n_repeats, cntx_t* cntx )
+{
+	void*     f     = bli_cntx_get_l3_nat_ukr_dt( p->dt, ukr_id, cntx );
+	void*     one   = bli_obj_buffer_for_const( p->dt, &BLIS_ONE );
+	dcomplex  beta;
+	dim_t     k     = p->k;
+	siz_t     es    = p->es;
+	double    dtime_save = 1.0e9;
+	auxinfo_t aux;
+	dim_t     r, i;
+
+	// Use a distinct copy of one for beta, since alpha and beta are
+	// restrict-qualified.
+	memcpy( &beta, one, es );
+
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		for ( i = 0; i < n_iter; ++i )
+		{
+			dim_t j  = i % p->n_pairs;
+			dim_t jn = ( j + 1 ) % p->n_pairs;
+			char* a  = p->a + j  * p->ps_a * es;
+			char* b  = p->b + j  * p->ps_b * es;
+			char* an = p->a + jn * p->ps_a * es;
+			char* bn = p->b + jn * p->ps_b * es;
+
+			bli_auxinfo_set_next_ab( an, bn, &aux );
+
+			if ( ukr_id == BLIS_GEMM_UKR )
+			{
+				( ( gemm_ukr_vft )f )
+				( k, one, a, b, &beta, p->c, p->rs_c, p->cs_c, &aux, cntx );
+			}
+			else if ( ukr_id == BLIS_GEMMTRSM_L_UKR ||
+			          ukr_id == BLIS_GEMMTRSM_U_UKR )
+			{
+				( ( gemmtrsm_ukr_vft )f )
+				( k, one, a, a + k * p->packmr * es, b, b + k * p->packnr * es,
+				  p->c, p->rs_c, p->cs_c, &aux, cntx );
+			}
+			else
+			{
+				( ( trsm_ukr_vft )f )
+				( a + k * p->packmr * es, b + k * p->packnr * es,
+				  p->c, p->rs_c, p->cs_c, &aux, cntx );
+			}
+		}
+
+		dtime_save = bli_clock_min_diff( dtime_save, dtime );
+	}
+
+	return dtime_save;
+}
+
+// Measure the bandwidth (in GB/s) of streaming through the packed A and B
+// micro-panels with dotv. This serves as the memory roof for the
+// micro-kernels, which read the same panels in the same order.
+static double stream_gbps( panels_t* p, dim_t n_repeats )
+{
+	dim_t  n      = bli_min( p->n_pairs * p->ps_a, p->n_pairs * p->ps_b );
+	double bytes  = 2.0 * n * p->es;
+	dim_t  n_iter = bli_max( FLOPS_PER_TRIAL / bytes, 1 );
+	double dtime_save = 1.0e9;
+	obj_t  x, y, rho;
+	dim_t  r, i;
+
+	bli_obj_create_with_attached_buffer( p->dt, n, 1, p->a, 1, n, &x );
+	bli_obj_create_with_attached_buffer( p->dt, n, 1, p->b, 1, n, &y );
+	bli_obj_create_1x1( p->dt, &rho );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		for ( i = 0; i < n_iter; ++i )
+			bli_dotv( &x, &y, &rho );
+
+		dtime_save = bli_clock_min_diff( dtime_save, dtime );
+	}
+
+	bli_obj_free( &rho );
+
+	return ( n_iter * bytes ) / ( dtime_save * 1.0e9 );
+}
+
+// Return the number of flops performed by one call to the micro-kernel.
+static double ukr_flops( l3ukr_t ukr_id, panels_t* p )
+{
+	double mr    = p->mr;
+	double nr    = p->nr;
+	double flops = 0.0;
+
+	if ( ukr_id == BLIS_GEMM_UKR ||
+	     ukr_id == BLIS_GEMMTRSM_L_UKR ||
+	     ukr_id == BLIS_GEMMTRSM_U_UKR ) flops += 2.0 * mr * nr * p->k;
+	if ( ukr_id != BLIS_GEMM_UKR )       flops += mr * mr * nr;
+
+	if ( bli_is_complex( p->dt ) ) flops *= 4.0;
+
+	return flops;
+}
+
+// Return the number of bytes of packed panels read by one call to the
+// micro-kernel.
+static double ukr_bytes( l3ukr_t ukr_id, panels_t* p )
+{
+	double mr    = p->mr;
+	double nr    = p->nr;
+	double elems = 0.0;
+
+	if ( ukr_id == BLIS_GEMM_UKR ||
+	     ukr_id == BLIS_GEMMTRSM_L_UKR ||
+	     ukr_id == BLIS_GEMMTRSM_U_UKR ) elems += ( mr + nr ) * p->k;
+	if ( ukr_id != BLIS_GEMM_UKR )       elems += mr * mr + mr * nr;
+
+	return elems * p->es;
+}
+
+
+// -- packm kernel timing ------------------------------------------------------
+
+// Time the packm kernel for panels of cdim rows (or columns), packing from
+// a column-stored source matrix as is done for A (is_a = TRUE) and for B
+// (is_a = FALSE) in gemm. Returns the best time for n_iter calls.
+static double time_packm( num_t dt, dim_t cdim, dim_t ldp, dim_t k,
+                          bool_t is_a, siz_t footprint, dim_t n_iter,
+                          dim_t n_repeats, cntx_t* cntx )
+{
+	void*  f     = bli_cntx_get_packm_ker_dt( dt, ( l1mkr_t )cdim, cntx );
+	void*  one   = bli_obj_buffer_for_const( dt, &BLIS_ONE );
+	siz_t  es    = bli_dt_size( dt );
+	double dtime_save = 1.0e9;
+	dim_t  n_panels;
+	inc_t  inca, lda, ps_src;
+	char*  src;
+	char*  dst;
+	obj_t  so;
+	dim_t  r, i;
+
+	// Divide the footprint between the source and the packed copies.
+	n_panels = footprint / ( ( cdim + ldp ) * k * es );
+	n_panels = bli_max( n_panels, 1 );
+
+	if ( is_a )
+	{
+		// A is m x k, with m = n_panels * cdim, and panels are row blocks.
+		inca   = 1;
+		lda    = n_panels * cdim;
+		ps_src = cdim;
+	}
+	else
+	{
+		// B is k x n, with n = n_panels * cdim, and panels are column blocks.
+		inca   = k;
+		lda    = 1;
+		ps_src = cdim * k;
+	}
+
+	src = bli_malloc_user( n_panels * cdim * k * es );
+	dst = bli_malloc_user( n_panels * ldp  * k * es );
+
+	bli_obj_create_with_attached_buffer( dt, n_panels * cdim * k, 1,
+	                                     src, 1, n_panels * cdim * k, &so );
+	bli_randv( &so );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		for ( i = 0; i < n_iter; ++i )
+		{
+			dim_t j = i % n_panels;
+
+			( ( packm_cxk_ker_vft )f )
+			( BLIS_NO_CONJUGATE, k, one,
+			  src + j * ps_src * es, inca, lda,
+			  dst + j * ldp * k * es,      ldp, cntx );
+		}
+
+		dtime_save = bli_clock_min_diff( dtime_save, dtime );
+	}
+
+	bli_free_user( src );
+	bli_free_user( dst );
+
+	return dtime_save;
+}
+
+
+// -----------------------------------------------------------------------------
+
+int main( int argc, char** argv )
+{
+	char*    dts       = "sdcz";
+	dim_t    k         = 0;
+	dim_t    n_repeats = 3;
+	siz_t    fp[ RES_NUM ];
+	peak_t   peak;
+	cntx_t*  cntx;
+	getopt_t state;
+	int      opt;
+
+	l3ukr_t  ukr_ids[] = { BLIS_GEMM_UKR,
+	                       BLIS_GEMMTRSM_L_UKR, BLIS_GEMMTRSM_U_UKR,
+	                       BLIS_TRSM_L_UKR,     BLIS_TRSM_U_UKR };
+	char*    ukr_strs[] = { "gemm",
+	                        "gemmtrsm_l", "gemmtrsm_u",
+	                        "trsm_l",     "trsm_u" };
+
+	bli_init();
+
+	query_peak( &peak );
+
+	// Use half of each cache, so that the panels are comfortably resident.
+	fp[ RES_HOT ] = 0;
+	fp[ RES_L2  ] = ( cache_size( 2 ) ? cache_size( 2 ) :  256 * 1024 ) / 2;
+	fp[ RES_L3  ] = ( cache_size( 3 ) ? cache_size( 3 ) : 8192 * 1024 ) / 2;
+
+	bli_getopt_init_state( 0, &state );
+
+	while ( ( opt = bli_getopt( argc, argv, "d:k:r:g:f:2:3:h", &state ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			case 'd': dts           = state.optarg;                  break;
+			case 'k': k             = atol( state.optarg );          break;
+			case 'r': n_repeats     = atol( state.optarg );          break;
+			case 'g': peak.ghz      = atof( state.optarg );
+			          peak.ghz_src  = "user";                        break;
+			case 'f': peak.fpc_d    = atof( state.optarg );
+			          peak.fpc_src  = "user";                        break;
+			case '2': fp[ RES_L2 ]  = atol( state.optarg ) * 1024 / 2; break;
+			case '3': fp[ RES_L3 ]  = atol( state.optarg ) * 1024 / 2; break;
+			default:
+			printf( "\n" );
+			printf( " %s [-d dts] [-k k] [-r reps] [-g ghz] [-f flops] [-2 kib] [-3 kib]\n", argv[0] );
+			printf( "\n" );
+			printf( "  -d dts    datatypes to benchmark (default: sdcz).\n" );
+			printf( "  -k k      micro-panel depth (default: KC for each datatype).\n" );
+			printf( "  -r reps   trials per measurement; the best is reported (default: 3).\n" );
+			printf( "  -g ghz    core frequency used for the peak (default: from cpuid).\n" );
+			printf( "  -f flops  double-precision flops/cycle (default: from cpuid).\n" );
+			printf( "  -2 kib    L2 cache size in KiB (default: from sysfs).\n" );
+			printf( "  -3 kib    L3 cache size in KiB (default: from sysfs).\n" );
+			printf( "\n" );
+			exit( 1 );
+		}
+	}
+
+	cntx = bli_gks_query_cntx();
+
+	printf( "%% sub-configuration: %s\n", bli_arch_string( bli_arch_query_id() ) );
+	printf( "%% frequency:         %.2f GHz (%s)\n", peak.ghz, peak.ghz_src );
+	printf( "%% peak (d):          %.1f flops/cycle (%s)\n", peak.fpc_d, peak.fpc_src );
+	printf( "%% footprints:        L2 %ld KiB, L3 %ld KiB\n",
+	        ( long )( fp[ RES_L2 ] / 1024 ), ( long )( fp[ RES_L3 ] / 1024 ) );
+
+	for ( char* dt_ch = dts; *dt_ch != '\0'; ++dt_ch )
+	{
+		num_t  dt;
+		dim_t  k_dt;
+		double peak_dt;
+		double gbps;
+		int    ui, ri, ab;
+
+		if      ( *dt_ch == 's' ) dt = BLIS_FLOAT;
+		else if ( *dt_ch == 'd' ) dt = BLIS_DOUBLE;
+		else if ( *dt_ch == 'c' ) dt = BLIS_SCOMPLEX;
+		else if ( *dt_ch == 'z' ) dt = BLIS_DCOMPLEX;
+		else continue;
+
+		k_dt    = ( k > 0 ? k : bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ) );
+		peak_dt = peak_gflops( dt, &peak );
+
+		printf( "%%\n" );
+		printf( "%% %-11s %2s %4s %4s %5s %5s %10s %7s\n",
+		        "kernel", "dt", "cdim", "ldp", "k", "res", "GB/s", "B/cycle" );
+
+		for ( ab = 0; ab < 2; ++ab )
+		for ( ri = 0; ri < RES_NUM; ++ri )
+		{
+			bszid_t bs_id  = ( ab == 0 ? BLIS_MR : BLIS_NR );
+			dim_t   cdim   = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+			dim_t   ldp    = bli_cntx_get_blksz_max_dt( dt, bs_id, cntx );
+			double  bytes  = ( cdim + ldp ) * k_dt * bli_dt_size( dt );
+			dim_t   n_iter = bli_max( FLOPS_PER_TRIAL / bytes, 1 );
+			double  dtime;
+
+			if ( cdim >= BLIS_NUM_PACKM_KERS ||
+			     bli_cntx_get_packm_ker_dt( dt, ( l1mkr_t )cdim, cntx ) == NULL )
+				continue;
+
+			dtime = time_packm( dt, cdim, ldp, k_dt, ab == 0, fp[ ri ],
+			                    n_iter, n_repeats, cntx );
+			gbps  = ( n_iter * bytes ) / ( dtime * 1.0e9 );
+
+			printf( "  %-11s %2c %4ld %4ld %5ld %5s %10.2f %7.2f\n",
+			        ( ab == 0 ? "packm_a" : "packm_b" ), *dt_ch,
+			        ( long )cdim, ( long )ldp, ( long )k_dt, res_str[ ri ],
+			        gbps, ( peak.ghz > 0.0 ? gbps / peak.ghz : 0.0 ) );
+		}
+
+		// The roof for each micro-kernel is the lesser of the peak and its
+		// arithmetic intensity times the streaming bandwidth of the panels.
+		printf( "%%\n" );
+		printf( "%% %-11s %2s %4s %4s %5s %5s %10s %7s %9s %10s\n",
+		        "kernel", "dt", "mr", "nr", "k", "res",
+		        "GFLOPS", "%peak", "flops/B", "roof" );
+
+		for ( ri = 0; ri < RES_NUM; ++ri )
+		{
+			panels_t p;
+
+			panels_create( dt, k_dt, fp[ ri ], cntx, &p );
+
+			gbps = stream_gbps( &p, n_repeats );
+
+			for ( ui = 0; ui < 5; ++ui )
+			{
+				double flops  = ukr_flops( ukr_ids[ ui ], &p );
+				double ai     = flops / ukr_bytes( ukr_ids[ ui ], &p );
+				dim_t  n_iter = bli_max( FLOPS_PER_TRIAL / flops, 1 );
+				double dtime  = time_ukr( ukr_ids[ ui ], &p, n_iter,
+				                          n_repeats, cntx );
+				double gflops = ( n_iter * flops ) / ( dtime * 1.0e9 );
+				double roof   = ai * gbps;
+
+				if ( peak_dt > 0.0 ) roof = bli_min( roof, peak_dt );
+
+				printf( "  %-11s %2c %4ld %4ld %5ld %5s %10.2f %7.1f %9.2f %10.2f\n",
+				        ukr_strs[ ui ], *dt_ch, ( long )p.mr, ( long )p.nr,
+				        ( long )k_dt, res_str[ ri ], gflops,
+				        ( peak_dt > 0.0 ? 100.0 * gflops / peak_dt : 0.0 ),
+				        ai, roof );
+			}
+
+			panels_free( &p );
+		}
+	}
+
+	bli_finalize();
+
+	return 0;
+}
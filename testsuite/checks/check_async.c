@@ -0,0 +1,297 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "test_checks.h"
+
+// Check the non-blocking level-3 object API: a 1x1 output operand, the
+// completion callback, several operations queued at once (with scalar
+// temporaries that are overwritten immediately after submission), and the
+// drain of outstanding operations performed by bli_finalize(), after which
+// BLIS is re-initialized and used again.
+
+#define N_QUEUED 6
+
+static int n_cb   = 0;
+
+static void count_cb( async_t* req, void* data )
+{
+	__atomic_fetch_add( &n_cb, 1, __ATOMIC_RELAXED );
+
+	*( int* )data = 1;
+}
+
+static void check( bool_t ok, char* label )
+{
+	libblis_check_report( ok, "async %s", label );
+}
+
+static void test_1x1( void )
+{
+	obj_t     a, b, c, beta;
+	double    c_val, junk;
+	async_t*  req;
+
+	// The output operand of a 1x1 problem must be updated in place rather
+	// than treated as a scalar whose value is captured at submission.
+	bli_obj_create( BLIS_DOUBLE, 1, 1, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, 1, 1, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, 1, 1, 0, 0, &c );
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &beta );
+
+	bli_setsc( 2.0, 0.0, &a );
+	bli_setsc( 3.0, 0.0, &b );
+	bli_setsc( 5.0, 0.0, &c );
+	bli_setsc( 0.0, 0.0, &beta );
+
+	req = bli_gemm_async( &BLIS_ONE, &a, &b, &beta, &c,
+	                      NULL, NULL, NULL, NULL );
+	bli_async_wait( req );
+	bli_async_free( req );
+
+	bli_getsc( &c, &c_val, &junk );
+	check( c_val == 6.0, "gemm_async, 1x1 output" );
+
+	// Likewise for trsm, whose output operand is b.
+	bli_setsc( 4.0, 0.0, &a );
+	bli_setsc( 8.0, 0.0, &b );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+	bli_obj_set_uplo( BLIS_LOWER, &a );
+
+	req = bli_trsm_async( BLIS_LEFT, &BLIS_ONE, &a, &b,
+	                      NULL, NULL, NULL, NULL );
+	bli_async_wait( req );
+	bli_async_free( req );
+
+	bli_getsc( &b, &c_val, &junk );
+	check( c_val == 2.0, "trsm_async, 1x1 output" );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+static void test_queued( dim_t m, char* label_cb, char* label_res )
+{
+	obj_t     a[ N_QUEUED ], b[ N_QUEUED ], c[ N_QUEUED ], c_ref[ N_QUEUED ];
+	async_t*  req[ N_QUEUED ];
+	int       done[ N_QUEUED ];
+	bool_t    ok_cb = TRUE;
+	double    resid = 0.0;
+	dim_t     i;
+
+	n_cb = 0;
+
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &a[ i ] );
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &b[ i ] );
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &c[ i ] );
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &c_ref[ i ] );
+
+		bli_randm( &a[ i ] );
+		bli_randm( &b[ i ] );
+		bli_randm( &c[ i ] );
+		bli_copym( &c[ i ], &c_ref[ i ] );
+
+		done[ i ] = 0;
+	}
+
+	// Queue all of the operations before waiting on any of them. The scalars
+	// are overwritten as soon as each call returns, so the results are only
+	// correct if their values were captured at submission.
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		obj_t alpha, beta;
+
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha );
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &beta );
+		bli_setsc( 1.5 + i, 0.0, &alpha );
+		bli_setsc( -0.5,    0.0, &beta );
+
+		req[ i ] = bli_gemm_async( &alpha, &a[ i ], &b[ i ], &beta, &c[ i ],
+		                           NULL, NULL, count_cb, &done[ i ] );
+
+		bli_setsc( 99.0, 0.0, &alpha );
+		bli_setsc( 99.0, 0.0, &beta );
+	}
+
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		bli_async_wait( req[ i ] );
+
+		if ( !bli_async_test( req[ i ] ) || !done[ i ] ) ok_cb = FALSE;
+
+		bli_async_free( req[ i ] );
+	}
+
+	check( ok_cb && n_cb == N_QUEUED, label_cb );
+
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		obj_t alpha, beta;
+
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha );
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &beta );
+		bli_setsc( 1.5 + i, 0.0, &alpha );
+		bli_setsc( -0.5,    0.0, &beta );
+
+		bli_gemm( &alpha, &a[ i ], &b[ i ], &beta, &c_ref[ i ] );
+
+		resid = bli_fmaxabs( resid,
+		                     libblis_check_rel_diff( &c[ i ], &c_ref[ i ] ) );
+
+		bli_obj_free( &a[ i ] );
+		bli_obj_free( &b[ i ] );
+		bli_obj_free( &c[ i ] );
+		bli_obj_free( &c_ref[ i ] );
+	}
+
+	check( resid < 1.0e-12, label_res );
+}
+
+static void test_herk( dim_t m, dim_t k )
+{
+	obj_t     a, c, c_ref;
+	async_t*  req;
+
+	bli_obj_create( BLIS_DCOMPLEX, m, k, 0, 0, &a );
+	bli_obj_create( BLIS_DCOMPLEX, m, m, 0, 0, &c );
+	bli_obj_create( BLIS_DCOMPLEX, m, m, 0, 0, &c_ref );
+
+	bli_randm( &a );
+	bli_randm( &c );
+
+	bli_obj_set_struc( BLIS_HERMITIAN, &c );
+	bli_obj_set_uplo( BLIS_LOWER, &c );
+	bli_mkherm( &c );
+	bli_copym( &c, &c_ref );
+	bli_obj_set_struc( BLIS_HERMITIAN, &c_ref );
+	bli_obj_set_uplo( BLIS_LOWER, &c_ref );
+
+	req = bli_herk_async( &BLIS_ONE, &a, &BLIS_ONE, &c,
+	                      NULL, NULL, NULL, NULL );
+	bli_async_wait( req );
+	bli_async_free( req );
+
+	bli_herk( &BLIS_ONE, &a, &BLIS_ONE, &c_ref );
+
+	// Only the stored (lower) triangle is updated, so reflect it into the
+	// upper triangle of each matrix before comparing them.
+	bli_mkherm( &c );
+	bli_mkherm( &c_ref );
+
+	check( libblis_check_rel_diff( &c, &c_ref ) < 1.0e-12,
+	       "herk_async, result" );
+
+	bli_obj_free( &a );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+}
+
+int main( int argc, char** argv )
+{
+	obj_t     a[ N_QUEUED ], b[ N_QUEUED ], c[ N_QUEUED ], c_ref[ N_QUEUED ];
+	int       done[ N_QUEUED ];
+	bool_t    ok_cb = TRUE;
+	double    resid = 0.0;
+	dim_t     m     = 300;
+	dim_t     i;
+
+	bli_init();
+
+	test_1x1();
+	test_queued( m, "gemm_async, callbacks", "gemm_async, queued results" );
+	test_herk( m, 100 );
+
+	// Queue several operations and release their handles without waiting on
+	// them; bli_finalize() must complete them (and run their callbacks)
+	// before it returns.
+	n_cb = 0;
+
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &a[ i ] );
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &b[ i ] );
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &c[ i ] );
+		bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &c_ref[ i ] );
+
+		bli_randm( &a[ i ] );
+		bli_randm( &b[ i ] );
+		bli_setm( &BLIS_ZERO, &c[ i ] );
+
+		bli_gemm( &BLIS_ONE, &a[ i ], &b[ i ], &BLIS_ZERO, &c_ref[ i ] );
+
+		done[ i ] = 0;
+	}
+
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		async_t* req = bli_gemm_async( &BLIS_ONE, &a[ i ], &b[ i ],
+		                               &BLIS_ZERO, &c[ i ],
+		                               NULL, NULL, count_cb, &done[ i ] );
+		bli_async_free( req );
+	}
+
+	bli_finalize();
+
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		if ( !done[ i ] ) ok_cb = FALSE;
+
+		resid = bli_fmaxabs( resid,
+		                     libblis_check_rel_diff( &c[ i ], &c_ref[ i ] ) );
+	}
+
+	check( ok_cb && n_cb == N_QUEUED, "bli_finalize, drained callbacks" );
+	check( resid < 1.0e-12, "bli_finalize, drained results" );
+
+	for ( i = 0; i < N_QUEUED; ++i )
+	{
+		bli_obj_free( &a[ i ] );
+		bli_obj_free( &b[ i ] );
+		bli_obj_free( &c[ i ] );
+		bli_obj_free( &c_ref[ i ] );
+	}
+
+	// Operations submitted after BLIS has been re-initialized must be
+	// executed as before.
+	bli_init();
+
+	test_queued( m, "bli_init again, callbacks", "bli_init again, results" );
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
@@ -0,0 +1,335 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <math.h>
+#include <string.h>
+#include "test_checks.h"
+
+// Check the 64-bit copy of the BLAS compatibility layer (configure with
+// --enable-blas64), whose symbols carry a "_64_" suffix and whose integer
+// arguments are 64 bits wide. Several routines are called through their
+// _64_ entry points and compared against the object API (and, for dgemm,
+// against the default dgemm_). Invalid arguments are then passed to check
+// the info code that each routine reports to xerbla_64_(), including sizes
+// that are only invalid when all 64 bits are read. This driver defines its
+// own xerbla_64_() to record those codes; the definition in libblis is not
+// linked because nothing else in its object file is needed.
+
+#if defined( BLIS_ENABLE_BLAS ) && defined( BLIS_ENABLE_BLAS64 )
+
+#define M 9
+#define N 7
+#define K 5
+
+// A size whose low 32 bits are small but whose full 64-bit value exceeds
+// every leading dimension used below.
+#define BIG ( ( int64_t )1 << 32 )
+
+static char    xerbla_name[ 8 ];
+static int64_t xerbla_info;
+
+int xerbla_64_( const bla_character* srname, const int64_t* info, int64_t srname_len )
+{
+	int64_t len = bli_min( srname_len, ( int64_t )sizeof( xerbla_name ) - 1 );
+
+	memcpy( xerbla_name, srname, len );
+	xerbla_name[ len ] = '\0';
+	xerbla_info = *info;
+
+	return 0;
+}
+
+static void create_op( num_t dt, dim_t m, dim_t n, obj_t* x )
+{
+	bli_obj_create( dt, m, n, 1, m + 2, x );
+	bli_randm( x );
+}
+
+static void copy_op( obj_t* x, obj_t* y )
+{
+	bli_obj_create_conf_to( x, y );
+	bli_copym( x, y );
+}
+
+// Make a random square matrix well-conditioned for triangular solves.
+static void make_tri( obj_t* a )
+{
+	dim_t  n = bli_obj_length( a );
+	dim_t  i;
+	double ar, ai;
+
+	for ( i = 0; i < n; ++i )
+	{
+		bli_getijm( i, i, a, &ar, &ai );
+		bli_setijm( ar + n, ai, i, i, a );
+	}
+}
+
+static void report_resid( char* name, double resid )
+{
+	libblis_check_report( resid < 1.0e-13 && xerbla_info == 0,
+	                      "%-10s matches the object API  %9.2e", name, resid );
+}
+
+// Check that the most recent call reported the given info code for the
+// given routine, and reset the recorded code.
+static void report_info( char* name, char* what, int64_t info )
+{
+	bool_t ok = ( xerbla_info == info &&
+	              strncmp( xerbla_name, name, strlen( name ) ) == 0 );
+
+	libblis_check_report( ok, "%-10s %-36s info %2d",
+	                      name, what, ( int )xerbla_info );
+
+	xerbla_info = 0;
+	xerbla_name[ 0 ] = '\0';
+}
+
+static void test_gemm( void )
+{
+	obj_t   alpha, beta, a, b, c, c_ref, c_lp64;
+	double  alpha_d = 1.3, beta_d = 0.7;
+	double  alpha_z[ 2 ] = { 1.3, -0.4 }, beta_z[ 2 ] = { 0.7, 0.2 };
+	int64_t m = M, n = N, k = K, lda, ldb, ldc;
+	f77_int m32 = M, n32 = N, k32 = K, lda32, ldb32, ldc32;
+	num_t   dt;
+
+	for ( dt = BLIS_DOUBLE; dt <= BLIS_DCOMPLEX; dt += BLIS_DCOMPLEX - BLIS_DOUBLE )
+	{
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( alpha_z[ 0 ], alpha_z[ 1 ], &alpha );
+		bli_setsc( beta_z[ 0 ],  beta_z[ 1 ],  &beta );
+
+		create_op( dt, K, M, &a );
+		create_op( dt, K, N, &b );
+		create_op( dt, M, N, &c );
+		copy_op( &c, &c_ref );
+
+		lda = bli_obj_col_stride( &a );
+		ldb = bli_obj_col_stride( &b );
+		ldc = bli_obj_col_stride( &c );
+
+		if ( bli_is_real( dt ) )
+		{
+			copy_op( &c, &c_lp64 );
+
+			dgemm_64_( "T", "N", &m, &n, &k, &alpha_d, bli_obj_buffer( &a ), &lda,
+			           bli_obj_buffer( &b ), &ldb, &beta_d, bli_obj_buffer( &c ), &ldc );
+
+			lda32 = lda; ldb32 = ldb; ldc32 = ldc;
+			dgemm_( "T", "N", &m32, &n32, &k32, &alpha_d, bli_obj_buffer( &a ), &lda32,
+			        bli_obj_buffer( &b ), &ldb32, &beta_d, bli_obj_buffer( &c_lp64 ), &ldc32 );
+
+			libblis_check_report( libblis_check_rel_diff( &c, &c_lp64 ) == 0.0,
+			                      "%-10s matches dgemm_", "dgemm_64_" );
+
+			bli_obj_free( &c_lp64 );
+		}
+		else
+		{
+			zgemm_64_( "C", "N", &m, &n, &k, ( dcomplex* )alpha_z, bli_obj_buffer( &a ), &lda,
+			           bli_obj_buffer( &b ), &ldb, ( dcomplex* )beta_z, bli_obj_buffer( &c ), &ldc );
+		}
+
+		bli_obj_set_conjtrans( ( bli_is_real( dt ) ? BLIS_TRANSPOSE : BLIS_CONJ_TRANSPOSE ), &a );
+		bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+		report_resid( ( bli_is_real( dt ) ? "dgemm_64_" : "zgemm_64_" ),
+		              libblis_check_rel_diff( &c, &c_ref ) );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+}
+
+static void test_others( void )
+{
+	obj_t   alpha, beta, alpha_r, a, c, c_ref, x, y, y_ref, rho, idx;
+	double  alpha_d = 1.3, beta_d = 0.7;
+	double  r, s, si;
+	int64_t m = M, n = N, k = K, lda, ldc, inc1 = 1, inc2 = 2, i;
+
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha );
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &beta );
+	bli_setsc( alpha_d, 0.0, &alpha );
+	bli_setsc( beta_d,  0.0, &beta );
+
+	// dgemv_64_ (transposed, with non-unit increments).
+	create_op( BLIS_DOUBLE, M, N, &a );
+	bli_obj_create( BLIS_DOUBLE, M, 1, 2, 2 * M, &x );
+	bli_obj_create( BLIS_DOUBLE, N, 1, 2, 2 * N, &y );
+	bli_randv( &x );
+	bli_randv( &y );
+	copy_op( &y, &y_ref );
+	lda = bli_obj_col_stride( &a );
+
+	dgemv_64_( "T", &m, &n, &alpha_d, bli_obj_buffer( &a ), &lda,
+	           bli_obj_buffer( &x ), &inc2, &beta_d, bli_obj_buffer( &y ), &inc2 );
+
+	bli_obj_set_conjtrans( BLIS_TRANSPOSE, &a );
+	bli_gemv( &alpha, &a, &x, &beta, &y_ref );
+	report_resid( "dgemv_64_", libblis_check_rel_diff( &y, &y_ref ) );
+
+	// daxpy_64_, ddot_64_, and idamax_64_ (whose result is one-based).
+	bli_obj_free( &y_ref );
+	bli_obj_free( &y );
+	bli_obj_create( BLIS_DOUBLE, M, 1, 1, M, &y );
+	bli_randv( &y );
+	copy_op( &y, &y_ref );
+
+	daxpy_64_( &m, &alpha_d, bli_obj_buffer( &x ), &inc2, bli_obj_buffer( &y ), &inc1 );
+	bli_axpyv( &alpha, &x, &y_ref );
+	report_resid( "daxpy_64_", libblis_check_rel_diff( &y, &y_ref ) );
+
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &rho );
+	r = ddot_64_( &m, bli_obj_buffer( &x ), &inc2, bli_obj_buffer( &y ), &inc1 );
+	bli_dotv( &x, &y, &rho );
+	bli_getsc( &rho, &s, &si );
+	report_resid( "ddot_64_", fabs( r - s ) / fabs( s ) );
+
+	bli_obj_scalar_init_detached( BLIS_INT, &idx );
+	i = idamax_64_( &m, bli_obj_buffer( &x ), &inc2 );
+	bli_amaxv( &x, &idx );
+	libblis_check_report( i == *( dim_t* )bli_obj_buffer( &idx ) + 1,
+	                      "%-10s matches the object API", "idamax_64_" );
+
+	bli_obj_free( &a );
+	bli_obj_free( &x );
+	bli_obj_free( &y );
+	bli_obj_free( &y_ref );
+
+	// dtrsm_64_ (right, upper, transpose, non-unit diagonal).
+	create_op( BLIS_DOUBLE, N, N, &a );
+	make_tri( &a );
+	create_op( BLIS_DOUBLE, M, N, &c );
+	copy_op( &c, &c_ref );
+	lda = bli_obj_col_stride( &a );
+	ldc = bli_obj_col_stride( &c );
+
+	dtrsm_64_( "R", "U", "T", "N", &m, &n, &alpha_d, bli_obj_buffer( &a ), &lda,
+	           bli_obj_buffer( &c ), &ldc );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+	bli_obj_set_uplo( BLIS_UPPER, &a );
+	bli_obj_set_conjtrans( BLIS_TRANSPOSE, &a );
+	bli_trsm( BLIS_RIGHT, &alpha, &a, &c_ref );
+	report_resid( "dtrsm_64_", libblis_check_rel_diff( &c, &c_ref ) );
+
+	bli_obj_free( &a );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+
+	// zherk_64_ (lower, conjugate transpose), which takes real scalars.
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha_r );
+	bli_setsc( alpha_d, 0.0, &alpha_r );
+	create_op( BLIS_DCOMPLEX, K, N, &a );
+	create_op( BLIS_DCOMPLEX, N, N, &c );
+	bli_setid( &BLIS_ZERO, &c );
+	copy_op( &c, &c_ref );
+	lda = bli_obj_col_stride( &a );
+	ldc = bli_obj_col_stride( &c );
+
+	zherk_64_( "L", "C", &n, &k, &alpha_d, bli_obj_buffer( &a ), &lda,
+	           &beta_d, bli_obj_buffer( &c ), &ldc );
+
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &a );
+	bli_obj_set_struc( BLIS_HERMITIAN, &c_ref );
+	bli_obj_set_uplo( BLIS_LOWER, &c_ref );
+	bli_herk( &alpha_r, &a, &beta, &c_ref );
+	bli_obj_set_struc( BLIS_GENERAL, &c_ref );
+	bli_obj_set_uplo( BLIS_DENSE, &c_ref );
+	report_resid( "zherk_64_", libblis_check_rel_diff( &c, &c_ref ) );
+
+	bli_obj_free( &a );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+}
+
+static void test_info( void )
+{
+	double  a[ 16 ] = { 0 }, b[ 16 ] = { 0 }, c[ 16 ] = { 0 };
+	double  x[ 4 ] = { 0 }, y[ 4 ] = { 0 };
+	double  alpha = 1.0, beta = 0.0;
+	int64_t one = 1, two = 2, four = 4, zero = 0, neg = -1;
+	int64_t big_m = BIG + 4, big_n = BIG + 2;
+
+	dgemm_64_( "X", "N", &two, &two, &two, &alpha, a, &four, b, &four, &beta, c, &four );
+	report_info( "DGEMM", "transa = 'X'", 1 );
+
+	dgemm_64_( "N", "N", &two, &neg, &two, &alpha, a, &four, b, &four, &beta, c, &four );
+	report_info( "DGEMM", "n = -1", 4 );
+
+	// The low 32 bits of big_m are 4, which would pass for lda = 4.
+	dgemm_64_( "N", "N", &big_m, &two, &two, &alpha, a, &four, b, &four, &beta, c, &four );
+	report_info( "DGEMM", "m = 2^32 + 4, lda = 4", 8 );
+
+	dgemv_64_( "N", &big_m, &two, &alpha, a, &four, x, &one, &beta, y, &one );
+	report_info( "DGEMV", "m = 2^32 + 4, lda = 4", 6 );
+
+	dger_64_( &two, &two, &alpha, x, &zero, y, &one, a, &four );
+	report_info( "DGER", "incx = 0", 5 );
+
+	dtrsm_64_( "L", "L", "N", "N", &big_n, &two, &alpha, a, &two, b, &big_n );
+	report_info( "DTRSM", "m = 2^32 + 2, lda = 2", 9 );
+
+	zherk_64_( "L", "T", &two, &two, &alpha, ( dcomplex* )a, &four,
+	           &beta, ( dcomplex* )c, &four );
+	report_info( "ZHERK", "trans = 'T'", 2 );
+}
+
+int main( int argc, char** argv )
+{
+	bli_init();
+
+	test_gemm();
+	test_others();
+	test_info();
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	libblis_check_skip( "the 64-bit BLAS is not enabled (configure with --enable-blas64)" );
+
+	return 0;
+}
+
+#endif
@@ -0,0 +1,125 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "test_checks.h"
+
+// Check the runtime blocksize overrides read from BLIS_BLKSZ_FILE and
+// BLIS_BLKSZ. The file holds file-wide overrides, a section for another
+// sub-configuration (which must not affect this one), a section for the
+// running sub-configuration (which must take precedence over the file-wide
+// overrides), and a section for an unknown name (which is ignored). The
+// environment variable must take precedence over both, invalid values
+// must be rejected, and VT may be set to zero. BLIS is initialized once to
+// query the blocksizes set by the configuration and then again with the
+// overrides in place.
+
+typedef struct
+{
+	dim_t mc, kc, nc, vt_s, vt_d;
+} blkszs_t;
+
+static void query( blkszs_t* b )
+{
+	cntx_t* cntx = bli_gks_query_cntx();
+
+	b->mc   = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_MC, cntx );
+	b->kc   = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_KC, cntx );
+	b->nc   = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_NC, cntx );
+	b->vt_s = bli_cntx_get_blksz_def_dt( BLIS_FLOAT,  BLIS_VT, cntx );
+	b->vt_d = bli_cntx_get_blksz_def_dt( BLIS_DOUBLE, BLIS_VT, cntx );
+}
+
+int main( int argc, char** argv )
+{
+	char*     filename = "check_blksz.tmp";
+	char      env[ 256 ];
+	blkszs_t  b0, b1;
+	arch_t    id, id_other;
+	FILE*     file;
+
+	bli_init();
+	query( &b0 );
+	id = bli_arch_query_id();
+	bli_finalize();
+
+	id_other = ( id == BLIS_ARCH_GENERIC ? BLIS_ARCH_HASWELL : BLIS_ARCH_GENERIC );
+
+	file = fopen( filename, "w" );
+
+	if ( file == NULL )
+	{
+		libblis_check_skip( "unable to create a blocksize file in the current directory" );
+		return 0;
+	}
+
+	// Multiples of the configured cache blocksizes are always multiples
+	// of the corresponding register blocksizes.
+	fprintf( file, "# File-wide overrides.\n" );
+	fprintf( file, "MC_d=%ld NC_d=%ld\n", ( long )( 2 * b0.mc ), ( long )( 2 * b0.nc ) );
+	fprintf( file, "VT_d=0\n" );
+	fprintf( file, "[%s]\n", bli_arch_string( id_other ) );
+	fprintf( file, "MC_d=%ld KC_d=%ld\n", ( long )( 3 * b0.mc ), ( long )( 3 * b0.kc ) );
+	fprintf( file, "  [%s]  # this sub-configuration\n", bli_arch_string( id ) );
+	fprintf( file, "NC_d=%ld, KC_d=%ld\n", ( long )( 3 * b0.nc ), ( long )( 2 * b0.kc ) );
+	fprintf( file, "[no_such_arch]\n" );
+	fprintf( file, "MC_d=%ld\n", ( long )( 4 * b0.mc ) );
+	fclose( file );
+
+	snprintf( env, sizeof( env ), "KC_d=%ld MC_d=0 VT_s=-1",
+	          ( long )( 4 * b0.kc ) );
+
+	setenv( "BLIS_BLKSZ_FILE", filename, 1 );
+	setenv( "BLIS_BLKSZ", env, 1 );
+
+	bli_init();
+	query( &b1 );
+	bli_finalize();
+
+	unsetenv( "BLIS_BLKSZ_FILE" );
+	unsetenv( "BLIS_BLKSZ" );
+	remove( filename );
+
+	libblis_check_report( b1.mc == 2 * b0.mc,
+	                      "MC_d from the file-wide overrides      %5ld", ( long )b1.mc );
+	libblis_check_report( b1.nc == 3 * b0.nc,
+	                      "NC_d from the section for %-12s %5ld", bli_arch_string( id ), ( long )b1.nc );
+	libblis_check_report( b1.kc == 4 * b0.kc,
+	                      "KC_d from BLIS_BLKSZ                   %5ld", ( long )b1.kc );
+	libblis_check_report( b1.vt_d == 0,
+	                      "VT_d=0 accepted                        %5ld", ( long )b1.vt_d );
+	libblis_check_report( b1.vt_s == b0.vt_s,
+	                      "VT_s=-1 rejected                       %5ld", ( long )b1.vt_s );
+
+	return libblis_check_status();
+}
@@ -0,0 +1,886 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <math.h>
+#include "test_checks.h"
+
+// Check the CBLAS API against the object API. Every level-2 and level-3
+// operation is called with row-major and column-major operands (whose
+// leading dimensions exceed their sizes) and with every combination of its
+// side, uplo, trans, and diag parameters, in real and complex double
+// precision. Banded and packed operands are expanded into dense matrices
+// for the reference computation. A few level-1 operations, which do not
+// take an order, are checked as well.
+
+#ifdef BLIS_ENABLE_CBLAS
+
+#define M  7
+#define N  5
+#define K  6
+#define KL 2
+#define KU 1
+
+#define ALPHA_R  1.3
+#define ALPHA_I -0.4
+#define BETA_R   0.7
+#define BETA_I   0.2
+
+static enum CBLAS_ORDER     orders[ 2 ] = { CblasColMajor, CblasRowMajor };
+static enum CBLAS_SIDE      sides[ 2 ]  = { CblasLeft, CblasRight };
+static enum CBLAS_UPLO      uplos[ 2 ]  = { CblasLower, CblasUpper };
+static enum CBLAS_TRANSPOSE transs[ 3 ] = { CblasNoTrans, CblasTrans, CblasConjTrans };
+static enum CBLAS_DIAG      diags[ 2 ]  = { CblasNonUnit, CblasUnit };
+
+static dcomplex alpha_z = { ALPHA_R, ALPHA_I };
+static dcomplex beta_z  = { BETA_R,  BETA_I  };
+
+static obj_t alpha, beta, alpha_r, beta_r;
+
+static double resid_max;
+static dim_t  n_cases;
+
+// -- Operand helpers ----------------------------------------------------------
+
+static void create_mat( num_t dt, enum CBLAS_ORDER order, dim_t m, dim_t n,
+                        obj_t* x )
+{
+	if ( order == CblasColMajor ) bli_obj_create( dt, m, n, 1, m + 2, x );
+	else                          bli_obj_create( dt, m, n, n + 2, 1, x );
+
+	bli_randm( x );
+}
+
+static void create_vec( num_t dt, dim_t n, inc_t inc, obj_t* x )
+{
+	bli_obj_create( dt, n, 1, inc, inc * n, x );
+	bli_randm( x );
+}
+
+static f77_int ld_of( obj_t* x )
+{
+	return ( f77_int )bli_max( bli_obj_row_stride( x ),
+	                           bli_obj_col_stride( x ) );
+}
+
+static f77_int inc_of( obj_t* x )
+{
+	return ( f77_int )bli_obj_row_stride( x );
+}
+
+// Give the diagonal of a (complex) Hermitian matrix zero imaginary parts,
+// as BLAS assumes.
+static void make_herm( obj_t* a )
+{
+	if ( bli_obj_is_complex( a ) ) bli_setid( &BLIS_ZERO, a );
+}
+
+// Make a random square matrix well-conditioned for triangular solves.
+static void make_tri( obj_t* a )
+{
+	dim_t  n = bli_obj_length( a );
+	dim_t  i;
+	double ar, ai;
+	obj_t  s;
+
+	bli_obj_scalar_init_detached( bli_obj_dt( a ), &s );
+	bli_setsc( 1.0 / n, 0.0, &s );
+	bli_scalm( &s, a );
+
+	for ( i = 0; i < n; ++i )
+	{
+		bli_getijm( i, i, a, &ar, &ai );
+		bli_setijm( ar + 1.0, ai, i, i, a );
+	}
+}
+
+static void set_struc( obj_t* a, struc_t struc, enum CBLAS_UPLO uplo )
+{
+	uplo_t uplo_b;
+
+	bli_param_map_cblas_to_blis_uplo( uplo, &uplo_b );
+	bli_obj_set_struc( struc, a );
+	bli_obj_set_uplo( uplo_b, a );
+}
+
+static void set_tri( obj_t* a, enum CBLAS_UPLO uplo,
+                     enum CBLAS_TRANSPOSE trans, enum CBLAS_DIAG diag )
+{
+	trans_t trans_b;
+	diag_t  diag_b;
+
+	bli_param_map_cblas_to_blis_trans( trans, &trans_b );
+	bli_param_map_cblas_to_blis_diag( diag, &diag_b );
+
+	set_struc( a, BLIS_TRIANGULAR, uplo );
+	bli_obj_set_conjtrans( trans_b, a );
+	bli_obj_set_diag( diag_b, a );
+}
+
+static void set_trans( obj_t* a, enum CBLAS_TRANSPOSE trans )
+{
+	trans_t trans_b;
+
+	bli_param_map_cblas_to_blis_trans( trans, &trans_b );
+	bli_obj_set_conjtrans( trans_b, a );
+}
+
+static void record( obj_t* x, obj_t* x_ref )
+{
+	resid_max = bli_fmax( resid_max, libblis_check_rel_diff( x, x_ref ) );
+	n_cases  += 1;
+}
+
+static void record_scalar( double r, double ri, double s, double si )
+{
+	double d = sqrt( ( r - s ) * ( r - s ) + ( ri - si ) * ( ri - si ) );
+	double n = sqrt( s * s + si * si );
+
+	resid_max = bli_fmax( resid_max, ( n > 0.0 ? d / n : d ) );
+	n_cases  += 1;
+}
+
+static void report( char* op, num_t dt, char* order )
+{
+	libblis_check_report( resid_max < 1.0e-12,
+	                      "cblas %-6s %c %-9s %3d cases  %9.2e",
+	                      op, ( bli_is_complex( dt ) ? 'z' : 'd' ), order,
+	                      ( int )n_cases, resid_max );
+
+	resid_max = 0.0;
+	n_cases   = 0;
+}
+
+// -- Banded and packed storage ------------------------------------------------
+
+// Return the offset of element (i,j) of an m x n matrix with kl sub- and ku
+// super-diagonals within its band storage, or -1 if it is outside the band.
+static dim_t band_off( enum CBLAS_ORDER order, dim_t kl, dim_t ku, dim_t ld,
+                       dim_t i, dim_t j )
+{
+	if ( i - j > kl || j - i > ku ) return -1;
+
+	if ( order == CblasColMajor ) return ku + i - j + j * ld;
+	else                          return kl + j - i + i * ld;
+}
+
+// Return the offset of element (i,j) of an n x n matrix within its packed
+// storage, or -1 if it is outside the stored triangle.
+static dim_t packed_off( enum CBLAS_ORDER order, enum CBLAS_UPLO uplo,
+                         dim_t n, dim_t i, dim_t j )
+{
+	if ( ( uplo == CblasUpper && i > j ) ||
+	     ( uplo == CblasLower && i < j ) ) return -1;
+
+	// A row-major triangle is stored like the column-major transpose of
+	// the opposite triangle.
+	if ( order == CblasRowMajor )
+	{
+		dim_t t = i; i = j; j = t;
+		uplo = ( uplo == CblasUpper ? CblasLower : CblasUpper );
+	}
+
+	if ( uplo == CblasUpper ) return i + j * ( j + 1 ) / 2;
+	else                      return i - j + j * ( 2 * n - j + 1 ) / 2;
+}
+
+// Copy the elements of a dense matrix a that lie within its compact storage
+// (as given by a band or packed layout) to or from the vector ap. When
+// copying to a, the elements outside of the layout are set to zero.
+static void copy_compact( bool_t to_a, obj_t* a, obj_t* ap,
+                          enum CBLAS_ORDER order, enum CBLAS_UPLO uplo,
+                          dim_t kl, dim_t ku, dim_t ld )
+{
+	dim_t  m = bli_obj_length( a );
+	dim_t  n = bli_obj_width( a );
+	dim_t  i, j, off;
+	double ar, ai;
+
+	if ( to_a ) bli_setm( &BLIS_ZERO, a );
+
+	for ( j = 0; j < n; ++j )
+	for ( i = 0; i < m; ++i )
+	{
+		if ( ld > 0 ) off = band_off( order, kl, ku, ld, i, j );
+		else          off = packed_off( order, uplo, n, i, j );
+
+		if ( off < 0 ) continue;
+
+		if ( to_a )
+		{
+			bli_getijm( off, 0, ap, &ar, &ai );
+			bli_setijm( ar, ai, i, j, a );
+		}
+		else
+		{
+			bli_getijm( i, j, a, &ar, &ai );
+			bli_setijm( ar, ai, off, 0, ap );
+		}
+	}
+}
+
+// Create compact storage ap for the dense matrix a (whose elements outside
+// of the layout are then zeroed). A positive ld selects band storage.
+static void create_compact( obj_t* a, obj_t* ap, enum CBLAS_ORDER order,
+                            enum CBLAS_UPLO uplo, dim_t kl, dim_t ku,
+                            dim_t ld )
+{
+	dim_t m = bli_obj_length( a );
+	dim_t n = bli_obj_width( a );
+	dim_t len;
+
+	if      ( ld <= 0 )                len = n * ( n + 1 ) / 2;
+	else if ( order == CblasColMajor ) len = ld * n;
+	else                               len = ld * m;
+
+	create_vec( bli_obj_dt( a ), len, 1, ap );
+
+	copy_compact( FALSE, a, ap, order, uplo, kl, ku, ld );
+	copy_compact( TRUE,  a, ap, order, uplo, kl, ku, ld );
+}
+
+// -- Level 1 ------------------------------------------------------------------
+
+static void test_level1( num_t dt )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        x, y, y_ref, rho, norm, idx;
+	double       r, ri, s, si;
+	dcomplex     rz;
+	f77_int      i;
+
+	create_vec( dt, N, 2, &x );
+	create_vec( dt, N, 1, &y );
+	bli_obj_create_conf_to( &y, &y_ref );
+	bli_copym( &y, &y_ref );
+
+	if ( z ) cblas_zaxpy( N, &alpha_z, bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1 );
+	else     cblas_daxpy( N, ALPHA_R,  bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1 );
+	bli_axpyv( &alpha, &x, &y_ref );
+	record( &y, &y_ref );
+	report( "axpy", dt, "" );
+
+	bli_obj_scalar_init_detached( dt, &rho );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+	bli_obj_scalar_init_detached( BLIS_INT, &idx );
+
+	if ( z ) { cblas_zdotc_sub( N, bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1, &rz );
+	           r = rz.real; ri = rz.imag; }
+	else     { r = cblas_ddot( N, bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1 ); ri = 0.0; }
+	bli_obj_set_conj( BLIS_CONJUGATE, &x );
+	bli_dotv( &x, &y, &rho );
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, &x );
+	bli_getsc( &rho, &s, &si );
+	record_scalar( r, ri, s, si );
+	report( ( z ? "dotc" : "dot" ), dt, "" );
+
+	if ( z ) r = cblas_dznrm2( N, bli_obj_buffer( &x ), 2 );
+	else     r = cblas_dnrm2( N, bli_obj_buffer( &x ), 2 );
+	bli_normfv( &x, &norm );
+	bli_getsc( &norm, &s, &si );
+	record_scalar( r, 0.0, s, 0.0 );
+	report( "nrm2", dt, "" );
+
+	if ( z ) i = cblas_izamax( N, bli_obj_buffer( &x ), 2 );
+	else     i = cblas_idamax( N, bli_obj_buffer( &x ), 2 );
+	bli_amaxv( &x, &idx );
+	record_scalar( ( double )i, 0.0, ( double )*( dim_t* )bli_obj_buffer( &idx ), 0.0 );
+	report( "iamax", dt, "" );
+
+	bli_obj_free( &x );
+	bli_obj_free( &y );
+	bli_obj_free( &y_ref );
+}
+
+// -- Level 2 ------------------------------------------------------------------
+
+static void test_gemv( num_t dt, enum CBLAS_ORDER order, bool_t banded )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, ap, x, y, y_ref;
+	dim_t        it;
+	f77_int      ld = KL + KU + 3;
+
+	for ( it = 0; it < 3; ++it )
+	{
+		enum CBLAS_TRANSPOSE trans = transs[ it ];
+		dim_t                m_x   = ( trans == CblasNoTrans ? N : M );
+		dim_t                m_y   = ( trans == CblasNoTrans ? M : N );
+
+		create_mat( dt, order, M, N, &a );
+		create_vec( dt, m_x, 2, &x );
+		create_vec( dt, m_y, 1, &y );
+		bli_obj_create_conf_to( &y, &y_ref );
+		bli_copym( &y, &y_ref );
+
+		if ( banded )
+		{
+			create_compact( &a, &ap, order, CblasUpper, KL, KU, ld );
+
+			if ( z ) cblas_zgbmv( order, trans, M, N, KL, KU, &alpha_z, bli_obj_buffer( &ap ), ld,
+			                      bli_obj_buffer( &x ), 2, &beta_z, bli_obj_buffer( &y ), 1 );
+			else     cblas_dgbmv( order, trans, M, N, KL, KU, ALPHA_R, bli_obj_buffer( &ap ), ld,
+			                      bli_obj_buffer( &x ), 2, BETA_R, bli_obj_buffer( &y ), 1 );
+
+			bli_obj_free( &ap );
+		}
+		else
+		{
+			if ( z ) cblas_zgemv( order, trans, M, N, &alpha_z, bli_obj_buffer( &a ), ld_of( &a ),
+			                      bli_obj_buffer( &x ), 2, &beta_z, bli_obj_buffer( &y ), 1 );
+			else     cblas_dgemv( order, trans, M, N, ALPHA_R, bli_obj_buffer( &a ), ld_of( &a ),
+			                      bli_obj_buffer( &x ), 2, BETA_R, bli_obj_buffer( &y ), 1 );
+		}
+
+		set_trans( &a, trans );
+		bli_gemv( &alpha, &a, &x, &beta, &y_ref );
+		record( &y, &y_ref );
+
+		bli_obj_free( &a );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &y_ref );
+	}
+}
+
+static void test_ger( num_t dt, enum CBLAS_ORDER order )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, a_ref, x, y;
+	dim_t        ic;
+
+	for ( ic = 0; ic < ( z ? 2 : 1 ); ++ic )
+	{
+		create_mat( dt, order, M, N, &a );
+		create_vec( dt, M, 2, &x );
+		create_vec( dt, N, 1, &y );
+		bli_obj_create_conf_to( &a, &a_ref );
+		bli_copym( &a, &a_ref );
+
+		if      ( !z )     cblas_dger(  order, M, N, ALPHA_R, bli_obj_buffer( &x ), 2,
+		                                bli_obj_buffer( &y ), 1, bli_obj_buffer( &a ), ld_of( &a ) );
+		else if ( ic == 0 ) cblas_zgeru( order, M, N, &alpha_z, bli_obj_buffer( &x ), 2,
+		                                bli_obj_buffer( &y ), 1, bli_obj_buffer( &a ), ld_of( &a ) );
+		else               cblas_zgerc( order, M, N, &alpha_z, bli_obj_buffer( &x ), 2,
+		                                bli_obj_buffer( &y ), 1, bli_obj_buffer( &a ), ld_of( &a ) );
+
+		if ( ic == 1 ) bli_obj_set_conj( BLIS_CONJUGATE, &y );
+		bli_ger( &alpha, &x, &y, &a_ref );
+		record( &a, &a_ref );
+
+		bli_obj_free( &a );
+		bli_obj_free( &a_ref );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+	}
+}
+
+// Check symv/hemv (storage 0), sbmv/hbmv (storage 1), and spmv/hpmv
+// (storage 2).
+static void test_hemv( num_t dt, enum CBLAS_ORDER order, dim_t storage )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, ap, x, y, y_ref;
+	dim_t        iu;
+	f77_int      ld = KU + 2;
+
+	for ( iu = 0; iu < 2; ++iu )
+	{
+		enum CBLAS_UPLO uplo = uplos[ iu ];
+		dim_t           kl   = ( uplo == CblasLower ? KU : 0 );
+		dim_t           ku   = ( uplo == CblasUpper ? KU : 0 );
+		void*           a_p;
+		f77_int         lda;
+
+		create_mat( dt, order, N, N, &a );
+		make_herm( &a );
+		create_vec( dt, N, 2, &x );
+		create_vec( dt, N, 1, &y );
+		bli_obj_create_conf_to( &y, &y_ref );
+		bli_copym( &y, &y_ref );
+
+		if ( storage == 1 )
+		{
+			create_compact( &a, &ap, order, uplo, kl, ku, ld );
+			a_p = bli_obj_buffer( &ap ); lda = ld;
+		}
+		else if ( storage == 2 )
+		{
+			create_compact( &a, &ap, order, uplo, 0, 0, 0 );
+			a_p = bli_obj_buffer( &ap ); lda = 0;
+		}
+		else
+		{
+			a_p = bli_obj_buffer( &a ); lda = ld_of( &a );
+		}
+
+		if ( storage == 0 )
+		{
+			if ( z ) cblas_zhemv( order, uplo, N, &alpha_z, a_p, lda, bli_obj_buffer( &x ), 2,
+			                      &beta_z, bli_obj_buffer( &y ), 1 );
+			else     cblas_dsymv( order, uplo, N, ALPHA_R, a_p, lda, bli_obj_buffer( &x ), 2,
+			                      BETA_R, bli_obj_buffer( &y ), 1 );
+		}
+		else if ( storage == 1 )
+		{
+			if ( z ) cblas_zhbmv( order, uplo, N, KU, &alpha_z, a_p, lda, bli_obj_buffer( &x ), 2,
+			                      &beta_z, bli_obj_buffer( &y ), 1 );
+			else     cblas_dsbmv( order, uplo, N, KU, ALPHA_R, a_p, lda, bli_obj_buffer( &x ), 2,
+			                      BETA_R, bli_obj_buffer( &y ), 1 );
+		}
+		else
+		{
+			if ( z ) cblas_zhpmv( order, uplo, N, &alpha_z, a_p, bli_obj_buffer( &x ), 2,
+			                      &beta_z, bli_obj_buffer( &y ), 1 );
+			else     cblas_dspmv( order, uplo, N, ALPHA_R, a_p, bli_obj_buffer( &x ), 2,
+			                      BETA_R, bli_obj_buffer( &y ), 1 );
+		}
+
+		set_struc( &a, BLIS_HERMITIAN, uplo );
+		bli_hemv( &alpha, &a, &x, &beta, &y_ref );
+		record( &y, &y_ref );
+
+		if ( storage != 0 ) bli_obj_free( &ap );
+		bli_obj_free( &a );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &y_ref );
+	}
+}
+
+// Check trmv/trsv (storage 0), tbmv/tbsv (storage 1), and tpmv/tpsv
+// (storage 2).
+static void test_trmv( num_t dt, enum CBLAS_ORDER order, dim_t storage,
+                       bool_t solve )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, ap, x, x_ref;
+	dim_t        iu, it, id;
+	f77_int      ld = KU + 2;
+
+	for ( iu = 0; iu < 2; ++iu )
+	for ( it = 0; it < 3; ++it )
+	for ( id = 0; id < 2; ++id )
+	{
+		enum CBLAS_UPLO      uplo  = uplos[ iu ];
+		enum CBLAS_TRANSPOSE trans = transs[ it ];
+		enum CBLAS_DIAG      diag  = diags[ id ];
+		dim_t                kl    = ( uplo == CblasLower ? KU : 0 );
+		dim_t                ku    = ( uplo == CblasUpper ? KU : 0 );
+		void*                a_p;
+		f77_int              lda;
+
+		create_mat( dt, order, N, N, &a );
+		make_tri( &a );
+		create_vec( dt, N, 2, &x );
+		bli_obj_create_conf_to( &x, &x_ref );
+		bli_copym( &x, &x_ref );
+
+		if ( storage == 1 )
+		{
+			create_compact( &a, &ap, order, uplo, kl, ku, ld );
+			a_p = bli_obj_buffer( &ap ); lda = ld;
+		}
+		else if ( storage == 2 )
+		{
+			create_compact( &a, &ap, order, uplo, 0, 0, 0 );
+			a_p = bli_obj_buffer( &ap ); lda = 0;
+		}
+		else
+		{
+			a_p = bli_obj_buffer( &a ); lda = ld_of( &a );
+		}
+
+		if ( z )
+		{
+			if      ( storage == 0 && !solve ) cblas_ztrmv( order, uplo, trans, diag, N, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( storage == 0 )           cblas_ztrsv( order, uplo, trans, diag, N, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( storage == 1 && !solve ) cblas_ztbmv( order, uplo, trans, diag, N, KU, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( storage == 1 )           cblas_ztbsv( order, uplo, trans, diag, N, KU, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( !solve )                 cblas_ztpmv( order, uplo, trans, diag, N, a_p, bli_obj_buffer( &x ), 2 );
+			else                               cblas_ztpsv( order, uplo, trans, diag, N, a_p, bli_obj_buffer( &x ), 2 );
+		}
+		else
+		{
+			if      ( storage == 0 && !solve ) cblas_dtrmv( order, uplo, trans, diag, N, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( storage == 0 )           cblas_dtrsv( order, uplo, trans, diag, N, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( storage == 1 && !solve ) cblas_dtbmv( order, uplo, trans, diag, N, KU, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( storage == 1 )           cblas_dtbsv( order, uplo, trans, diag, N, KU, a_p, lda, bli_obj_buffer( &x ), 2 );
+			else if ( !solve )                 cblas_dtpmv( order, uplo, trans, diag, N, a_p, bli_obj_buffer( &x ), 2 );
+			else                               cblas_dtpsv( order, uplo, trans, diag, N, a_p, bli_obj_buffer( &x ), 2 );
+		}
+
+		set_tri( &a, uplo, trans, diag );
+		if ( solve ) bli_trsv( &BLIS_ONE, &a, &x_ref );
+		else         bli_trmv( &BLIS_ONE, &a, &x_ref );
+		record( &x, &x_ref );
+
+		if ( storage != 0 ) bli_obj_free( &ap );
+		bli_obj_free( &a );
+		bli_obj_free( &x );
+		bli_obj_free( &x_ref );
+	}
+}
+
+// Check syr/her and syr2/her2 (packed = FALSE), and spr/hpr and spr2/hpr2
+// (packed = TRUE).
+static void test_her( num_t dt, enum CBLAS_ORDER order, bool_t packed,
+                      bool_t rank2 )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, a_ref, ap, x, y;
+	dim_t        iu;
+
+	for ( iu = 0; iu < 2; ++iu )
+	{
+		enum CBLAS_UPLO uplo = uplos[ iu ];
+		void*           a_p;
+		f77_int         lda;
+
+		create_mat( dt, order, N, N, &a );
+		make_herm( &a );
+		create_vec( dt, N, 2, &x );
+		create_vec( dt, N, 1, &y );
+
+		if ( packed )
+		{
+			create_compact( &a, &ap, order, uplo, 0, 0, 0 );
+			a_p = bli_obj_buffer( &ap ); lda = 0;
+		}
+		else
+		{
+			a_p = bli_obj_buffer( &a ); lda = ld_of( &a );
+		}
+
+		bli_obj_create_conf_to( &a, &a_ref );
+		bli_copym( &a, &a_ref );
+
+		if ( z )
+		{
+			if      ( !packed && !rank2 ) cblas_zher(  order, uplo, N, ALPHA_R, bli_obj_buffer( &x ), 2, a_p, lda );
+			else if ( !packed )           cblas_zher2( order, uplo, N, &alpha_z, bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1, a_p, lda );
+			else if ( !rank2 )            cblas_zhpr(  order, uplo, N, ALPHA_R, bli_obj_buffer( &x ), 2, a_p );
+			else                          cblas_zhpr2( order, uplo, N, &alpha_z, bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1, a_p );
+		}
+		else
+		{
+			if      ( !packed && !rank2 ) cblas_dsyr(  order, uplo, N, ALPHA_R, bli_obj_buffer( &x ), 2, a_p, lda );
+			else if ( !packed )           cblas_dsyr2( order, uplo, N, ALPHA_R, bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1, a_p, lda );
+			else if ( !rank2 )            cblas_dspr(  order, uplo, N, ALPHA_R, bli_obj_buffer( &x ), 2, a_p );
+			else                          cblas_dspr2( order, uplo, N, ALPHA_R, bli_obj_buffer( &x ), 2, bli_obj_buffer( &y ), 1, a_p );
+		}
+
+		if ( packed ) copy_compact( TRUE, &a, &ap, order, uplo, 0, 0, 0 );
+
+		set_struc( &a_ref, BLIS_HERMITIAN, uplo );
+		if ( rank2 ) bli_her2( &alpha, &x, &y, &a_ref );
+		else         bli_her( &alpha_r, &x, &a_ref );
+		bli_obj_set_struc( BLIS_GENERAL, &a_ref );
+		bli_obj_set_uplo( BLIS_DENSE, &a_ref );
+		record( &a, &a_ref );
+
+		if ( packed ) bli_obj_free( &ap );
+		bli_obj_free( &a );
+		bli_obj_free( &a_ref );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+	}
+}
+
+// -- Level 3 ------------------------------------------------------------------
+
+static void test_gemm( num_t dt, enum CBLAS_ORDER order )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, b, c, c_ref;
+	dim_t        ia, ib;
+
+	for ( ia = 0; ia < 3; ++ia )
+	for ( ib = 0; ib < 3; ++ib )
+	{
+		enum CBLAS_TRANSPOSE transa = transs[ ia ];
+		enum CBLAS_TRANSPOSE transb = transs[ ib ];
+
+		if ( transa == CblasNoTrans ) create_mat( dt, order, M, K, &a );
+		else                          create_mat( dt, order, K, M, &a );
+		if ( transb == CblasNoTrans ) create_mat( dt, order, K, N, &b );
+		else                          create_mat( dt, order, N, K, &b );
+		create_mat( dt, order, M, N, &c );
+		bli_obj_create_conf_to( &c, &c_ref );
+		bli_copym( &c, &c_ref );
+
+		if ( z ) cblas_zgemm( order, transa, transb, M, N, K, &alpha_z,
+		                      bli_obj_buffer( &a ), ld_of( &a ),
+		                      bli_obj_buffer( &b ), ld_of( &b ), &beta_z,
+		                      bli_obj_buffer( &c ), ld_of( &c ) );
+		else     cblas_dgemm( order, transa, transb, M, N, K, ALPHA_R,
+		                      bli_obj_buffer( &a ), ld_of( &a ),
+		                      bli_obj_buffer( &b ), ld_of( &b ), BETA_R,
+		                      bli_obj_buffer( &c ), ld_of( &c ) );
+
+		set_trans( &a, transa );
+		set_trans( &b, transb );
+		bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+		record( &c, &c_ref );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+}
+
+static void test_hemm( num_t dt, enum CBLAS_ORDER order )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, b, c, c_ref;
+	dim_t        is, iu;
+
+	for ( is = 0; is < 2; ++is )
+	for ( iu = 0; iu < 2; ++iu )
+	{
+		enum CBLAS_SIDE side = sides[ is ];
+		enum CBLAS_UPLO uplo = uplos[ iu ];
+		dim_t           m_a  = ( side == CblasLeft ? M : N );
+		side_t          side_b;
+
+		create_mat( dt, order, m_a, m_a, &a );
+		make_herm( &a );
+		create_mat( dt, order, M, N, &b );
+		create_mat( dt, order, M, N, &c );
+		bli_obj_create_conf_to( &c, &c_ref );
+		bli_copym( &c, &c_ref );
+
+		if ( z ) cblas_zhemm( order, side, uplo, M, N, &alpha_z,
+		                      bli_obj_buffer( &a ), ld_of( &a ),
+		                      bli_obj_buffer( &b ), ld_of( &b ), &beta_z,
+		                      bli_obj_buffer( &c ), ld_of( &c ) );
+		else     cblas_dsymm( order, side, uplo, M, N, ALPHA_R,
+		                      bli_obj_buffer( &a ), ld_of( &a ),
+		                      bli_obj_buffer( &b ), ld_of( &b ), BETA_R,
+		                      bli_obj_buffer( &c ), ld_of( &c ) );
+
+		bli_param_map_cblas_to_blis_side( side, &side_b );
+		set_struc( &a, BLIS_HERMITIAN, uplo );
+		bli_hemm( side_b, &alpha, &a, &b, &beta, &c_ref );
+		record( &c, &c_ref );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+}
+
+static void test_herk( num_t dt, enum CBLAS_ORDER order, bool_t rank2 )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, b, c, c_ref;
+	dim_t        iu, it;
+
+	for ( iu = 0; iu < 2; ++iu )
+	for ( it = 0; it < 2; ++it )
+	{
+		enum CBLAS_UPLO      uplo  = uplos[ iu ];
+		enum CBLAS_TRANSPOSE trans = ( it == 0 ? CblasNoTrans :
+		                               z ? CblasConjTrans : CblasTrans );
+
+		if ( trans == CblasNoTrans ) { create_mat( dt, order, N, K, &a );
+		                               create_mat( dt, order, N, K, &b ); }
+		else                         { create_mat( dt, order, K, N, &a );
+		                               create_mat( dt, order, K, N, &b ); }
+		create_mat( dt, order, N, N, &c );
+		make_herm( &c );
+		bli_obj_create_conf_to( &c, &c_ref );
+		bli_copym( &c, &c_ref );
+
+		if ( z )
+		{
+			if ( rank2 ) cblas_zher2k( order, uplo, trans, N, K, &alpha_z,
+			                           bli_obj_buffer( &a ), ld_of( &a ),
+			                           bli_obj_buffer( &b ), ld_of( &b ), BETA_R,
+			                           bli_obj_buffer( &c ), ld_of( &c ) );
+			else         cblas_zherk( order, uplo, trans, N, K, ALPHA_R,
+			                          bli_obj_buffer( &a ), ld_of( &a ), BETA_R,
+			                          bli_obj_buffer( &c ), ld_of( &c ) );
+		}
+		else
+		{
+			if ( rank2 ) cblas_dsyr2k( order, uplo, trans, N, K, ALPHA_R,
+			                           bli_obj_buffer( &a ), ld_of( &a ),
+			                           bli_obj_buffer( &b ), ld_of( &b ), BETA_R,
+			                           bli_obj_buffer( &c ), ld_of( &c ) );
+			else         cblas_dsyrk( order, uplo, trans, N, K, ALPHA_R,
+			                          bli_obj_buffer( &a ), ld_of( &a ), BETA_R,
+			                          bli_obj_buffer( &c ), ld_of( &c ) );
+		}
+
+		set_trans( &a, trans );
+		set_trans( &b, trans );
+		set_struc( &c_ref, BLIS_HERMITIAN, uplo );
+		if ( rank2 ) bli_her2k( &alpha, &a, &b, &beta_r, &c_ref );
+		else         bli_herk( &alpha_r, &a, &beta_r, &c_ref );
+		bli_obj_set_struc( BLIS_GENERAL, &c_ref );
+		bli_obj_set_uplo( BLIS_DENSE, &c_ref );
+		record( &c, &c_ref );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+}
+
+static void test_trmm( num_t dt, enum CBLAS_ORDER order, bool_t solve )
+{
+	const bool_t z = bli_is_complex( dt );
+	obj_t        a, b, b_ref;
+	dim_t        is, iu, it, id;
+
+	for ( is = 0; is < 2; ++is )
+	for ( iu = 0; iu < 2; ++iu )
+	for ( it = 0; it < 3; ++it )
+	for ( id = 0; id < 2; ++id )
+	{
+		enum CBLAS_SIDE      side  = sides[ is ];
+		enum CBLAS_UPLO      uplo  = uplos[ iu ];
+		enum CBLAS_TRANSPOSE trans = transs[ it ];
+		enum CBLAS_DIAG      diag  = diags[ id ];
+		dim_t                m_a   = ( side == CblasLeft ? M : N );
+		side_t               side_b;
+
+		create_mat( dt, order, m_a, m_a, &a );
+		make_tri( &a );
+		create_mat( dt, order, M, N, &b );
+		bli_obj_create_conf_to( &b, &b_ref );
+		bli_copym( &b, &b_ref );
+
+		if ( z )
+		{
+			if ( solve ) cblas_ztrsm( order, side, uplo, trans, diag, M, N, &alpha_z,
+			                          bli_obj_buffer( &a ), ld_of( &a ),
+			                          bli_obj_buffer( &b ), ld_of( &b ) );
+			else         cblas_ztrmm( order, side, uplo, trans, diag, M, N, &alpha_z,
+			                          bli_obj_buffer( &a ), ld_of( &a ),
+			                          bli_obj_buffer( &b ), ld_of( &b ) );
+		}
+		else
+		{
+			if ( solve ) cblas_dtrsm( order, side, uplo, trans, diag, M, N, ALPHA_R,
+			                          bli_obj_buffer( &a ), ld_of( &a ),
+			                          bli_obj_buffer( &b ), ld_of( &b ) );
+			else         cblas_dtrmm( order, side, uplo, trans, diag, M, N, ALPHA_R,
+			                          bli_obj_buffer( &a ), ld_of( &a ),
+			                          bli_obj_buffer( &b ), ld_of( &b ) );
+		}
+
+		bli_param_map_cblas_to_blis_side( side, &side_b );
+		set_tri( &a, uplo, trans, diag );
+		if ( solve ) bli_trsm( side_b, &alpha, &a, &b_ref );
+		else         bli_trmm( side_b, &alpha, &a, &b_ref );
+		record( &b, &b_ref );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &b_ref );
+	}
+}
+
+int main( int argc, char** argv )
+{
+	num_t dts[ 2 ] = { BLIS_DOUBLE, BLIS_DCOMPLEX };
+	dim_t id, io;
+
+	bli_init();
+
+	for ( id = 0; id < 2; ++id )
+	{
+		num_t dt = dts[ id ];
+		bool_t z = bli_is_complex( dt );
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha_r );
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &beta_r );
+		bli_setsc( ALPHA_R, ALPHA_I, &alpha );
+		bli_setsc( BETA_R,  BETA_I,  &beta );
+		bli_setsc( ALPHA_R, 0.0,     &alpha_r );
+		bli_setsc( BETA_R,  0.0,     &beta_r );
+
+		test_level1( dt );
+
+		for ( io = 0; io < 2; ++io )
+		{
+			enum CBLAS_ORDER order = orders[ io ];
+			char*            os    = ( order == CblasColMajor ? "col-major" : "row-major" );
+
+			test_gemv( dt, order, FALSE );   report( "gemv",  dt, os );
+			test_gemv( dt, order, TRUE );    report( "gbmv",  dt, os );
+			test_ger( dt, order );           report( z ? "geru/c" : "ger", dt, os );
+			test_hemv( dt, order, 0 );       report( z ? "hemv" : "symv", dt, os );
+			test_hemv( dt, order, 1 );       report( z ? "hbmv" : "sbmv", dt, os );
+			test_hemv( dt, order, 2 );       report( z ? "hpmv" : "spmv", dt, os );
+			test_trmv( dt, order, 0, FALSE ); report( "trmv",  dt, os );
+			test_trmv( dt, order, 0, TRUE );  report( "trsv",  dt, os );
+			test_trmv( dt, order, 1, FALSE ); report( "tbmv",  dt, os );
+			test_trmv( dt, order, 1, TRUE );  report( "tbsv",  dt, os );
+			test_trmv( dt, order, 2, FALSE ); report( "tpmv",  dt, os );
+			test_trmv( dt, order, 2, TRUE );  report( "tpsv",  dt, os );
+			test_her( dt, order, FALSE, FALSE ); report( z ? "her"  : "syr",  dt, os );
+			test_her( dt, order, FALSE, TRUE );  report( z ? "her2" : "syr2", dt, os );
+			test_her( dt, order, TRUE,  FALSE ); report( z ? "hpr"  : "spr",  dt, os );
+			test_her( dt, order, TRUE,  TRUE );  report( z ? "hpr2" : "spr2", dt, os );
+			test_gemm( dt, order );          report( "gemm",  dt, os );
+			test_hemm( dt, order );          report( z ? "hemm" : "symm", dt, os );
+			test_herk( dt, order, FALSE );   report( z ? "herk" : "syrk", dt, os );
+			test_herk( dt, order, TRUE );    report( z ? "her2k" : "syr2k", dt, os );
+			test_trmm( dt, order, FALSE );   report( "trmm",  dt, os );
+			test_trmm( dt, order, TRUE );    report( "trsm",  dt, os );
+		}
+	}
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	libblis_check_skip( "the CBLAS API is not enabled (configure with --enable-cblas)" );
+
+	return 0;
+}
+
+#endif
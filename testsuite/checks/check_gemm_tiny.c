@@ -0,0 +1,241 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "test_checks.h"
+
+// Check the tiny gemm path of the typed API (bli_?gemm()). For every
+// datatype and every combination of transa and transb, gemm is computed
+// for all m, n, and k in a set of sizes up to BLIS_TINY_GEMM_MAX_DIM
+// (including micro-tile fringes), with column-, row-, and general-stored
+// operands, and with zero and nonzero beta. Each result is compared against
+// the object API, which never takes the tiny path. Each case is also given
+// to bli_?gemm_tiny() directly, which must accept some of them whenever
+// complex problems are computed natively.
+
+#define N_DIMS 5
+
+static dim_t dims[ N_DIMS ] = { 1, 3, 8, 13, BLIS_TINY_GEMM_MAX_DIM };
+
+static trans_t transs[ 4 ] =
+{
+	BLIS_NO_TRANSPOSE,
+	BLIS_TRANSPOSE,
+	BLIS_CONJ_NO_TRANSPOSE,
+	BLIS_CONJ_TRANSPOSE
+};
+
+static char trans_chars[ 4 ] = { 'n', 't', 'c', 'h' };
+
+// Create an m x n operand that is column-stored (stor = 0), row-stored
+// (stor = 1), or general-stored (stor = 2), with padding between columns
+// or rows.
+static void create_op( num_t dt, dim_t m, dim_t n, dim_t stor, obj_t* x )
+{
+	inc_t rs, cs;
+
+	if      ( stor == 0 ) { rs = 1;     cs = m + 3; }
+	else if ( stor == 1 ) { rs = n + 3; cs = 1; }
+	else                  { rs = 2;     cs = 2 * m + 3; }
+
+	bli_obj_create( dt, m, n, rs, cs, x );
+	bli_randm( x );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  b, \
+       obj_t*  beta, \
+       obj_t*  c, \
+       obj_t*  c_tiny  \
+     ) \
+{ \
+	const dim_t m = bli_obj_length( c ); \
+	const dim_t n = bli_obj_width( c ); \
+	const dim_t k = ( bli_does_trans( transa ) ? bli_obj_length( a ) \
+	                                           : bli_obj_width( a ) ); \
+\
+	PASTEMAC(ch,gemm) \
+	( \
+	  transa, transb, m, n, k, \
+	  bli_obj_buffer_for_1x1( PASTEMAC(ch,type), alpha ), \
+	  bli_obj_buffer( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ), \
+	  bli_obj_buffer( b ), bli_obj_row_stride( b ), bli_obj_col_stride( b ), \
+	  bli_obj_buffer_for_1x1( PASTEMAC(ch,type), beta ), \
+	  bli_obj_buffer( c ), bli_obj_row_stride( c ), bli_obj_col_stride( c ) \
+	); \
+\
+	return PASTEMAC(ch,gemm_tiny) \
+	( \
+	  transa, transb, m, n, k, \
+	  bli_obj_buffer_for_1x1( PASTEMAC(ch,type), alpha ), \
+	  bli_obj_buffer( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ), \
+	  bli_obj_buffer( b ), bli_obj_row_stride( b ), bli_obj_col_stride( b ), \
+	  bli_obj_buffer_for_1x1( PASTEMAC(ch,type), beta ), \
+	  bli_obj_buffer( c_tiny ), bli_obj_row_stride( c_tiny ), \
+	                            bli_obj_col_stride( c_tiny ), \
+	  NULL \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_typed )
+
+// Compute one case via the typed API, bli_?gemm_tiny(), and the object
+// API, and return the larger of the two relative differences. *tiny is
+// set if bli_?gemm_tiny() computed the product.
+static double test_case
+     (
+       num_t   dt,
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   stor,
+       bool_t* tiny
+     )
+{
+	obj_t  alpha, beta, a, b, c, c_tiny, c_ref;
+	dim_t  m_a, n_a, m_b, n_b;
+	err_t  r_val = BLIS_FAILURE;
+	double resid;
+
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b );
+
+	// Rotate the storage schemes so that each operand sees all three.
+	create_op( dt, m_a, n_a, stor,             &a );
+	create_op( dt, m_b, n_b, ( stor + 1 ) % 3, &b );
+	create_op( dt, m,   n,   ( stor + 2 ) % 3, &c );
+	create_op( dt, m,   n,   ( stor + 2 ) % 3, &c_tiny );
+	bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+	bli_copym( &c, &c_tiny );
+	bli_copym( &c, &c_ref );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_setsc(  1.2, -0.7, &alpha );
+	bli_setsc( ( stor == 2 ? 0.0 : 0.9 ), ( stor == 2 ? 0.0 : 0.3 ), &beta );
+
+	if      ( dt == BLIS_FLOAT    ) r_val = bli_sgemm_typed( transa, transb, &alpha, &a, &b, &beta, &c, &c_tiny );
+	else if ( dt == BLIS_DOUBLE   ) r_val = bli_dgemm_typed( transa, transb, &alpha, &a, &b, &beta, &c, &c_tiny );
+	else if ( dt == BLIS_SCOMPLEX ) r_val = bli_cgemm_typed( transa, transb, &alpha, &a, &b, &beta, &c, &c_tiny );
+	else if ( dt == BLIS_DCOMPLEX ) r_val = bli_zgemm_typed( transa, transb, &alpha, &a, &b, &beta, &c, &c_tiny );
+
+	bli_obj_set_conjtrans( transa, &a );
+	bli_obj_set_conjtrans( transb, &b );
+
+	bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+
+	*tiny = ( r_val == BLIS_SUCCESS );
+
+	resid = libblis_check_rel_diff( &c, &c_ref );
+
+	if ( *tiny )
+		resid = bli_fmaxabs( resid, libblis_check_rel_diff( &c_tiny, &c_ref ) );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_tiny );
+	bli_obj_free( &c_ref );
+
+	return resid;
+}
+
+static void test_trans( num_t dt, dim_t ia, dim_t ib )
+{
+	double thresh = ( bli_is_single_prec( dt ) ? 1.0e-5 : 1.0e-13 );
+	double resid_max = 0.0;
+	dim_t  n_cases = 0, n_tiny = 0;
+	dim_t  im, in, ik, stor;
+	bool_t tiny;
+	char   dt_char;
+
+	bli_param_map_blis_to_char_dt( dt, &dt_char );
+
+	for ( im = 0; im < N_DIMS; ++im )
+	for ( in = 0; in < N_DIMS; ++in )
+	for ( ik = 0; ik < N_DIMS; ++ik )
+	for ( stor = 0; stor < 3; ++stor )
+	{
+		double resid = test_case( dt, transs[ ia ], transs[ ib ],
+		                          dims[ im ], dims[ in ], dims[ ik ],
+		                          stor, &tiny );
+
+		resid_max = bli_fmaxabs( resid_max, resid );
+		n_cases  += 1;
+		n_tiny   += ( tiny ? 1 : 0 );
+	}
+
+	// The tiny path defers to the conventional one when an induced method
+	// would be used, so only require it to be taken for native execution.
+	bool_t taken = ( n_tiny > 0 ||
+	                 bli_ind_oper_find_avail( BLIS_GEMM, dt ) != BLIS_NAT );
+
+	libblis_check_report( resid_max < thresh && taken,
+	                      "gemm_tiny %c transa %c transb %c  cases %4d  tiny %4d  %9.2e",
+	                      dt_char, trans_chars[ ia ], trans_chars[ ib ],
+	                      ( int )n_cases, ( int )n_tiny, resid_max );
+}
+
+int main( int argc, char** argv )
+{
+	num_t dt;
+	dim_t ia, ib;
+
+	if ( BLIS_TINY_GEMM_MAX_DIM < dims[ N_DIMS - 2 ] )
+	{
+		libblis_check_skip( "BLIS_TINY_GEMM_MAX_DIM is smaller than the sizes tested" );
+		return 0;
+	}
+
+	bli_init();
+
+	for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	for ( ia = 0; ia < 4; ++ia )
+	for ( ib = 0; ib < 4; ++ib )
+		test_trans( dt, ia, ib );
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
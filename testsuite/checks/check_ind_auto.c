@@ -0,0 +1,250 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "test_checks.h"
+
+// Check the automatic selection of induced methods (BLIS_IND_AUTO=1). For
+// each of several complex level-3 operations and problem shapes, which
+// fall into distinct buckets, the operation is called enough times for
+// every candidate method to be timed BLIS_IND_AUTO_TRIALS times. Every
+// result is compared against native execution, and afterwards the bucket
+// must consistently dispatch to a single method without further trials.
+// Finally, with the automatic mode disabled, check the default choice of
+// method and that explicitly enabled methods take precedence over it.
+
+#define N_EXTRA 3
+
+static void test_oper( opid_t oper, num_t dt, dim_t m, dim_t n, dim_t k )
+{
+	obj_t  a, b, c, c_ref;
+	rntm_t rntm;
+	double resid, resid_max = 0.0;
+	double thresh = ( bli_is_single_prec( dt ) ? 1.0e-4 : 1.0e-12 );
+	ind_t  method, method_prev = BLIS_NAT;
+	gint_t trial;
+	bool_t settled = TRUE;
+	dim_t  n_calls = 3 * BLIS_IND_AUTO_TRIALS + N_EXTRA;
+	dim_t  i;
+	char*  opname;
+
+	// Create the operands and compute the reference result natively.
+	if ( oper == BLIS_GEMM )
+	{
+		opname = "gemm";
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+		bli_randm( &a );
+		bli_randm( &b );
+
+		bli_gemmnat( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c_ref, NULL, NULL );
+	}
+	else if ( oper == BLIS_HERK )
+	{
+		opname = "herk";
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, m, m, 0, 0, &c );
+		bli_obj_create( dt, m, m, 0, 0, &c_ref );
+
+		bli_randm( &a );
+
+		bli_obj_set_struc( BLIS_HERMITIAN, &c );
+		bli_obj_set_uplo( BLIS_LOWER, &c );
+		bli_obj_set_struc( BLIS_HERMITIAN, &c_ref );
+		bli_obj_set_uplo( BLIS_LOWER, &c_ref );
+
+		bli_setm( &BLIS_ZERO, &c_ref );
+		bli_herknat( &BLIS_ONE, &a, &BLIS_ZERO, &c_ref, NULL, NULL );
+		bli_mkherm( &c_ref );
+	}
+	else // if ( oper == BLIS_TRSM )
+	{
+		opname = "trsm";
+
+		// Make the triangular matrix diagonally dominant so that the
+		// solution is well-conditioned.
+		bli_obj_create( dt, m, m, 0, 0, &a );
+		bli_obj_create( dt, m, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		{
+			obj_t m_obj;
+
+			bli_obj_scalar_init_detached( dt, &m_obj );
+			bli_setsc( ( double )m, 0.0, &m_obj );
+			bli_setd( &m_obj, &a );
+		}
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_uplo( BLIS_LOWER, &a );
+
+		bli_copym( &b, &c_ref );
+		bli_trsmnat( BLIS_LEFT, &BLIS_ONE, &a, &c_ref, NULL, NULL );
+	}
+
+	// Call the operation enough times for the bucket to be decided (and a
+	// few more), checking each result.
+	for ( i = 0; i < n_calls; ++i )
+	{
+		if ( oper == BLIS_GEMM )
+		{
+			bli_setm( &BLIS_ZERO, &c );
+			bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c );
+		}
+		else if ( oper == BLIS_HERK )
+		{
+			bli_setm( &BLIS_ZERO, &c );
+			bli_herk( &BLIS_ONE, &a, &BLIS_ZERO, &c );
+			bli_mkherm( &c );
+		}
+		else // if ( oper == BLIS_TRSM )
+		{
+			bli_copym( &b, &c );
+			bli_trsm( BLIS_LEFT, &BLIS_ONE, &a, &c );
+		}
+
+		resid     = libblis_check_rel_diff( &c, &c_ref );
+		resid_max = bli_fmax( resid_max, resid );
+	}
+
+	// Query the method that the bucket dispatches to now, as the front-end
+	// would for a call without a rntm_t. Every query must return the same
+	// method and not be timed as a trial.
+	bli_thread_init_rntm( &rntm );
+
+	for ( i = 0; i < N_EXTRA; ++i )
+	{
+		method = bli_l3_ind_auto_find_avail( oper, dt, m, n, k, &rntm, &trial );
+
+		if ( trial >= 0 || ( i > 0 && method != method_prev ) )
+			settled = FALSE;
+
+		method_prev = method;
+	}
+
+	libblis_check_report( resid_max < thresh,
+	                      "ind_auto %c%-5s %5ld %5ld %5ld  %9.2e",
+	                      ( bli_is_scomplex( dt ) ? 'c' : 'z' ), opname,
+	                      ( long )m, ( long )n, ( long )k, resid_max );
+	libblis_check_report( settled,
+	                      "ind_auto %c%-5s %5ld %5ld %5ld  settled on %s",
+	                      ( bli_is_scomplex( dt ) ? 'c' : 'z' ), opname,
+	                      ( long )m, ( long )n, ( long )k,
+	                      bli_ind_get_impl_string( method_prev ) );
+
+	bli_obj_free( &a );
+	if ( oper != BLIS_HERK ) bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+}
+
+static void check_method( opid_t oper, num_t dt, dim_t mnk, ind_t exp,
+                          char* label )
+{
+	ind_t method = bli_l3_ind_oper_find_avail_dims( oper, dt, mnk, mnk, mnk );
+
+	libblis_check_report( method == exp, "ind_auto %s %s %c %5d %8s",
+	                      label, ( oper == BLIS_GEMM ? "gemm" : "trsm" ),
+	                      ( dt == BLIS_SCOMPLEX ? 'c' : 'z' ), ( int )mnk,
+	                      bli_ind_get_impl_string( method ) );
+}
+
+static void test_default( num_t dt )
+{
+	const dim_t  small   = BLIS_IND_3M_MIN_DIM / 4;
+	const dim_t  large   = BLIS_IND_3M_MIN_DIM;
+	cntx_t*      cntx    = bli_gks_query_cntx();
+	const bool_t use_ind = bli_gks_cntx_l3_nat_ukr_is_ref
+	                       ( dt, BLIS_GEMM_UKR, cntx ) &&
+	                       !bli_gks_cntx_l3_nat_ukr_is_ref
+	                       ( bli_dt_proj_to_real( dt ), BLIS_GEMM_UKR, cntx );
+
+	// Without explicit settings, native execution is used unless only the
+	// real gemm micro-kernel is optimized, in which case 1m is used, or 3m1
+	// for large problems (other than trsm).
+	check_method( BLIS_GEMM, dt, small, use_ind ? BLIS_1M  : BLIS_NAT, "default " );
+	check_method( BLIS_GEMM, dt, large, use_ind ? BLIS_3M1 : BLIS_NAT, "default " );
+	check_method( BLIS_TRSM, dt, large, use_ind ? BLIS_1M  : BLIS_NAT, "default " );
+
+	// Explicitly enabled methods are used regardless of problem size.
+	bli_ind_oper_enable_only( BLIS_GEMM, BLIS_3M1, dt );
+	check_method( BLIS_GEMM, dt, small, BLIS_3M1, "explicit" );
+	check_method( BLIS_TRSM, dt, large, use_ind ? BLIS_1M  : BLIS_NAT, "default " );
+
+	bli_ind_oper_enable_only( BLIS_GEMM, BLIS_NAT, dt );
+	check_method( BLIS_GEMM, dt, large, BLIS_NAT, "explicit" );
+}
+
+int main( int argc, char** argv )
+{
+	// Enable the automatic mode the way an application would, via the
+	// environment, before BLIS is initialized.
+	setenv( "BLIS_IND_AUTO", "1", 1 );
+
+	bli_init();
+
+	if ( !bli_ind_auto_is_enabled() )
+	{
+		libblis_check_report( FALSE, "ind_auto enabled via BLIS_IND_AUTO" );
+		return libblis_check_status();
+	}
+
+	// The shapes fall into distinct buckets, some of which are large
+	// enough for 3m1 to be among the candidates.
+	test_oper( BLIS_GEMM, BLIS_DCOMPLEX,  200,  200,  200 );
+	test_oper( BLIS_GEMM, BLIS_DCOMPLEX,  600,  600,  600 );
+	test_oper( BLIS_GEMM, BLIS_DCOMPLEX,  300, 1100,  300 );
+	test_oper( BLIS_GEMM, BLIS_SCOMPLEX,  300,  300,  300 );
+	test_oper( BLIS_GEMM, BLIS_SCOMPLEX, 1100, 1100, 1100 );
+	test_oper( BLIS_HERK, BLIS_DCOMPLEX,  400,  400,  400 );
+	test_oper( BLIS_TRSM, BLIS_DCOMPLEX,  400,  400,  400 );
+
+	bli_ind_disable_auto();
+
+	test_default( BLIS_SCOMPLEX );
+	test_default( BLIS_DCOMPLEX );
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
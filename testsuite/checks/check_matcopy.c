@@ -0,0 +1,285 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "test_checks.h"
+
+// Check bli_?omatcopy() and bli_?imatcopy(), including the two paths of the
+// latter: the in-place exchange of block pairs (bli_?itransm_var1()) for a
+// square matrix whose strides are unchanged, and the workspace path for
+// everything else. Every transa is tested with a non-unit alpha, with row-
+// and column-stored operands, and with sizes that are not multiples of the
+// block size of the in-place variant. Each case is run with several thread
+// counts; the level-1m threading threshold (BLIS_VT) is lowered in a copy
+// of the context so that even these small matrices are split among the
+// requested number of threads.
+
+#define N_SIZES 6
+#define N_NT    4
+#define PAD     3
+
+static dim_t sizes[ N_SIZES ][ 2 ] =
+{
+	{  1,  1 }, { 31, 31 }, { 45, 45 }, { 70, 70 }, { 45, 70 }, { 70, 33 }
+};
+
+static dim_t nts[ N_NT ] = { 1, 2, 3, 4 };
+
+static trans_t transs[ 4 ] =
+{
+	BLIS_NO_TRANSPOSE,
+	BLIS_TRANSPOSE,
+	BLIS_CONJ_NO_TRANSPOSE,
+	BLIS_CONJ_TRANSPOSE
+};
+
+#define ALPHA_R  1.3
+#define ALPHA_I -0.4
+
+// Return the strides of an m x n matrix that is column-stored (stor = 0) or
+// row-stored (stor = 1), with padding between columns or rows.
+static void strides( dim_t m, dim_t n, dim_t stor, inc_t* rs, inc_t* cs )
+{
+	if ( stor == 0 ) { *rs = 1;       *cs = m + PAD; }
+	else             { *rs = n + PAD; *cs = 1; }
+}
+
+// Compute b_ref := alpha * transa( a ) one element at a time.
+static void matcopy_ref( trans_t transa, obj_t* a, obj_t* b_ref )
+{
+	dim_t  m = bli_obj_length( b_ref );
+	dim_t  n = bli_obj_width( b_ref );
+	dim_t  i, j;
+	double ar, ai;
+
+	for ( j = 0; j < n; ++j )
+	for ( i = 0; i < m; ++i )
+	{
+		if ( bli_does_trans( transa ) ) bli_getijm( j, i, a, &ar, &ai );
+		else                            bli_getijm( i, j, a, &ar, &ai );
+
+		if ( bli_does_conj( transa ) ) ai = -ai;
+
+		bli_setijm( ALPHA_R * ar - ALPHA_I * ai,
+		            ALPHA_R * ai + ALPHA_I * ar, i, j, b_ref );
+	}
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       bool_t  in_place, \
+       trans_t transa, \
+       obj_t*  a, \
+       obj_t*  b, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	ctype alpha; \
+\
+	PASTEMAC(ch,sets)( ALPHA_R, ALPHA_I, alpha ); \
+\
+	if ( in_place ) \
+		PASTEMAC2(ch,imatcopy,BLIS_TAPI_EX_SUF) \
+		( \
+		  transa, bli_obj_length( b ), bli_obj_width( b ), &alpha, \
+		  bli_obj_buffer( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ), \
+		                       bli_obj_row_stride( b ), bli_obj_col_stride( b ), \
+		  cntx, rntm \
+		); \
+	else \
+		PASTEMAC2(ch,omatcopy,BLIS_TAPI_EX_SUF) \
+		( \
+		  transa, bli_obj_length( b ), bli_obj_width( b ), &alpha, \
+		  bli_obj_buffer( a ), bli_obj_row_stride( a ), bli_obj_col_stride( a ), \
+		  bli_obj_buffer( b ), bli_obj_row_stride( b ), bli_obj_col_stride( b ), \
+		  cntx, rntm \
+		); \
+}
+
+INSERT_GENTFUNC_BASIC0( matcopy_typed )
+
+// Compute one case and return the relative difference from the reference.
+// For imatcopy, a and b are views of one buffer, and *pairs is set if the
+// in-place exchange of block pairs applies.
+static double test_case
+     (
+       num_t   dt,
+       bool_t  in_place,
+       trans_t transa,
+       dim_t   m,
+       dim_t   n,
+       dim_t   stor_a,
+       dim_t   stor_b,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       bool_t* pairs
+     )
+{
+	obj_t  a, a_save, b, b_ref;
+	dim_t  m_a, n_a;
+	inc_t  rs_a, cs_a, rs_b, cs_b;
+	siz_t  elem_size = bli_dt_size( dt );
+	void*  buf = NULL;
+	double resid;
+
+	bli_set_dims_with_trans( transa, m, n, &m_a, &n_a );
+
+	strides( m_a, n_a, stor_a, &rs_a, &cs_a );
+	strides( m,   n,   stor_b, &rs_b, &cs_b );
+
+	if ( in_place )
+	{
+		// The buffer must be large enough for either layout.
+		siz_t size_a = ( siz_t )bli_max( m_a * rs_a, n_a * cs_a );
+		siz_t size_b = ( siz_t )bli_max( m   * rs_b, n   * cs_b );
+
+		buf = bli_malloc_user( bli_max( size_a, size_b ) * elem_size );
+
+		bli_obj_create_with_attached_buffer( dt, m_a, n_a, buf, rs_a, cs_a, &a );
+		bli_obj_create_with_attached_buffer( dt, m,   n,   buf, rs_b, cs_b, &b );
+	}
+	else
+	{
+		bli_obj_create( dt, m_a, n_a, rs_a, cs_a, &a );
+		bli_obj_create( dt, m,   n,   rs_b, cs_b, &b );
+		bli_randm( &b );
+	}
+
+	bli_randm( &a );
+
+	bli_obj_create( dt, m_a, n_a, 0, 0, &a_save );
+	bli_obj_create( dt, m,   n,   0, 0, &b_ref );
+	bli_copym( &a, &a_save );
+
+	matcopy_ref( transa, &a_save, &b_ref );
+
+	if      ( dt == BLIS_FLOAT    ) bli_smatcopy_typed( in_place, transa, &a, &b, cntx, rntm );
+	else if ( dt == BLIS_DOUBLE   ) bli_dmatcopy_typed( in_place, transa, &a, &b, cntx, rntm );
+	else if ( dt == BLIS_SCOMPLEX ) bli_cmatcopy_typed( in_place, transa, &a, &b, cntx, rntm );
+	else if ( dt == BLIS_DCOMPLEX ) bli_zmatcopy_typed( in_place, transa, &a, &b, cntx, rntm );
+
+	*pairs = ( in_place && bli_does_trans( transa ) &&
+	           m == n && rs_a == rs_b && cs_a == cs_b );
+
+	resid = libblis_check_rel_diff( &b, &b_ref );
+
+	if ( in_place ) bli_free_user( buf );
+	else          { bli_obj_free( &a ); bli_obj_free( &b ); }
+
+	bli_obj_free( &a_save );
+	bli_obj_free( &b_ref );
+
+	return resid;
+}
+
+// Check one operation with one datatype and thread count. For imatcopy,
+// the cases that exchange block pairs (pairs = TRUE) and those that use a
+// workspace (pairs = FALSE) are reported separately.
+static void test_op( num_t dt, bool_t in_place, bool_t pairs, dim_t nt )
+{
+	double  thresh = ( bli_is_single_prec( dt ) ? 1.0e-6 : 1.0e-14 );
+	double  resid_max = 0.0;
+	dim_t   n_cases = 0;
+	dim_t   is, it, stor_a, stor_b;
+	dim_t   nt_used;
+	cntx_t  cntx = *bli_gks_query_cntx();
+	rntm_t  rntm;
+	bool_t  pairs_case;
+	char    dt_char;
+	char*   op;
+
+	bli_param_map_blis_to_char_dt( dt, &dt_char );
+
+	bli_blksz_set_def( 64, dt, bli_cntx_get_blksz( BLIS_VT, &cntx ) );
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	// Confirm that the largest matrices are split among nt threads.
+	nt_used = bli_l1v_thread_num_threads( dt, 70 * 70, &cntx, &rntm );
+
+	for ( is = 0; is < N_SIZES; ++is )
+	for ( it = 0; it < 4; ++it )
+	for ( stor_a = 0; stor_a < 2; ++stor_a )
+	for ( stor_b = 0; stor_b < 2; ++stor_b )
+	{
+		double resid = test_case( dt, in_place, transs[ it ],
+		                          sizes[ is ][ 0 ], sizes[ is ][ 1 ],
+		                          stor_a, stor_b, &cntx, &rntm,
+		                          &pairs_case );
+
+		if ( in_place && pairs_case != pairs ) continue;
+
+		resid_max = bli_fmax( resid_max, resid );
+		n_cases  += 1;
+	}
+
+	if      ( !in_place ) op = "omatcopy";
+	else if ( pairs )     op = "imatcopy (block pairs)";
+	else                  op = "imatcopy (workspace)";
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+	bool_t nt_ok = ( nt_used == nt );
+#else
+	bool_t nt_ok = ( nt_used == 1 );
+#endif
+
+	libblis_check_report( resid_max < thresh && nt_ok,
+	                      "%-22s %c  threads %d/%d  cases %3d  %9.2e",
+	                      op, dt_char, ( int )nt_used, ( int )nt,
+	                      ( int )n_cases, resid_max );
+}
+
+int main( int argc, char** argv )
+{
+	num_t dt;
+	dim_t inth;
+
+	bli_init();
+
+	for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	for ( inth = 0; inth < N_NT; ++inth )
+	{
+		test_op( dt, FALSE, FALSE, nts[ inth ] );
+		test_op( dt, TRUE,  TRUE,  nts[ inth ] );
+		test_op( dt, TRUE,  FALSE, nts[ inth ] );
+	}
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
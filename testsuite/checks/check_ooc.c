@@ -0,0 +1,172 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "test_checks.h"
+
+// Check bli_gemm_ooc_ex() against bli_gemm() on file-backed operands. The
+// operands are mapped from files in the directory given on the command line
+// (default: the current directory), at nonzero offsets, and most cases
+// limit the working memory so that the problem is split into many tiles
+// of A, B, and C. Some cases also mark C as transposed.
+
+static void test_ooc
+     (
+       char*   dir,
+       num_t   dt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       trans_t transa,
+       trans_t transb,
+       bool_t  transc,
+       siz_t   max_mem
+     )
+{
+	obj_t  alpha, beta;
+	obj_t  a, b, c, c_ref, c_file;
+	dim_t  m_a, n_a, m_b, n_b, m_c, n_c;
+	char   path_a[ 1024 ], path_b[ 1024 ], path_c[ 1024 ];
+	double resid, thresh;
+
+	sprintf( path_a, "%s/check_ooc_a.bin", dir );
+	sprintf( path_b, "%s/check_ooc_b.bin", dir );
+	sprintf( path_c, "%s/check_ooc_c.bin", dir );
+
+	remove( path_a );
+	remove( path_b );
+	remove( path_c );
+
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b );
+
+	// If C is marked as transposed, the matrix stored in its file is n x m.
+	m_c = ( transc ? n : m );
+	n_c = ( transc ? m : n );
+
+	bli_obj_create_with_file( dt, m_a, n_a, 0, 0, path_a, 800,  TRUE, &a );
+	bli_obj_create_with_file( dt, m_b, n_b, 0, 0, path_b, 0,    TRUE, &b );
+	bli_obj_create_with_file( dt, m_c, n_c, 0, 0, path_c, 4096, TRUE, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	bli_obj_create( dt, m_c, n_c, 0, 0, &c_ref );
+	bli_copym( &c, &c_ref );
+
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_setsc(  1.25, 0.5, &alpha );
+	bli_setsc( -0.75, 0.0, &beta );
+
+	bli_obj_set_conjtrans( transa, &a );
+	bli_obj_set_conjtrans( transb, &b );
+
+	if ( transc ) bli_obj_set_onlytrans( BLIS_TRANSPOSE, &c );
+
+	bli_gemm_ooc_ex( &alpha, &a, &b, &beta, &c, max_mem, NULL, NULL );
+
+	// Compute the reference. Since bli_gemm() does not support a transposed
+	// C, compute C^T = op(B)^T op(A)^T in that case instead.
+	if ( transc )
+	{
+		obj_t at = a, bt = b;
+
+		bli_obj_toggle_trans( &at );
+		bli_obj_toggle_trans( &bt );
+
+		bli_gemm( &alpha, &bt, &at, &beta, &c_ref );
+	}
+	else
+	{
+		bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+	}
+
+	// Unmap C and map its file again (read-only) so that the comparison is
+	// made against what was actually written back to the file.
+	bli_obj_free_file( &c );
+	bli_obj_create_with_file( dt, m_c, n_c, 0, 0, path_c, 4096, FALSE, &c_file );
+
+	resid  = libblis_check_rel_diff( &c_file, &c_ref );
+	thresh = ( bli_is_single_prec( dt ) ? 1.0e-5 : 1.0e-13 );
+
+	libblis_check_report( resid < thresh,
+	                      "gemm_ooc %c %5ld %5ld %5ld  transc %d  mem %8ld  %9.2e",
+	                      ( bli_is_float( dt )    ? 's' :
+	                        bli_is_double( dt )   ? 'd' :
+	                        bli_is_scomplex( dt ) ? 'c' : 'z' ),
+	                      ( long )m, ( long )n, ( long )k, ( int )transc,
+	                      ( long )max_mem, resid );
+
+	bli_obj_free_file( &c_file );
+	bli_obj_free_file( &a );
+	bli_obj_free_file( &b );
+	bli_obj_free( &c_ref );
+
+	remove( path_a );
+	remove( path_b );
+	remove( path_c );
+}
+
+int main( int argc, char** argv )
+{
+	char* dir = ( argc > 1 ? argv[1] : "." );
+
+	bli_init();
+
+	// Whole problem in memory (a single tile).
+	test_ooc( dir, BLIS_DOUBLE,   500,  700,  900,
+	          BLIS_NO_TRANSPOSE,      BLIS_NO_TRANSPOSE,   FALSE, 0 );
+
+	// Many tiles.
+	test_ooc( dir, BLIS_DOUBLE,   500,  700,  900,
+	          BLIS_NO_TRANSPOSE,      BLIS_NO_TRANSPOSE,   FALSE, 1 << 20 );
+	test_ooc( dir, BLIS_DOUBLE,  1001, 1503,  777,
+	          BLIS_TRANSPOSE,         BLIS_NO_TRANSPOSE,   FALSE, 1 << 20 );
+	test_ooc( dir, BLIS_FLOAT,    800,  900, 1000,
+	          BLIS_NO_TRANSPOSE,      BLIS_NO_TRANSPOSE,   FALSE, 1 << 18 );
+	test_ooc( dir, BLIS_DCOMPLEX, 333,  444,  555,
+	          BLIS_CONJ_TRANSPOSE,    BLIS_CONJ_NO_TRANSPOSE, FALSE, 1 << 20 );
+
+	// Many tiles with a transposed C.
+	test_ooc( dir, BLIS_DOUBLE,   300, 5000,  400,
+	          BLIS_NO_TRANSPOSE,      BLIS_TRANSPOSE,      TRUE,  1 << 20 );
+	test_ooc( dir, BLIS_DCOMPLEX, 333,  444,  555,
+	          BLIS_NO_TRANSPOSE,      BLIS_CONJ_TRANSPOSE, TRUE,  1 << 19 );
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
@@ -0,0 +1,204 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "test_checks.h"
+
+// Check the strassen sandbox against a reference computed one column at a
+// time with gemv. The problem sizes are chosen relative to the smallest
+// size at which the sandbox applies one (or two) levels of Strassen, so the
+// driver adapts to the thresholds the library was built with (see
+// docs/Sandboxes.md). Levels that would require problems larger than
+// MAX_DIM (such as two levels, which are disabled by default) are skipped.
+// Each case states the number of levels it is meant to exercise, and the
+// driver fails if the library would use a different number.
+
+#define MAX_DIM 2048
+
+#ifdef BLX_STRASSEN_SANDBOX
+
+static void test_strassen
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       trans_t transa,
+       bool_t  row_c,
+       dim_t   depth_exp
+     )
+{
+	obj_t   alpha, beta;
+	obj_t   a, b, c, c_ref;
+	dim_t   m_a, n_a;
+	dim_t   depth = blx_strassen_depth( m, n, k );
+	double  resid;
+	double  alpha_r = 1.25, beta_r = -0.5;
+	double* a_p;
+	double* b_p;
+	double* c_p;
+	inc_t   rs_a, cs_a, rs_b, cs_b, rs_c, cs_c;
+	dim_t   j;
+
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+
+	bli_obj_create( BLIS_DOUBLE, m_a, n_a, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, k,   n,   0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m,   n,   ( row_c ? n : 1 ),
+	                                       ( row_c ? 1 : m ), &c );
+	bli_obj_create( BLIS_DOUBLE, m,   n,   0, 0, &c_ref );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+	bli_copym( &c, &c_ref );
+
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha );
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &beta );
+	bli_setsc( alpha_r, 0.0, &alpha );
+	bli_setsc( beta_r,  0.0, &beta );
+
+	bli_obj_set_onlytrans( transa, &a );
+
+	bli_gemm( &alpha, &a, &b, &beta, &c );
+
+	// Compute the reference one column at a time.
+	a_p  = bli_obj_buffer( &a );
+	b_p  = bli_obj_buffer( &b );
+	c_p  = bli_obj_buffer( &c_ref );
+	rs_a = bli_obj_row_stride( &a ); cs_a = bli_obj_col_stride( &a );
+	rs_b = bli_obj_row_stride( &b ); cs_b = bli_obj_col_stride( &b );
+	rs_c = bli_obj_row_stride( &c_ref ); cs_c = bli_obj_col_stride( &c_ref );
+
+	for ( j = 0; j < n; ++j )
+	{
+		bli_dgemv( transa, BLIS_NO_CONJUGATE, m_a, n_a,
+		           &alpha_r, a_p, rs_a, cs_a,
+		                     b_p + j * cs_b, rs_b,
+		           &beta_r,  c_p + j * cs_c, rs_c );
+	}
+
+	resid = libblis_check_rel_diff( &c, &c_ref );
+
+	libblis_check_report( depth == depth_exp && resid < 1.0e-13,
+	                      "strassen %5ld %5ld %5ld  transa %d  row_c %d  "
+	                      "levels %ld (%ld)  %9.2e",
+	                      ( long )m, ( long )n, ( long )k,
+	                      ( int )bli_does_trans( transa ), ( int )row_c,
+	                      ( long )depth, ( long )depth_exp, resid );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+}
+
+// Return the smallest n (up to MAX_DIM) for which an n x n x n problem uses
+// the given number of levels, or zero if there is none.
+static dim_t min_dim_for_depth( dim_t depth )
+{
+	dim_t lo = 1, hi = MAX_DIM;
+
+	if ( blx_strassen_depth( hi, hi, hi ) < depth ) return 0;
+
+	while ( lo < hi )
+	{
+		dim_t mid = ( lo + hi ) / 2;
+
+		if ( blx_strassen_depth( mid, mid, mid ) >= depth ) hi = mid;
+		else                                                lo = mid + 1;
+	}
+
+	return lo;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t d1, d2;
+
+	bli_init();
+
+	d1 = min_dim_for_depth( 1 );
+	d2 = min_dim_for_depth( 2 );
+
+	if ( d1 == 0 )
+	{
+		libblis_check_skip( "strassen: no problem size up to MAX_DIM uses Strassen" );
+	}
+	else
+	{
+		// Below the one-level threshold (conventional gemm).
+		test_strassen( d1 - 1, d1 + 44, d1 + 50, BLIS_NO_TRANSPOSE, FALSE, 0 );
+
+		// One level, with and without fringes. (Two-level fringes are
+		// covered below, if enabled.)
+		if ( d2 == 0 || d1 + 261 < d2 )
+		{
+			dim_t d = d1 + ( d1 % 2 );
+
+			test_strassen( d,      d,       d,      BLIS_NO_TRANSPOSE, FALSE, 1 );
+			test_strassen( d1+45,  d1+261,  d1+147, BLIS_NO_TRANSPOSE, FALSE, 1 );
+			test_strassen( d1+45,  d1+261,  d1+147, BLIS_TRANSPOSE,    FALSE, 1 );
+			test_strassen( d1+45,  d1+261,  d1+147, BLIS_NO_TRANSPOSE, TRUE,  1 );
+		}
+	}
+
+	if ( d2 == 0 )
+	{
+		libblis_check_skip( "strassen: no problem size up to MAX_DIM uses two levels" );
+	}
+	else
+	{
+		dim_t d = d2 + ( ( 4 - d2 % 4 ) % 4 );
+
+		// Two levels, with and without fringes.
+		test_strassen( d,      d,       d,      BLIS_NO_TRANSPOSE, FALSE, 2 );
+		test_strassen( d2+33,  d2+235,  d2+9,   BLIS_NO_TRANSPOSE, FALSE, 2 );
+		test_strassen( d2+33,  d2+235,  d2+9,   BLIS_TRANSPOSE,    TRUE,  2 );
+	}
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	libblis_check_skip( "strassen: BLIS was not configured with the strassen sandbox" );
+
+	return 0;
+}
+
+#endif
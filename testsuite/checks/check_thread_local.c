@@ -0,0 +1,210 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <pthread.h>
+#include "test_checks.h"
+
+// Check the per-thread threading settings (bli_thread_set_*_local()). When
+// BLIS uses pthreads and the driver is linked statically, the Makefile links
+// it with -Wl,--wrap=pthread_create (and defines CHECKS_WRAP_PTHREAD_CREATE)
+// so that it can count the threads that BLIS spawns on behalf of each
+// application thread: a gemm parallelized n ways creates n - 1 threads from
+// the calling thread. Otherwise the driver is skipped.
+
+#ifdef CHECKS_WRAP_PTHREAD_CREATE
+
+#define N_GLOBAL 4
+
+int __real_pthread_create( pthread_t* thread, const pthread_attr_t* attr,
+                           void* (*start)( void* ), void* arg );
+
+static __thread int n_created = 0;
+
+int __wrap_pthread_create( pthread_t* thread, const pthread_attr_t* attr,
+                           void* (*start)( void* ), void* arg )
+{
+	++n_created;
+
+	return __real_pthread_create( thread, attr, start, arg );
+}
+
+static pthread_barrier_t barrier;
+
+static void check( int n_got, int n_exp, char* label )
+{
+	libblis_check_report( n_got == n_exp, "thread_local %-44s %2d %2d",
+	                      label, n_got, n_exp );
+}
+
+// Return the number of threads spawned by a gemm called from this thread
+// without a rntm_t. The problem is kept small so that sandboxes that split
+// large products into several gemm calls (e.g. strassen) still perform a
+// single conventional gemm here.
+static int count_gemm( void )
+{
+	obj_t a, b, c;
+	dim_t m = 128;
+	int   n_before;
+
+	bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, m, m, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_setm( &BLIS_ZERO, &c );
+
+	n_before = n_created;
+
+	bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return n_created - n_before;
+}
+
+// These two workers run concurrently, one with local settings and one
+// without, so that a local setting leaking into the global state (or into
+// other threads) would be observed by the second.
+static void* worker_local( void* arg )
+{
+	int* n = arg;
+
+	bli_thread_set_num_threads_local( 1 );
+
+	pthread_barrier_wait( &barrier );
+
+	n[0] = count_gemm();
+
+	pthread_barrier_wait( &barrier );
+
+	bli_thread_set_ways_local( 1, 1, 2, 1, 1 );
+
+	n[1] = count_gemm();
+
+	bli_thread_clear_local();
+
+	n[2] = count_gemm();
+
+	return NULL;
+}
+
+static void* worker_global( void* arg )
+{
+	int* n = arg;
+
+	pthread_barrier_wait( &barrier );
+
+	n[0] = count_gemm();
+
+	pthread_barrier_wait( &barrier );
+
+	return NULL;
+}
+
+static void* worker_rntm( void* arg )
+{
+	int*   n = arg;
+	rntm_t rntm;
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( 2, &rntm );
+
+	bli_thread_set_rntm_local( &rntm );
+
+	n[0] = count_gemm();
+
+	bli_thread_set_rntm_local( NULL );
+
+	n[1] = count_gemm();
+
+	return NULL;
+}
+
+int main( int argc, char** argv )
+{
+	pthread_t thr_local, thr_global, thr_rntm;
+	int       n_local[ 3 ], n_global[ 1 ], n_rntm[ 2 ];
+
+	bli_init();
+
+	bli_thread_set_num_threads( N_GLOBAL );
+
+	check( count_gemm(), N_GLOBAL - 1, "main thread, global settings" );
+
+	pthread_barrier_init( &barrier, NULL, 2 );
+
+	__real_pthread_create( &thr_local,  NULL, worker_local,  n_local );
+	__real_pthread_create( &thr_global, NULL, worker_global, n_global );
+
+	pthread_join( thr_local,  NULL );
+	pthread_join( thr_global, NULL );
+
+	pthread_barrier_destroy( &barrier );
+
+	check( n_local[0],  0,            "worker, 1 local thread" );
+	check( n_global[0], N_GLOBAL - 1, "concurrent worker, global settings" );
+	check( n_local[1],  1,            "worker, local ways (ic = 2)" );
+	check( n_local[2],  N_GLOBAL - 1, "worker, local settings cleared" );
+
+	__real_pthread_create( &thr_rntm, NULL, worker_rntm, n_rntm );
+
+	pthread_join( thr_rntm, NULL );
+
+	check( n_rntm[0], 1,            "worker, local rntm_t (2 threads)" );
+	check( n_rntm[1], N_GLOBAL - 1, "worker, local rntm_t cleared" );
+
+	// The global settings must be unaffected by any of the above.
+	check( ( int )bli_thread_get_num_threads(), N_GLOBAL,
+	       "global number of threads afterwards" );
+	check( count_gemm(), N_GLOBAL - 1, "main thread, global settings afterwards" );
+
+	bli_finalize();
+
+	return libblis_check_status();
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	libblis_check_skip( "thread_local: pthread_create() cannot be intercepted" );
+
+	return 0;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stdarg.h>
+#include "test_checks.h"
+
+static int n_fail = 0;
+
+void libblis_check_report( bool_t ok, char* fmt, ... )
+{
+	char    label[ 256 ];
+	va_list args;
+
+	va_start( args, fmt );
+	vsnprintf( label, sizeof( label ), fmt, args );
+	va_end( args );
+
+	printf( "%-68s %s\n", label, ( ok ? "PASS" : "FAILURE" ) );
+	fflush( stdout );
+
+	if ( !ok ) ++n_fail;
+}
+
+void libblis_check_skip( char* reason )
+{
+	printf( "skipped: %s\n", reason );
+}
+
+int libblis_check_status( void )
+{
+	return ( n_fail == 0 ? 0 : 1 );
+}
+
+// Return the Frobenius norm of x - y, relative to that of y.
+double libblis_check_rel_diff( obj_t* x, obj_t* y )
+{
+	obj_t  d, norm;
+	double n_d, n_y, junk;
+
+	bli_obj_create_conf_to( y, &d );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( bli_obj_dt( y ) ),
+	                              &norm );
+
+	bli_copym( x, &d );
+	bli_subm( y, &d );
+	bli_normfm( &d, &norm );
+	bli_getsc( &norm, &n_d, &junk );
+	bli_normfm( y, &norm );
+	bli_getsc( &norm, &n_y, &junk );
+
+	bli_obj_free( &d );
+
+	return ( n_y > 0.0 ? n_d / n_y : n_d );
+}
+
@@ -316,6 +316,7 @@ void libblis_test_dotaxpyv_check
 	obj_t  norm_z;
 
 	double resid1, resid2;
+	double norm_xy, norm_y;
 	double junk;
 
 	//
@@ -342,7 +343,10 @@ void libblis_test_dotaxpyv_check
 	//   normf( z - z_temp )
 	//
 	// are negligible, where rho_temp and z_temp contain rho and z as
-	// computed by dotv and axpyv, respectively.
+	// computed by dotv and axpyv, respectively. Since dotv may sum in a
+	// different order than the fused kernel (for example, when it is split
+	// across threads), the former is measured relative to normf(x) *
+	// normf(y), which bounds the rounding error of any summation order.
 	//
 
 	bli_obj_scalar_init_detached( dt,      &rho_temp );
@@ -359,6 +363,14 @@ void libblis_test_dotaxpyv_check
 	bli_subsc( rho, &rho_temp );
 	bli_getsc( &rho_temp, &resid1, &junk );
 
+	bli_normfv( x, &norm_z );
+	bli_getsc( &norm_z, &norm_xy, &junk );
+	bli_normfv( y, &norm_z );
+	bli_getsc( &norm_z, &norm_y, &junk );
+	norm_xy *= norm_y;
+
+	if ( norm_xy > 1.0 ) resid1 /= norm_xy;
+
 	bli_subv( &z_temp, z );
 	bli_normfv( z, &norm_z );
 	bli_getsc( &norm_z, &resid2, &junk );
@@ -109,6 +109,7 @@ void libblis_test_dotxaxpyf_deps
 	libblis_test_randv( tdata, params, &(op->ops->randv) );
 	libblis_test_randm( tdata, params, &(op->ops->randm) );
 	libblis_test_normfv( tdata, params, &(op->ops->normfv) );
+	libblis_test_normfm( tdata, params, &(op->ops->normfm) );
 	libblis_test_subv( tdata, params, &(op->ops->subv) );
 	libblis_test_copyv( tdata, params, &(op->ops->copyv) );
 	libblis_test_axpyv( tdata, params, &(op->ops->axpyv) );
@@ -339,6 +340,7 @@ void libblis_test_dotxaxpyf_check
 	obj_t  norm;
 
 	double resid1, resid2;
+	double norm_aw, norm_w;
 	double junk;
 
 	//
@@ -367,7 +369,10 @@ void libblis_test_dotxaxpyf_check
 	//   normf( z - q )
 	//
 	// are negligible, where v and q contain y and z as computed by repeated
-	// calls to dotxv and axpyv, respectively.
+	// calls to dotxv and axpyv, respectively. Since dotxv may sum in a
+	// different order than the fused kernel (for example, when it is split
+	// across threads), the former is measured relative to normf(A) *
+	// normf(w), which bounds the rounding error of any summation order.
 	//
 
 	bli_obj_scalar_init_detached( dt_real, &norm );
@@ -405,6 +410,14 @@ void libblis_test_dotxaxpyf_check
 	bli_normfv( &v, &norm );
 	bli_getsc( &norm, &resid1, &junk );
 
+	bli_normfm( a, &norm );
+	bli_getsc( &norm, &norm_aw, &junk );
+	bli_normfv( w, &norm );
+	bli_getsc( &norm, &norm_w, &junk );
+	norm_aw *= norm_w;
+
+	if ( norm_aw > 1.0 ) resid1 /= norm_aw;
+
 	bli_subv( z, &q );
 	bli_normfv( &q, &norm );
 	bli_getsc( &norm, &resid2, &junk );
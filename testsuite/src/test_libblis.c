@@ -587,6 +587,15 @@ void libblis_test_read_params_file( char* input_filename, test_params_t* params
 	libblis_test_read_next_line( buffer, input_stream );
 	sscanf( buffer, "%u ", &(params->output_files) );
 
+	// Read whether to report hardware performance counters.
+	libblis_test_read_next_line( buffer, input_stream );
+	sscanf( buffer, "%u ", &(params->perf_counters) );
+
+	// Enable counting within BLIS, if requested. (This has no effect unless
+	// BLIS was configured with --enable-perf-counters.)
+	if ( params->perf_counters )
+		bli_perfctr_set_enabled( TRUE );
+
 	// Close the file.
 	fclose( input_stream );
 
@@ -753,7 +762,8 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "--- BLIS configuration info ---\n" );
 	libblis_test_fprintf_c( os, "\n" );
-	libblis_test_fprintf_c( os, "active sub-configuration       %s\n", bli_arch_string( bli_arch_query_id() ) );
+	libblis_test_fprintf_c( os, "active sub-configuration       %s\n", bli_info_get_arch_string() );
+	libblis_test_fprintf_c( os, "  overridden?                  %d\n", ( int )bli_info_get_arch_is_overridden() );
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "integer type size (bits)       %d\n", ( int )int_type_size );
 	libblis_test_fprintf_c( os, "\n" );
@@ -766,6 +776,12 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "memory pools for pack buffers\n" );
 	libblis_test_fprintf_c( os, "  enabled?                     %d\n", ( int )bli_info_get_enable_packbuf_pools() );
 	libblis_test_fprintf_c( os, "\n" );
+	libblis_test_fprintf_c( os, "level-3 profiling               \n" );
+	libblis_test_fprintf_c( os, "  enabled?                     %d\n", ( int )bli_info_get_enable_l3_prof() );
+	libblis_test_fprintf_c( os, "\n" );
+	libblis_test_fprintf_c( os, "hardware performance counters   \n" );
+	libblis_test_fprintf_c( os, "  enabled?                     %d\n", ( int )bli_info_get_enable_perf_counters() );
+	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "memory alignment (bytes)         \n" );
 	libblis_test_fprintf_c( os, "  stack address                %d\n", ( int )bli_info_get_stack_buf_align_size() );
 	libblis_test_fprintf_c( os, "  obj_t address                %d\n", ( int )bli_info_get_heap_addr_align_size() );
@@ -1089,6 +1105,7 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "reaction to failure          %c\n", params->reaction_to_failure );
 	libblis_test_fprintf_c( os, "output in matlab format?     %u\n", params->output_matlab_format );
 	libblis_test_fprintf_c( os, "output to stdout AND files?  %u\n", params->output_files );
+	libblis_test_fprintf_c( os, "report perf counters?        %u\n", params->perf_counters );
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf( os, "\n" );
 }
@@ -1674,6 +1691,10 @@ void libblis_test_op_driver( thread_data_t* tdata,
 							continue;
 						}
 
+						// Reset the hardware performance counters, if they are to
+						// be reported for this experiment.
+						if ( params->perf_counters ) bli_perfctr_reset();
+
 						// Call the given experiment function. perf and resid will
 						// contain the resulting performance and residual values,
 						// respectively.
@@ -1763,6 +1784,16 @@ void libblis_test_op_driver( thread_data_t* tdata,
 							         pass_str );
 						}
 
+						// Output the hardware performance counters for the level-3
+						// operations executed during the experiment, if requested.
+						if ( params->perf_counters )
+						{
+							libblis_test_output_perfctr( stdout );
+
+							if ( output_stream )
+								libblis_test_output_perfctr( output_stream );
+						}
+
 						// If we need to check whether to do something on failure,
 						// do so now.
 						if ( reaction_to_failure == ON_FAILURE_SLEEP_CHAR )
@@ -2289,6 +2320,36 @@ void libblis_test_fopen_check_stream( char* filename_str,
 
 
 
+void libblis_test_output_perfctr( FILE* output_stream )
+{
+	perfctr_t ctr;
+	char      str[ 256 ];
+	int       len;
+
+	// Query the totals over all level-3 operations.
+	bli_perfctr_query( BLIS_NOID, &ctr );
+
+	if ( ctr.n_calls == 0 ) return;
+
+	len = sprintf( str, "%c   per call (%lu calls):", OUTPUT_COMMENT_CHAR,
+	               ( unsigned long )ctr.n_calls );
+
+	for ( int e = 0; e < BLIS_NUM_PERFCTR_EVENTS; ++e )
+	{
+		if ( ctr.avail[ e ] )
+			len += sprintf( str + len, "  %s %.3le",
+			                bli_perfctr_event_string( e ),
+			                ( double )ctr.count[ e ] / ctr.n_calls );
+		else
+			len += sprintf( str + len, "  %s n/a",
+			                bli_perfctr_event_string( e ) );
+	}
+
+	fprintf( output_stream, "%s\n", str );
+}
+
+
+
 void libblis_test_read_next_line( char* buffer, FILE* input_stream )
 {
 	char temp[ INPUT_BUFFER_SIZE ];
@@ -184,6 +184,7 @@ typedef struct
 	char          reaction_to_failure;
 	unsigned int  output_matlab_format;
 	unsigned int  output_files;
+	unsigned int  perf_counters;
 	unsigned int  error_checking_level;
 } test_params_t;
 
@@ -441,6 +442,10 @@ void libblis_test_fopen_check_stream( char* filename_str, FILE* stream );
 
 void libblis_test_read_next_line( char* buffer, FILE* input_stream );
 
+// --- Hardware performance counters ---
+
+void libblis_test_output_perfctr( FILE* output_stream );
+
 // --- Custom fprintf-related ---
 
 void libblis_test_fprintf( FILE* output_stream, char* message, ... );